@@ -0,0 +1,123 @@
+#pragma once
+#include <chrono>
+#include <vector>
+#include "battle.h"
+using namespace std;
+
+//Milliseconds the enemy gets to think about each move
+const int AI_BUDGET_MS = 5;
+
+//Something that picks moves for the enemy Pokemon
+class OpponentAI {
+  public:
+	//Picks a move slot for the side to move in s
+	virtual int choose(const Matchup &matchup, const BattleState &s, Rng &rng) = 0;
+	virtual ~OpponentAI() {}
+};
+
+//Expectimax opponent. It searches the battle tree taking the best move for itself, the worst one
+//for the other side, and averaging over each move's outcomes. It deepens one ply at a time until
+//its time budget runs out, and remembers positions it has already scored in a transposition table
+//since the same HP and PP are reached through many different move orders. An entry holds its whole
+//position, turn included since MAX_TURNS decides how a battle can end, so a hash collision is a miss.
+class ExpectimaxAI : public OpponentAI {
+	struct Entry {
+		BattleState s;
+		uint32_t generation = 0;	//Which search wrote this entry, older entries are ignored
+		int depth = -1;	//EXACT if no line was cut short by the depth limit
+		float value = 0;
+	};
+	static constexpr int EXACT = MAX_TURNS + 1;
+	vector<Entry> table;
+	uint32_t generation = 0;
+	chrono::microseconds budget;
+	const Matchup *m = nullptr;
+	int me = 0;	//Side the AI is playing
+	chrono::steady_clock::time_point deadline;
+	long nodes = 0;
+	bool out_of_time = false;
+	bool cut_off = false;	//Whether the current subtree stopped anywhere before the battle ended
+
+	//Guess at how good a state is for the AI when the search stops before the battle ends
+	float evaluate(const BattleState &s) const {
+		int them = 1 - me;
+		return 0.5 + 0.5 * (float(s.hp[me]) / m->side[me].max_hp - float(s.hp[them]) / m->side[them].max_hp);
+	}
+
+	float search(const BattleState &s, int depth) {
+		int w = winner(s);
+		if (w != -1) return w == me ? 1 : 0;
+		if (s.turn >= MAX_TURNS) return 0.5;
+		if (++nodes % 1024 == 0 and chrono::steady_clock::now() > deadline) out_of_time = true;
+		if (depth == 0 or out_of_time) {
+			cut_off = true;
+			return evaluate(s);
+		}
+
+		Entry &e = table[s.hash & (table.size() - 1)];
+		if (e.generation == generation and e.s == s and e.s.turn == s.turn and e.depth >= depth) {
+			if (e.depth != EXACT) cut_off = true;
+			return e.value;
+		}
+
+		array<int, MAX_MOVES> moves;
+		int n = legal_moves(*m, s, moves);
+		bool maximizing = s.to_move == me;
+		float best = maximizing ? -1 : 2;
+		bool outer_cut_off = cut_off;
+		cut_off = false;
+		for (int i = 0; i < n; i++) {
+			float value = move_value(s, moves[i], depth);
+			best = maximizing ? max(best, value) : min(best, value);
+		}
+		if (!out_of_time) e = {s, generation, cut_off ? depth : EXACT, best};
+		cut_off = cut_off or outer_cut_off;
+		return best;
+	}
+
+	//Average value of using the move in slot over all of its outcomes
+	float move_value(const BattleState &s, int slot, int depth) {
+		array<Outcome, MAX_OUTCOMES> outcomes;
+		int n = move_outcomes(*m, s, slot, outcomes);
+		float value = 0;
+		for (int i = 0; i < n; i++) {
+			BattleState next = s;
+			apply_hit(next, slot, outcomes[i].damage);
+			value += outcomes[i].prob * search(next, depth - 1);
+		}
+		return value;
+	}
+  public:
+	ExpectimaxAI(chrono::microseconds budget = chrono::milliseconds(AI_BUDGET_MS), int table_bits = 16) : table(size_t(1) << table_bits), budget(budget) {}
+
+	//Ties are broken with rng
+	int choose(const Matchup &matchup, const BattleState &s, Rng &rng) override {
+		m = &matchup;
+		me = s.to_move;
+		generation++;
+		deadline = chrono::steady_clock::now() + budget;
+		out_of_time = false;
+		array<int, MAX_MOVES> moves;
+		int n = legal_moves(matchup, s, moves);
+		int best = moves[rng.range(n)];
+		if (n == 1) return best;
+		//Deepen until time runs out or the whole battle fits in the search
+		for (int depth = 1; depth <= MAX_TURNS - s.turn; depth++) {
+			cut_off = false;
+			array<float, MAX_MOVES> values;
+			for (int i = 0; i < n; i++) values[i] = move_value(s, moves[i], depth);
+			if (out_of_time) break;	//Only trust searches that finished
+			float best_value = -1;
+			int ties = 0;
+			for (int i = 0; i < n; i++) {
+				if (values[i] > best_value) {
+					best_value = values[i];
+					best = moves[i];
+					ties = 1;
+				} else if (values[i] == best_value and rng.range(++ties) == 0) best = moves[i];
+			}
+			if (!cut_off) break;	//Every line ended in a faint before the depth limit
+		}
+		return best;
+	}
+};
@@ -0,0 +1,111 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include "battle.h"
+#include "scheduler.h"
+using namespace std;
+
+//Batch battles for scripts.
+//Each line of the input is one battle spec with tab separated fields:
+//	pokemon1	moves1	policy1	pokemon2	moves2	policy2	seed	reps
+//Moves are comma separated names or indexes, "-" for the headless default moveset. Policies are
+//RANDOM or GREEDY, seed is "-" for the game's seed. Blank lines and lines starting with # are
+//skipped. Every battle is run headless on all cores and written as one tab separated record:
+//	line	rep	pokemon1	pokemon2	first	winner	turns	hp1	hp2
+//where first and winner are 1 or 2 (winner 0 for a draw).
+
+struct BatchSpec {
+	int line = 0;
+	Pokemon p[2];
+	Policy policy[2] = {Policy::GREEDY, Policy::GREEDY};
+	uint64_t seed = 0;
+	int reps = 1;
+};
+
+//Fills spec from one line of input, returns an error message or "" if the line was fine
+string parse_batch_spec(const string &line, uint64_t default_seed, BatchSpec &spec) {
+	vector<string> fields;
+	istringstream iss(line);
+	string token;
+	while (getline(iss, token, '\t')) fields.push_back(token);
+	if (fields.size() != 8) return "expected 8 tab separated fields, found " + to_string(fields.size());
+	for (int i = 0; i < 2; i++) {
+		const string &name = fields.at(i * 3), &moves = fields.at(i * 3 + 1), &policy = fields.at(i * 3 + 2);
+		auto p = find(pokemon_db.begin(), pokemon_db.end(), name);
+		if (p == pokemon_db.end()) return "unknown Pokemon " + name;
+		spec.p[i] = *p;
+		if (moves == "-") spec.p[i].moves = default_moveset(*p);
+		else {
+			istringstream move_list(moves);
+			while (getline(move_list, token, ',')) {
+				auto m = find(move_db.begin(), move_db.end(), token);
+				if (m == move_db.end() and !token.empty() and all_of(token.begin(), token.end(), ::isdigit)) m = find(move_db.begin(), move_db.end(), stoi(token));
+				if (m == move_db.end()) return "unknown move " + token;
+				if (spec.p[i].moves.size() == MAX_MOVES) return "more than " + to_string(MAX_MOVES) + " moves for " + name;
+				spec.p[i].moves.push_back(*m);
+			}
+		}
+		if (uppercaseify(policy) == "RANDOM") spec.policy[i] = Policy::RANDOM;
+		else if (uppercaseify(policy) == "GREEDY") spec.policy[i] = Policy::GREEDY;
+		else return "unknown policy " + policy;
+	}
+	try {
+		spec.seed = fields.at(6) == "-" ? default_seed : stoull(fields.at(6));
+		spec.reps = stoi(fields.at(7));
+	} catch (const exception &) {
+		return "bad seed or reps";
+	}
+	if (spec.reps <= 0) return "reps must be positive";
+	return "";
+}
+
+//Runs every battle in the specs read from ins and writes their records to outs, in input order.
+//Bad lines are reported on cerr and skipped. Returns the number of battles run.
+size_t run_batch(istream &ins, ostream &outs, uint64_t default_seed) {
+	vector<BatchSpec> specs;
+	string line;
+	for (int n = 1; getline(ins, line); n++) {
+		if (!line.empty() and line.back() == '\r') line.pop_back();
+		if (line.empty() or line[0] == '#') continue;
+		BatchSpec spec;
+		spec.line = n;
+		string error = parse_batch_spec(line, default_seed, spec);
+		if (error.empty()) specs.push_back(spec);
+		else cerr << "Line " << n << ": " << error << endl;
+	}
+
+	//One task per battle so a spec with many reps still spreads over every core
+	vector<pair<size_t, int>> battles;
+	for (size_t i = 0; i < specs.size(); i++)
+		for (int r = 0; r < specs[i].reps; r++) battles.push_back({i, r});
+	struct Result {
+		int first;
+		BattleResult result;
+		array<int, 2> hp;
+	};
+	vector<Result> results(battles.size());
+	WorkStealer pool;
+	pool.run(battles.size(), [&](size_t b) {
+		const BatchSpec &spec = specs[battles[b].first];
+		//The battle id is the rep, so a spec plays out the same wherever it is in the file
+		uint64_t battle = battles[b].second;
+		Matchup m = make_matchup(spec.p[0], spec.p[1]);
+		BattleState s = make_state(spec.p[0], spec.p[1]);
+		Rng setup(spec.seed, battle);
+		int first = first_mover(m, setup);
+		s.set_to_move(first);
+		BattleResult result = play_battle(m, s, spec.policy[0], spec.policy[1], spec.seed, battle);
+		results[b] = {first, result, {s.hp[0], s.hp[1]}};
+	});
+
+	outs << "line\trep\tpokemon1\tpokemon2\tfirst\twinner\tturns\thp1\thp2\n";
+	for (size_t b = 0; b < battles.size(); b++) {
+		const BatchSpec &spec = specs[battles[b].first];
+		const Result &r = results[b];
+		outs << spec.line << "\t" << battles[b].second << "\t" << spec.p[0].name << "\t" << spec.p[1].name << "\t" << r.first + 1 << "\t" << r.result.winner + 1 << "\t" << r.result.turns << "\t" << r.hp[0] << "\t" << r.hp[1] << "\n";
+	}
+	return battles.size();
+}
@@ -0,0 +1,309 @@
+#pragma once
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "pokemon.h"
+#include "rng.h"
+using namespace std;
+
+//Headless battle rules. These follow the same damage formula as the interactive battles
+//but skip all of the printing and prompting, so they can be run millions of times.
+//Damage is worked out in integers so every build and every machine gets the same numbers:
+//type chart entries (0, 1/2, 1, 2) are counted in halves, so two of them multiply to quarters,
+//and STAB is 3 halves. The only division is the last one, which rounds up.
+
+//Product of the type chart entries for a move type hitting a defending Pokemon, in quarters
+//(0, 1, 2, 4, 8 or 16, 4 is neutral)
+int type_modifier_quarters(const string &move_type, const Pokemon &defender) {
+	int move_t = lookup_type(move_type);
+	int type1 = lookup_type(defender.type1);
+	int type2 = lookup_type(defender.type2);
+	if (move_t == -1 or type1 == -1) return 4;
+	int mult = lround(type_system.at(move_t).at(type1) * 2);
+	return mult * (type2 != -1 ? lround(type_system.at(move_t).at(type2) * 2) : 2);
+}
+
+float type_modifier(const string &move_type, const Pokemon &defender) {
+	return type_modifier_quarters(move_type, defender) / 4.0f;
+}
+
+bool has_stab(const Pokemon &attacker, const Move &move) {
+	return attacker.type1 == move.type or attacker.type2 == move.type;
+}
+
+//Like Gen1, every hit is scaled by a random roll from MIN_ROLL/255 to MAX_ROLL/255
+const int MIN_ROLL = 217, MAX_ROLL = 255;
+const int DAMAGE_ROLLS = MAX_ROLL - MIN_ROLL + 1;
+
+//HP taken by a hit: (power * attack)/defense * STAB * type_modifier * roll/255, rounded up.
+//The interactive battles used to subtract this as a float from an int HP, which truncates, so
+//rounding the damage up leaves the same HP.
+//Split in two so a Matchup can work out the part that doesn't depend on the roll once per move.
+int64_t damage_before_roll(const Pokemon &attacker, const Move &move, const Pokemon &defender) {
+	return int64_t(move.power) * attacker.attack * type_modifier_quarters(move.type, defender) * (has_stab(attacker, move) ? 3 : 2);
+}
+int damage_with_roll(int64_t before_roll, const Pokemon &defender, int roll) {
+	int64_t num = before_roll * roll;
+	int64_t den = 8 * int64_t(max(defender.defense, 1)) * MAX_ROLL;
+	if (num <= 0) return 0;
+	return min<int64_t>((num + den - 1) / den, numeric_limits<int>::max());
+}
+int calc_damage(const Pokemon &attacker, const Move &move, const Pokemon &defender, int roll = MAX_ROLL) {
+	return damage_with_roll(damage_before_roll(attacker, move, defender), defender, roll);
+}
+
+//Chance in 100 that a move hits. Moves listed without an accuracy never miss.
+int hit_chance(const Move &move) {
+	return move.accuracy > 0 ? min(move.accuracy, 100) : 100;
+}
+
+//The random part of a move: whether it hits and its damage roll. Both numbers are always drawn, in
+//this order, so the interactive battles and the headless rules use up a turn's stream the same way.
+struct Roll {
+	bool hit;
+	int roll;
+};
+Roll roll_move(int hit_chance, Rng &rng) {
+	Roll r;
+	r.hit = int(rng.range(100)) < hit_chance;
+	r.roll = MIN_ROLL + rng.range(DAMAGE_ROLLS);
+	return r;
+}
+
+//The move a Pokemon falls back on once every other move is out of PP
+Move struggle_move() {
+	for (const Move &m : move_db)
+		if (m.name == "Struggle") return m;
+	return Move{165, "Struggle", "Normal", "Physical", 1, 50, 100};
+}
+
+//Slot number used for Struggle, after the regular move slots
+const int STRUGGLE = MAX_MOVES;
+//Battles that go this many turns without a faint are called a draw
+const int MAX_TURNS = 1000;
+
+//Everything about one side of a battle that doesn't change from turn to turn
+struct Side {
+	int species = 0;	//Pokedex index
+	int max_hp = 0;
+	int speed = 0;
+	int n_moves = 0;
+	array<int, MAX_MOVES + 1> move_id{};		//Move::index of each slot
+	array<int, MAX_MOVES + 1> damage{};	//Damage each slot does to the other side on its highest roll
+	array<int, MAX_MOVES + 1> accuracy{};	//hit_chance of each slot
+	array<array<uint16_t, DAMAGE_ROLLS>, MAX_MOVES + 1> roll_damage{};	//Damage for each roll, lowest first
+};
+
+struct Matchup {
+	array<Side, 2> side;
+};
+
+//Zobrist key for one value of one field of a battle position
+inline uint64_t zobrist(uint64_t field, uint64_t value) {
+	return splitmix64(0x5A0B2157ull ^ (field << 32) ^ value);
+}
+enum ZobristField : uint64_t { Z_SPECIES = 0, Z_HP = 2, Z_PP = 4, Z_TO_MOVE = 4 + 2 * MAX_MOVES };
+
+//Everything that changes during a battle, packed into four machine words.
+//The position (species, HP, PP and side to move) is canonical within one Matchup: movesets and
+//stats live in the Matchup, so two states only stand for the same position when they come from the
+//same one. Equal positions compare equal and have the same Zobrist hash, which the setters below
+//keep up to date as the battle goes on. Search and result caches key on it, along with the matchup.
+struct BattleState {
+	array<uint16_t, 2> species{};	//Pokedex index of each side
+	array<uint16_t, 2> hp{};
+	array<array<uint8_t, MAX_MOVES>, 2> pp{};
+	uint8_t to_move = 0;	//Which side picks a move next
+	uint16_t turn = 0;	//Not part of the position
+	uint64_t hash = 0;
+
+	//Hash from scratch, matches hash whenever the setters were used
+	uint64_t full_hash() const {
+		uint64_t h = zobrist(Z_TO_MOVE, to_move);
+		for (int i = 0; i < 2; i++) {
+			h ^= zobrist(Z_SPECIES + i, species[i]) ^ zobrist(Z_HP + i, hp[i]);
+			for (int j = 0; j < MAX_MOVES; j++) h ^= zobrist(Z_PP + i * MAX_MOVES + j, pp[i][j]);
+		}
+		return h;
+	}
+	void set_hp(int side, int value) {
+		hash ^= zobrist(Z_HP + side, hp[side]) ^ zobrist(Z_HP + side, value);
+		hp[side] = value;
+	}
+	void spend_pp(int side, int slot) {
+		uint64_t field = Z_PP + side * MAX_MOVES + slot;
+		hash ^= zobrist(field, pp[side][slot]) ^ zobrist(field, pp[side][slot] - 1);
+		pp[side][slot]--;
+	}
+	void refund_pp(int side, int slot) {
+		uint64_t field = Z_PP + side * MAX_MOVES + slot;
+		hash ^= zobrist(field, pp[side][slot]) ^ zobrist(field, pp[side][slot] + 1);
+		pp[side][slot]++;
+	}
+	void set_to_move(int side) {
+		hash ^= zobrist(Z_TO_MOVE, to_move) ^ zobrist(Z_TO_MOVE, side);
+		to_move = side;
+	}
+	bool operator==(const BattleState &o) const {
+		return species == o.species and hp == o.hp and pp == o.pp and to_move == o.to_move;
+	}
+};
+static_assert(sizeof(BattleState) == 32, "BattleState should stay four machine words");
+
+//Builds the matchup for a battle between a (side 0) and b (side 1), using their current moves
+Matchup make_matchup(const Pokemon &a, const Pokemon &b) {
+	Matchup m;
+	const Pokemon *p[2] = {&a, &b};
+	Move struggle = struggle_move();
+	for (int s = 0; s < 2; s++) {
+		Side &side = m.side[s];
+		const Pokemon &att = *p[s], &def = *p[1 - s];
+		side.species = att.index;
+		side.max_hp = att.original_hp;
+		side.speed = att.speed;
+		side.n_moves = min((int)att.moves.size(), MAX_MOVES);
+		auto fill = [&](int slot, const Move &move) {
+			side.move_id[slot] = move.index;
+			int64_t before_roll = damage_before_roll(att, move, def);
+			side.damage[slot] = damage_with_roll(before_roll, def, MAX_ROLL);
+			side.accuracy[slot] = hit_chance(move);
+			for (int r = 0; r < DAMAGE_ROLLS; r++) side.roll_damage[slot][r] = min(damage_with_roll(before_roll, def, MIN_ROLL + r), 0xFFFF);
+		};
+		for (int i = 0; i < side.n_moves; i++) fill(i, att.moves.at(i));
+		fill(STRUGGLE, struggle);
+	}
+	return m;
+}
+
+//Starting state from the two Pokemon's current HP and PP, with a moving first
+BattleState make_state(const Pokemon &a, const Pokemon &b) {
+	BattleState s;
+	const Pokemon *p[2] = {&a, &b};
+	for (int i = 0; i < 2; i++) {
+		s.species[i] = p[i]->index;
+		s.hp[i] = clamp(p[i]->hp, 0, 0xFFFF);
+		for (size_t j = 0; j < p[i]->moves.size() and j < MAX_MOVES; j++)
+			s.pp[i][j] = clamp(p[i]->moves.at(j).PP, 0, 0xFF);
+	}
+	s.hash = s.full_hash();
+	return s;
+}
+
+//Higher speed goes first, coin flip on a tie
+int first_mover(const Matchup &m, Rng &rng) {
+	if (m.side[0].speed != m.side[1].speed) return m.side[0].speed > m.side[1].speed ? 0 : 1;
+	return rng.coin_flip();
+}
+
+//Fills moves with the slots the side to move may use, returns how many there are
+int legal_moves(const Matchup &m, const BattleState &s, array<int, MAX_MOVES> &moves) {
+	int n = 0;
+	for (int i = 0; i < m.side[s.to_move].n_moves; i++)
+		if (s.pp[s.to_move][i] > 0) moves[n++] = i;
+	if (!n) moves[n++] = STRUGGLE;
+	return n;
+}
+
+//One possible result of using a move, and how likely it is
+struct Outcome {
+	float prob;
+	int damage;
+};
+const int MAX_OUTCOMES = DAMAGE_ROLLS + 1;	//Every roll plus a miss
+
+//Every way a move can turn out: a miss, then each distinct damage from the rolls, least damage first.
+//Rolls that round to the same damage are merged into one outcome.
+int move_outcomes(const Matchup &m, const BattleState &s, int slot, array<Outcome, MAX_OUTCOMES> &outcomes) {
+	const Side &side = m.side[s.to_move];
+	float hit = side.accuracy[slot] / 100.0f;
+	int n = 0;
+	if (side.accuracy[slot] < 100) outcomes[n++] = {1 - hit, 0};
+	for (int r = 0; r < DAMAGE_ROLLS; r++) {
+		int damage = side.roll_damage[slot][r];
+		if (n and outcomes[n - 1].damage == damage) outcomes[n - 1].prob += hit / DAMAGE_ROLLS;
+		else outcomes[n++] = {hit / DAMAGE_ROLLS, damage};
+	}
+	return n;
+}
+
+//Uses the move in slot, doing damage to the other side
+void apply_hit(BattleState &s, int slot, int damage) {
+	int me = s.to_move, them = 1 - me;
+	if (damage > 0) s.set_hp(them, max(s.hp[them] - damage, 0));
+	if (slot != STRUGGLE) s.spend_pp(me, slot);
+	s.set_to_move(them);
+	s.turn++;
+}
+
+//Uses the move in slot with a random hit and roll
+void play_move(const Matchup &m, BattleState &s, int slot, Rng &rng) {
+	const Side &side = m.side[s.to_move];
+	Roll r = roll_move(side.accuracy[slot], rng);
+	apply_hit(s, slot, r.hit ? side.roll_damage[slot][r.roll - MIN_ROLL] : 0);
+}
+
+//Returns the side that won, or -1 if nobody has fainted yet
+int winner(const BattleState &s) {
+	if (s.hp[1] == 0) return 0;
+	if (s.hp[0] == 0) return 1;
+	return -1;
+}
+
+//How a side picks its move in a headless battle
+enum class Policy { RANDOM, GREEDY };
+
+int choose_move(Policy policy, const Matchup &m, const BattleState &s, Rng &rng) {
+	array<int, MAX_MOVES> moves;
+	int n = legal_moves(m, s, moves);
+	if (policy == Policy::RANDOM) return moves[rng.range(n)];
+	//Strongest on average, counting misses
+	const Side &side = m.side[s.to_move];
+	int best = moves[0];
+	for (int i = 1; i < n; i++)
+		if (int64_t(side.damage[moves[i]]) * side.accuracy[moves[i]] > int64_t(side.damage[best]) * side.accuracy[best]) best = moves[i];
+	return best;
+}
+
+struct BattleResult {
+	int winner;	//0 or 1, -1 for a draw
+	int turns;
+};
+
+//Plays a battle to the end without any output, leaving the final state in s.
+//Each turn draws from its own (seed, battle, turn) stream.
+BattleResult play_battle(const Matchup &m, BattleState &s, Policy p0, Policy p1, uint64_t seed, uint64_t battle) {
+	Policy policy[2] = {p0, p1};
+	while (winner(s) == -1 and s.turn < MAX_TURNS) {
+		Rng rng(seed, battle, s.turn + 1);
+		play_move(m, s, choose_move(policy[s.to_move], m, s, rng), rng);
+	}
+	return {winner(s), s.turn};
+}
+
+BattleResult simulate_battle(const Matchup &m, BattleState s, Policy p0, Policy p1, uint64_t seed, uint64_t battle) {
+	return play_battle(m, s, p0, p1, seed, battle);
+}
+
+//Up to four damaging moves for a species to use in headless battles:
+//the strongest moves (counting STAB), preferring one move per type for coverage
+vector<Move> default_moveset(const Pokemon &p) {
+	vector<Move> candidates;
+	for (const Move &m : move_db)
+		if (m.power > 0 and m.name != "Struggle") candidates.push_back(m);
+	auto score = [&](const Move &m) { return m.power * (has_stab(p, m) ? 1.5 : 1.0); };
+	stable_sort(candidates.begin(), candidates.end(), [&](const Move &a, const Move &b) { return score(a) > score(b); });
+	vector<Move> moves;
+	for (const Move &m : candidates) {
+		if (moves.size() == MAX_MOVES) break;
+		bool dup_type = false;
+		for (const Move &taken : moves)
+			if (taken.type == m.type) dup_type = true;
+		if (!dup_type) moves.push_back(m);
+	}
+	for (const Move &m : candidates) {
+		if (moves.size() == MAX_MOVES) break;
+		if (find(moves.begin(), moves.end(), m.index) == moves.end()) moves.push_back(m);
+	}
+	return moves;
+}
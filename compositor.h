@@ -0,0 +1,361 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <sstream>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cctype>
+#include "pokemon.h"
+#include "battle.h"
+#include "rng.h"
+#include "terminal.h"
+#include "pokedex_ascii.h"
+#include "halfblock.h"
+using namespace std;
+
+//Battle screen compositor.
+//The battle screen (enemy sprite, health bar, move list and any log lines) is laid out in an off
+//screen grid of character cells, then handed to a backend. The terminal backend remembers the
+//last frame and sends only the cells that changed, as long as nothing has scrolled it off the
+//screen since; the memory backend keeps frames in memory so screens can be benchmarked or
+//compared without a terminal. With half block sprites on, the grid leaves the sprite's cells blank
+//and the terminal backend paints the sprite's cached escape sequences over them.
+
+//Next character of UTF-8 text at i, moving i past it. A byte that doesn't start a whole character
+//is taken as a character on its own.
+char32_t next_char(const string &text, size_t &i) {
+	unsigned char lead = text[i++];
+	int extra = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+	if (i + extra > text.size()) return lead;
+	char32_t ch = extra ? lead & (0x3F >> extra) : lead;
+	for (int k = 0; k < extra; k++) {
+		if ((text[i + k] & 0xC0) != 0x80) return lead;
+		ch = ch << 6 | (text[i + k] & 0x3F);
+	}
+	i += extra;
+	return ch;
+}
+
+void append_utf8(string &out, char32_t ch) {
+	if (ch < 0x80) out += char(ch);
+	else if (ch < 0x800) out += {char(0xC0 | ch >> 6), char(0x80 | (ch & 0x3F))};
+	else if (ch < 0x10000) out += {char(0xE0 | ch >> 12), char(0x80 | (ch >> 6 & 0x3F)), char(0x80 | (ch & 0x3F))};
+	else out += {char(0xF0 | ch >> 18), char(0x80 | (ch >> 12 & 0x3F)), char(0x80 | (ch >> 6 & 0x3F)), char(0x80 | (ch & 0x3F))};
+}
+
+//One character a cell, so names like Nidoran♀ take as many cells as they do on the terminal
+class CellGrid {
+	int w = 0, h = 0;
+	vector<char32_t> cells;
+  public:
+	int sprite = 0, sprite_row = 0;	//A half block sprite to draw from sprite_row, see halfblock.h
+	CellGrid() {}
+	CellGrid(int width, int height) {
+		reset(width, height);
+	}
+	//Resizes to width x height blank cells
+	void reset(int width, int height) {
+		w = width;
+		h = height;
+		cells.assign(size_t(w) * h, ' ');
+		sprite = 0;
+	}
+	int width() const { return w; }
+	int height() const { return h; }
+	const char32_t *row(int r) const { return &cells[size_t(r) * w]; }
+	bool operator==(const CellGrid &other) const {
+		return w == other.w and h == other.h and cells == other.cells and same_sprite(other);
+	}
+	bool same_sprite(const CellGrid &other) const {
+		return sprite == other.sprite and (!sprite or sprite_row == other.sprite_row);
+	}
+
+	//Writes one line of text starting at (r, c), cut off at the edges. Tabs go to the next multiple of 8.
+	void put(int r, int c, const string &text) {
+		if (r < 0 or r >= h) return;
+		for (size_t i = 0; i < text.size();) {
+			char32_t ch = next_char(text, i);
+			if (ch == '\n') break;
+			if (ch == '\t') {
+				do {
+					if (c >= 0 and c < w) cells[size_t(r) * w + c] = ' ';
+				} while (++c % 8);
+				continue;
+			}
+			if (c >= 0 and c < w) cells[size_t(r) * w + c] = ch;
+			c++;
+		}
+	}
+	//Row r without the blanks on the end
+	string line(int r) const {
+		const char32_t *p = row(r);
+		int n = w;
+		while (n > 0 and p[n - 1] == ' ') n--;
+		string out;
+		for (int c = 0; c < n; c++) append_utf8(out, p[c]);
+		return out;
+	}
+	//The whole grid as text, one line per row
+	string text() const {
+		string out;
+		for (int r = 0; r < h; r++) out += line(r) + "\n";
+		return out;
+	}
+};
+
+//Width of a line in cells once its tabs are expanded
+int text_width(const string &text) {
+	int c = 0;
+	for (size_t i = 0; i < text.size();) c = next_char(text, i) == '\t' ? (c / 8 + 1) * 8 : c + 1;
+	return c;
+}
+
+//Lays out the battle screen for attacker against defender, who started with max_hp, with the
+//log lines under the moves. The grid is sized to fit.
+void compose_battle(CellGrid &grid, const Pokemon &attacker, const Pokemon &defender, float max_hp, const vector<string> &log = {}) {
+	vector<string> lines = {"", ""};
+	int sprite_row = lines.size();
+	HalfBlockSprites &half_blocks = half_block_sprites();
+	if (half_blocks.enabled()) {
+		string blank(half_blocks.width(defender.index), ' ');
+		lines.insert(lines.end(), half_blocks.height(defender.index), blank);
+	} else {
+		istringstream sprite(sprite_pack().sprite(defender.index));
+		for (string line; getline(sprite, line);) lines.push_back(line);
+	}
+	lines.push_back("");
+	lines.push_back("");
+	float health = (defender.hp / max_hp) * 100;
+	ostringstream bar;
+	bar << "[" << string(max(0, int(ceil(health))), '#') << string(max(0, int(ceil(((max_hp - defender.hp) / max_hp) * 100))), ' ') << "]\t" << defender.hp << "/" << max_hp << " HP";
+	lines.push_back(bar.str());
+	lines.push_back("");
+	int i = 0;
+	for (const Move &m : attacker.moves) {
+		ostringstream move;
+		move << ++i << ") " << m;
+		lines.push_back(move.str());
+	}
+	lines.push_back("");
+	lines.insert(lines.end(), log.begin(), log.end());
+
+	int width = 0;
+	for (const string &line : lines) width = max(width, text_width(line));
+	grid.reset(width, lines.size());
+	for (size_t r = 0; r < lines.size(); r++) grid.put(r, 0, lines[r]);
+	if (half_blocks.enabled()) {
+		grid.sprite = defender.index;
+		grid.sprite_row = sprite_row;
+	}
+}
+
+class RenderBackend {
+  public:
+	virtual ~RenderBackend() {}
+	virtual void present(const CellGrid &grid) = 0;
+};
+
+//Keeps every frame in memory instead of drawing it
+class MemoryBackend : public RenderBackend {
+	CellGrid last;
+	size_t count = 0;
+  public:
+	void present(const CellGrid &grid) override {
+		last = grid;
+		count++;
+	}
+	const CellGrid &frame() const { return last; }
+	size_t frames() const { return count; }
+	//The last frame as text, for comparing screens
+	string snapshot() const { return last.text(); }
+};
+
+//Draws frames on the terminal, sending only the changes from the frame before when it can.
+//Anything else printed under a frame is cleared by the next one. When stdout isn't a terminal
+//each frame is written out as plain text.
+class TerminalBackend : public RenderBackend {
+	CellGrid shown;
+	bool valid = false;
+	uint64_t lines_after = 0, clears = 0;	//The output layer's line count and screen_clears after the last frame
+
+	//Whether the last frame is still where it was drawn: nothing has cleared the screen, and the
+	//frame and the lines printed under it since fit without scrolling or wrapping
+	bool still_shown(const CellGrid &grid) const {
+		int rows, cols;
+		if (!valid or clears != screen_clears or !terminal_size(rows, cols)) return false;
+		if (max(grid.width(), shown.width()) > cols) return false;
+		return uint64_t(max(grid.height(), shown.height())) + 1 + (screen_output.lines() - lines_after) < uint64_t(rows);
+	}
+  public:
+	//Makes the next frame a full redraw
+	void invalidate() { valid = false; }
+
+	//The bytes that turn the last frame into grid: a clear and the whole grid, or if diff is set
+	//a cursor move and the new text for each changed span. Either way the cursor ends up under the
+	//grid with the rest of the screen cleared. A half block sprite is only sent when it isn't
+	//already on screen, and a different one means a full redraw, to clear the old one's cells.
+	string encode(const CellGrid &grid, bool diff) const {
+		if (!diff or !grid.same_sprite(shown)) {
+			string out = CLEAR_SCREEN + grid.text();
+			if (grid.sprite) {
+				out += "\033[" + to_string(grid.sprite_row + 1) + ";1H" + half_block_sprites().sprite(grid.sprite);
+				out += "\033[" + to_string(grid.height() + 1) + ";1H";
+			}
+			return out;
+		}
+		string out;
+		//Cells past the edge of either frame count as blank
+		auto cell = [](const CellGrid &g, int r, int c) { return r < g.height() and c < g.width() ? g.row(r)[c] : U' '; };
+		int width = max(grid.width(), shown.width());
+		for (int r = 0; r < grid.height(); r++) {
+			for (int c = 0; c < width;) {
+				if (cell(grid, r, c) == cell(shown, r, c)) {
+					c++;
+					continue;
+				}
+				//A span ends after a few unchanged cells, where a cursor move is cheaper than resending them
+				int end = c + 1, same = 0;
+				for (; end < width and same < 8; end++) same = cell(grid, r, end) == cell(shown, r, end) ? same + 1 : 0;
+				end -= same;
+				out += "\033[" + to_string(r + 1) + ";" + to_string(c + 1) + "H";
+				for (int k = c; k < end; k++) append_utf8(out, cell(grid, r, k));
+				c = end;
+			}
+		}
+		out += "\033[" + to_string(grid.height() + 1) + ";1H\033[J";
+		return out;
+	}
+
+	//encode, then remembers grid as the frame on screen
+	string render(const CellGrid &grid, bool diff) {
+		string out = encode(grid, diff);
+		shown = grid;
+		valid = true;
+		return out;
+	}
+	void present(const CellGrid &grid) override {
+		if (!isatty(STDOUT_FILENO)) {
+			term_write(grid.text());
+			return;
+		}
+		term_write(render(grid, still_shown(grid)));
+		lines_after = screen_output.lines();
+		clears = screen_clears;
+	}
+};
+
+//What a terminal shows after a stream of output, as far as the terminal backend uses it: text,
+//newlines, cursor moves, clears and colors (which are skipped), one character a cell. Lets frames be
+//checked against the memory backend without a terminal.
+class ScreenModel {
+	vector<u32string> rows;
+	int r = 0, c = 0;
+  public:
+	void apply(const string &bytes) {
+		for (size_t i = 0; i < bytes.size();) {
+			if (bytes[i] == '\033' and i + 1 < bytes.size() and bytes[i + 1] == '[') {
+				size_t end = i + 2;
+				while (end < bytes.size() and !isalpha(bytes[end])) end++;
+				if (end == bytes.size()) break;
+				string params = bytes.substr(i + 2, end - i - 2);
+				if (bytes[end] == 'H') {
+					int row = 1, col = 1;
+					sscanf(params.c_str(), "%d;%d", &row, &col);
+					r = row - 1;
+					c = col - 1;
+				} else if (bytes[end] == 'J') {
+					if (params.empty() or params == "0") {
+						if (r < int(rows.size())) {
+							if (c < int(rows[r].size())) rows[r].resize(c);
+							rows.resize(r + 1);
+						}
+					} else
+						rows.clear();
+				}
+				i = end + 1;
+				continue;
+			}
+			char32_t ch = next_char(bytes, i);
+			if (ch == '\n') {
+				r++;
+				c = 0;
+			} else {
+				if (r >= int(rows.size())) rows.resize(r + 1);
+				if (c >= int(rows[r].size())) rows[r].resize(c + 1, ' ');
+				rows[r][c++] = ch;
+			}
+		}
+	}
+	//The screen as text, one line per row with the blanks on the end left off, down to the last row
+	//with anything on it
+	string text() const {
+		size_t n = rows.size();
+		while (n > 0 and rows[n - 1].find_first_not_of(U' ') == u32string::npos) n--;
+		string out;
+		for (size_t r = 0; r < n; r++) {
+			for (size_t c = 0; c < rows[r].find_last_not_of(U' ') + 1; c++) append_utf8(out, rows[r][c]);
+			out += "\n";
+		}
+		return out;
+	}
+};
+
+//A snapshot without its blank lines at the bottom, which a screen doesn't show
+string trim_snapshot(string text) {
+	while (text.size() >= 2 and text[text.size() - 1] == '\n' and text[text.size() - 2] == '\n') text.pop_back();
+	return text == "\n" ? "" : text;
+}
+
+struct RenderStats {
+	size_t frames = 0;
+	double seconds = 0;
+	size_t full_bytes = 0, diff_bytes = 0;	//Totals the terminal backend would send each way
+	size_t checked = 0, mismatches = 0;	//Frames where the screen was compared with the memory backend's snapshot
+};
+
+//Composes frames of made up battles, each Pokemon losing HP a turn at a time with a line in the
+//log about it, into a memory backend, and works out what the terminal backend would send for them.
+//With check set, the terminal output is also played on a ScreenModel and compared with the memory
+//backend's snapshot after every frame (frames with a half block sprite, which isn't text, are skipped).
+RenderStats benchmark_render(const vector<Pokemon> &dex, size_t frames, uint64_t seed, bool check = false) {
+	RenderStats stats;
+	Rng rng(seed);
+	MemoryBackend memory;
+	TerminalBackend terminal;
+	ScreenModel screen;
+	CellGrid grid;
+	Pokemon attacker, defender;
+	vector<string> log;
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (size_t f = 0; f < frames; f++) {
+		bool new_battle = f % 10 == 0 or defender.hp <= 0;
+		if (new_battle) {
+			attacker = dex.at(rng.range(dex.size()));
+			defender = dex.at(rng.range(dex.size()));
+			attacker.moves = default_moveset(attacker);
+			log.clear();
+		} else {
+			int damage = 1 + rng.range(max(defender.original_hp / 4, 1));
+			defender.hp -= damage;
+			const Move &move = attacker.moves.at(rng.range(attacker.moves.size()));
+			log = {attacker.name + " used " + move.name + ", which dealt " + to_string(damage) + " damage to " + defender.name + ".", defender.name + "'s HP is now " + to_string(defender.hp) + "."};
+		}
+		compose_battle(grid, attacker, defender, defender.original_hp, log);
+		memory.present(grid);
+		stats.full_bytes += terminal.encode(grid, false).size();
+		string sent = terminal.render(grid, !new_battle);
+		stats.diff_bytes += sent.size();
+		if (check) {
+			screen.apply(sent);
+			if (!grid.sprite) {
+				stats.checked++;
+				if (screen.text() != trim_snapshot(memory.snapshot())) stats.mismatches++;
+			}
+		}
+	}
+	stats.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	stats.frames = memory.frames();
+	return stats;
+}
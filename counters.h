@@ -0,0 +1,123 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include "battle.h"
+#include "scheduler.h"
+using namespace std;
+
+//"What beats X?"
+//For each target species, every other species is battled against it with the headless rules and
+//ranked by win rate, then by how many of its own turns it needs for the KO. Results are cached
+//per target. Editing a species or move only marks the battles it takes part in as stale, which
+//is one cell in every other row plus the edited species' own row, so the next query only redoes those.
+
+//Battles per ordering of who moves first, enough to average out misses and damage rolls
+const int COUNTER_BATTLES = 8;
+
+struct Counter {
+	size_t species = 0;	//Position in the dex
+	float win_rate = 0;
+	float turns = MAX_TURNS;	//Average turns it took the counter to win, MAX_TURNS if it never did
+};
+
+class CounterCache {
+	vector<Pokemon> dex;	//Each species with its headless moveset
+	struct Row {
+		vector<Counter> cells;	//cells[c] = species c against this row's species
+		vector<char> stale;
+	};
+	vector<Row> rows;
+	uint64_t seed;
+
+	Counter evaluate(size_t c, size_t target) const {
+		Counter result;
+		result.species = c;
+		Matchup m = make_matchup(dex[c], dex[target]);
+		BattleState start = make_state(dex[c], dex[target]);
+		//Speed decides who goes first, so a tie is the average of both orders
+		vector<int> firsts;
+		if (m.side[0].speed != m.side[1].speed) firsts = {m.side[0].speed > m.side[1].speed ? 0 : 1};
+		else firsts = {0, 1};
+		float points = 0, win_turns = 0;
+		int battles = 0, wins = 0;
+		for (int first : firsts) {
+			for (int r = 0; r < COUNTER_BATTLES; r++, battles++) {
+				BattleState s = start;
+				s.set_to_move(first);
+				uint64_t battle = (uint64_t(c) << 32 | target) * 2 * COUNTER_BATTLES + battles;
+				BattleResult b = simulate_battle(m, s, Policy::GREEDY, Policy::GREEDY, seed, battle);
+				if (b.winner == 0) {
+					points++;
+					wins++;
+					win_turns += first == 0 ? (b.turns + 1) / 2 : b.turns / 2;
+				} else if (b.winner == -1) points += 0.5;
+			}
+		}
+		result.win_rate = points / battles;
+		if (wins) result.turns = win_turns / wins;
+		return result;
+	}
+
+	void mark(size_t row, size_t c) {
+		Row &r = rows[row];
+		if (r.cells.empty() or r.stale[c]) return;
+		r.stale[c] = true;
+	}
+  public:
+	CounterCache(const vector<Pokemon> &species, uint64_t seed) : dex(species), rows(species.size()), seed(seed) {
+		for (Pokemon &p : dex) p.moves = default_moveset(p);
+	}
+
+	//Call after a species record has changed
+	void species_changed(size_t i, const Pokemon &p) {
+		dex.at(i) = p;
+		dex[i].moves = default_moveset(p);
+		for (size_t c = 0; c < dex.size(); c++) mark(i, c);
+		for (size_t row = 0; row < dex.size(); row++) mark(row, i);
+	}
+
+	//Call after a move record in move_db has changed. Species whose moveset uses the move, or whose
+	//best moveset is now different, are treated as changed.
+	void move_changed(const Move &move) {
+		for (size_t i = 0; i < dex.size(); i++) {
+			vector<Move> moves = default_moveset(dex[i]);
+			bool changed = moves.size() != dex[i].moves.size();
+			for (size_t j = 0; j < moves.size() and !changed; j++)
+				changed = moves[j].index != dex[i].moves[j].index or moves[j].index == move.index;
+			if (changed) species_changed(i, dex[i]);
+		}
+	}
+
+	//How many matchups the last call to counters() had to battle out
+	size_t last_matchups = 0;
+
+	//Every other species against target, best counter first
+	vector<Counter> counters(size_t target) {
+		Row &row = rows.at(target);
+		vector<size_t> todo;
+		if (row.cells.empty()) {
+			row.cells.resize(dex.size());
+			row.stale.assign(dex.size(), false);
+			for (size_t c = 0; c < dex.size(); c++)
+				if (c != target) todo.push_back(c);
+		} else {
+			for (size_t c = 0; c < dex.size(); c++)
+				if (c != target and row.stale[c]) todo.push_back(c);
+		}
+		WorkStealer pool;
+		pool.run(todo.size(), [&](size_t i) { row.cells[todo[i]] = evaluate(todo[i], target); }, todo.size() > 64 ? WorkStealer::default_threads() : 1);
+		for (size_t c : todo) row.stale[c] = false;
+		last_matchups = todo.size();
+
+		vector<Counter> ranked;
+		for (size_t c = 0; c < dex.size(); c++)
+			if (c != target) ranked.push_back(row.cells[c]);
+		sort(ranked.begin(), ranked.end(), [](const Counter &a, const Counter &b) {
+			if (a.win_rate != b.win_rate) return a.win_rate > b.win_rate;
+			return a.turns < b.turns;
+		});
+		return ranked;
+	}
+
+	const Pokemon &species(size_t i) const { return dex.at(i); }
+};
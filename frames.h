@@ -0,0 +1,76 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <ncurses.h>
+#include <poll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+using namespace std;
+
+//Event driven frame loop for the explore screen.
+//Waits on stdin and a timerfd with poll, so the game sleeps until a key arrives. A key marks the
+//screen as changed, and the next frame is drawn once every key waiting has been handled and at
+//least 1/fps seconds have passed since the last one; the timer wakes the loop up for a frame that
+//had to wait. Nothing on the map moves by itself, so with no keys there are no frames at all.
+
+class FrameLoop {
+	using clock = chrono::steady_clock;
+	int timer = -1;
+	clock::duration frame;
+	clock::time_point last_frame;
+	bool changed = true;
+  public:
+	FrameLoop(double fps) : frame(chrono::duration_cast<clock::duration>(chrono::duration<double>(1 / fps))) {
+		timer = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+		last_frame = clock::now() - frame;
+		nodelay(stdscr, TRUE);
+	}
+	FrameLoop(const FrameLoop &) = delete;
+	FrameLoop &operator=(const FrameLoop &) = delete;
+	~FrameLoop() {
+		if (timer != -1) close(timer);
+	}
+
+	//Blocks until there is a key, returning it, or a frame is due, returning ERR.
+	//Returns 'q' once stdin is closed, so the caller leaves instead of spinning.
+	int next() {
+		while (true) {
+			int ch = getch();
+			if (ch != ERR) {
+				changed = true;
+				return ch;
+			}
+			clock::duration wait = last_frame + frame - clock::now();
+			if (changed and wait <= clock::duration::zero()) return ERR;
+			itimerspec when = {};	//All zero disarms the timer
+			if (changed) {
+				auto ns = chrono::duration_cast<chrono::nanoseconds>(wait).count();
+				when.it_value.tv_sec = ns / 1000000000;
+				when.it_value.tv_nsec = ns % 1000000000;
+			}
+			if (timer != -1) timerfd_settime(timer, 0, &when, nullptr);
+			pollfd fds[2] = {{STDIN_FILENO, POLLIN, 0}, {timer, POLLIN, 0}};
+			//Without a timerfd, fall back to a plain poll timeout
+			int timeout = timer == -1 and changed ? int(chrono::duration_cast<chrono::milliseconds>(wait).count()) + 1 : -1;
+			if (poll(fds, timer == -1 ? 1 : 2, timeout) < 0) continue;	//EINTR, a signal such as a resize
+			if (fds[1].revents & POLLIN) {
+				uint64_t expirations;
+				ssize_t drained = read(timer, &expirations, sizeof(expirations));
+				(void) drained;
+			}
+			if (fds[0].revents) {
+				ch = getch();
+				if (ch != ERR) {
+					changed = true;
+					return ch;
+				}
+				return 'q';	//stdin woke us up but had nothing to read: it was closed
+			}
+		}
+	}
+	//Call after drawing a frame
+	void drew() {
+		changed = false;
+		last_frame = clock::now();
+	}
+};
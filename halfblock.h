@@ -0,0 +1,208 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <unistd.h>
+#include "pokemon.h"
+#include "terminal.h"
+#include "pokedex_ascii.h"
+using namespace std;
+
+//Unicode sprite renderer.
+//With POKEMON_UNICODE set, sprites are drawn in color with half block characters. Each character
+//cell shows two rows of the ASCII art, ▀ in the top row's color over the bottom row's, so a sprite
+//takes half the lines. How much ink a character has picks a shade of a color for the Pokemon's type.
+//The colors are brought down to what the terminal can show (24 bit color, the 256 color cube or the
+//16 ANSI colors) once, when the renderer is turned on, and each sprite's escape sequences are built
+//the first time it is drawn and kept, so drawing it again is one copy into the output buffer.
+
+enum class ColorDepth { ANSI16, ANSI256, TRUECOLOR };
+
+//What the terminal can show, going by COLORTERM and TERM
+ColorDepth detect_color_depth() {
+	const char *colorterm = getenv("COLORTERM"), *term = getenv("TERM");
+	if (colorterm and (colorterm == "truecolor"s or colorterm == "24bit"s)) return ColorDepth::TRUECOLOR;
+	if (term and string(term).find("256color") != string::npos) return ColorDepth::ANSI256;
+	return ColorDepth::ANSI16;
+}
+
+struct Rgb {
+	int r, g, b;
+};
+
+//A color for each type, in lookup_type order
+const Rgb TYPE_COLORS[NUM_TYPES] = {
+	{168, 168, 120}, {192, 48, 40}, {168, 144, 240}, {160, 64, 160}, {224, 192, 104}, {184, 160, 56},
+	{168, 184, 32}, {112, 88, 152}, {184, 184, 208}, {240, 128, 48}, {104, 144, 240}, {120, 200, 80},
+	{248, 208, 48}, {248, 88, 136}, {152, 216, 216}, {112, 56, 248}, {112, 88, 72}, {238, 153, 172},
+};
+const Rgb PLAIN_COLOR = {200, 200, 200};	//For a sprite whose type isn't known
+
+class HalfBlockSprites {
+	static const int SHADES = 5;	//Ink levels, 0 is no ink at all
+	static const int PLAIN = NUM_TYPES;	//Palette row for PLAIN_COLOR
+	bool on = false;
+	string fg[NUM_TYPES + 1][SHADES], bg[NUM_TYPES + 1][SHADES];	//Escape sequences, quantized
+	vector<string> cache;
+	vector<int> widths, heights;	//In character cells, for each sprite in the cache
+
+	//How much ink character c puts down, 0 to SHADES - 1
+	static int ink(char c) {
+		if (c == ' ' or c == '\t' or c == '\r') return 0;
+		if (strchr("`.,'-_:", c)) return 1;
+		if (strchr(";~\"^!/\\|()[]{}<>=+*ilrt", c)) return 2;
+		if (strchr("#@%&$MWBNQ0", c)) return 4;
+		return 3;
+	}
+	//The escape sequence to set the foreground (or background, with background set) to color,
+	//as near as the terminal can show it
+	static string quantize(Rgb color, ColorDepth depth, bool background) {
+		if (depth == ColorDepth::TRUECOLOR)
+			return "\033[" + string(background ? "48" : "38") + ";2;" + to_string(color.r) + ";" + to_string(color.g) + ";" + to_string(color.b) + "m";
+		if (depth == ColorDepth::ANSI256) {
+			auto level = [](int c) { return (c * 5 + 127) / 255; };
+			int index = 16 + 36 * level(color.r) + 6 * level(color.g) + level(color.b);
+			return "\033[" + string(background ? "48" : "38") + ";5;" + to_string(index) + "m";
+		}
+		//The 16 colors as xterm shows them, the nearest one wins
+		static const Rgb ANSI[16] = {
+			{0, 0, 0}, {205, 0, 0}, {0, 205, 0}, {205, 205, 0}, {0, 0, 238}, {205, 0, 205}, {0, 205, 205}, {229, 229, 229},
+			{127, 127, 127}, {255, 0, 0}, {0, 255, 0}, {255, 255, 0}, {92, 92, 255}, {255, 0, 255}, {0, 255, 255}, {255, 255, 255},
+		};
+		int best = 0;
+		long best_distance = -1;
+		for (int i = 0; i < 16; i++) {
+			long dr = color.r - ANSI[i].r, dg = color.g - ANSI[i].g, db = color.b - ANSI[i].b;
+			long distance = dr * dr + dg * dg + db * db;
+			if (best_distance < 0 or distance < best_distance) {
+				best = i;
+				best_distance = distance;
+			}
+		}
+		int code = (best < 8 ? 30 : 90) + best % 8 + (background ? 10 : 0);
+		return "\033[" + to_string(code) + "m";
+	}
+	//Palette row for Pokedex number n: its first type, or PLAIN if it isn't in the Pokedex
+	static int palette_row(int n) {
+		auto p = find(pokemon_db.begin(), pokemon_db.end(), n);
+		int type = p == pokemon_db.end() ? -1 : lookup_type(p->type1);
+		return type >= 0 and type < int(NUM_TYPES) ? type : PLAIN;
+	}
+	//Builds the escape sequences for Pokedex number n, in the colors of its type
+	void encode(int n) {
+		int type = palette_row(n);
+		vector<string> lines;
+		string line;
+		for (char c : sprite_pack().sprite(n)) {
+			if (c == '\n') {
+				lines.push_back(line);
+				line.clear();
+			} else
+				line += c;
+		}
+		if (!line.empty()) lines.push_back(line);
+		int width = 0;
+		for (const string &l : lines) width = max(width, int(l.size()));
+		string &out = cache[n];
+		out.clear();
+		const string *cur_fg = nullptr, *cur_bg = nullptr;	//What the terminal is set to, null for its default
+		auto set = [&](const string *want_fg, const string *want_bg) {
+			if ((!want_fg and cur_fg) or (!want_bg and cur_bg)) {
+				out += "\033[0m";
+				cur_fg = cur_bg = nullptr;
+			}
+			if (want_fg and want_fg != cur_fg) out += *want_fg;
+			if (want_bg and want_bg != cur_bg) out += *want_bg;
+			cur_fg = want_fg;
+			cur_bg = want_bg;
+		};
+		auto at = [](const string &l, int c) { return c < int(l.size()) ? l[c] : ' '; };
+		for (size_t r = 0; r < lines.size(); r += 2) {
+			const string &top = lines[r];
+			string bottom = r + 1 < lines.size() ? lines[r + 1] : "";
+			//Past the last inked cell the row is left as it is
+			int end = width;
+			while (end > 0 and !ink(at(top, end - 1)) and !ink(at(bottom, end - 1))) end--;
+			for (int c = 0; c < end; c++) {
+				int t = ink(at(top, c)), b = ink(at(bottom, c));
+				if (!t and !b) {
+					set(nullptr, nullptr);
+					out += ' ';
+				} else if (!b) {
+					set(&fg[type][t], nullptr);
+					out += "▀";
+				} else if (!t) {
+					set(&fg[type][b], nullptr);
+					out += "▄";
+				} else if (t == b) {
+					set(&fg[type][t], nullptr);
+					out += "█";
+				} else {
+					set(&fg[type][t], &bg[type][b]);
+					out += "▀";
+				}
+			}
+			set(nullptr, nullptr);
+			out += "\n";
+		}
+		widths[n] = width;
+		heights[n] = (lines.size() + 1) / 2;
+	}
+  public:
+	//Turns the renderer on, working out the palette for depth
+	void enable(ColorDepth depth) {
+		for (int type = 0; type <= PLAIN; type++) {
+			Rgb base = type == PLAIN ? PLAIN_COLOR : TYPE_COLORS[type];
+			for (int shade = 1; shade < SHADES; shade++) {
+				//Light ink is dimmer, so the outline of a sprite still reads
+				double scale = 0.4 + 0.6 * shade / (SHADES - 1);
+				Rgb color = {int(base.r * scale), int(base.g * scale), int(base.b * scale)};
+				fg[type][shade] = quantize(color, depth, false);
+				bg[type][shade] = quantize(color, depth, true);
+			}
+		}
+		cache.clear();
+		widths.clear();
+		heights.clear();
+		on = true;
+	}
+	bool enabled() const { return on; }
+
+	//The escape sequences that draw Pokedex number n in the colors of its first type, one line per
+	//two rows of the ASCII art. The cursor starts and ends at the left edge, and the colors are put
+	//back at the end of each line.
+	const string &sprite(int n) {
+		static const string none;
+		if (n < 1) return none;
+		if (size_t(n) >= cache.size()) {
+			cache.resize(n + 1);
+			widths.resize(n + 1, -1);
+			heights.resize(n + 1, 0);
+		}
+		if (widths[n] < 0) encode(n);
+		return cache[n];
+	}
+	//Size of a sprite in character cells
+	int width(int n) {
+		sprite(n);
+		return n < 1 ? 0 : widths[n];
+	}
+	int height(int n) {
+		sprite(n);
+		return n < 1 ? 0 : heights[n];
+	}
+};
+
+HalfBlockSprites &half_block_sprites() {
+	static HalfBlockSprites sprites;
+	return sprites;
+}
+
+//Draws p's sprite, in half blocks if they're on
+void print_sprite(const Pokemon &p) {
+	if (half_block_sprites().enabled()) term_write(half_block_sprites().sprite(p.index));
+	else print_pokemon(p.index);
+}
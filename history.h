@@ -0,0 +1,105 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include "battle.h"
+using namespace std;
+
+//Event-sourced battles.
+//A battle is kept as an append-only list of events (move chosen, damage dealt, PP spent, fainted)
+//and the current BattleState is whatever those events add up to. Every event can be undone, so
+//stepping back a turn only reverts that turn's few events, and a snapshot every SNAPSHOT_TURNS
+//turns bounds the cost of jumping anywhere else. Playing a move after rewinding branches the
+//battle: the old future is dropped and the new one is appended in its place.
+
+const int SNAPSHOT_TURNS = 32;
+
+struct BattleEvent {
+	enum Kind : uint8_t { MOVE_CHOSEN, DAMAGE, PP_SPENT, FAINTED };
+	Kind kind;
+	uint8_t side;	//Side using the move, or the side taking damage or fainting
+	uint8_t slot = 0;	//Move slot for MOVE_CHOSEN and PP_SPENT
+	uint16_t amount = 0;	//HP lost for DAMAGE
+};
+
+class BattleHistory {
+	Matchup m;
+	BattleState now;
+	vector<BattleEvent> events;
+	vector<size_t> turn_start;	//turn_start[t] = first event of turn t + 1, plus one past the last turn
+	vector<BattleState> snapshots;	//snapshots[k] = state after k * SNAPSHOT_TURNS turns
+	int head = 0;	//Turns applied to now
+
+	void apply(const BattleEvent &e) {
+		if (e.kind == BattleEvent::MOVE_CHOSEN) {
+			now.set_to_move(1 - e.side);
+			now.turn++;
+		} else if (e.kind == BattleEvent::DAMAGE) now.set_hp(e.side, now.hp[e.side] - e.amount);
+		else if (e.kind == BattleEvent::PP_SPENT) now.spend_pp(e.side, e.slot);
+	}
+	void revert(const BattleEvent &e) {
+		if (e.kind == BattleEvent::MOVE_CHOSEN) {
+			now.set_to_move(e.side);
+			now.turn--;
+		} else if (e.kind == BattleEvent::DAMAGE) now.set_hp(e.side, now.hp[e.side] + e.amount);
+		else if (e.kind == BattleEvent::PP_SPENT) now.refund_pp(e.side, e.slot);
+	}
+  public:
+	BattleHistory(const Matchup &m, const BattleState &start) : m(m), now(start), turn_start{0}, snapshots{start} {}
+
+	const Matchup &matchup() const { return m; }
+	const BattleState &state() const { return now; }
+	const vector<BattleEvent> &log() const { return events; }
+	int turn() const { return head; }
+	int turns_recorded() const { return turn_start.size() - 1; }
+	//Move::index of the move used on each turn up to now
+	vector<int> played_moves() const {
+		vector<int> moves;
+		for (size_t i = 0; i < turn_start[head]; i++)
+			if (events[i].kind == BattleEvent::MOVE_CHOSEN) moves.push_back(m.side[events[i].side].move_id[events[i].slot]);
+		return moves;
+	}
+
+	//Plays the move in slot for the side to move, dropping any turns that had been undone
+	void play(int slot, Rng &rng) {
+		events.resize(turn_start[head]);
+		turn_start.resize(head + 1);
+		snapshots.resize(head / SNAPSHOT_TURNS + 1);
+
+		BattleState next = now;
+		play_move(m, next, slot, rng);
+		int me = now.to_move, them = 1 - me;
+		events.push_back({BattleEvent::MOVE_CHOSEN, uint8_t(me), uint8_t(slot)});
+		if (next.hp[them] != now.hp[them]) events.push_back({BattleEvent::DAMAGE, uint8_t(them), 0, uint16_t(now.hp[them] - next.hp[them])});
+		if (slot != STRUGGLE) events.push_back({BattleEvent::PP_SPENT, uint8_t(me), uint8_t(slot)});
+		if (next.hp[them] == 0) events.push_back({BattleEvent::FAINTED, uint8_t(them)});
+		for (size_t i = turn_start[head]; i < events.size(); i++) apply(events[i]);
+		head++;
+		turn_start.push_back(events.size());
+		if (head % SNAPSHOT_TURNS == 0) snapshots.push_back(now);
+	}
+
+	//Steps back one turn, returns false at the start of the battle
+	bool undo() {
+		if (head == 0) return false;
+		for (size_t i = turn_start[head]; i-- > turn_start[head - 1];) revert(events[i]);
+		head--;
+		return true;
+	}
+	//Steps forward again through a turn that was undone
+	bool redo() {
+		if (head == turns_recorded()) return false;
+		for (size_t i = turn_start[head]; i < turn_start[head + 1]; i++) apply(events[i]);
+		head++;
+		return true;
+	}
+	//Moves to any recorded turn, starting from the nearest snapshot when that is closer
+	void seek(int turn) {
+		turn = clamp(turn, 0, turns_recorded());
+		if (abs(turn - head) > SNAPSHOT_TURNS) {
+			head = turn / SNAPSHOT_TURNS * SNAPSHOT_TURNS;
+			now = snapshots[turn / SNAPSHOT_TURNS];
+		}
+		while (head > turn) undo();
+		while (head < turn) redo();
+	}
+};
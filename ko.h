@@ -0,0 +1,97 @@
+#pragma once
+#include <vector>
+#include <complex>
+#include <cmath>
+#include "battle.h"
+using namespace std;
+
+//Exact knockout odds.
+//The damage one use of a move does is a probability vector indexed by HP taken: a miss plus each of
+//the damage rolls. The damage after n uses is the n-fold convolution of that vector, with anything
+//at or past the defender's HP lumped into the last entry since overkill doesn't matter. Short
+//vectors are convolved directly and long ones through an FFT.
+
+//Above this many multiply-adds a direct convolution is slower than an FFT
+const size_t FFT_WORK = 1 << 14;
+
+//In-place radix 2 FFT, the size of a must be a power of two
+void fft(vector<complex<double>> &a, bool inverse) {
+	size_t n = a.size();
+	for (size_t i = 1, j = 0; i < n; i++) {
+		size_t bit = n >> 1;
+		for (; j & bit; bit >>= 1) j ^= bit;
+		j ^= bit;
+		if (i < j) swap(a[i], a[j]);
+	}
+	for (size_t len = 2; len <= n; len <<= 1) {
+		double angle = 2 * M_PI / len * (inverse ? 1 : -1);
+		complex<double> step(cos(angle), sin(angle));
+		for (size_t i = 0; i < n; i += len) {
+			complex<double> w(1);
+			for (size_t j = 0; j < len / 2; j++) {
+				complex<double> u = a[i + j], v = a[i + j + len / 2] * w;
+				a[i + j] = u + v;
+				a[i + j + len / 2] = u - v;
+				w *= step;
+			}
+		}
+	}
+	if (inverse)
+		for (auto &x : a) x /= double(n);
+}
+
+//Distribution of the sum of two independent damages, with everything from cap up lumped at cap
+vector<double> convolve(const vector<double> &a, const vector<double> &b, size_t cap) {
+	size_t full = a.size() + b.size() - 1;
+	vector<double> sum(full, 0);
+	if (a.size() * b.size() <= FFT_WORK) {
+		for (size_t i = 0; i < a.size(); i++) {
+			if (a[i] == 0) continue;
+			for (size_t j = 0; j < b.size(); j++) sum[i + j] += a[i] * b[j];
+		}
+	} else {
+		size_t n = 1;
+		while (n < full) n <<= 1;
+		vector<complex<double>> fa(a.begin(), a.end()), fb(b.begin(), b.end());
+		fa.resize(n);
+		fb.resize(n);
+		fft(fa, false);
+		fft(fb, false);
+		for (size_t i = 0; i < n; i++) fa[i] *= fb[i];
+		fft(fa, true);
+		for (size_t i = 0; i < full; i++) sum[i] = max(fa[i].real(), 0.0);	//Rounding can leave tiny negatives
+	}
+	if (full > cap + 1) {
+		for (size_t i = cap + 1; i < full; i++) sum[cap] += sum[i];
+		sum.resize(cap + 1);
+	}
+	return sum;
+}
+
+//Chance of each amount of HP taken by one use of move, lumping cap and above together
+vector<double> damage_distribution(const Pokemon &attacker, const Move &move, const Pokemon &defender, int cap) {
+	vector<double> dist(1, 0);
+	double hit = hit_chance(move) / 100.0;
+	dist[0] = 1 - hit;
+	for (int roll = MIN_ROLL; roll <= MAX_ROLL; roll++) {
+		int damage = min(calc_damage(attacker, move, defender, roll), cap);
+		if (damage >= int(dist.size())) dist.resize(damage + 1, 0);
+		dist[damage] += hit / DAMAGE_ROLLS;
+	}
+	return dist;
+}
+
+//ko[n - 1] is the chance that n uses of move knock out the defender from its current HP.
+//Stops early once a KO is certain or can't happen.
+vector<double> ko_chances(const Pokemon &attacker, const Move &move, const Pokemon &defender, int max_hits) {
+	vector<double> ko;
+	int hp = max(defender.hp, 1);
+	vector<double> hit = damage_distribution(attacker, move, defender, hp);
+	vector<double> total = hit;
+	for (int n = 1; n <= max_hits; n++) {
+		if (n > 1) total = convolve(total, hit, hp);
+		ko.push_back(int(total.size()) > hp ? total[hp] : 0);
+		if (ko.back() >= 1 - 1e-12 or hit.size() == 1) break;
+	}
+	return ko;
+}
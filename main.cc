@@ -6,90 +6,50 @@
 #include <algorithm>
 #include <vector>
 #include <sstream>
+#include <memory>
 #include <unistd.h>
+#include <clocale>
+#include "terminal.h"
 #include "pokedex_ascii.h"
 #include "map.h"
+#include "pokemon.h"
+#include "battle.h"
+#include "tournament.h"
+#include "ai.h"
+#include "mcts.h"
+#include "recommend.h"
+#include "counters.h"
+#include "optimizer.h"
+#include "replay.h"
+#include "history.h"
+#include "batch.h"
+#include "ko.h"
+#include "solver.h"
+#include "tablebase.h"
+#include "frames.h"
+#include "halfblock.h"
+#include "compositor.h"
 #include <cassert>
 using namespace std;
 using hrc = std::chrono::high_resolution_clock;
 
 const bool DEBUG = true;
 
-const unsigned int TIMEOUT = 10; //Milliseconds to wait for a getch to finish
+const double FRAME_RATE = 60; //Most frames a second explore mode draws, set POKEMON_FPS to change it
 const int UP = 65; //Key code for up arrow
 const int DOWN = 66;
 const int LEFT = 68;
 const int RIGHT = 67;
 
-string uppercaseify(string s) {
-	string str;
-	for (char c : s) {
-		c = toupper(c);
-		str += c;
-	}
-	return str;
-}
-
-//This class holds a record for each move in the game
-class Move {
-	public:
-		int index;
-		string name;
-		string type;
-		string category;
-		int PP;
-		int power;
-		int accuracy;
-};
-
-//Holds a record for a single species of Pokemon, such as Pikachu
-class Pokemon {
-	public:
-		int index;			//Index number in the pokedex
-		string name;		//Name of the pokemon
-		int hp;				//Health points
-		int original_hp;
-		int attack;			//this number gets multiplied by the move's power to estimate damage
-		int defense;		//incoming damage gets divided by this number
-		int speed;			//whichever pokemon has the highest speed attacks first, flip a coin on a tie
-		int special;		//like attack and defense both, but for special moves
-		string type1;
-		string type2;
-		vector<Move> moves;
-};
-
-ostream& operator<<(ostream &outs, const Pokemon &p) {
-	outs << p.index << "\t" << p.name << "\tHP: " << p.hp << "\tAttack: " << p.attack << "\tDefense: " << p.defense << "\tSpeed: " << p.speed << "\tSpecial: " << p.special << "\tType 1: " << p.type1 << "\tType2: " << p.type2;
-	return outs;
-}
-
-ostream& operator<<(ostream &outs, const Move &m) {
-	outs << m.name << "\tType: " << m.type << "\tCategory: " << m.category << "\tPP: " << m.PP << "\tPower: " << m.power << "\tAccuracy: " << m.accuracy;
-	return outs;
-}
-
-
-bool operator==(const Pokemon &p, const string &s) {
-	return uppercaseify(s)== uppercaseify(p.name);
-}
-
-bool operator==(const Pokemon &p, const int &i) {
-	return i == p.index;
-}
-
-bool operator==(const Move &m, const string &s) {
-	return uppercaseify(s)== uppercaseify(m.name);
-}
-
-bool operator==(const Move &m, const int &i) {
-	return i == m.index;
-}
-
-vector<Pokemon> pokemon_db; //Holds all pokemon known to mankind
-vector<Pokemon> water_pokemon_db;
-vector<Move> move_db;	//Holds all moves available to pokemon
+uint64_t game_seed;	//Every random number in the game comes from this seed
+uint64_t battle_count = 0;	//Battle ids for the random number streams
+BattleRecorder recorder;	//Appends every battle fought to the battle log
 
 void turn_on_ncurses() {
+	flush_output(); //ncurses writes to the terminal itself
+#ifdef UNICODE_TILES
+	setlocale(LC_CTYPE, ""); //ncursesw needs the terminal's encoding to draw the Unicode tiles
+#endif
 	initscr();//Start curses mode
 	start_color(); //Enable Colors if possible
 	init_pair(1, COLOR_GREEN, COLOR_BLACK); //Set up some color pairs
@@ -101,14 +61,13 @@ void turn_on_ncurses() {
 	clear();
 	noecho();
 	cbreak();
-	timeout(TIMEOUT); //Set a max delay for key entry
 }
 
 void turn_off_ncurses() {
 	//Exit NCURSES
 	clear();
 	endwin(); // End curses mode
-	system("clear");
+	clear_screen();
 }
 
 void die(string s = "INVALID INPUT!") {
@@ -126,7 +85,7 @@ bool string_search(const string &needle, const string &haystack) {
 //Each row has: pokemon number, name, hp, etc.
 //void load_pokemon_db(string filename = "pokemon.txt", string filename2 = "types.txt") {
 void load_pokemon_db(string filename, string filename2) {
-	if constexpr(DEBUG) cout << "Loading pokemon database" << endl;
+	if constexpr(DEBUG) cerr << "Loading pokemon database" << endl;
 	ifstream ins(filename);
 	if (!ins) die("Couldn't load file "s + filename);
 	ifstream ins2(filename2);
@@ -169,7 +128,7 @@ void load_pokemon_db(string filename, string filename2) {
 	for (Pokemon p : pokemon_db) {
 		if (p.type1 == "Water" or p.type2 == "Water") water_pokemon_db.push_back(p);
 	}
-	if constexpr(DEBUG) cout << "Pokemon loaded successfully." << endl;
+	if constexpr(DEBUG) cerr << "Pokemon loaded successfully." << endl;
 }
 
 //Reads all moves from moves.txt into move_db, discards all status moves
@@ -207,13 +166,9 @@ void load_move_db(string filename) {
 		move_db.push_back(temp);	//push the complete move back into a vector of moves
 
 	}
-	if constexpr(DEBUG) cout << "Moves loaded successfully." << endl;
+	if constexpr(DEBUG) cerr << "Moves loaded successfully." << endl;
 }
 
-vector<vector<double>>type_system(18,vector<double>(18));
-
-const size_t NUM_TYPES = 18;
-
 void load_type_system(string filename = "type_system.txt") {	//WRK - assert that type system rows and cols are the same as the file height and width
 	double temp = 0;
 	ifstream ins(filename);
@@ -241,11 +196,9 @@ Pokemon select_pokemon(vector<Pokemon> vec) {
 	return temp;
 }
 
-const int MAX_MOVES = 4, MIN_MOVES = 1;
-
 void add_moves(Pokemon &temp) {
 	cout << "Enter up to four moves for " << temp.name << ": " << endl;
-	cout << "(use move name or index. DONE to stop adding moves.)" << endl;
+	cout << "(use move name or index. DONE to stop adding moves. SUGGEST to fill the rest with the best type coverage.)" << endl;
 	int move_count = 0;
 	string move_name;
 	vector<Move> move_vec;
@@ -264,6 +217,15 @@ void add_moves(Pokemon &temp) {
 			}
 			break;
 		}
+		if (uppercaseify(move_name) == "SUGGEST") {
+			hrc::time_point start = hrc::now();
+			MoveSuggestion suggestion = MoveRecommender(temp, pokemon_db).suggest(move_vec);
+			chrono::duration<double, milli> elapsed = hrc::now() - start;
+			for (size_t i = move_vec.size(); i < suggestion.moves.size(); i++)
+				cout << "Move \"" << suggestion.moves.at(i).name << "\" added to " << temp.name << "'s moves." << endl;
+			move_vec = suggestion.moves;
+			cout << "These moves hit " << lround(suggestion.coverage * 100) << "% of all Pokémon super effectively, and take " << lround(suggestion.damage * 100) << "% of their HP per hit on average. (found in " << elapsed.count() << " ms)\n";
+		}
 		for (Move m : move_db) {	//WRK - implement find() or string_search()
 			if (move_name == m.name or move_name == to_string(m.index)) {
 				move_vec.push_back(m);
@@ -286,137 +248,127 @@ void add_moves(Pokemon &temp) {
 	cout << endl << endl;
 }
 
-int lookup_type(string s) {
-	if (s == "Normal") return 0;
-	else if (s == "Fighting") return 1;
-	else if (s == "Flying") return 2;
-	else if (s == "Poison") return 3;
-	else if (s == "Ground") return 4;
-	else if (s == "Rock") return 5;
-	else if (s == "Bug") return 6;
-	else if (s == "Ghost") return 7;
-	else if (s == "Steel") return 8;
-	else if (s == "Fire") return 9;
-	else if (s == "Water") return 10;
-	else if (s == "Grass") return 11;
-	else if (s == "Electric") return 12;
-	else if (s == "Psychic") return 13;
-	else if (s == "Ice") return 14;
-	else if (s == "Dragon") return 15;
-	else if (s == "Dark") return 16;
-	else if (s == "Fairy") return 17;
-	else return -1;
+TerminalBackend battle_screen;	//Draws the battle screens, see compositor.h
+
+void print_battle(Pokemon p1, Pokemon p2, float healthP2, const vector<string> &log = {}) {
+	CellGrid grid;
+	compose_battle(grid, p1, p2, healthP2, log);
+	battle_screen.present(grid);
 }
 
-void print_battle(Pokemon p1, Pokemon p2, float healthP2) {
-	system("clear");
-	cout << "\n\n";
-	print_pokemon(p2.index);
-	cout << "\n\n";
-	float health_bar = (p2.hp / healthP2) * 100;
-	cout << "[";
-	for (int i = 0; i < health_bar; i++) cout << "#";
-	for (int i = 0; i < (((healthP2-p2.hp)/healthP2)*100); i++) cout << " ";
-	cout << "]\t" << p2.hp << "/" << healthP2 << " HP\n\n";
-	int i = 0;
-	for (Move m : p1.moves) 
-		cout << ++i << ") " << m << endl;
-	cout << endl;
+//What p1 hitting p2 with move did, one line each, for the log under the battle screen
+vector<string> attack_log(const Pokemon &p1, const Move &move, const Pokemon &p2, Roll roll, int damage) {
+	vector<string> log;
+	int type1 = lookup_type(p2.type1);      //defending pokemon's type 1 type-system multiplier (column)
+	int type2 = lookup_type(p2.type2);      //defending pokemon's type 2 type-system multiplier (column)
+	int  move_type = lookup_type(move.type);    //attacking move's type system multiplier (row)
+	float type_multiplier = type_modifier(move.type, p2);
+	bool stab = has_stab(p1, move);
+	if constexpr (DEBUG) {
+		ostringstream multiplier, formula;
+		multiplier << "type_multiplier(" << type_multiplier << ") = " << type_system.at(move_type).at(type1);
+		if (type2 != -1) multiplier << " * " << type_system.at(move_type).at(type2);
+		formula << "damage(" << damage << ") = p1_move.power(" << move.power << ") * p1.attack(" << p1.attack << ") * type_multiplier(" << type_multiplier << ")] / p2.defense(" << p2.defense << ") " << (stab ? " * STAB(150%)" : "") << " * roll(" << roll.roll << "/" << MAX_ROLL << ").";
+		log.push_back(multiplier.str());
+		log.push_back(formula.str());
+		log.push_back("");
+	}
+	if (!roll.hit) log.push_back(p1.name + "'s attack missed!");
+	log.push_back(p1.name + " used " + move.name + ", which dealt " + to_string(damage) + " damage to " + p2.name + ".");
+	log.push_back(p2.name + "'s HP is now " + to_string(p2.hp) + ".");
+	if (type_multiplier < 1) log.push_back("It's not very effective...");
+	else if (type_multiplier > 1) log.push_back("It's super effective!.");
+	if (stab) log.push_back("Same Type Attack Bonus applied. 50% extra damage!");
+	if (p2.hp == 0) log.push_back(p2.name + " has fainted. " + p1.name + " has won!");
+	log.push_back("");
+	return log;
 }
 
-void fight(Pokemon &p1, Pokemon &p2) {
+//Returns the slot of the move used (STRUGGLE once every move is out of PP). With a history the
+//player can also type UNDO, REDO or TURN n to step through the battle instead, which moves the
+//history and returns -1. rng is the turn's stream, for the hit and damage roll.
+int fight(Pokemon &p1, Pokemon &p2, Rng rng, BattleHistory *history = nullptr) {
 	//p1 pokemon attacks p2 pokemon
-	print_battle(p1, p2, p2.original_hp);
 	string input;
 	int choice = 0;
-	cout << "Choose a move for " << p1.name << " to use against " << p2.name << " (enter the move's inventory number):\n";
-	while (true) {
-		cin >> input;
-		if (isdigit(input.at(0))) {
-			choice = stoi(input);
-			if (choice > 0 and choice < 5) break;
+	bool struggling = none_of(p1.moves.begin(), p1.moves.end(), [](const Move &m) { return m.PP > 0; });
+	if (struggling) print_battle(p1, p2, p2.original_hp, {p1.name + " has no moves left!"});
+	else {
+		print_battle(p1, p2, p2.original_hp);
+		cout << "Choose a move for " << p1.name << " to use against " << p2.name << " (enter the move's inventory number";
+		if (history) cout << ", UNDO or REDO to step a turn back or forward, or TURN and a number to go to that turn (0 to " << history->turns_recorded() << ")";
+		cout << "):\n";
+		while (true) {
+			cin >> input;
+			string command = uppercaseify(input);
+			if (history and command == "UNDO") {
+				if (history->undo()) return -1;
+				cout << "This is the start of the battle.\n";
+				continue;
+			}
+			if (history and command == "REDO") {
+				if (history->redo()) return -1;
+				cout << "There is nothing to redo.\n";
+				continue;
+			}
+			if (history and command == "TURN") {
+				int turn;
+				if (cin >> turn and turn >= 0 and turn <= history->turns_recorded()) {
+					history->seek(turn);
+					return -1;
+				}
+				cin.clear();
+				cout << "Turns go from 0 to " << history->turns_recorded() << ".\n";
+				continue;
+			}
+			if (isdigit(input.at(0))) {
+				choice = stoi(input);
+				if (choice > 0 and choice <= int(p1.moves.size())) {
+					if (p1.moves.at(choice-1).PP > 0) break;
+					cout << "No PP left for that move.\n";
+				}
+			}
+			else continue;
 		}
-		else continue;
 	}
-	Move move = p1.moves.at(choice-1);
+	Move move = struggling ? struggle_move() : p1.moves.at(choice-1);
+	recorder.turn(move);
 
-	int type1 = lookup_type(p2.type1);      //defending pokemon's type 1 type-system multiplier (column)
-	int type2 = lookup_type(p2.type2);      //defending pokemon's type 2 type-system multiplier (column)
-	int  move_type = lookup_type(move.type);    //attacking move's type system multiplier (row)
-	float type_multiplier = 1.0;
-	if (lookup_type(p2.type2) != -1) type_multiplier = type_system.at(move_type).at(type1) * type_system.at(move_type).at(type2);
-	else type_multiplier = type_system.at(move_type).at(type1);
-	float damage = (move.power * p1.attack * type_multiplier) / p2.defense;
-	bool stab = false;
-	if (p1.type1 == move.type or p1.type2 == move.type) {
-		damage *= 1.5;
-		stab = true;
-	}
+	Roll roll = roll_move(hit_chance(move), rng);
+	int damage = roll.hit ? calc_damage(p1, move, p2, roll.roll) : 0;
 	p2.hp -= damage;
 	if (p2.hp < 0) p2.hp = 0;
-	print_battle(p1, p2, p2.original_hp);
-	if constexpr (DEBUG) {
-		cout << "type_multiplier(" << type_multiplier << ") = " << type_system.at(move_type).at(type1);
-		if (type2 != -1) cout << " * " << type_system.at(move_type).at(type2) << endl;
-		else cout << endl;
-		cout << "damage(" << damage << ") = p1_move.power(" << move.power << ") * p1.attack(" << p1.attack << ") * type_multiplier(" << type_multiplier << ")] / p2.defense(" << p2.defense << ") " << (stab ? " * STAB(150%)" : "") << ".\n\n";
-	}
-	cout << p1.name << " used " << move.name << ", which dealt " << damage << " damage to " << p2.name << ".\n" << p2.name << "'s HP is now " << p2.hp << ".\n\n";
-	if (type_multiplier < 1) cout << "It's not very effective...\n";
-	else if (type_multiplier > 1) cout << "It's super effective!.\n";
-	if (stab) cout << "Same Type Attack Bonus applied. 50% extra damage!\n\n";
-	if (p2.hp == 0) {
-		cout << p2.name << " has fainted. "  << p1.name << " has won!\n\n";
-	}
-	p1.moves.at(choice-1).PP--;
-	if (p1.moves.at(choice-1).PP == 0) p1.moves.erase(p1.moves.begin()+choice-1);
+	print_battle(p1, p2, p2.original_hp, attack_log(p1, move, p2, roll, damage));
+	if (!struggling) p1.moves.at(choice-1).PP--;
 	cout << "ENTER to continue.\n";
 	string temp;
+	if (!struggling) getline(cin, temp);
 	getline(cin, temp);
-	getline(cin, temp);
+	return struggling ? STRUGGLE : choice-1;
 }
 
 
-void explore_fight(Pokemon &p1, Pokemon &p2) {
+//rng is the turn's stream, for the hit and damage roll, and think is for the AI's own choices
+void explore_fight(Pokemon &p1, Pokemon &p2, Rng rng, Rng think, OpponentAI &ai) {
 	//Enemy pokemon attacks your pokemon
 	print_battle(p1, p2, p2.original_hp);
-	int choice = (rand() % MAX_MOVES) + 1;
-	Move move = p1.moves.at(choice-1);
+	//The enemy is side 0 of the search, it falls back on Struggle once it is out of PP
+	BattleState state = make_state(p1, p2);
+	int slot = ai.choose(make_matchup(p1, p2), state, think);
+	int choice = slot + 1;
+	Move move = (slot == STRUGGLE ? struggle_move() : p1.moves.at(slot));
+	recorder.turn(move);
 	cout << p1.name << "'s move.\n\nENTER to continue.\n";
 	string temp;
 	getline(cin, temp);
-	cout << "\n\nEnemy " << p1.name << " used " << move.name << "!\n";
-
-	int type1 = lookup_type(p2.type1);		//defending pokemon's type 1 type-system multiplier (column)
-	int type2 = lookup_type(p2.type2);		//defending pokemon's type 2 type-system multiplier (column)
-	int  move_type = lookup_type(move.type);	//attacking move's type system multiplier (row)
-	float type_multiplier = 1.0;
-	if (lookup_type(p2.type2) != -1) type_multiplier = type_system.at(move_type).at(type1) * type_system.at(move_type).at(type2);
-	else type_multiplier = type_system.at(move_type).at(type1);
-	float damage = (move.power * p1.attack * type_multiplier) / p2.defense;
-	bool stab = false;
-	if (p1.type1 == move.type or p1.type2 == move.type) {
-		damage *= 1.5;
-		stab = true;
-	}
+	Roll roll = roll_move(hit_chance(move), rng);
+	int damage = roll.hit ? calc_damage(p1, move, p2, roll.roll) : 0;
 	p2.hp -= damage;
 	if (p2.hp < 0) p2.hp = 0;
-	print_battle(p1, p2, p2.original_hp);
-	if constexpr (DEBUG) {
-		cout << "type_multiplier(" << type_multiplier << ") = " << type_system.at(move_type).at(type1);
-		if (type2 != -1) cout << " * " << type_system.at(move_type).at(type2) << endl;
-		else cout << endl;
-		cout << "damage(" << damage << ") = p1_move.power(" << move.power << ") * p1.attack(" << p1.attack << ") * type_multiplier(" << type_multiplier << ")] / p2.defense(" << p2.defense << ") " << (stab ? " * STAB(150%)" : "") << ".\n\n";
-	}
-	if (type_multiplier < 1) cout << "It's not very effective...\n";
-	else if (type_multiplier > 1) cout << "It's super effective!.\n";
-	if (stab) cout << "Same Type Attack Bonus applied. 50% extra damage!\n\n";
-	cout << p1.name << " used " << move.name << ", which dealt " << damage << " damage to " << p2.name << ".\n" << p2.name << "'s HP is now " << p2.hp << ".\n\n";
-	if (p2.hp == 0) {
-		cout << p2.name << " has fainted. "  << p1.name << " has won!\n\n";
-	}
-	p1.moves.at(choice-1).PP--;
-	if (p1.moves.at(choice-1).PP == 0) p1.moves.erase(p1.moves.begin()+choice-1);
+	vector<string> log = attack_log(p1, move, p2, roll, damage);
+	log.insert(log.begin(), "Enemy " + p1.name + " used " + move.name + "!");
+	print_battle(p1, p2, p2.original_hp, log);
+	if (slot != STRUGGLE) p1.moves.at(choice-1).PP--;
 	cout << "ENTER to continue.\n";
 	getline(cin, temp);
 }
@@ -434,6 +386,8 @@ void battle_mode() {
 	cout << "Choose a Pokemon for team 2 (enter the name): " << endl;
 	twoP = select_pokemon(pokemon_db);
 	cout << twoP.name << ", I choose you!\n";
+	uint64_t battle = battle_count++;
+	Rng rng(game_seed, battle);
 	//Pick up to four moves for team two's pokemon
 	add_moves(twoP);
 	//Whichever Pokemon has the higher speed goes first
@@ -441,8 +395,7 @@ void battle_mode() {
 
 	(oneP.speed > twoP.speed ? (goesFirst = oneP, goesSecond = twoP) : (goesFirst = twoP, goesSecond = oneP));
 	if (oneP.speed == twoP.speed) {
-		int coin_flip = (rand() % 2);
-		if (coin_flip) {
+		if (rng.coin_flip()) {
 			goesFirst = oneP;
 			goesSecond = twoP;
 		}
@@ -450,23 +403,33 @@ void battle_mode() {
 	cout << "Team one -- " << oneP.name << "'s speed: " << oneP.speed << endl;
 	cout << "Team two -- " << twoP.name << "'s speed: " << twoP.speed << endl;
 	cout << goesFirst.name << " goes first.\n" << goesSecond.name << " goes second.\n";
+	recorder.begin(game_seed, battle, goesFirst, goesSecond, 0);
 	//Have them do damage to each other based on their move * power * type modifier
 	//Target Pokémon reduces damage based on its defense or special defense
-	while (true) {
-		fight(goesFirst, goesSecond);
-		if (goesSecond.hp == 0) {
-			goesSecond.hp = goesSecond.original_hp;
-			break;
+	//The battle itself lives in the history, the two Pokemon are refreshed from it before each turn
+	Pokemon *side[2] = {&goesFirst, &goesSecond};
+	BattleHistory history(make_matchup(goesFirst, goesSecond), make_state(goesFirst, goesSecond));
+	while (winner(history.state()) == -1) {
+		const BattleState &s = history.state();
+		for (int i = 0; i < 2; i++) {
+			side[i]->hp = s.hp[i];
+			for (size_t j = 0; j < side[i]->moves.size() and j < MAX_MOVES; j++) side[i]->moves[j].PP = s.pp[i][j];
 		}
-		fight(goesSecond, goesFirst);
-		if (goesFirst.hp == 0) {
-			goesFirst.hp = goesFirst.original_hp;	
-			break;
+		int me = s.to_move;
+		Rng rng(game_seed, battle, history.turn() + 1);
+		int slot = fight(*side[me], *side[1 - me], rng, &history);
+		if (slot == -1) {
+			recorder.replace_turns(history.played_moves());
+			continue;
 		}
+		history.play(slot, rng);
 	}
+	recorder.end(winner(history.state()));
 }
 
 
+vector<Pokemon> inventory;
+
 Pokemon choose_starter() {
 	Pokemon temp;
 	string name;
@@ -479,8 +442,20 @@ Pokemon choose_starter() {
 	cout << "\n\n\nPlease select your starter pokemon from the following:\n";
 	for (Pokemon p : starters) 
 		cout << p << endl;
+	cout << "(or TEAM to start with the team saved in team.txt)\n";
 	while (true) {
 		getline(cin, name);
+		if (uppercaseify(name) == "TEAM") {
+			vector<Pokemon> team = load_team("team.txt");
+			if (team.empty()) {
+				cout << "No team found in team.txt\n";
+				continue;
+			}
+			//The first member is returned as the starter, the rest go straight into the inventory
+			for (size_t i = 1; i < team.size(); i++) inventory.push_back(team.at(i));
+			temp = team.at(0);
+			break;
+		}
 		for (Pokemon p : starters) {
 			if (uppercaseify(name) == uppercaseify(p.name) or name == to_string(p.index)) {
 				found = true;
@@ -496,19 +471,16 @@ Pokemon choose_starter() {
 	return temp;
 
 }
-vector<Pokemon> inventory;
 
-void explore_battle(string location) {
+void explore_battle(string location, OpponentAI &ai) {
 	turn_off_ncurses();
 	Pokemon oneP, twoP;
+	uint64_t battle = battle_count++;
+	Rng rng(game_seed, battle);
 	//Randomly generate an enemy pokemon
-	int random_index = rand() % pokemon_db.size();
-
-	for (Pokemon p : pokemon_db) {
-		if (p.index == random_index) twoP = p;
-	}
-	if (location == "water") twoP = water_pokemon_db.at(rand() % water_pokemon_db.size()); 
-	print_pokemon(twoP.index);
+	twoP = pokemon_db.at(rng.range(pokemon_db.size()));
+	if (location == "water") twoP = water_pokemon_db.at(rng.range(water_pokemon_db.size()));
+	print_sprite(twoP);
 	cout << "\nWild " << twoP.name << " appeared!\n";
 	while (true) {	
 		cout << "\n1) FIGHT\n2) RUN\n";
@@ -525,11 +497,19 @@ void explore_battle(string location) {
 	} 
 	oneP = select_pokemon(inventory);
 	cout << "Go! " << oneP.name << "!\n";
-	//Pick up to four moves for team one's pokemon
-	add_moves(oneP);
+	//Pick up to four moves for team one's pokemon, or keep the ones it already knows
+	if (oneP.moves.empty()) add_moves(oneP);
+	else {
+		cout << oneP.name << "'s moves: \n\n";
+		for (Move m : oneP.moves) cout << m << endl;
+		cout << "\nENTER to keep these moves, NEW to pick new ones.\n";
+		string answer;
+		getline(cin, answer);
+		if (uppercaseify(answer) == "NEW") add_moves(oneP);
+	}
 	//Randomly generate 4 moves for the enemy
 	for (int i = 0; i < MAX_MOVES; i++) {
-		int random_move = rand() % move_db.size();
+		int random_move = rng.range(move_db.size());
 		twoP.moves.push_back(move_db.at(random_move));
 	}
 	cout << "Enemies moves: " << endl;
@@ -541,8 +521,7 @@ void explore_battle(string location) {
 
 	(oneP.speed > twoP.speed ? (goesFirst = oneP, goesSecond = twoP) : (goesFirst = twoP, goesSecond = oneP));
 	if (oneP.speed == twoP.speed) {
-		int coin_flip = (rand() % 2);
-		if (coin_flip) {
+		if (rng.coin_flip()) {
 			goesFirst = oneP;
 			goesSecond = twoP;
 		}
@@ -550,25 +529,39 @@ void explore_battle(string location) {
 	//Have them do damage to each other based on their move * power * type modifier
 	//Target Pokémon reduces damage based on its defense or special defense
 	string temp;
+	int turn = 0;
+	recorder.begin(game_seed, battle, oneP, twoP, goesFirst.name == oneP.name ? 0 : 1);
 	if (goesFirst.name == oneP.name) {
 		while (true) {
-			fight(oneP, twoP);
+			turn++;
+			fight(oneP, twoP, Rng(game_seed, battle, turn));
 			if (twoP.hp == 0) {
+				recorder.end(0);
 				twoP.hp = twoP.original_hp;
 				inventory.push_back(twoP);
 				cout << twoP.name << " has been added to your inventory.\n\nENTER to continue.\n";
 				getline(cin,temp);
 				break;
 			}
-			explore_fight(twoP, oneP);
-			if (oneP.hp == 0) break;
+			turn++;
+			explore_fight(twoP, oneP, Rng(game_seed, battle, turn), Rng(game_seed, battle, turn | THINK_TURN), ai);
+			if (oneP.hp == 0) {
+				recorder.end(1);
+				break;
+			}
 		}
 	} else {
 		while (true) {
-			explore_fight(twoP, oneP);
-			if (oneP.hp == 0) break;
-			fight(oneP, twoP);
+			turn++;
+			explore_fight(twoP, oneP, Rng(game_seed, battle, turn), Rng(game_seed, battle, turn | THINK_TURN), ai);
+			if (oneP.hp == 0) {
+				recorder.end(1);
+				break;
+			}
+			turn++;
+			fight(oneP, twoP, Rng(game_seed, battle, turn));
 			if (twoP.hp == 0) {
+				recorder.end(0);
 				twoP.hp = twoP.original_hp;
 				inventory.push_back(twoP);
 				cout << twoP.name << " has been added to your inventory.\n\nENTER to continue.\n";
@@ -579,19 +572,226 @@ void explore_battle(string location) {
 	}
 }
 
+//Battles every species against every other species and ranks them
+void tournament_mode() {
+	cout << "Which move policy should the Pokémon use?\n1) Random\n2) Greedy (strongest move)\n";
+	int choice = 0;
+	cin >> choice;
+	if (!cin || choice < 1 || choice > 2) die();
+	Policy policy = (choice == 1 ? Policy::RANDOM : Policy::GREEDY);
+	cout << "How many battles per pairing?\n";
+	int reps = 0;
+	cin >> reps;
+	if (!cin || reps <= 0) die();
+
+	hrc::time_point start = hrc::now();
+	Tournament t = run_tournament(pokemon_db, policy, reps, game_seed);
+	chrono::duration<double> elapsed = hrc::now() - start;
+	cout << "Ran " << pokemon_db.size() * (pokemon_db.size() - 1) / 2 * reps << " battles on " << WorkStealer::default_threads() << " threads in " << elapsed.count() << " seconds.\n";
+
+	save_win_matrix(t, pokemon_db, "tournament.csv");
+	cout << "Win matrix saved to tournament.csv\n\n";
+	vector<size_t> ranking(t.n);
+	for (size_t i = 0; i < t.n; i++) ranking[i] = i;
+	sort(ranking.begin(), ranking.end(), [&](size_t a, size_t b) { return t.rating[a] > t.rating[b]; });
+	cout << "Rank\tElo\tPokemon\n";
+	for (size_t r = 0; r < ranking.size(); r++)
+		cout << r + 1 << "\t" << lround(t.rating[ranking[r]]) << "\t" << pokemon_db[ranking[r]].name << endl;
+}
+
+//Plays every battle in the battle log again and checks each still ends the same way
+void replay_mode() {
+	hrc::time_point start = hrc::now();
+	ReplayStats stats = replay_log(BATTLE_LOG);
+	chrono::duration<double> elapsed = hrc::now() - start;
+	if (!stats.battles) {
+		cout << "No battles recorded in " << BATTLE_LOG << endl;
+		return;
+	}
+	cout << "Replayed " << stats.battles << " battles (" << stats.turns << " turns) in " << elapsed.count() << " seconds, " << stats.turns / max(elapsed.count(), 1e-9) << " turns per second.\n";
+	cout << stats.mismatches << " battles ended differently under the current rules, " << stats.bad_records << " could not be replayed.\n";
+}
+
+//Shows the damage range of a move and the exact odds of knocking the defender out in each number of hits
+void damage_mode() {
+	cout << "Choose the attacking Pokemon (enter the name): " << endl;
+	Pokemon attacker = select_pokemon(pokemon_db);
+	cout << "Choose its move (enter the name or index): " << endl;
+	Move move;
+	while (true) {
+		string name;
+		getline(cin, name);
+		auto m = find(move_db.begin(), move_db.end(), name);
+		if (m == move_db.end() and !name.empty() and all_of(name.begin(), name.end(), ::isdigit)) m = find(move_db.begin(), move_db.end(), stoi(name));
+		if (m != move_db.end()) {
+			move = *m;
+			break;
+		}
+	}
+	cout << "Choose the defending Pokemon (enter the name): " << endl;
+	Pokemon defender = select_pokemon(pokemon_db);
+
+	hrc::time_point start = hrc::now();
+	vector<double> ko = ko_chances(attacker, move, defender, max(move.PP, 1));
+	chrono::duration<double, milli> elapsed = hrc::now() - start;
+	int low = calc_damage(attacker, move, defender, MIN_ROLL), high = calc_damage(attacker, move, defender, MAX_ROLL);
+	cout << "\n" << attacker.name << "'s " << move.name << " does " << low << "-" << high << " damage to " << defender.name << " (" << defender.hp << " HP) and hits " << hit_chance(move) << "% of the time.\n\n";
+	for (size_t n = 0; n < ko.size(); n++)
+		cout << "KO in " << n + 1 << (n ? " hits: " : " hit: ") << ko[n] * 100 << "%\n";
+	cout << "(worked out in " << elapsed.count() << " ms)\n";
+}
+
+//Works out the exact chance each Pokemon wins a 1v1 with both sides playing perfectly
+void solve_mode() {
+	Pokemon p[2];
+	for (int i = 0; i < 2; i++) {
+		cout << "Choose Pokemon " << i + 1 << " (enter the name): " << endl;
+		p[i] = select_pokemon(pokemon_db);
+		add_moves(p[i]);
+	}
+	Matchup m = make_matchup(p[0], p[1]);
+	BattleState s = make_state(p[0], p[1]);
+	hrc::time_point start = hrc::now();
+	BattleSolver solver(m);
+	if (!solver.solve(s)) {
+		cout << "This battle has too many positions to solve.\n";
+		return;
+	}
+	chrono::duration<double> elapsed = hrc::now() - start;
+	cout << "Solved " << solver.positions() << " positions in " << elapsed.count() << " seconds.\n\n";
+	for (int first = 0; first < 2; first++) {
+		s.set_to_move(first);
+		int slot = solver.best_move(s);
+		double win = solver.value(s);
+		cout << "If " << p[first].name << " goes first, " << p[0].name << " wins " << win * 100 << "% and " << p[1].name << " wins " << (1 - win) * 100 << "%";
+		if (slot != -1) cout << ", best opening: " << (slot == STRUGGLE ? struggle_move() : p[first].moves.at(slot)).name;
+		cout << ".\n";
+	}
+	cout << "(draws count as half a win)\n";
+}
+
+//Asks how hard the wild Pokemon should think about their moves
+unique_ptr<OpponentAI> choose_difficulty() {
+	cout << "\nHow strong should wild Pokémon be?\n1) Normal\n2) Hard (Monte Carlo tree search)\n";
+	string choice;
+	while (true) {
+		getline(cin, choice);
+		if (choice == "1" or uppercaseify(choice) == "NORMAL") return make_unique<ExpectimaxAI>();
+		if (choice == "2" or uppercaseify(choice) == "HARD") return make_unique<MctsAI>();
+	}
+}
+
+//Evolves a team against the meta and saves it for explore mode
+void optimize_mode() {
+	cout << "How many generations should the team evolve for?\n";
+	int generations = 0;
+	cin >> generations;
+	if (!cin || generations <= 0) die();
+	hrc::time_point start = hrc::now();
+	TeamOptimizer optimizer(game_seed, 16, max(4u, WorkStealer::default_threads()));
+	Team best = optimizer.run(generations);
+	chrono::duration<double> elapsed = hrc::now() - start;
+	vector<Pokemon> team = best.pokemon();
+	cout << "Best team wins " << lround(best.fitness * 100) << "% of its battles against the meta (" << optimizer.genomes_evaluated() << " teams tried in " << elapsed.count() << " seconds):\n\n";
+	for (const Pokemon &p : team) {
+		cout << p.name << ": ";
+		for (const Move &m : p.moves) cout << m.name << (&m == &p.moves.back() ? "\n" : ", ");
+	}
+	save_team(team, "team.txt");
+	cout << "\nTeam saved to team.txt, type TEAM when choosing a starter in explore mode to use it.\n";
+}
+
+//Reloads the data files and tells the counter cache which records changed
+void reload_data(CounterCache &cache, string pokemon_file, string types_file, string moves_file) {
+	vector<Pokemon> old_pokemon = pokemon_db;
+	vector<Move> old_moves = move_db;
+	pokemon_db.clear();
+	water_pokemon_db.clear();
+	move_db.clear();
+	load_pokemon_db(pokemon_file, types_file);
+	load_move_db(moves_file);
+	if (pokemon_db.size() != old_pokemon.size() or move_db.size() != old_moves.size()) {
+		cout << "Records were added or removed, starting over.\n";
+		cache = CounterCache(pokemon_db, game_seed);
+		return;
+	}
+	int species_changed = 0, moves_changed = 0;
+	for (size_t i = 0; i < pokemon_db.size(); i++) {
+		if (pokemon_db.at(i) == old_pokemon.at(i)) continue;
+		cache.species_changed(i, pokemon_db.at(i));
+		species_changed++;
+	}
+	for (size_t i = 0; i < move_db.size(); i++) {
+		if (move_db.at(i) == old_moves.at(i)) continue;
+		cache.move_changed(move_db.at(i));
+		moves_changed++;
+	}
+	cout << species_changed << " Pokémon and " << moves_changed << " moves changed.\n";
+}
+
+//Answers "what beats X?" for any species
+void counter_mode(string pokemon_file, string types_file, string moves_file) {
+	CounterCache cache(pokemon_db, game_seed);
+	string name;
+	while (true) {
+		cout << "\nEnter a Pokémon to find its best counters (RELOAD to reload the data files, QUIT to stop):\n";
+		getline(cin, name);
+		if (!cin or uppercaseify(name) == "QUIT") break;
+		if (uppercaseify(name) == "RELOAD") {
+			reload_data(cache, pokemon_file, types_file, moves_file);
+			continue;
+		}
+		auto iter = find(pokemon_db.begin(), pokemon_db.end(), name);
+		if (iter == pokemon_db.end()) continue;
+		hrc::time_point start = hrc::now();
+		vector<Counter> counters = cache.counters(iter - pokemon_db.begin());
+		chrono::duration<double, milli> elapsed = hrc::now() - start;
+		cout << "Best counters to " << iter->name << " (" << cache.last_matchups << " matchups battled, " << elapsed.count() << " ms):\n";
+		cout << "Rank\tWin %\tTurns\tPokemon\tMoves\n";
+		for (size_t r = 0; r < counters.size() and r < 10; r++) {
+			const Pokemon &p = cache.species(counters.at(r).species);
+			cout << r + 1 << "\t" << lround(counters.at(r).win_rate * 100) << "\t";
+			if (counters.at(r).turns < MAX_TURNS) cout << counters.at(r).turns;
+			else cout << "-";
+			cout << "\t" << p.name << "\t";
+			for (const Move &m : p.moves) cout << m.name << (&m == &p.moves.back() ? "" : ", ");
+			cout << endl;
+		}
+	}
+}
+
 void explore_mode() {
 	inventory.push_back(choose_starter());
+	unique_ptr<OpponentAI> ai = choose_difficulty();
+	//With a tablebase, known positions are looked up instead of searched
+	Tablebase tablebase;
+	TablebaseAI *lookups = nullptr;
+	if (tablebase.open(TABLEBASE_FILE)) {
+		auto tablebase_ai = make_unique<TablebaseAI>(tablebase, move(ai));
+		lookups = tablebase_ai.get();
+		ai = move(tablebase_ai);
+	}
 	hrc::time_point old_time = hrc::now();
 	turn_on_ncurses(); //Turn on full screen mode
-	Map map;
-	random_device rd;     // only used once to initialise (seed) engine
-	mt19937 gen(rd());    // random-number engine used (Mersenne-Twister in this case)
-	uniform_int_distribution<int> d100(1, 100);
+	Map map(game_seed);
+	Rng rng(game_seed, WORLD_STREAM);
 	int x = Map::SIZE / 2, y = Map::SIZE / 2; //Start in middle of the world
+	uint64_t battles_drawn = battle_count;
+	const int STATUS_LINES = 2; //Position and FPS, under the map
+	const char *fps_env = getenv("POKEMON_FPS");
+	FrameLoop frames(fps_env ? max(atof(fps_env), 1.0) : FRAME_RATE);
 	while (true) {
-		int ch = getch(); // Wait for user input, with TIMEOUT delay
+		int ch = frames.next(); // Sleep until a key arrives or it is time to draw
 		if (ch == 'q' || ch == 'Q') break;
-		else if (ch == RIGHT) {
+		else if (ch == 'm' || ch == 'M') {
+			map.show_minimap(!map.minimap_shown());
+			continue;
+		} else if (ch == KEY_RESIZE) {
+			//ncurses has already picked up the new LINES and COLS, the view follows at the next frame
+			clear();
+			map.invalidate();
+			continue;
+		} else if (ch == RIGHT) {
 			if (map.get(x + 1, y) == Map::WALL) {
 				continue;
 			} else if (map.get(x + 1, y) == Map::WATER) {	//WRK - implement water type pokemon battles in water areas
@@ -609,7 +809,7 @@ void explore_mode() {
 					map.set(x, y, Map::WATER);
 					if (x < 0) x = 0;
 				} else continue;
-				if (d100(gen) <= 30) explore_battle("water");
+				if (rng.d100() <= 30) explore_battle("water", *ai);
 			} else if (map.get(x + 1, y) != Map::WATER and map.get(x, y) == Map::WATER) {
 				map.set(x, y, Map::WATER);
 				x++;
@@ -630,7 +830,7 @@ void explore_mode() {
 					map.set(x, y, Map::GRASS);
 					if (x < 0) x = 0;
 				} else continue;
-				if (d100(gen) <= 30) explore_battle("grass");
+				if (rng.d100() <= 30) explore_battle("grass", *ai);
 			} else if (map.get(x + 1, y) != Map::WATER) {
 				map.set(x, y, Map::OPEN);
 				x++;
@@ -655,7 +855,7 @@ void explore_mode() {
 					map.set(x, y, Map::WATER);
 					if (x < 0) x = 0;
 				} else continue;
-				if (d100(gen) <= 30) explore_battle("water");
+				if (rng.d100() <= 30) explore_battle("water", *ai);
 			} else if (map.get(x - 1, y) != Map::WATER and map.get(x, y) == Map::WATER) {
 				map.set(x, y, Map::WATER);
 				x--;
@@ -676,7 +876,7 @@ void explore_mode() {
 					map.set(x, y, Map::GRASS);
 					if (x < 0) x = 0;
 				} else continue;
-				if (d100(gen) <= 20) explore_battle("grass");
+				if (rng.d100() <= 20) explore_battle("grass", *ai);
 			} else if (map.get(x - 1, y) != Map::WATER) {
 				map.set(x, y, Map::OPEN);
 				x--;
@@ -701,7 +901,7 @@ void explore_mode() {
 					map.set(x, y, Map::WATER);
 					if (x < 0) x = 0;
 				} else continue;
-				if (d100(gen) <= 30) explore_battle("water");
+				if (rng.d100() <= 30) explore_battle("water", *ai);
 			} else if (map.get(x, y + 1) != Map::WATER and map.get(x, y) == Map::WATER) {
 				map.set(x, y, Map::WATER);
 				y++;
@@ -722,7 +922,7 @@ void explore_mode() {
 					map.set(x, y, Map::GRASS);
 					if (x < 0) x = 0;
 				} else continue;
-				if (d100(gen) <= 30) explore_battle("grass");
+				if (rng.d100() <= 30) explore_battle("grass", *ai);
 			} else if (map.get(x, y + 1) != Map::WATER) {
 				map.set(x, y, Map::OPEN);
 				y++;
@@ -747,7 +947,7 @@ void explore_mode() {
 					map.set(x, y, Map::WATER);
 					if (x < 0) x = 0;
 				} else continue;
-				if (d100(gen) <= 30) explore_battle("water");
+				if (rng.d100() <= 30) explore_battle("water", *ai);
 			} else if (map.get(x, y - 1) != Map::WATER and map.get(x, y) == Map::WATER) {
 				map.set(x, y, Map::WATER);
 				y--;
@@ -768,38 +968,116 @@ void explore_mode() {
 					map.set(x, y, Map::GRASS);
 					if (x < 0) x = 0;
 				} else continue;
-				if (d100(gen) <= 30) explore_battle("grass");
+				if (rng.d100() <= 30) explore_battle("grass", *ai);
 			} else if (map.get(x, y - 1) != Map::WATER) {
 				map.set(x, y, Map::OPEN);
 				y--;
 				map.set(x, y, Map::TRAINER);
 			}
-		} else if (ch == ERR) { //No keystroke
-			; //Do nothing
 		}
+		if (ch != ERR) continue; //Draw once the keys waiting are handled and a frame is due
 		//clear(); //Uncomment these lines if the code is drawing garbage
+		//A battle clears the screen, so the whole map has to be drawn again
+		if (battle_count != battles_drawn) {
+			map.invalidate();
+			battles_drawn = battle_count;
+		}
+		//Fill the terminal, keeping room for the status lines under the map
+		if (map.resize(LINES - STATUS_LINES, COLS)) clear();
 		map.draw(x, y);
-		mvprintw(Map::DISPLAY + 1, 0, "X: %i Y: %i\n", x, y);
-		usleep(10000); //pause for 10000 us
-		//refresh(); //Uncomment these lines if the code is drawing garbage
+		mvprintw(map.view_rows(), 0, "X: %i Y: %i\n", x, y);
 		hrc::time_point new_time = hrc::now();
 		chrono::duration<double> time_span = chrono::duration_cast<chrono::duration<double>>(new_time - old_time);
-		mvprintw(Map::DISPLAY + 2, 0, "FPS: %5.1f\n", 1 / time_span.count());
+		mvprintw(map.view_rows() + 1, 0, "FPS: %5.1f\n", 1 / time_span.count());
 		old_time = new_time;
+		refresh();
+		frames.drew();
 	}
 	//Exit NCURSES
 	clear();
 	endwin(); // End curses mode
-	system("clear");
+	clear_screen();
+	if (lookups) cout << "The tablebase answered " << lround(lookups->hit_rate() * 100) << "% of the enemy's moves, the rest were searched.\n";
 }
 
-int main() {
+int main(int argc, char **argv) {
 #ifndef MADE_USING_MAKEFILE
 	static_assert(0, "Compile this code using 'make' not 'compile.");
 #endif
-	srand(time(0));
-	system("figlet POKEMON");
-	system("figlet ++ and \\#");
+	screen_output.install(); //cout goes out a screen at a time, see terminal.h
+	send_output_on_crash();
+	//Set POKEMON_SEED to replay a run exactly
+	const char *seed_env = getenv("POKEMON_SEED");
+	game_seed = seed_env ? stoull(seed_env) : time(0);
+	//Set POKEMON_SPRITES to a pack from sprite_pack.cc to draw a custom dex
+	const char *sprites_env = getenv("POKEMON_SPRITES");
+	if (sprites_env and !load_sprite_pack(sprites_env)) die("Couldn't load sprite pack "s + sprites_env);
+	//Set POKEMON_UNICODE to draw sprites in color with half blocks, see halfblock.h. It can be
+	//truecolor, 256 or 16 to say what the terminal can show, anything else asks the environment.
+	const char *unicode_env = getenv("POKEMON_UNICODE");
+	bool render_bench = argc > 1 and argv[1] == "--render-bench"s;
+	if (unicode_env and *unicode_env and (isatty(STDOUT_FILENO) or render_bench)) {
+		string depth = unicode_env;
+		half_block_sprites().enable(depth == "truecolor" ? ColorDepth::TRUECOLOR : depth == "256" ? ColorDepth::ANSI256 : depth == "16" ? ColorDepth::ANSI16 : detect_color_depth());
+	}
+
+	//a.out --batch FILE runs the battle specs in FILE (- for stdin) without any prompts, see batch.h
+	if (argc > 1 and argv[1] == "--batch"s) {
+		if (argc != 3) die("Usage: "s + argv[0] + " --batch FILE");
+		load_pokemon_db("pokemon.txt", "types.txt");
+		load_move_db("moves.txt");
+		load_type_system("type_system.txt");
+		string filename = argv[2];
+		ifstream file;
+		if (filename != "-") {
+			file.open(filename);
+			if (!file) die("Couldn't load "s + filename);
+		}
+		run_batch(filename == "-" ? cin : file, cout, game_seed);
+		return 0;
+	}
+	//a.out --render-bench [FRAMES] times the battle screen compositor without drawing anything
+	if (render_bench) {
+		if (argc > 3) die("Usage: "s + argv[0] + " --render-bench [FRAMES]");
+		size_t frames = argc == 3 ? stoull(argv[2]) : 100000;
+		load_pokemon_db("pokemon.txt", "types.txt");
+		load_move_db("moves.txt");
+		load_type_system("type_system.txt");
+		RenderStats stats = benchmark_render(pokemon_db, frames, game_seed);
+		cout << "Composed " << stats.frames << " battle screens in " << stats.seconds << " seconds, " << stats.frames / max(stats.seconds, 1e-9) << " frames per second.\n";
+		cout << "The terminal would get " << stats.full_bytes / max<size_t>(stats.frames, 1) << " bytes a frame redrawing everything, " << stats.diff_bytes / max<size_t>(stats.frames, 1) << " sending changes.\n";
+		return 0;
+	}
+	//a.out --render-check [FRAMES] plays what the terminal would get on a model screen and checks every
+	//frame against the memory backend, no terminal needed. Exits with 1 if any frame differs.
+	if (argc > 1 and argv[1] == "--render-check"s) {
+		if (argc > 3) die("Usage: "s + argv[0] + " --render-check [FRAMES]");
+		size_t frames = argc == 3 ? stoull(argv[2]) : 10000;
+		load_pokemon_db("pokemon.txt", "types.txt");
+		load_move_db("moves.txt");
+		load_type_system("type_system.txt");
+		RenderStats stats = benchmark_render(pokemon_db, frames, game_seed, true);
+		cout << "Checked " << stats.checked << " of " << stats.frames << " battle screens against the memory backend, " << stats.mismatches << " differed.\n";
+		return stats.mismatches ? 1 : 0;
+	}
+	//a.out --tablebase [FILE] solves every pair of species with their default movesets for explore mode
+	if (argc > 1 and argv[1] == "--tablebase"s) {
+		if (argc > 3) die("Usage: "s + argv[0] + " --tablebase [FILE]");
+		string filename = argc == 3 ? argv[2] : TABLEBASE_FILE;
+		load_pokemon_db("pokemon.txt", "types.txt");
+		load_move_db("moves.txt");
+		load_type_system("type_system.txt");
+		vector<Pokemon> dex = pokemon_db;
+		for (Pokemon &p : dex) p.moves = default_moveset(p);
+		hrc::time_point start = hrc::now();
+		TablebaseStats stats = build_tablebase(dex, filename);
+		chrono::duration<double> elapsed = hrc::now() - start;
+		cout << "Solved " << stats.solved << " of " << stats.pairs << " matchups (" << stats.positions << " positions) into " << filename << " in " << elapsed.count() << " seconds.\n";
+		if (stats.solved < stats.pairs) cout << stats.pairs - stats.solved << " matchups had too many positions and were skipped, the AI searches those.\n";
+		return 0;
+	}
+	if constexpr(DEBUG) cout << "Seed: " << game_seed << endl;
+	term_write(banner("POKEMON") + banner("++ and #"));
 	cout << "Do you want to use the Gen1 Pokémon? (Type \"NO\" for no, anything else for yes.)\n";
 	string answer;
 	getline(cin, answer);
@@ -857,10 +1135,10 @@ int main() {
 		}
 	}
 
-	cout << "Do you want to\n1) Print Pokémon Data?\n2) Print Move Data?\n3) Pokemon Battle (1v1)\n4) Explore the World?\n";
+	cout << "Do you want to\n1) Print Pokémon Data?\n2) Print Move Data?\n3) Pokemon Battle (1v1)\n4) Explore the World?\n5) Run a Tournament?\n6) Find Counters?\n7) Optimize a Team?\n8) Replay the Battle Log?\n9) Damage Calculator?\n10) Solve a Matchup?\n";
 	int choice = 0;
 	cin >> choice;
-	if (!cin || choice < 1 || choice > 4) die();
+	if (!cin || choice < 1 || choice > 10) die();
 	if (choice == 1) {
 		cout << "Please enter the Pokedex number of the Pokémon whose data you want to print:\n";
 		int index = 0;
@@ -885,5 +1163,11 @@ int main() {
 	}
 	if (choice == 3) battle_mode(); 
 	if (choice == 4) explore_mode();
+	if (choice == 5) tournament_mode();
+	if (choice == 6) counter_mode(filename1, filename2, filename3);
+	if (choice == 7) optimize_mode();
+	if (choice == 8) replay_mode();
+	if (choice == 9) damage_mode();
+	if (choice == 10) solve_mode();
 	else return 0;
 }
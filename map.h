@@ -1,12 +1,84 @@
 #pragma once
 #include <vector>
 #include <string>
-#include <random>
+#include <algorithm>
+#include <cstdlib>
+#include "rng.h"
+#include "minimap.h"
 #include <ncurses.h>
 using namespace std;
 
+#ifdef UNICODE_TILES
+//Built with "make unicode", against ncursesw: tiles are wide characters with Unicode glyphs
+typedef cchar_t Tile;
+#define TILE_LINE(name) (*WACS_##name)
+void put_tiles(int y, int x, const Tile *tiles, int n) { mvadd_wchnstr(y, x, tiles, n); }
+#else
+typedef chtype Tile;
+#define TILE_LINE(name) ACS_##name
+void put_tiles(int y, int x, const Tile *tiles, int n) { mvaddchnstr(y, x, tiles, n); }
+#endif
+
 class Map {
 	vector<vector<char>> map;
+	//The tiles on screen from the last draw, row by row, and the world coordinates of its top left
+	//corner. 0 marks a cell that has to be drawn.
+	vector<char> shown;
+	int shown_x = -1, shown_y = -1;
+	Tile tiles[256];	//Each tile with its color pair
+	Tile marker;	//The player on the minimap
+	vector<Tile> cells;	//One row of the view, reused by every draw
+
+	struct Rect {
+		int x, y, w, h;
+	};
+	Rect view = {0, 0, 0, 0};	//Where the map goes on screen
+	Rect camera = {0, 0, 0, 0};	//The part of the world it shows, always inside the world
+	int aimed_x = -1, aimed_y = -1;	//Where the camera was last centered
+	MipPyramid mips{minimap_tile};
+	bool minimap = true;
+	int minimap_level = 0;
+	Rect covered = {0, 0, 0, 0};	//The top right corner of the view the minimap is drawn over
+
+	//On the minimap the trainer is drawn on its own, not as terrain
+	static char minimap_tile(char c) { return c == TRAINER ? OPEN : c; }
+	//Picks the most detailed level that fits in a third of the view's width and half its height,
+	//border included, and sets aside the corner for it. Nothing if the minimap is off or too big.
+	void place_minimap() {
+		covered = {0, 0, 0, 0};
+		if (!minimap) return;
+		int k = 1;
+		while (k < mips.count() and (mips.width(k) + 1 > view.w / 3 or mips.height(k) + 1 > view.h / 2)) k++;
+		if (mips.width(k) + 1 > view.w or mips.height(k) + 1 > view.h) return;
+		minimap_level = k;
+		covered = {view.w - mips.width(k) - 1, 0, mips.width(k) + 1, mips.height(k) + 1};
+	}
+	//Draws the minimap with the player at (x,y) into the covered corner, with a border on its left
+	//and bottom. It is small, so it is all sent every frame; ncurses passes on just the changes.
+	void draw_minimap(int x, int y) {
+		const int k = minimap_level, w = mips.width(k), h = mips.height(k);
+		for (int r = 0; r < h; r++) {
+			cells[0] = TILE_LINE(VLINE);
+			for (int c = 0; c < w; c++) cells[c + 1] = tiles[(unsigned char) mips.at(k, c, r)];
+			if (r == y >> k) cells[(x >> k) + 1] = marker;
+			put_tiles(view.y + covered.y + r, view.x + covered.x, cells.data(), w + 1);
+		}
+		cells[0] = TILE_LINE(LLCORNER);
+		fill(cells.begin() + 1, cells.begin() + w + 1, TILE_LINE(HLINE));
+		put_tiles(view.y + covered.y + h, view.x + covered.x, cells.data(), w + 1);
+	}
+
+	//Centers the camera on (x,y), pushed back inside the world at the edges. Only worked out again
+	//when the player moves or the view is resized.
+	void aim(int x, int y) {
+		if (x == aimed_x and y == aimed_y) return;
+		aimed_x = x;
+		aimed_y = y;
+		camera.w = view.w;
+		camera.h = view.h;
+		camera.x = clamp(x - view.w / 2, 0, int(SIZE) - view.w);
+		camera.y = clamp(y - view.h / 2, 0, int(SIZE) - view.h);
+	}
   public:
 	static const char TRAINER  = 'T';
 	static const char WALL     = '#';
@@ -14,12 +86,10 @@ class Map {
 	static const char WATER    = '~';
 	static const char OPEN     = ' ';
 	static const size_t SIZE = 100; //World is a 100x100 map
-	static const size_t DISPLAY = 20; //Show a 20x20 area at a time
-	//Randomly generate map
-	void init_map() {
-		random_device rd;     // only used once to initialise (seed) engine
-		mt19937 gen(rd());    // random-number engine used (Mersenne-Twister in this case)
-		uniform_int_distribution<int> d100(1, 100);
+	static const int DEFAULT_VIEW = 21; //Show a 21x21 area until resize() says how big the terminal is
+	//Randomly generate map, the same seed always makes the same map
+	void init_map(uint64_t seed) {
+		Rng rng(seed, MAP_STREAM);
 		map.clear();
 		map.resize(SIZE); //100 rows tall
 		for (auto &v : map) v.resize(SIZE, ' '); //100 columns wide
@@ -31,78 +101,130 @@ class Map {
 				else if (i == SIZE / 2 and j == SIZE / 2)
 					map.at(i).at(j) = TRAINER;
 				else {
-					if (d100(gen) <= 10) { //10% each spot is WALL
+					if (rng.d100() <= 10) { //10% each spot is WALL
 						map.at(i).at(j) = WALL;
 					}
-					else if (d100(gen) <= 1) { //1% each spot is water
+					else if (rng.d100() <= 1) { //1% each spot is water
 						map.at(i).at(j) = WATER;
-					} else if (d100(gen) <= 60) {
+					} else if (rng.d100() <= 60) {
 						if (map.at(i - 1).at(j) == WATER or map.at(i + 1).at(j) == WATER or map.at(i).at(j - 1) == WATER or map.at(i).at(j + 1) == WATER)
 							map.at(i).at(j) = WATER;
 					}
-					else if (d100(gen) <= 15) { //15% each spot is GRASS
+					else if (rng.d100() <= 15) { //15% each spot is GRASS
 						map.at(i).at(j) = GRASS;
-					} else if (d100(gen) <= 100) {
+					} else if (rng.d100() <= 100) {
 						if (map.at(i - 1).at(j) == GRASS or map.at(i + 1).at(j) == GRASS or map.at(i).at(j - 1) == GRASS or map.at(i).at(j + 1) == GRASS)
 							map.at(i).at(j) = GRASS;
 					}
 				}
 			}
 		}
+		mips.build(map);
 	}
-	//Draw the DISPLAY tiles around coordinate (x,y)
+	//Draw the tiles the camera sees around coordinate (x,y). Only the cells that changed since the
+	//last draw are sent to ncurses. Moving up or down scrolls the rows already on screen, so the
+	//terminal moves them itself and just the new row is drawn; moving sideways redraws the cells that
+	//differ. The minimap, if it is on, goes over the top right corner, which the tiles leave alone.
+	//Call invalidate() after anything else has drawn over the map.
 	void draw(int x, int y) {
-		int start_x = x - DISPLAY / 2;
-		int end_x = x + DISPLAY / 2;
-		int start_y = y - DISPLAY / 2;
-		int end_y = y + DISPLAY / 2;
-
-		//Bounds check to handle the edges
-		if (start_x < 0) {
-			end_x = end_x - start_x;
-			start_x = 0;
-		}
-		if (end_x > int(SIZE - 1)) {
-			start_x = start_x - (end_x - (SIZE - 1));
-			end_x = SIZE - 1;
-		}
-		if (start_y < 0) {
-			end_y = end_y - start_y;
-			start_y = 0;
-		}
-		if (end_y > int(SIZE - 1)) {
-			start_y = start_y - (end_y - (SIZE - 1));
-			end_y = SIZE - 1;
+		aim(x, y);
+		const int w = view.w, h = view.h;
+		int dy = camera.y - shown_y;
+		if (shown_y != -1 and dy != 0 and abs(dy) < h) {
+			//Scroll just the map rows, the lines under it stay put
+			scrollok(stdscr, TRUE);
+			idlok(stdscr, TRUE);
+			setscrreg(0, h - 1);
+			scrl(dy);
+			setscrreg(0, LINES - 1);
+			scrollok(stdscr, FALSE);
+			if (dy > 0) {
+				copy(shown.begin() + dy * w, shown.end(), shown.begin());
+				fill(shown.end() - dy * w, shown.end(), 0);
+			} else {
+				copy_backward(shown.begin(), shown.end() + dy * w, shown.end());
+				fill(shown.begin(), shown.begin() - dy * w, 0);
+			}
 		}
+		shown_x = camera.x;
+		shown_y = camera.y;
 
-		//Now draw the map using NCURSES
-		for (int i = start_y; i <= end_y; i++) {
-			for (int j = start_x; j <= end_x; j++) {
-				//if (i == cursor_x && j == cursor_y)
-				//  attron(A_UNDERLINE | A_BOLD);
-				int color = 1;
-				if (map.at(i).at(j) == WALL)
-					color = 5;
-				else if (map.at(i).at(j) == WATER)
-					color = 2;
-				else if (map.at(i).at(j) == TRAINER)
-					color = 3;
-
-				attron(COLOR_PAIR(color));
-				mvaddch(i - start_y, j - start_x, map.at(i).at(j));
-				attroff(COLOR_PAIR(color));
-				//attroff(A_UNDERLINE | A_BOLD);
+		//Now draw the map using NCURSES, one call for the changed span of each row. The color pairs
+		//are part of each tile, so a span with several colors is still one write.
+		for (int r = 0; r < h; r++) {
+			const char *row = &map[camera.y + r][camera.x];
+			char *on_screen = &shown[r * w];
+			//Under the minimap the cells are left marked as needing a draw, for when it goes away
+			int width = r < covered.y + covered.h ? covered.x : w;
+			fill(on_screen + width, on_screen + w, 0);
+			int first = 0, last = width - 1;
+			while (first < width and on_screen[first] == row[first]) first++;
+			if (first == width) continue;
+			while (on_screen[last] == row[last]) last--;
+			for (int j = first; j <= last; j++) {
+				on_screen[j] = row[j];
+				cells[j - first] = tiles[(unsigned char) row[j]];
 			}
+			put_tiles(view.y + r, view.x + first, cells.data(), last - first + 1);
 		}
+		if (covered.w) draw_minimap(x, y);
 	}
+	//Forget what is on screen, so the next draw paints every cell
+	void invalidate() {
+		shown.assign(size_t(view.w) * view.h, 0);
+		shown_x = shown_y = -1;
+	}
+	//Sizes the view to rows x cols of the screen, or the whole world if that is smaller. Returns true
+	//if the size changed, in which case the screen should be cleared before the next draw.
+	bool resize(int rows, int cols) {
+		int w = clamp(cols, 1, int(SIZE)), h = clamp(rows, 1, int(SIZE));
+		if (w == view.w and h == view.h) return false;
+		view = {0, 0, w, h};
+		cells.resize(w);
+		aimed_x = aimed_y = -1;
+		place_minimap();
+		invalidate();
+		return true;
+	}
+	//Turns the minimap overlay on or off
+	void show_minimap(bool on) {
+		minimap = on;
+		place_minimap();
+	}
+	bool minimap_shown() const { return minimap; }
+	//Size of the view on screen; the map takes rows 0 to view_rows() - 1
+	int view_rows() const { return view.h; }
+	int view_cols() const { return view.w; }
 
 	void set(int x, int y, char c) {
 		map.at(y).at(x) = c;
+		mips.update(map, x, y);
 	}
 	char get(int x, int y) {
 		return map.at(y).at(x);
 	}
-	Map() {
-		init_map();
+	Map(uint64_t seed) {
+		for (int c = 0; c < 256; c++) {
+			int color = 1;
+			if (c == WALL)
+				color = 5;
+			else if (c == WATER)
+				color = 2;
+			else if (c == TRAINER)
+				color = 3;
+#ifdef UNICODE_TILES
+			wchar_t glyph[2] = {wchar_t(c), 0};
+			if (c == WALL) glyph[0] = L'\u2593';	//▓
+			else if (c == WATER) glyph[0] = L'\u2248';	//≈
+			else if (c == GRASS) glyph[0] = L'\u2591';	//░
+			setcchar(&tiles[c], glyph, A_NORMAL, color, nullptr);
+			if (c == TRAINER) setcchar(&marker, glyph, A_BOLD, color, nullptr);
+#else
+			tiles[c] = chtype((unsigned char) c) | COLOR_PAIR(color);
+			if (c == TRAINER) marker = tiles[c] | A_BOLD;
+#endif
+		}
+		init_map(seed);
+		resize(DEFAULT_VIEW, DEFAULT_VIEW);
 	}
 };
@@ -0,0 +1,135 @@
+#pragma once
+#include <chrono>
+#include <cmath>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "ai.h"
+#include "scheduler.h"
+using namespace std;
+
+//Milliseconds the tree search opponent gets per move
+const int MCTS_BUDGET_MS = 20;
+
+//Monte Carlo tree search opponent.
+//Several threads share one tree. Each one walks down it with UCT, plays the rest of the battle out
+//with the headless rules, and adds the result to every node it passed. A thread marks its path with
+//a virtual loss on the way down so the others spread out to different lines instead of piling on.
+//Nodes are keyed by moves only and outcomes are drawn fresh on every walk, so misses and damage
+//rolls are averaged over rather than stored.
+//There is no lock on the tree. Visits and wins are atomics on each node, and nodes come out of a
+//pool allocated once, so the tree never moves; a thread expands a node by claiming a slot from the
+//pool and swapping it into the parent's child link, and if another thread got there first the slot
+//is just left unused. Once the pool is full the tree stops growing and walks end at its leaves.
+class MctsAI : public OpponentAI {
+	static const int POOL_NODES = 1 << 16;
+	struct Node {
+		int mover = 0;	//Side that made the move leading here
+		atomic<int> visits{0};	//Includes walks still in progress (virtual losses)
+		atomic<int> half_wins{0};	//Twice the wins for the mover, so a draw is a whole 1
+		array<atomic<int>, MAX_MOVES + 1> child;	//Node index for each move slot, -1 if not expanded
+	};
+	vector<Node> tree;
+	atomic<int> used{0};	//Nodes handed out from tree
+	chrono::microseconds budget;
+	unsigned threads;
+	WorkStealer pool;
+
+	//A fresh node from the pool, or -1 if it is used up
+	int new_node(int mover) {
+		int i = used.fetch_add(1, memory_order_relaxed);
+		if (i >= int(tree.size())) return -1;
+		Node &node = tree[i];
+		node.mover = mover;
+		node.visits.store(0, memory_order_relaxed);
+		node.half_wins.store(0, memory_order_relaxed);
+		for (atomic<int> &c : node.child) c.store(-1, memory_order_relaxed);
+		return i;
+	}
+	int select_child(const Node &node, const array<int, MAX_MOVES> &moves, int n) const {
+		float log_visits = log(float(max(node.visits.load(memory_order_relaxed), 1)));
+		int best = moves[0];
+		float best_score = -1;
+		for (int i = 0; i < n; i++) {
+			const Node &c = tree[node.child[moves[i]].load(memory_order_acquire)];
+			int visits = c.visits.load(memory_order_relaxed);
+			//A child another thread has only just added hasn't been counted yet, try it first
+			float score = visits ? c.half_wins.load(memory_order_relaxed) / (2.0f * visits) + 1.4f * sqrt(log_visits / visits) : 1e9f;
+			if (score > best_score) {
+				best_score = score;
+				best = moves[i];
+			}
+		}
+		return best;
+	}
+
+	//Random playout that favors the strongest move, returns the winner (-1 for a draw)
+	static int playout(const Matchup &m, BattleState s, Rng &rng) {
+		while (winner(s) == -1 and s.turn < MAX_TURNS)
+			play_move(m, s, choose_move(rng.range(4) ? Policy::GREEDY : Policy::RANDOM, m, s, rng), rng);
+		return winner(s);
+	}
+
+	void worker(const Matchup &m, const BattleState &root, Rng rng, chrono::steady_clock::time_point deadline) {
+		vector<int> path;
+		while (chrono::steady_clock::now() < deadline) {
+			BattleState s = root;
+			path.assign(1, 0);
+			tree[0].visits.fetch_add(1, memory_order_relaxed);
+			while (winner(s) == -1 and s.turn < MAX_TURNS) {
+				Node &node = tree[path.back()];
+				array<int, MAX_MOVES> moves;
+				int n = legal_moves(m, s, moves);
+				int slot = -1, next = -1;
+				for (int i = 0; i < n and slot == -1; i++)
+					if (node.child[moves[i]].load(memory_order_acquire) == -1) slot = moves[i];
+				bool expand = false;
+				if (slot != -1) {
+					int fresh = new_node(s.to_move);
+					if (fresh == -1) break;	//Pool is full, play out from here
+					int expected = -1;
+					//Release, so a thread that follows the link sees the node set up
+					expand = node.child[slot].compare_exchange_strong(expected, fresh, memory_order_acq_rel);
+					next = expand ? fresh : expected;
+				} else {
+					slot = select_child(node, moves, n);
+					next = node.child[slot].load(memory_order_acquire);
+				}
+				path.push_back(next);
+				tree[next].visits.fetch_add(1, memory_order_relaxed);	//Virtual loss until the playout comes back
+				play_move(m, s, slot, rng);
+				if (expand) break;
+			}
+			int w = playout(m, s, rng);
+			for (int i : path) {
+				Node &node = tree[i];
+				node.half_wins.fetch_add(w == -1 ? 1 : w == node.mover ? 2 : 0, memory_order_relaxed);
+			}
+		}
+	}
+  public:
+	MctsAI(chrono::microseconds budget = chrono::milliseconds(MCTS_BUDGET_MS), unsigned threads = WorkStealer::default_threads()) : tree(POOL_NODES), budget(budget), threads(threads) {}
+
+	//Returns the most visited move once the time budget runs out
+	int choose(const Matchup &matchup, const BattleState &s, Rng &rng) override {
+		array<int, MAX_MOVES> moves;
+		int n = legal_moves(matchup, s, moves);
+		if (n == 1) return moves[0];
+		used.store(0, memory_order_relaxed);
+		new_node(1 - s.to_move);
+		auto deadline = chrono::steady_clock::now() + budget;
+		uint64_t seed = rng.next();
+		//One task per thread, each searching until the deadline
+		pool.run(threads, [&](size_t t) { worker(matchup, s, Rng(seed, t), deadline); }, threads);
+
+		int best = moves[0], best_visits = -1;
+		for (int i = 0; i < n; i++) {
+			int c = tree[0].child[moves[i]].load(memory_order_relaxed);
+			if (c != -1 and tree[c].visits.load(memory_order_relaxed) > best_visits) {
+				best_visits = tree[c].visits.load(memory_order_relaxed);
+				best = moves[i];
+			}
+		}
+		return best;
+	}
+};
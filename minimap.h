@@ -0,0 +1,90 @@
+#pragma once
+#include <vector>
+using namespace std;
+
+//Mip pyramid for the minimap.
+//Level 0 is the world itself. Each level above it is half as big (rounded up), with every cell
+//standing for a 2x2 block of the level below by whichever terrain covers most of it. The levels are
+//built once for a new map, and a changed tile only redoes the one cell above it on each level, so
+//drawing the minimap never has to look at the whole world.
+
+class MipPyramid {
+	struct Level {
+		int w = 0, h = 0;
+		vector<char> cells;
+		char at(int x, int y) const { return cells[size_t(y) * w + x]; }
+	};
+	vector<Level> levels;	//levels[0] is level 1, the world is kept by the map
+	char (*summarize)(char);	//What a world tile counts as on the minimap
+
+	//Which of a block's tiles wins: the most common, and on a tie the rarer kind of terrain, which is
+	//listed first, so small lakes don't vanish into the grass around them
+	static char dominant(const char *tiles, int n) {
+		static const char RARITY[] = "~,# ";
+		char best = tiles[0];
+		int best_count = 0, best_rank = 0;
+		for (int i = 0; i < n; i++) {
+			int count = 0, rank = 0;
+			for (int j = 0; j < n; j++) count += tiles[j] == tiles[i];
+			while (RARITY[rank] and RARITY[rank] != tiles[i]) rank++;
+			if (count > best_count or (count == best_count and rank < best_rank)) {
+				best = tiles[i];
+				best_count = count;
+				best_rank = rank;
+			}
+		}
+		return best;
+	}
+	//Works out cell (x,y) of level k (1 and up) from the level below it, returns true if it changed
+	bool refresh_cell(const vector<vector<char>> &world, int k, int x, int y) {
+		Level &level = levels[k - 1];
+		char tiles[4];
+		int n = 0;
+		for (int dy = 0; dy < 2; dy++) {
+			for (int dx = 0; dx < 2; dx++) {
+				int cx = 2 * x + dx, cy = 2 * y + dy;
+				if (k == 1) {
+					if (cy < int(world.size()) and cx < int(world[cy].size())) tiles[n++] = summarize(world[cy][cx]);
+				} else {
+					const Level &below = levels[k - 2];
+					if (cy < below.h and cx < below.w) tiles[n++] = below.at(cx, cy);
+				}
+			}
+		}
+		char c = dominant(tiles, n);
+		char &cell = level.cells[size_t(y) * level.w + x];
+		if (cell == c) return false;
+		cell = c;
+		return true;
+	}
+  public:
+	MipPyramid(char (*summarize)(char)) : summarize(summarize) {}
+
+	//Builds every level above world, down to a single cell
+	void build(const vector<vector<char>> &world) {
+		levels.clear();
+		int w = world.empty() ? 0 : world[0].size(), h = world.size();
+		for (int k = 1; w > 1 or h > 1; k++) {
+			w = (w + 1) / 2;
+			h = (h + 1) / 2;
+			levels.push_back(Level{w, h, vector<char>(size_t(w) * h, 0)});
+			for (int y = 0; y < h; y++)
+				for (int x = 0; x < w; x++) refresh_cell(world, k, x, y);
+		}
+	}
+	//Call after tile (x,y) of world changes. Stops going up once a level comes out the same.
+	void update(const vector<vector<char>> &world, int x, int y) {
+		for (int k = 1; k <= int(levels.size()); k++) {
+			x /= 2;
+			y /= 2;
+			if (!refresh_cell(world, k, x, y)) break;
+		}
+	}
+
+	//Number of levels above the world
+	int count() const { return levels.size(); }
+	int width(int k) const { return levels.at(k - 1).w; }
+	int height(int k) const { return levels.at(k - 1).h; }
+	//Cell (x,y) of level k, which covers the world tiles from (x << k, y << k)
+	char at(int k, int x, int y) const { return levels.at(k - 1).at(x, y); }
+};
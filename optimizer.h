@@ -0,0 +1,210 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <mutex>
+#include <unordered_map>
+#include <algorithm>
+#include "battle.h"
+#include "scheduler.h"
+using namespace std;
+
+//Genetic algorithm team optimizer.
+//A genome is a team of species and movesets. Its fitness is how often it beats a set of reference
+//teams (the meta) in headless team battles. Each island evolves its own population in parallel with
+//the others and every few generations sends its best team to the next island. Fitness is memoized
+//by genome since good teams keep turning up again.
+
+const int TEAM_SIZE = 6;
+
+struct Member {
+	int species = 0;	//Position in pokemon_db
+	array<int, MAX_MOVES> moves{};	//Positions in move_db
+};
+
+struct Team {
+	array<Member, TEAM_SIZE> members;
+	float fitness = -1;
+
+	uint64_t hash() const {
+		uint64_t h = 0;
+		for (const Member &m : members) {
+			h = splitmix64(h ^ m.species);
+			for (int move : m.moves) h = splitmix64(h ^ move);
+		}
+		return h;
+	}
+	vector<Pokemon> pokemon() const {
+		vector<Pokemon> team;
+		for (const Member &m : members) {
+			Pokemon p = pokemon_db.at(m.species);
+			for (int move : m.moves) p.moves.push_back(move_db.at(move));
+			team.push_back(p);
+		}
+		return team;
+	}
+};
+
+//Members fight one on one in order. The winner keeps its HP and PP for the next opponent and the
+//team that runs out of Pokemon first loses. Returns 0 or 1 for the winning team, -1 for a draw.
+int team_battle(const vector<Pokemon> &a, const vector<Pokemon> &b, uint64_t seed, uint64_t battle) {
+	vector<Pokemon> team[2] = {a, b};
+	size_t active[2] = {0, 0};
+	int round = 0;
+	while (active[0] < team[0].size() and active[1] < team[1].size()) {
+		Pokemon &p0 = team[0][active[0]], &p1 = team[1][active[1]];
+		Matchup m = make_matchup(p0, p1);
+		BattleState s = make_state(p0, p1);
+		uint64_t id = (battle << 8) + round++;
+		Rng setup(seed, id);
+		s.set_to_move(first_mover(m, setup));
+		BattleResult r = play_battle(m, s, Policy::GREEDY, Policy::GREEDY, seed, id);
+		if (r.winner == -1) return -1;
+		//The winner carries its HP and PP over to the next opponent
+		Pokemon *p[2] = {&p0, &p1};
+		for (int i = 0; i < 2; i++) {
+			p[i]->hp = s.hp[i];
+			for (size_t j = 0; j < p[i]->moves.size() and j < MAX_MOVES; j++) p[i]->moves[j].PP = s.pp[i][j];
+		}
+		active[1 - r.winner]++;
+	}
+	return active[0] < team[0].size() ? 0 : 1;
+}
+
+class TeamOptimizer {
+	vector<vector<Pokemon>> meta;
+	vector<int> damaging_moves;	//Positions in move_db of moves that do damage
+	unordered_map<uint64_t, float> memo;
+	mutex memo_lock;
+	uint64_t seed;
+	size_t island_size;
+	vector<vector<Team>> islands;
+
+	Member random_member(Rng &rng) const {
+		Member m;
+		m.species = rng.range(pokemon_db.size());
+		for (int &move : m.moves) move = damaging_moves[rng.range(damaging_moves.size())];
+		return m;
+	}
+
+	void evaluate(Team &t) {
+		uint64_t key = t.hash();
+		{
+			lock_guard<mutex> guard(memo_lock);
+			auto it = memo.find(key);
+			if (it != memo.end()) {
+				t.fitness = it->second;
+				return;
+			}
+		}
+		vector<Pokemon> team = t.pokemon();
+		float points = 0;
+		for (size_t i = 0; i < meta.size(); i++) {
+			int w = team_battle(team, meta[i], seed, key ^ i);
+			points += (w == 0 ? 1 : w == -1 ? 0.5 : 0);
+		}
+		t.fitness = points / meta.size();
+		lock_guard<mutex> guard(memo_lock);
+		memo[key] = t.fitness;
+	}
+
+	const Team &select(const vector<Team> &pop, Rng &rng) const {
+		const Team &a = pop[rng.range(pop.size())], &b = pop[rng.range(pop.size())];
+		return a.fitness >= b.fitness ? a : b;
+	}
+
+	//Runs one island for a number of generations
+	void evolve(vector<Team> &pop, int generations, Rng rng) {
+		for (int g = 0; g < generations; g++) {
+			sort(pop.begin(), pop.end(), [](const Team &a, const Team &b) { return a.fitness > b.fitness; });
+			vector<Team> next(pop.begin(), pop.begin() + 2);	//The two best carry over unchanged
+			while (next.size() < pop.size()) {
+				const Team &mom = select(pop, rng), &dad = select(pop, rng);
+				Team child;
+				for (int i = 0; i < TEAM_SIZE; i++) child.members[i] = rng.coin_flip() ? mom.members[i] : dad.members[i];
+				if (rng.range(4) == 0) child.members[rng.range(TEAM_SIZE)] = random_member(rng);
+				if (rng.range(2) == 0) child.members[rng.range(TEAM_SIZE)].moves[rng.range(MAX_MOVES)] = damaging_moves[rng.range(damaging_moves.size())];
+				if (rng.range(4) == 0) swap(child.members[rng.range(TEAM_SIZE)], child.members[rng.range(TEAM_SIZE)]);
+				evaluate(child);
+				next.push_back(child);
+			}
+			pop = next;
+		}
+		sort(pop.begin(), pop.end(), [](const Team &a, const Team &b) { return a.fitness > b.fitness; });
+	}
+  public:
+	//The meta is meta_size teams of random species using their headless movesets
+	TeamOptimizer(uint64_t seed, size_t meta_size = 16, size_t n_islands = 4, size_t island_size = 32) : seed(seed), island_size(island_size), islands(n_islands) {
+		for (size_t i = 0; i < move_db.size(); i++)
+			if (move_db[i].power > 0 and move_db[i].name != "Struggle") damaging_moves.push_back(i);
+		Rng rng(seed, OPTIMIZER_STREAM);
+		for (size_t i = 0; i < meta_size; i++) {
+			vector<Pokemon> team;
+			for (int j = 0; j < TEAM_SIZE; j++) {
+				Pokemon p = pokemon_db.at(rng.range(pokemon_db.size()));
+				p.moves = default_moveset(p);
+				team.push_back(p);
+			}
+			meta.push_back(team);
+		}
+	}
+
+	//Evolves every island in parallel, migrating between them every migrate_every generations
+	Team run(int generations, int migrate_every = 5) {
+		WorkStealer pool;
+		pool.run(islands.size(), [&](size_t i) {
+			Rng rng(seed, OPTIMIZER_STREAM - 1 - i);
+			islands[i].resize(island_size);
+			for (Team &t : islands[i]) {
+				for (Member &m : t.members) m = random_member(rng);
+				evaluate(t);
+			}
+		});
+		for (int g = 0; g < generations; g += migrate_every) {
+			int epoch = min(migrate_every, generations - g);
+			pool.run(islands.size(), [&](size_t i) { evolve(islands[i], epoch, Rng(seed, OPTIMIZER_STREAM - 1 - i, g + 1)); });
+			//Ring migration: each island's best replaces the next island's worst
+			vector<Team> best;
+			for (auto &island : islands) best.push_back(island.front());
+			for (size_t i = 0; i < islands.size(); i++) islands[(i + 1) % islands.size()].back() = best[i];
+		}
+		Team best = islands[0].front();
+		for (auto &island : islands)
+			for (Team &t : island)
+				if (t.fitness > best.fitness) best = t;
+		return best;
+	}
+	size_t genomes_evaluated() const { return memo.size(); }
+};
+
+//Writes a team as one line per member: the species then its moves, tab separated
+void save_team(const vector<Pokemon> &team, string filename) {
+	ofstream outs(filename);
+	for (const Pokemon &p : team) {
+		outs << p.name;
+		for (const Move &m : p.moves) outs << "\t" << m.name;
+		outs << "\n";
+	}
+}
+
+//Reads a team written by save_team, skipping species or moves that aren't loaded
+vector<Pokemon> load_team(string filename) {
+	vector<Pokemon> team;
+	ifstream ins(filename);
+	string line;
+	while (getline(ins, line)) {
+		istringstream iss(line);
+		string token;
+		getline(iss, token, '\t');
+		auto p = find(pokemon_db.begin(), pokemon_db.end(), token);
+		if (p == pokemon_db.end()) continue;
+		Pokemon member = *p;
+		while (getline(iss, token, '\t')) {
+			auto m = find(move_db.begin(), move_db.end(), token);
+			if (m != move_db.end() and member.moves.size() < MAX_MOVES) member.moves.push_back(*m);
+		}
+		team.push_back(member);
+	}
+	return team;
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <iostream>
+using namespace std;
+
+string uppercaseify(string s) {
+	string str;
+	for (char c : s) {
+		c = toupper(c);
+		str += c;
+	}
+	return str;
+}
+
+//This class holds a record for each move in the game
+class Move {
+	public:
+		int index;
+		string name;
+		string type;
+		string category;
+		int PP;
+		int power;
+		int accuracy;
+};
+
+//Holds a record for a single species of Pokemon, such as Pikachu
+class Pokemon {
+	public:
+		int index;			//Index number in the pokedex
+		string name;		//Name of the pokemon
+		int hp;				//Health points
+		int original_hp;
+		int attack;			//this number gets multiplied by the move's power to estimate damage
+		int defense;		//incoming damage gets divided by this number
+		int speed;			//whichever pokemon has the highest speed attacks first, flip a coin on a tie
+		int special;		//like attack and defense both, but for special moves
+		string type1;
+		string type2;
+		vector<Move> moves;
+};
+
+ostream& operator<<(ostream &outs, const Pokemon &p) {
+	outs << p.index << "\t" << p.name << "\tHP: " << p.hp << "\tAttack: " << p.attack << "\tDefense: " << p.defense << "\tSpeed: " << p.speed << "\tSpecial: " << p.special << "\tType 1: " << p.type1 << "\tType2: " << p.type2;
+	return outs;
+}
+
+ostream& operator<<(ostream &outs, const Move &m) {
+	outs << m.name << "\tType: " << m.type << "\tCategory: " << m.category << "\tPP: " << m.PP << "\tPower: " << m.power << "\tAccuracy: " << m.accuracy;
+	return outs;
+}
+
+
+bool operator==(const Pokemon &p, const string &s) {
+	return uppercaseify(s)== uppercaseify(p.name);
+}
+
+bool operator==(const Pokemon &p, const int &i) {
+	return i == p.index;
+}
+
+bool operator==(const Move &m, const string &s) {
+	return uppercaseify(s)== uppercaseify(m.name);
+}
+
+bool operator==(const Move &m, const int &i) {
+	return i == m.index;
+}
+
+//Same data record, ignoring HP lost and moves learned
+bool operator==(const Pokemon &a, const Pokemon &b) {
+	return a.index == b.index and a.name == b.name and a.original_hp == b.original_hp and a.attack == b.attack and a.defense == b.defense and a.speed == b.speed and a.special == b.special and a.type1 == b.type1 and a.type2 == b.type2;
+}
+
+bool operator==(const Move &a, const Move &b) {
+	return a.index == b.index and a.name == b.name and a.type == b.type and a.category == b.category and a.PP == b.PP and a.power == b.power and a.accuracy == b.accuracy;
+}
+
+vector<Pokemon> pokemon_db; //Holds all pokemon known to mankind
+vector<Pokemon> water_pokemon_db;
+vector<Move> move_db;	//Holds all moves available to pokemon
+
+const int MAX_MOVES = 4, MIN_MOVES = 1;
+
+const size_t NUM_TYPES = 18;
+
+vector<vector<double>>type_system(NUM_TYPES,vector<double>(NUM_TYPES));
+
+int lookup_type(string s) {
+	if (s == "Normal") return 0;
+	else if (s == "Fighting") return 1;
+	else if (s == "Flying") return 2;
+	else if (s == "Poison") return 3;
+	else if (s == "Ground") return 4;
+	else if (s == "Rock") return 5;
+	else if (s == "Bug") return 6;
+	else if (s == "Ghost") return 7;
+	else if (s == "Steel") return 8;
+	else if (s == "Fire") return 9;
+	else if (s == "Water") return 10;
+	else if (s == "Grass") return 11;
+	else if (s == "Electric") return 12;
+	else if (s == "Psychic") return 13;
+	else if (s == "Ice") return 14;
+	else if (s == "Dragon") return 15;
+	else if (s == "Dark") return 16;
+	else if (s == "Fairy") return 17;
+	else return -1;
+}
@@ -0,0 +1,181 @@
+#pragma once
+#include <vector>
+#include <map>
+#include <cstdint>
+#include <algorithm>
+#include "battle.h"
+using namespace std;
+
+//Move set recommender.
+//Finds the moves that cover the most of a group of defenders super effectively, breaking ties on
+//expected damage. Only the move's type, power, accuracy and STAB matter, so each type keeps just
+//its strongest move, moves another move beats against every defender are dropped, and a branch and
+//bound search picks the best set from the few that are left.
+
+struct MoveSuggestion {
+	vector<Move> moves;
+	float coverage = 0;	//Fraction of the defenders hit super effectively by at least one move
+	float damage = 0;	//Average fraction of a defender's HP taken by the best move against it
+};
+
+class MoveRecommender {
+	//Defenders with the same types take the same multiplier from every move, so they are grouped
+	struct TypeGroup {
+		int type1, type2;
+		float weight = 0;	//Share of the defenders in this group
+		float damage_weight = 0;	//Sum over the group of attack / (defense * hp) per defender
+	};
+	struct Candidate {
+		Move move;
+		vector<uint64_t> hits;	//Bitset over groups hit super effectively
+		float base = 0;	//power * accuracy * STAB
+		vector<float> value;	//base * type multiplier against each group
+		float coverage = 0;
+	};
+	Pokemon attacker;
+	vector<TypeGroup> groups;
+	vector<Candidate> candidates;
+	size_t words = 0;
+	//Search state
+	vector<vector<uint64_t>> suffix_hits;	//Union of hits over candidates[i..]
+	vector<vector<float>> suffix_value;	//Best value against each group over candidates[i..]
+	vector<int> picked, best_picked;
+	float best_coverage = -1, best_damage = -1;
+
+	float coverage(const vector<uint64_t> &hits) const {
+		float total = 0;
+		for (size_t g = 0; g < groups.size(); g++)
+			if (hits[g / 64] >> (g % 64) & 1) total += groups[g].weight;
+		return total;
+	}
+	float damage(const vector<float> &value) const {
+		float total = 0;
+		for (size_t g = 0; g < groups.size(); g++) total += groups[g].damage_weight * value[g];
+		return total;
+	}
+	static bool better(float cov, float dmg, float best_cov, float best_dmg) {
+		return cov > best_cov or (cov == best_cov and dmg > best_dmg);
+	}
+
+	void search(size_t start, int slots, const vector<uint64_t> &hits, const vector<float> &value) {
+		float cov = coverage(hits), dmg = damage(value);
+		if (slots == 0 or start == candidates.size()) {
+			if (better(cov, dmg, best_coverage, best_damage)) {
+				best_coverage = cov;
+				best_damage = dmg;
+				best_picked = picked;
+			}
+			return;
+		}
+		//Bound: even taking every remaining candidate can't beat the best set so far
+		vector<uint64_t> bound_hits = hits;
+		vector<float> bound_value = value;
+		for (size_t w = 0; w < words; w++) bound_hits[w] |= suffix_hits[start][w];
+		for (size_t g = 0; g < groups.size(); g++) bound_value[g] = max(bound_value[g], suffix_value[start][g]);
+		if (!better(coverage(bound_hits), damage(bound_value), best_coverage, best_damage)) return;
+
+		for (size_t i = start; i < candidates.size(); i++) {
+			vector<uint64_t> next_hits = hits;
+			vector<float> next_value = value;
+			for (size_t w = 0; w < words; w++) next_hits[w] |= candidates[i].hits[w];
+			for (size_t g = 0; g < groups.size(); g++) next_value[g] = max(next_value[g], candidates[i].value[g]);
+			picked.push_back(i);
+			search(i + 1, slots - 1, next_hits, next_value);
+			picked.pop_back();
+		}
+	}
+
+	Candidate make_candidate(const Move &m) const {
+		Candidate c;
+		c.move = m;
+		c.hits.assign(words, 0);
+		c.value.assign(groups.size(), 0);
+		int move_type = lookup_type(m.type);
+		float accuracy = (m.accuracy > 0 ? m.accuracy : 100) / 100.0;	//Moves listed without an accuracy never miss
+		c.base = m.power * accuracy * (has_stab(attacker, m) ? 1.5 : 1.0);
+		for (size_t g = 0; g < groups.size(); g++) {
+			float mult = 1;
+			if (move_type != -1) {
+				mult = type_system.at(move_type).at(groups[g].type1);
+				if (groups[g].type2 != -1) mult *= type_system.at(move_type).at(groups[g].type2);
+			}
+			//Every group needs the multiplier for its damage anyway, so it decides super effective too
+			if (mult > 1) c.hits[g / 64] |= uint64_t(1) << (g % 64);
+			c.value[g] = c.base * mult;
+		}
+		c.coverage = coverage(c.hits);
+		return c;
+	}
+  public:
+	MoveRecommender(const Pokemon &attacker, const vector<Pokemon> &defenders) : attacker(attacker) {
+		map<pair<int, int>, size_t> group_of;
+		for (const Pokemon &d : defenders) {
+			int t1 = lookup_type(d.type1), t2 = lookup_type(d.type2);
+			if (t1 == -1 or d.defense <= 0 or d.hp <= 0) continue;
+			auto it = group_of.find({t1, t2});
+			if (it == group_of.end()) {
+				it = group_of.insert({{t1, t2}, groups.size()}).first;
+				groups.push_back({t1, t2});
+			}
+			groups[it->second].weight += 1.0f / defenders.size();
+			groups[it->second].damage_weight += float(attacker.attack) / (d.defense * d.hp) / defenders.size();
+		}
+		words = (groups.size() + 63) / 64;
+	}
+
+	//Picks moves to fill the slots left after the moves already chosen
+	MoveSuggestion suggest(const vector<Move> &chosen, const vector<Move> &moves = move_db) {
+		//Strongest move of each type, the others can't add coverage or damage
+		map<string, Candidate> best_of_type;
+		for (const Move &m : moves) {
+			if (m.power <= 0 or m.name == "Struggle" or find(chosen.begin(), chosen.end(), m.index) != chosen.end()) continue;
+			Candidate c = make_candidate(m);
+			auto it = best_of_type.find(m.type);
+			if (it == best_of_type.end() or c.base > it->second.base) best_of_type[m.type] = c;
+		}
+		//Drop candidates another candidate beats against every group (keeping one of any exact ties)
+		candidates.clear();
+		for (auto &[type, c] : best_of_type) {
+			bool dominated = false;
+			for (auto &[other_type, o] : best_of_type) {
+				if (other_type == type) continue;
+				bool all = true, strictly = other_type < type;
+				for (size_t g = 0; g < groups.size() and all; g++) {
+					all = o.value[g] >= c.value[g];
+					strictly = strictly or o.value[g] > c.value[g];
+				}
+				for (size_t w = 0; w < words and all; w++) all = (c.hits[w] & ~o.hits[w]) == 0;
+				if (all and strictly) dominated = true;
+			}
+			if (!dominated) candidates.push_back(c);
+		}
+		//Good sets first so the bound starts cutting early
+		sort(candidates.begin(), candidates.end(), [](const Candidate &a, const Candidate &b) { return a.coverage > b.coverage; });
+		size_t n = candidates.size();
+		suffix_hits.assign(n + 1, vector<uint64_t>(words, 0));
+		suffix_value.assign(n + 1, vector<float>(groups.size(), 0));
+		for (size_t i = n; i-- > 0;) {
+			for (size_t w = 0; w < words; w++) suffix_hits[i][w] = suffix_hits[i + 1][w] | candidates[i].hits[w];
+			for (size_t g = 0; g < groups.size(); g++) suffix_value[i][g] = max(suffix_value[i + 1][g], candidates[i].value[g]);
+		}
+
+		vector<uint64_t> hits(words, 0);
+		vector<float> value(groups.size(), 0);
+		for (const Move &m : chosen) {
+			Candidate c = make_candidate(m);
+			for (size_t w = 0; w < words; w++) hits[w] |= c.hits[w];
+			for (size_t g = 0; g < groups.size(); g++) value[g] = max(value[g], c.value[g]);
+		}
+		picked.clear();
+		best_picked.clear();
+		best_coverage = best_damage = -1;
+		search(0, MAX_MOVES - min((int)chosen.size(), MAX_MOVES), hits, value);
+
+		MoveSuggestion s;
+		s.moves = chosen;
+		for (int i : best_picked) s.moves.push_back(candidates[i].move);
+		s.coverage = best_coverage;
+		s.damage = best_damage;
+		return s;
+	}
+};
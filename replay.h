@@ -0,0 +1,275 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <atomic>
+#include <map>
+#include "battle.h"
+#include "scheduler.h"
+using namespace std;
+
+//Binary battle log.
+//Every battle is stored as its seed, its setup and the move used on each turn. The rules and the
+//random streams are deterministic, so that is enough to play the whole battle again. Numbers are
+//written as varints (7 bits a byte), which makes a turn one byte for the Gen1 moves.
+//Record layout: length, seed, battle id, then for each side the species, HP, number of moves and
+//(move, PP) pairs, then the side that moved first, the number of turns, one move per turn, and
+//the winner plus one (0 if nobody won).
+
+const string BATTLE_LOG = "battles.log";
+
+void put_varint(string &out, uint64_t v) {
+	while (v >= 0x80) {
+		out += char(v | 0x80);
+		v >>= 7;
+	}
+	out += char(v);
+}
+
+bool get_varint(const char *&p, const char *end, uint64_t &v) {
+	v = 0;
+	for (int shift = 0; p < end and shift < 64; shift += 7) {
+		uint8_t byte = *p++;
+		v |= uint64_t(byte & 0x7F) << shift;
+		if (!(byte & 0x80)) return true;
+	}
+	return false;
+}
+
+struct BattleRecord {
+	uint64_t seed = 0, battle = 0;
+	array<int, 2> species{}, hp{};
+	array<vector<pair<int, int>>, 2> moves;	//(Move::index, PP) for each slot
+	int first = 0;
+	vector<int> turns;	//Move::index used on each turn
+	int winner = -1;
+};
+
+string encode(const BattleRecord &r) {
+	string body;
+	put_varint(body, r.seed);
+	put_varint(body, r.battle);
+	for (int i = 0; i < 2; i++) {
+		put_varint(body, r.species[i]);
+		put_varint(body, r.hp[i]);
+		put_varint(body, r.moves[i].size());
+		for (auto [move, pp] : r.moves[i]) {
+			put_varint(body, move);
+			put_varint(body, pp);
+		}
+	}
+	put_varint(body, r.first);
+	put_varint(body, r.turns.size());
+	for (int move : r.turns) put_varint(body, move);
+	put_varint(body, r.winner + 1);
+	string out;
+	put_varint(out, body.size());
+	return out + body;
+}
+
+//Reads the record body that starts at p and ends at end
+bool decode(const char *p, const char *end, BattleRecord &r) {
+	uint64_t v;
+	auto next = [&](auto &field) {
+		if (!get_varint(p, end, v)) return false;
+		field = v;
+		return true;
+	};
+	if (!next(r.seed) or !next(r.battle)) return false;
+	for (int i = 0; i < 2; i++) {
+		size_t n;
+		if (!next(r.species[i]) or !next(r.hp[i]) or !next(n) or n > MAX_MOVES) return false;
+		r.moves[i].resize(n);
+		for (auto &[move, pp] : r.moves[i])
+			if (!next(move) or !next(pp)) return false;
+	}
+	size_t n_turns;
+	if (!next(r.first) or !next(n_turns) or n_turns > MAX_TURNS) return false;
+	r.turns.resize(n_turns);
+	for (int &move : r.turns)
+		if (!next(move)) return false;
+	if (!next(r.winner)) return false;
+	r.winner--;
+	return p == end;
+}
+
+//Builds up the record for the battle in progress and appends it to the log when it ends
+class BattleRecorder {
+	BattleRecord record;
+	bool recording = false;
+  public:
+	string filename = BATTLE_LOG;
+
+	void begin(uint64_t seed, uint64_t battle, const Pokemon &p0, const Pokemon &p1, int first) {
+		record = BattleRecord();
+		record.seed = seed;
+		record.battle = battle;
+		const Pokemon *p[2] = {&p0, &p1};
+		for (int i = 0; i < 2; i++) {
+			record.species[i] = p[i]->index;
+			record.hp[i] = p[i]->hp;
+			for (const Move &m : p[i]->moves) record.moves[i].push_back({m.index, m.PP});
+		}
+		record.first = first;
+		recording = true;
+	}
+	void turn(const Move &move) {
+		if (recording) record.turns.push_back(move.index);
+	}
+	//Puts in the Move::index of each turn played so far, for battles that step back and forth
+	void replace_turns(const vector<int> &moves) {
+		if (recording) record.turns = moves;
+	}
+	void end(int winner) {
+		if (!recording) return;
+		record.winner = winner;
+		ofstream outs(filename, ios::app | ios::binary);
+		outs << encode(record);
+		recording = false;
+	}
+};
+
+struct ReplayStats {
+	size_t battles = 0, turns = 0;
+	size_t mismatches = 0;	//Battles that came out differently under the current rules and data
+	size_t bad_records = 0;
+};
+
+//Where each Pokedex number and move index is in pokemon_db and move_db, -1 for ones that aren't there
+struct ReplayIndex {
+	vector<int> species_pos, move_pos;
+
+	ReplayIndex() {
+		auto add = [](vector<int> &pos, int index, int i) {
+			if (index < 0) return;
+			if (size_t(index) >= pos.size()) pos.resize(index + 1, -1);
+			pos[index] = i;
+		};
+		for (size_t i = 0; i < pokemon_db.size(); i++) add(species_pos, pokemon_db[i].index, i);
+		for (size_t i = 0; i < move_db.size(); i++) add(move_pos, move_db[i].index, i);
+	}
+	static int at(const vector<int> &pos, int index) { return index < 0 or size_t(index) >= pos.size() ? -1 : pos[index]; }
+};
+
+//What decides a record's Matchup: both species and the moves they know. Battles in the log mostly
+//share a few of these, so each Matchup is built once.
+vector<int> matchup_key(const BattleRecord &r) {
+	vector<int> key;
+	for (int i = 0; i < 2; i++) {
+		key.push_back(r.species[i]);
+		key.push_back(r.moves[i].size());
+		for (auto [move, pp] : r.moves[i]) key.push_back(move);
+	}
+	return key;
+}
+
+//Builds the Matchup for a record, returns false if it names a species or move that isn't known
+bool replay_matchup(const BattleRecord &r, const ReplayIndex &index, Matchup &m) {
+	Pokemon p[2];
+	for (int i = 0; i < 2; i++) {
+		int pos = ReplayIndex::at(index.species_pos, r.species[i]);
+		if (pos == -1) return false;
+		p[i] = pokemon_db[pos];
+		for (auto [move, pp] : r.moves[i]) {
+			int move_pos = ReplayIndex::at(index.move_pos, move);
+			if (move_pos == -1) return false;
+			p[i].moves.push_back(move_db[move_pos]);
+		}
+	}
+	m = make_matchup(p[0], p[1]);
+	return true;
+}
+
+//Plays a recorded battle again with the headless rules in the record's Matchup. Returns the winner,
+//or -2 if the record can't be played (a move that isn't available).
+int replay_battle(const BattleRecord &r, const Matchup &m) {
+	//The same state make_state gives for the recorded HP and PP
+	BattleState s;
+	for (int i = 0; i < 2; i++) {
+		s.species[i] = r.species[i];
+		s.hp[i] = clamp(r.hp[i], 0, 0xFFFF);
+		for (size_t j = 0; j < r.moves[i].size() and j < MAX_MOVES; j++) s.pp[i][j] = clamp(r.moves[i][j].second, 0, 0xFF);
+	}
+	s.hash = s.full_hash();
+	s.set_to_move(r.first);
+	for (int move : r.turns) {
+		if (winner(s) != -1) return -2;
+		//Any slot holding the move will do, duplicate slots play out the same
+		const Side &side = m.side[s.to_move];
+		int slot = -1;
+		for (int i = 0; i < side.n_moves and slot == -1; i++)
+			if (side.move_id[i] == move and s.pp[s.to_move][i] > 0) slot = i;
+		if (slot == -1) {
+			array<int, MAX_MOVES> legal;
+			if (side.move_id[STRUGGLE] != move or legal_moves(m, s, legal) != 1 or legal[0] != STRUGGLE) return -2;
+			slot = STRUGGLE;
+		}
+		Rng rng(r.seed, r.battle, s.turn + 1);
+		play_move(m, s, slot, rng);
+	}
+	return winner(s);
+}
+
+//Replays every battle in a log file on all cores
+ReplayStats replay_log(string filename) {
+	ReplayStats stats;
+	ifstream ins(filename, ios::binary);
+	stringstream buffer;
+	buffer << ins.rdbuf();
+	string data = buffer.str();
+
+	//Find where each record starts so they can be handed out to threads
+	vector<pair<size_t, size_t>> records;
+	const char *p = data.data(), *end = data.data() + data.size();
+	while (p < end) {
+		uint64_t length;
+		if (!get_varint(p, end, length) or length > size_t(end - p)) {
+			stats.bad_records++;
+			break;
+		}
+		records.push_back({p - data.data(), length});
+		p += length;
+	}
+
+	atomic<size_t> turns{0}, mismatches{0}, bad{0};
+	WorkStealer pool;
+	vector<BattleRecord> decoded(records.size());
+	vector<char> ok(records.size());
+	pool.run(records.size(), [&](size_t i) {
+		const char *start = data.data() + records[i].first;
+		ok[i] = decode(start, start + records[i].second, decoded[i]);
+	});
+
+	//One Matchup for each distinct setup, built on all cores
+	ReplayIndex index;
+	map<vector<int>, int> matchup_of;
+	vector<int> which(records.size(), -1);
+	vector<size_t> first_record;	//A record with each setup
+	for (size_t i = 0; i < records.size(); i++) {
+		if (!ok[i]) continue;
+		auto [it, inserted] = matchup_of.insert({matchup_key(decoded[i]), matchup_of.size()});
+		if (inserted) first_record.push_back(i);
+		which[i] = it->second;
+	}
+	vector<Matchup> matchups(first_record.size());
+	vector<char> known(first_record.size());
+	pool.run(first_record.size(), [&](size_t k) { known[k] = replay_matchup(decoded[first_record[k]], index, matchups[k]); });
+
+	pool.run(records.size(), [&](size_t i) {
+		if (!ok[i]) {
+			bad++;
+			return;
+		}
+		const BattleRecord &r = decoded[i];
+		int w = known[which[i]] ? replay_battle(r, matchups[which[i]]) : -2;
+		if (w == -2) bad++;
+		else if (w != r.winner) mismatches++;
+		turns += r.turns.size();
+	});
+	stats.battles = records.size();
+	stats.turns = turns;
+	stats.mismatches = mismatches;
+	stats.bad_records += bad;
+	return stats;
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+using namespace std;
+
+//Counter-based random numbers.
+//Each Rng is a stream picked by (seed, battle id, turn). The n-th number of a stream is a hash of
+//its key and n, so streams need no shared state: parallel battles never lock, and a battle
+//replays bit-for-bit from the seed, its id and its turn numbers.
+
+//SplitMix64 finalizer, a bijective 64 bit mixer
+inline uint64_t splitmix64(uint64_t x) {
+	x += 0x9E3779B97F4A7C15ull;
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+	return x ^ (x >> 31);
+}
+
+//Stream ids outside of the battle id range
+const uint64_t MAP_STREAM = numeric_limits<uint64_t>::max();	//World generation
+const uint64_t WORLD_STREAM = MAP_STREAM - 1;	//Wild encounters while exploring
+const uint64_t OPTIMIZER_STREAM = MAP_STREAM - 2;	//Team optimizer, counting down from here
+//Added to a turn number for the numbers an AI draws while picking that turn's move, which keeps
+//the turn's own stream for the move's hit and damage roll
+const uint64_t THINK_TURN = uint64_t(1) << 63;
+
+class Rng {
+	uint64_t key;
+	uint64_t counter = 0;
+  public:
+	//Turn 0 is for setting a battle up (coin flips, wild Pokemon), turns after that are the moves
+	Rng(uint64_t seed, uint64_t stream = 0, uint64_t turn = 0) : key(splitmix64(splitmix64(splitmix64(seed) ^ stream) ^ turn)) {}
+	uint64_t next() {
+		return splitmix64(key ^ splitmix64(counter++));
+	}
+	//Uniform number in [0, n), n must be less than 2^32
+	uint32_t range(uint32_t n) {
+		return ((next() >> 32) * n) >> 32;
+	}
+	int d100() { return range(100) + 1; }
+	bool coin_flip() { return next() >> 63; }
+
+	//Lets an Rng be used with <random> distributions and algorithms
+	using result_type = uint64_t;
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return numeric_limits<uint64_t>::max(); }
+	result_type operator()() { return next(); }
+};
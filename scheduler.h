@@ -0,0 +1,117 @@
+#pragma once
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <cstdint>
+using namespace std;
+
+//Work-stealing parallel for loop.
+//Each worker starts with an equal slice of [0, n) and takes one index at a time off the
+//front of its slice. When a worker runs out it steals the back half of another worker's
+//slice, so a few long battles can't leave the other cores sitting idle.
+//The helper threads are started the first time they are needed and then wait for the next run,
+//so a pool that is kept around (like the tree search's) doesn't start threads on every call.
+class WorkStealer {
+	struct alignas(64) Slice { //One cache line each so workers don't fight over them
+		mutex lock;
+		size_t lo = 0, hi = 0;
+	};
+	vector<Slice> slices;
+	vector<thread> helpers;	//helpers[k] works slice k + 1, the thread calling run works slice 0
+	mutex state;
+	condition_variable wake, done;
+	function<void(size_t)> job;
+	unsigned active = 0;	//Slices in the current run
+	unsigned running = 0;	//Helpers still working on it
+	uint64_t generation = 0;	//Counts runs, so a helper knows a new one has started
+	bool stopping = false;
+
+	bool take(size_t w, size_t &i) {
+		lock_guard<mutex> guard(slices[w].lock);
+		if (slices[w].lo == slices[w].hi) return false;
+		i = slices[w].lo++;
+		return true;
+	}
+	bool steal(size_t w) {
+		for (size_t k = 1; k < slices.size(); k++) {
+			Slice &victim = slices[(w + k) % slices.size()];
+			size_t lo, hi;
+			{
+				lock_guard<mutex> guard(victim.lock);
+				if (victim.hi - victim.lo < 2) continue;
+				lo = victim.lo + (victim.hi - victim.lo) / 2;
+				hi = victim.hi;
+				victim.hi = lo;
+			}
+			lock_guard<mutex> guard(slices[w].lock);
+			slices[w].lo = lo;
+			slices[w].hi = hi;
+			return true;
+		}
+		return false;
+	}
+	void drain(size_t w) {
+		size_t i;
+		while (true) {
+			if (take(w, i)) job(i);
+			else if (!steal(w)) break;
+		}
+	}
+	void helper(size_t w, uint64_t seen) {
+		unique_lock<mutex> guard(state);
+		while (true) {
+			wake.wait(guard, [&] { return stopping or generation != seen; });
+			if (stopping) return;
+			seen = generation;
+			if (w >= active) continue;	//This run has fewer slices
+			guard.unlock();
+			drain(w);
+			guard.lock();
+			if (--running == 0) done.notify_one();
+		}
+	}
+  public:
+	WorkStealer() {}
+	WorkStealer(const WorkStealer &) = delete;
+	WorkStealer &operator=(const WorkStealer &) = delete;
+	~WorkStealer() {
+		{
+			lock_guard<mutex> guard(state);
+			stopping = true;
+		}
+		wake.notify_all();
+		for (thread &t : helpers) t.join();
+	}
+
+	static unsigned default_threads() {
+		unsigned n = thread::hardware_concurrency();
+		return n ? n : 1;
+	}
+	//Calls fn(i) for every i in [0, n), fn(i) must be safe to run concurrently. One run at a time.
+	template <class F>
+	void run(size_t n, F fn, unsigned threads = default_threads()) {
+		if (!threads) threads = 1;
+		job = fn;
+		slices = vector<Slice>(threads);
+		for (size_t w = 0; w < threads; w++) {
+			slices[w].lo = n * w / threads;
+			slices[w].hi = n * (w + 1) / threads;
+		}
+		if (threads > 1) {
+			while (helpers.size() + 1 < threads) helpers.emplace_back(&WorkStealer::helper, this, helpers.size() + 1, generation);
+			{
+				lock_guard<mutex> guard(state);
+				active = threads;
+				running = threads - 1;
+				generation++;
+			}
+			wake.notify_all();
+		}
+		drain(0);
+		unique_lock<mutex> guard(state);
+		done.wait(guard, [&] { return running == 0; });
+		job = nullptr;
+	}
+};
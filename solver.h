@@ -0,0 +1,205 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include "battle.h"
+#include "scheduler.h"
+using namespace std;
+
+//Exact 1v1 solver.
+//With both move sets fixed, a battle's future only depends on the two HPs, the PP left and whose
+//turn it is. The solver finds every position reachable from the start, then works out the exact
+//chance side 0 wins from each one, with each side picking its best move and draws counting half.
+//Positions are stored once for both sides to move (a cell) in an open addressing hash table,
+//which checks the whole position on a hash match so colliding positions stay apart.
+//Every move either takes HP or spends PP, so a cell only depends on cells with less total HP, or
+//the same HP and less total PP. Cells with the same totals form a layer that is solved in parallel.
+//The one exception is Struggle doing no damage, which leaves the position as it was; that is
+//solved directly as a pair of equations. The MAX_TURNS limit of the headless battles is ignored.
+
+class BattleSolver {
+	struct Cell {
+		BattleState s;	//Side 0 to move, turn 0
+		double value[2] = {0, 0};	//Chance side 0 wins with each side to move
+		int8_t best[2] = {-1, -1};	//Best slot for each side to move
+	};
+	Matchup m;
+	vector<Cell> cells;
+	static constexpr uint32_t EMPTY = UINT32_MAX;
+	vector<pair<uint64_t, uint32_t>> table;	//(cell hash, position in cells), EMPTY position if unused
+	size_t max_cells;
+
+	static BattleState canonical(BattleState s) {
+		s.set_to_move(0);
+		s.turn = 0;
+		return s;
+	}
+	int find(const BattleState &c) const {
+		for (size_t i = c.hash & (table.size() - 1);; i = (i + 1) & (table.size() - 1)) {
+			if (table[i].second == EMPTY) return -1;
+			if (table[i].first == c.hash and cells[table[i].second].s == c) return table[i].second;
+		}
+	}
+	//Adds a cell if it isn't there yet, returns false if that would go past max_cells
+	bool insert(const BattleState &c, vector<uint32_t> &todo) {
+		if (find(c) != -1) return true;
+		if (cells.size() == max_cells) return false;
+		if (2 * (cells.size() + 1) > table.size()) {
+			vector<pair<uint64_t, uint32_t>> old(table.size() * 2, {0, EMPTY});
+			swap(old, table);
+			for (auto &slot : old)
+				if (slot.second != EMPTY) place(slot.first, slot.second);
+		}
+		place(c.hash, cells.size());
+		todo.push_back(cells.size());
+		cells.push_back({c});
+		return true;
+	}
+	void place(uint64_t key, uint32_t index) {
+		size_t i = key & (table.size() - 1);
+		while (table[i].second != EMPTY) i = (i + 1) & (table.size() - 1);
+		table[i] = {key, index};
+	}
+
+	//Chance side 0 wins after side me uses slot in cell c. Outcomes that leave the cell as it was
+	//aren't counted, their chance is added to stay instead.
+	double move_value(const Cell &c, int me, int slot, double &stay) const {
+		BattleState s = c.s;
+		s.set_to_move(me);
+		array<Outcome, MAX_OUTCOMES> outcomes;
+		int n = move_outcomes(m, s, slot, outcomes);
+		double value = 0;
+		stay = 0;
+		for (int i = 0; i < n; i++) {
+			BattleState next = s;
+			apply_hit(next, slot, outcomes[i].damage);
+			int w = winner(next);
+			if (w != -1) {
+				value += outcomes[i].prob * (w == 0 ? 1 : 0);
+				continue;
+			}
+			next = canonical(next);
+			if (next == c.s) stay += outcomes[i].prob;
+			else value += outcomes[i].prob * cells[find(next)].value[1 - me];
+		}
+		return value;
+	}
+
+	void solve_cell(Cell &c) {
+		array<int, MAX_MOVES> moves[2];
+		int n[2];
+		bool stuck[2];	//Only Struggle is left, which might leave the cell as it was
+		double stay[2] = {0, 0}, rest[2] = {0, 0};
+		for (int me = 0; me < 2; me++) {
+			BattleState s = c.s;
+			s.set_to_move(me);
+			n[me] = legal_moves(m, s, moves[me]);
+			stuck[me] = n[me] == 1 and moves[me][0] == STRUGGLE;
+			if (stuck[me]) {
+				rest[me] = move_value(c, me, STRUGGLE, stay[me]);
+				c.best[me] = STRUGGLE;
+				continue;
+			}
+			//Side 0 maximizes its chance to win, side 1 minimizes it
+			double best = me == 0 ? -1 : 2, unused;
+			for (int i = 0; i < n[me]; i++) {
+				double v = move_value(c, me, moves[me][i], unused);
+				if (me == 0 ? v > best : v < best) {
+					best = v;
+					c.best[me] = moves[me][i];
+				}
+			}
+			c.value[me] = best;
+		}
+		//value[me] = rest[me] + stay[me] * value[1 - me] for a stuck side
+		if (stuck[0] and stuck[1]) {
+			double loop = stay[0] * stay[1];
+			if (loop >= 1 - 1e-12) c.value[0] = c.value[1] = 0.5;	//Neither side can ever do damage: a draw
+			else {
+				c.value[0] = (rest[0] + stay[0] * rest[1]) / (1 - loop);
+				c.value[1] = rest[1] + stay[1] * c.value[0];
+			}
+		} else if (stuck[0]) c.value[0] = rest[0] + stay[0] * c.value[1];
+		else if (stuck[1]) c.value[1] = rest[1] + stay[1] * c.value[0];
+		//Outcome chances are floats, keep their rounding from creeping past certainty
+		for (double &v : c.value) v = clamp(v, 0.0, 1.0);
+	}
+  public:
+	BattleSolver(const Matchup &m, size_t max_cells = size_t(1) << 22) : m(m), table(1 << 10, {0, EMPTY}), max_cells(max_cells) {}
+
+	//Solves every position reachable from start. Returns false if there were more than max_cells.
+	bool solve(const BattleState &start) {
+		cells.clear();
+		fill(table.begin(), table.end(), make_pair(uint64_t(0), EMPTY));
+		if (winner(start) != -1) return true;
+		vector<uint32_t> todo;
+		if (!insert(canonical(start), todo)) return false;
+		while (!todo.empty()) {
+			BattleState c = cells[todo.back()].s;
+			todo.pop_back();
+			for (int me = 0; me < 2; me++) {
+				BattleState s = c;
+				s.set_to_move(me);
+				array<int, MAX_MOVES> moves;
+				int n = legal_moves(m, s, moves);
+				for (int i = 0; i < n; i++) {
+					array<Outcome, MAX_OUTCOMES> outcomes;
+					int k = move_outcomes(m, s, moves[i], outcomes);
+					for (int j = 0; j < k; j++) {
+						BattleState next = s;
+						apply_hit(next, moves[i], outcomes[j].damage);
+						if (winner(next) == -1 and !insert(canonical(next), todo)) return false;
+					}
+				}
+			}
+		}
+
+		//Layers from the least HP and PP up, each one only needs the layers before it
+		auto layer = [](const BattleState &s) {
+			int pp = 0;
+			for (auto &side : s.pp)
+				for (int p : side) pp += p;
+			return uint64_t(s.hp[0] + s.hp[1]) << 32 | pp;
+		};
+		vector<uint32_t> order(cells.size());
+		for (size_t i = 0; i < order.size(); i++) order[i] = i;
+		sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return layer(cells[a].s) < layer(cells[b].s); });
+		WorkStealer pool;
+		for (size_t lo = 0, hi; lo < order.size(); lo = hi) {
+			for (hi = lo + 1; hi < order.size() and layer(cells[order[hi]].s) == layer(cells[order[lo]].s); hi++);
+			size_t width = hi - lo;
+			pool.run(width, [&](size_t i) { solve_cell(cells[order[lo + i]]); }, width > 256 ? WorkStealer::default_threads() : 1);
+		}
+		return true;
+	}
+
+	//Chance side 0 wins from s with both sides playing their best, or -1 if s wasn't solved
+	double value(const BattleState &s) const {
+		int w = winner(s);
+		if (w != -1) return w == 0 ? 1 : 0;
+		int i = find(canonical(s));
+		return i == -1 ? -1 : cells[i].value[s.to_move];
+	}
+	//Chance side 0 wins if the side to move in s uses slot and both sides play their best after
+	//that, or -1 if s wasn't solved. Not for a side that only has Struggle left.
+	double value(const BattleState &s, int slot) const {
+		int i = winner(s) == -1 ? find(canonical(s)) : -1;
+		double stay;
+		return i == -1 ? -1 : move_value(cells[i], s.to_move, slot, stay);
+	}
+	//Best slot for the side to move in s, or -1 if s wasn't solved
+	int best_move(const BattleState &s) const {
+		int i = winner(s) == -1 ? find(canonical(s)) : -1;
+		return i == -1 ? -1 : cells[i].best[s.to_move];
+	}
+	size_t positions() const { return cells.size(); }
+	//Calls fn(position, best slot) for every solved position with each side to move
+	template <class F>
+	void for_each(F fn) const {
+		for (const Cell &c : cells)
+			for (int me = 0; me < 2; me++) {
+				BattleState s = c.s;
+				s.set_to_move(me);
+				fn(s, c.best[me]);
+			}
+	}
+};
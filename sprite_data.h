@@ -0,0 +1,5460 @@
+//Generated by sprite_pack.cc from sprites.txt, edit that instead
+#pragma once
+const unsigned char SPRITE_DATA[] = {
+80,79,75,69,83,80,82,49,151,0,0,0,0,0,0,0,253,5,0,0,16,3,0,0,
+236,6,0,0,50,7,0,0,127,7,0,0,109,12,0,0,72,6,0,0,59,15,0,0,
+113,7,0,0,148,18,0,0,94,8,0,0,236,22,0,0,156,6,0,0,225,25,0,0,
+31,8,0,0,214,29,0,0,49,7,0,0,225,33,0,0,18,6,0,0,8,37,0,0,
+0,7,0,0,99,39,0,0,9,9,0,0,20,43,0,0,146,6,0,0,177,45,0,0,
+44,5,0,0,46,48,0,0,183,5,0,0,126,51,0,0,154,5,0,0,142,54,0,0,
+110,5,0,0,141,57,0,0,46,5,0,0,115,60,0,0,102,8,0,0,190,63,0,0,
+89,6,0,0,149,67,0,0,107,5,0,0,49,70,0,0,99,5,0,0,143,73,0,0,
+6,5,0,0,221,75,0,0,101,5,0,0,150,78,0,0,70,7,0,0,3,81,0,0,
+21,8,0,0,199,84,0,0,158,5,0,0,83,88,0,0,147,6,0,0,201,91,0,0,
+253,6,0,0,75,95,0,0,49,6,0,0,76,98,0,0,231,6,0,0,202,101,0,0,
+108,8,0,0,82,105,0,0,255,6,0,0,214,108,0,0,128,7,0,0,59,113,0,0,
+141,5,0,0,217,115,0,0,156,5,0,0,86,118,0,0,92,6,0,0,163,121,0,0,
+24,6,0,0,6,124,0,0,15,7,0,0,242,126,0,0,132,6,0,0,160,129,0,0,
+98,7,0,0,90,132,0,0,233,6,0,0,243,134,0,0,239,6,0,0,170,137,0,0,
+194,6,0,0,242,140,0,0,34,6,0,0,32,144,0,0,46,7,0,0,235,147,0,0,
+32,8,0,0,128,151,0,0,112,6,0,0,113,154,0,0,18,7,0,0,73,158,0,0,
+239,4,0,0,33,160,0,0,209,5,0,0,240,162,0,0,44,7,0,0,190,166,0,0,
+142,4,0,0,94,169,0,0,204,6,0,0,244,171,0,0,225,6,0,0,10,175,0,0,
+31,7,0,0,70,178,0,0,162,7,0,0,197,181,0,0,56,5,0,0,198,184,0,0,
+53,6,0,0,208,188,0,0,156,5,0,0,152,191,0,0,102,5,0,0,69,194,0,0,
+139,7,0,0,13,198,0,0,168,8,0,0,126,201,0,0,108,7,0,0,213,205,0,0,
+162,8,0,0,157,209,0,0,49,7,0,0,224,212,0,0,188,5,0,0,169,216,0,0,
+123,9,0,0,5,221,0,0,214,5,0,0,27,223,0,0,158,5,0,0,73,225,0,0,
+90,7,0,0,55,228,0,0,215,7,0,0,208,230,0,0,143,6,0,0,184,234,0,0,
+154,7,0,0,207,237,0,0,159,6,0,0,81,241,0,0,159,6,0,0,70,245,0,0,
+229,7,0,0,232,248,0,0,230,8,0,0,125,253,0,0,88,8,0,0,25,0,1,0,
+81,7,0,0,234,3,1,0,225,4,0,0,11,6,1,0,142,6,0,0,132,9,1,0,
+170,6,0,0,28,13,1,0,84,6,0,0,219,15,1,0,46,5,0,0,184,18,1,0,
+217,8,0,0,167,21,1,0,187,5,0,0,221,23,1,0,110,6,0,0,3,28,1,0,
+187,4,0,0,236,30,1,0,163,6,0,0,140,33,1,0,51,8,0,0,253,36,1,0,
+87,5,0,0,176,39,1,0,163,5,0,0,254,41,1,0,117,5,0,0,86,44,1,0,
+64,9,0,0,168,48,1,0,244,6,0,0,30,51,1,0,66,5,0,0,223,53,1,0,
+182,4,0,0,121,56,1,0,161,5,0,0,81,59,1,0,36,8,0,0,103,61,1,0,
+29,9,0,0,97,63,1,0,222,7,0,0,178,66,1,0,10,7,0,0,49,70,1,0,
+95,8,0,0,210,72,1,0,50,7,0,0,129,75,1,0,112,8,0,0,173,78,1,0,
+109,8,0,0,170,81,1,0,48,7,0,0,197,84,1,0,133,7,0,0,85,87,1,0,
+16,5,0,0,97,90,1,0,10,8,0,0,243,93,1,0,233,5,0,0,43,97,1,0,
+66,4,0,0,14,99,1,0,223,8,0,0,162,104,1,0,37,7,0,0,216,107,1,0,
+141,6,0,0,149,110,1,0,72,7,0,0,24,114,1,0,119,7,0,0,230,116,1,0,
+254,6,0,0,129,120,1,0,155,6,0,0,90,123,1,0,123,6,0,0,158,126,1,0,
+159,6,0,0,16,130,1,0,227,5,0,0,29,133,1,0,251,6,0,0,11,137,1,0,
+200,6,0,0,162,140,1,0,153,7,0,0,164,144,1,0,207,6,0,0,200,147,1,0,
+147,8,0,0,207,150,1,0,206,6,0,0,158,154,1,0,33,8,0,0,70,159,1,0,
+158,6,0,0,177,161,1,0,25,8,0,0,35,163,1,0,232,6,0,0,186,165,1,0,
+45,17,0,0,112,170,1,0,18,9,0,0,87,174,1,0,243,8,0,0,232,177,1,0,
+174,17,0,0,60,183,1,0,245,21,0,0,183,190,1,0,65,15,0,0,124,197,1,0,
+118,14,0,0,90,202,1,0,91,17,0,0,202,206,1,0,99,12,0,0,113,210,1,0,
+103,10,0,0,189,213,1,0,61,26,0,0,154,222,1,0,175,13,0,0,24,227,1,0,
+99,15,0,0,8,231,1,0,222,4,0,0,43,233,1,0,3,8,0,0,199,235,1,0,
+51,19,0,0,185,240,1,0,166,26,0,0,27,248,1,0,75,5,0,0,0,32,167,0,
+0,1,47,10,149,25,0,3,95,44,46,45,130,0,0,0,46,128,0,0,1,95,95,128,
+14,0,2,39,32,39,128,19,0,0,46,147,49,0,2,44,45,39,140,59,0,0,34,133,
+13,0,0,124,145,49,0,0,44,135,46,0,1,95,46,137,59,0,129,0,0,145,99,0,
+0,47,129,52,0,141,58,0,135,0,0,0,96,143,50,0,0,46,132,53,0,133,5,0,
+142,50,0,0,96,144,103,0,0,124,130,2,0,132,61,0,145,0,0,2,92,46,92,133,
+53,0,128,21,1,0,95,132,53,0,128,9,0,1,46,95,128,50,0,131,59,0,129,26,
+0,141,54,0,0,32,133,109,0,128,71,1,129,124,0,128,89,1,0,34,133,34,1,3,
+96,96,34,45,129,49,1,1,39,96,129,40,0,142,197,0,131,112,0,128,8,0,131,255,
+0,149,98,0,128,60,0,140,201,0,132,72,1,0,96,136,49,1,0,44,128,101,0,143,
+220,0,139,116,0,130,196,0,0,76,129,58,0,137,106,1,130,10,0,0,95,131,189,0,
+137,0,0,1,45,46,136,136,0,130,105,1,129,240,1,2,44,96,45,130,100,0,1,44,
+34,129,6,0,128,237,0,145,180,1,128,0,0,0,62,132,138,0,132,105,0,128,58,0,
+0,46,128,33,1,0,92,129,13,0,0,96,134,51,0,131,234,0,128,253,0,0,44,131,
+84,0,133,106,0,0,96,128,152,2,1,46,45,133,64,0,5,10,32,124,124,58,44,138,
+219,0,129,85,0,0,59,130,42,0,0,47,129,129,1,134,41,1,130,35,0,132,40,0,
+1,46,39,128,4,3,3,106,124,58,68,138,6,1,131,177,0,0,39,128,65,0,128,123,
+0,128,146,0,135,24,0,128,115,0,0,44,130,41,0,0,44,128,61,3,3,47,32,76,
+58,128,32,0,133,246,1,138,182,1,128,104,1,1,58,95,128,125,0,140,165,1,4,46,
+39,46,39,10,130,79,0,0,34,129,138,1,141,0,0,0,34,129,0,0,146,44,1,1,
+86,10,132,184,0,154,0,0,130,33,0,130,39,0,128,133,3,128,6,0,130,24,3,1,
+96,44,129,65,1,137,245,0,137,172,3,1,45,39,130,182,1,128,45,0,131,41,2,129,
+110,1,131,79,3,2,41,32,92,128,239,0,135,113,2,0,95,129,12,4,129,20,4,129,
+161,0,130,43,0,129,15,2,0,92,130,255,0,130,8,0,131,113,2,129,78,0,128,130,
+0,0,34,128,3,2,131,42,0,134,106,0,129,80,1,133,95,1,128,96,1,130,55,1,
+1,96,46,128,47,0,129,51,2,130,180,0,128,15,0,128,255,0,129,118,4,129,94,3,
+128,112,0,131,73,4,138,250,2,131,139,2,134,92,4,3,124,32,46,34,129,111,0,132,
+114,2,138,53,4,138,18,0,136,7,4,0,44,130,55,0,128,220,0,132,142,3,130,32,
+1,134,0,0,131,51,2,143,170,4,129,222,0,137,1,3,0,47,128,66,0,135,97,0,
+0,46,137,42,0,137,176,0,128,108,0,0,39,128,38,3,0,95,129,89,1,128,3,1,
+131,37,0,0,39,128,57,0,129,227,0,0,59,129,97,5,130,225,2,128,98,5,0,92,
+130,84,4,129,22,0,128,36,2,128,9,1,0,94,128,37,1,0,46,130,113,0,8,39,
+45,96,45,94,45,39,34,45,130,239,2,130,11,0,128,74,2,0,39,130,46,2,5,96,
+46,44,94,46,96,128,41,1,2,39,32,10,0,32,155,0,0,9,44,39,34,96,46,44,
+46,47,46,10,156,38,0,133,9,0,4,89,39,44,34,46,154,45,0,135,43,0,128,0,
+0,5,92,32,32,124,32,92,152,46,0,0,47,139,14,0,0,46,128,46,0,1,32,96,
+151,47,0,140,46,0,128,45,0,128,47,0,140,96,0,1,95,95,137,79,0,146,48,0,
+0,32,134,193,0,129,43,0,128,164,0,5,96,46,32,45,45,45,129,45,0,130,30,0,
+139,49,0,0,106,130,6,0,132,49,0,5,47,32,96,45,46,95,128,50,0,2,32,96,
+89,133,224,0,141,49,0,131,117,0,132,49,0,0,95,128,91,0,129,45,0,0,96,132,
+15,1,128,3,0,1,124,46,140,151,0,132,50,1,8,124,44,45,39,34,34,55,44,46,
+128,0,0,131,60,0,0,108,131,30,0,130,153,0,129,205,0,2,44,32,96,128,110,0,
+0,124,128,7,0,0,124,128,86,0,0,44,128,1,0,1,32,47,128,3,0,134,118,1,
+0,39,129,32,1,5,44,39,95,44,46,45,132,65,0,128,173,0,131,60,0,128,8,0,
+2,32,32,58,128,1,0,130,105,0,128,198,0,130,119,0,1,34,92,128,56,0,0,124,
+129,6,1,136,90,1,1,39,45,130,76,0,3,47,95,95,95,132,245,0,3,92,34,34,
+39,128,88,1,128,42,2,2,45,96,46,133,68,0,132,143,1,1,47,46,130,112,1,4,
+108,39,46,44,39,133,86,1,2,96,45,45,129,150,0,1,95,46,128,73,0,1,96,34,
+137,237,0,128,84,0,1,32,96,128,208,0,0,39,133,244,0,137,141,1,0,44,129,132,
+1,1,46,46,129,190,0,1,45,34,131,0,0,128,16,0,128,119,0,128,15,0,128,81,
+0,129,53,0,130,211,1,130,171,0,130,12,0,129,41,0,133,61,0,142,136,1,137,148,
+2,1,58,124,131,53,0,132,6,0,2,32,59,46,128,108,1,1,45,45,132,30,0,0,
+46,140,68,0,129,111,0,140,163,1,129,110,0,1,58,124,131,180,0,128,62,1,128,50,
+0,7,61,39,34,45,46,96,34,96,128,25,1,128,19,0,128,156,0,133,67,0,130,97,
+0,129,234,1,142,175,2,128,180,1,1,58,124,130,90,0,2,95,76,44,128,219,0,128,
+237,0,134,173,2,129,14,0,0,45,132,67,0,128,148,1,130,54,2,0,92,139,78,3,
+0,95,131,235,1,1,96,39,129,20,0,1,96,96,129,93,1,133,111,1,129,128,0,128,
+41,1,0,95,132,131,1,128,28,2,128,63,0,129,66,0,129,231,1,132,18,3,130,47,
+0,128,147,1,139,144,0,130,25,0,131,33,0,131,72,3,128,191,2,0,124,130,173,2,
+130,149,0,128,42,1,128,6,0,0,33,130,37,1,141,99,1,132,218,2,0,46,128,208,
+1,133,186,0,0,44,128,97,3,0,67,130,251,0,130,123,0,132,115,1,129,100,2,1,
+40,93,138,60,0,128,4,1,0,124,128,178,0,1,45,45,130,238,3,128,39,0,0,34,
+128,68,0,133,207,0,132,7,0,129,129,2,3,124,95,95,93,137,111,0,128,234,0,128,
+251,2,128,51,0,133,159,1,138,33,1,134,240,1,136,124,1,132,164,0,132,221,0,133,
+155,0,140,0,0,129,14,2,138,75,0,134,53,3,131,145,1,0,120,130,172,1,129,128,
+0,130,68,1,130,146,2,2,39,34,47,130,163,2,129,184,2,132,141,0,129,226,0,130,
+3,0,130,53,0,2,47,32,92,129,191,2,128,238,2,129,167,2,131,91,0,0,95,129,
+171,1,129,134,1,128,228,0,133,161,0,131,24,1,1,45,46,130,53,0,129,186,0,130,
+184,1,130,208,1,0,32,128,15,3,130,58,0,129,20,3,129,170,3,129,153,1,129,222,
+3,131,151,1,128,65,0,0,39,129,53,0,129,81,2,136,188,0,128,153,2,129,0,0,
+129,154,0,134,95,0,129,56,0,130,253,2,131,39,0,0,59,128,53,0,0,124,129,88,
+0,130,75,0,129,32,1,136,55,5,136,149,0,128,23,0,0,47,128,238,2,131,91,0,
+3,47,10,32,95,131,76,0,130,205,0,129,114,0,0,34,128,235,3,130,121,2,131,0,
+0,134,227,1,0,96,131,50,0,0,95,128,31,4,2,10,47,47,129,117,1,128,36,1,
+1,95,46,128,51,1,0,92,128,165,2,129,114,0,1,95,44,131,158,0,1,47,95,128,
+17,0,0,47,128,90,1,1,47,39,128,139,0,128,3,0,2,47,95,44,129,95,0,4,
+10,96,45,34,96,128,119,4,0,118,130,72,0,0,96,128,44,0,1,96,45,128,18,0,
+140,81,3,1,45,39,128,21,0,129,19,3,0,10,0,32,151,0,0,2,95,46,95,133,
+9,0,3,44,46,95,10,151,38,0,0,39,128,5,0,4,96,46,32,39,32,130,9,0,
+2,95,96,46,142,43,0,28,44,34,34,34,47,96,34,34,45,46,45,46,44,47,46,32,
+96,32,86,39,92,45,44,96,46,44,45,45,47,128,27,0,0,46,128,25,0,141,53,0,
+0,44,129,76,0,128,87,0,1,46,46,128,9,0,4,46,32,44,92,45,129,0,0,2,
+46,95,124,130,29,0,128,111,0,2,32,32,47,128,3,0,0,92,139,54,0,130,23,0,
+134,0,0,5,46,96,32,32,45,39,128,120,0,1,32,46,130,204,0,4,58,62,32,96,
+45,131,174,0,138,54,0,129,107,0,1,44,45,128,58,0,128,233,0,2,45,39,124,129,
+117,0,2,95,95,95,131,130,0,1,124,39,128,155,0,128,12,0,128,77,0,128,67,0,
+0,76,137,55,0,130,107,0,1,92,95,128,98,0,129,82,0,130,5,0,129,37,0,133,
+137,0,128,16,0,9,96,46,96,45,46,39,95,32,46,124,137,55,0,129,194,0,3,44,
+39,44,45,128,253,0,129,45,0,130,6,0,128,203,0,129,187,0,128,32,1,130,144,0,
+128,78,0,128,8,0,0,96,139,167,0,128,47,1,0,39,128,26,0,130,63,0,128,3,
+0,129,47,0,6,47,39,47,44,44,46,92,128,61,0,130,23,1,0,92,130,26,0,142,
+127,1,128,6,1,0,96,128,60,1,131,81,1,0,106,132,185,0,0,92,132,192,0,128,
+184,1,2,32,32,106,141,125,1,3,95,95,96,34,135,30,1,9,124,96,39,92,95,47,
+96,46,39,92,131,228,0,129,101,0,4,92,45,39,45,44,129,49,1,133,58,0,0,46,
+129,199,0,129,240,0,128,108,0,128,155,0,129,157,1,2,32,39,45,134,16,1,0,95,
+128,185,0,128,176,0,0,92,129,86,1,128,42,0,0,34,129,115,1,1,39,34,132,61,
+0,2,95,39,45,128,30,2,129,9,0,0,45,128,5,0,1,95,96,129,116,1,128,19,
+1,128,119,1,8,39,46,39,96,45,94,44,95,96,128,32,0,128,34,0,130,99,0,130,
+143,1,0,39,128,81,0,1,45,96,129,62,0,0,95,128,78,0,1,45,45,128,228,0,
+1,95,46,129,131,0,135,162,0,2,32,32,34,128,142,0,2,46,45,34,128,72,0,1,
+124,39,129,113,0,133,170,0,129,139,2,3,32,34,34,39,129,78,0,129,219,2,130,172,
+0,133,12,1,132,13,0,128,175,0,2,95,46,43,130,79,0,3,124,124,46,95,129,25,
+0,129,130,0,0,46,132,54,1,133,89,1,129,78,0,1,95,95,128,135,2,129,98,1,
+135,61,0,131,8,0,2,47,32,106,133,117,0,2,95,47,124,128,29,1,128,224,0,130,
+31,1,0,92,129,127,1,129,3,0,129,6,0,129,201,1,0,92,129,242,1,2,46,10,
+44,128,171,0,129,57,2,130,68,0,2,47,96,32,129,24,2,3,47,96,95,124,128,235,
+0,129,143,1,0,39,128,139,1,135,234,2,0,124,129,221,2,0,46,130,88,1,0,76,
+129,65,0,129,50,2,129,156,0,2,124,10,96,128,236,0,130,126,0,128,2,0,128,203,
+1,128,50,1,130,62,3,0,124,128,92,0,128,45,0,131,91,3,134,195,0,0,124,130,
+89,3,0,46,128,98,1,4,46,124,39,32,124,128,224,0,128,119,0,129,140,2,129,92,
+1,128,66,0,128,114,0,0,47,128,183,3,129,175,0,130,39,0,128,169,0,131,136,2,
+136,8,3,128,135,0,128,84,0,0,95,128,14,2,0,44,129,67,1,1,39,39,128,187,
+2,0,95,128,146,0,3,92,96,44,39,129,95,1,1,95,44,128,107,1,128,30,1,131,
+53,0,0,92,129,181,0,128,177,1,2,92,32,47,130,162,0,0,46,130,6,1,128,188,
+0,129,203,0,1,45,96,128,4,0,0,47,128,1,0,129,116,3,129,237,0,4,96,45,
+76,32,45,132,139,0,137,229,3,128,38,0,129,11,2,128,111,0,2,96,95,47,129,165,
+0,0,124,128,68,1,131,168,1,131,123,2,132,154,4,132,238,0,129,23,3,135,248,0,
+131,96,1,132,175,3,129,80,0,0,96,128,106,1,2,124,32,59,128,7,0,130,36,0,
+128,179,4,1,32,44,133,80,1,131,158,0,132,90,3,133,125,0,129,38,0,131,34,4,
+129,120,0,131,128,3,129,35,2,136,126,2,2,44,39,92,130,23,0,131,221,0,130,53,
+0,130,65,4,1,47,124,130,188,3,134,112,2,128,36,0,0,96,128,156,1,138,150,1,
+132,166,0,129,87,4,130,90,0,128,225,1,130,33,1,128,53,0,129,244,4,129,172,0,
+1,46,96,130,25,0,128,4,0,131,196,0,131,139,5,142,253,3,128,158,2,130,167,0,
+128,36,0,131,164,0,128,5,0,0,40,128,57,3,130,115,3,0,39,131,81,5,128,143,
+0,130,39,0,129,248,4,130,237,4,132,29,4,131,181,3,130,9,0,130,18,5,128,194,
+1,129,64,4,128,230,0,128,165,2,0,34,129,218,1,131,0,0,132,32,1,130,182,4,
+0,92,128,226,5,129,11,0,128,173,3,131,119,5,130,87,5,128,127,4,1,34,34,129,
+169,4,0,34,128,13,0,131,167,0,1,47,45,135,64,0,1,32,41,134,175,0,128,229,
+5,129,188,1,135,15,0,130,250,2,131,232,3,0,39,128,205,3,134,97,1,136,30,5,
+129,39,3,136,242,0,128,185,1,1,96,34,130,197,5,131,0,0,128,39,2,1,34,34,
+128,62,0,0,34,137,32,6,0,95,134,245,4,2,47,95,92,129,252,0,129,220,3,128,
+162,1,129,157,0,130,56,4,134,63,0,129,189,0,131,117,0,0,46,132,34,0,129,128,
+1,140,123,6,128,10,6,129,204,6,132,7,6,147,0,0,128,205,1,5,45,45,40,95,
+44,96,128,95,0,2,96,32,10,0,32,138,0,0,10,95,46,45,45,34,34,96,45,46,
+46,10,137,22,0,1,44,39,135,11,0,0,96,137,26,0,137,24,0,1,95,95,139,28,
+0,1,47,124,135,27,0,0,34,130,29,0,1,32,92,134,29,0,1,44,32,136,29,0,
+4,32,47,32,124,46,128,6,0,135,60,0,0,124,137,88,0,3,33,95,46,39,129,45,
+0,0,124,132,30,0,137,27,0,128,0,0,129,13,0,136,30,0,0,47,139,209,0,3,
+124,96,45,45,136,61,0,137,117,0,131,206,0,0,45,128,31,0,135,61,0,129,134,0,
+0,44,141,35,0,145,55,0,133,199,0,0,34,133,180,0,0,46,129,224,0,131,141,0,
+134,17,1,128,12,0,146,56,0,0,44,128,38,0,2,92,32,96,128,57,0,2,96,46,
+46,128,3,0,129,112,1,4,46,95,95,95,44,128,6,0,128,143,0,1,34,34,137,114,
+0,129,22,0,134,56,0,0,96,129,26,0,1,76,44,129,173,0,1,124,44,128,188,0,
+2,32,46,96,132,120,0,129,41,0,3,44,45,44,46,129,128,0,128,47,0,0,95,128,
+202,1,2,39,45,46,135,14,1,134,217,0,3,92,10,45,58,128,117,0,131,203,1,128,
+66,0,129,114,0,4,95,46,44,46,60,133,17,1,130,125,0,129,72,1,128,30,0,134,
+37,1,128,162,1,132,161,1,0,96,135,31,1,0,34,128,0,0,131,240,0,135,42,0,
+142,163,1,130,124,1,128,24,1,1,44,44,130,41,1,133,41,0,138,196,1,138,12,0,
+136,193,1,130,23,0,5,124,39,46,32,124,47,132,102,1,130,62,0,140,84,1,0,92,
+135,255,0,137,72,0,133,37,0,1,39,39,134,87,2,128,44,1,139,60,2,131,60,0,
+1,39,34,133,66,0,134,0,0,132,165,0,133,115,2,147,4,2,131,75,0,142,59,0,
+130,146,1,0,44,135,117,0,146,63,2,148,59,0,0,32,128,235,2,155,56,0,132,153,
+0,142,57,0,0,124,156,172,0,134,17,0,0,76,142,170,1,138,56,0,0,96,150,56,
+0,139,82,0,129,166,1,138,227,0,145,146,0,143,56,0,130,25,2,133,205,1,132,16,
+0,141,56,0,128,47,0,0,95,128,16,3,1,32,44,128,156,2,131,22,3,131,216,1,
+137,83,1,131,37,2,139,118,2,132,13,0,1,96,33,139,224,0,0,106,135,54,0,133,
+91,2,137,175,2,138,34,3,135,134,1,134,163,0,136,22,0,134,54,0,135,163,2,134,
+219,0,128,165,4,0,46,137,105,2,135,53,0,2,55,96,39,132,101,4,133,51,0,128,
+14,0,129,231,3,0,39,128,51,0,133,49,0,128,229,0,1,96,44,131,202,3,142,163,
+2,128,248,0,129,65,0,129,49,0,129,46,0,128,231,2,130,40,0,133,38,0,132,107,
+0,130,250,3,129,44,0,130,102,5,3,45,34,32,47,136,132,0,0,95,132,145,3,1,
+124,32,128,58,0,129,2,0,0,46,131,244,1,1,34,34,128,153,0,130,115,4,134,203,
+3,129,81,0,6,39,32,39,33,32,124,33,138,168,1,143,0,0,128,42,4,1,34,32,
+128,216,0,2,10,10,10,0,32,146,0,0,5,44,45,39,96,92,10,143,23,0,3,95,
+44,34,39,129,7,0,0,106,137,27,0,2,95,95,46,128,0,0,0,43,132,13,0,0,
+47,140,50,0,0,46,133,42,0,128,83,0,0,34,138,25,0,141,41,0,7,59,32,96,
+45,46,95,46,39,133,49,0,141,31,0,1,32,40,140,164,0,130,138,0,129,98,0,0,
+39,131,49,0,0,124,138,170,0,0,46,129,5,0,0,92,138,49,0,129,13,0,1,45,
+45,128,100,0,129,105,0,131,51,0,0,44,130,52,0,0,44,130,48,0,128,79,0,0,
+89,143,52,0,1,96,45,131,105,0,129,21,0,2,96,46,96,132,55,0,0,108,130,124,
+0,0,92,128,26,0,3,46,95,44,92,128,24,0,130,136,0,139,160,0,133,192,0,0,
+44,128,114,0,1,32,108,128,55,0,2,46,44,45,134,85,0,128,132,0,129,176,0,130,
+126,0,138,184,0,135,127,0,128,33,0,1,32,108,129,64,1,140,9,1,3,96,34,45,
+45,130,126,0,140,23,0,129,192,0,131,32,0,128,142,0,128,83,0,2,41,10,46,130,
+74,0,129,221,0,139,0,0,140,112,0,136,185,0,130,202,0,1,39,10,131,207,0,143,
+33,0,142,56,0,128,254,0,129,1,2,129,190,1,2,46,32,92,129,136,1,128,90,1,
+0,46,128,100,1,130,0,0,128,23,2,133,147,0,139,84,1,131,166,0,128,27,0,3,
+96,45,34,39,128,90,0,133,108,2,0,96,129,74,2,2,46,46,95,130,81,0,137,42,
+1,147,0,0,128,142,0,142,166,2,1,47,96,138,99,0,0,46,142,201,0,134,200,0,
+134,154,2,133,57,0,142,221,0,128,203,0,147,58,0,1,32,76,139,59,0,0,47,142,
+25,1,131,46,2,141,185,0,130,78,0,0,124,137,59,0,129,91,2,3,124,44,45,34,
+130,105,0,133,109,0,131,7,0,139,132,1,131,236,1,136,59,0,131,255,2,131,119,0,
+133,160,2,136,162,1,136,61,0,132,39,2,134,59,0,132,57,3,134,239,0,128,57,0,
+141,222,1,133,60,0,133,98,2,132,59,0,133,115,3,136,239,0,133,60,0,133,0,4,
+133,137,0,141,158,3,136,219,0,135,102,0,0,92,132,11,0,136,29,2,1,92,95,134,
+57,0,128,102,0,131,105,4,133,48,0,128,7,0,0,76,136,157,1,132,22,0,136,38,
+1,134,251,1,128,67,0,131,118,0,130,35,0,128,12,4,129,7,0,136,101,0,133,18,
+1,142,225,2,128,176,2,0,44,135,57,0,128,38,0,131,101,0,134,58,0,133,108,0,
+128,21,0,134,126,3,129,33,0,128,112,0,132,232,0,130,13,0,128,250,2,131,50,0,
+132,65,2,134,131,3,0,124,136,181,3,1,124,44,135,109,0,129,178,3,128,246,2,0,
+44,130,193,0,129,118,0,129,55,0,0,47,134,196,1,134,18,1,130,95,0,133,241,4,
+3,32,39,45,96,131,10,4,1,32,106,132,255,0,3,47,46,34,55,129,119,3,0,46,
+137,205,2,0,44,128,37,0,142,206,5,134,31,0,129,163,3,4,47,32,95,47,95,136,
+49,0,141,27,3,128,90,0,133,194,0,3,96,34,39,47,131,6,6,136,79,1,133,23,
+5,147,50,0,129,226,3,141,148,2,138,5,3,129,67,4,1,44,46,132,202,0,139,40,
+0,0,92,133,20,0,139,48,0,1,47,95,128,80,6,136,128,0,135,52,2,134,197,0,
+0,95,140,147,0,129,95,1,129,154,4,129,90,0,128,60,0,134,234,0,2,45,39,58,
+128,128,3,1,96,92,129,194,1,144,197,0,0,76,128,152,0,128,165,4,137,244,4,128,
+60,0,128,101,0,128,47,0,128,32,4,145,39,7,147,0,0,0,96,128,104,1,0,10,
+0,32,141,0,0,7,46,34,45,44,46,95,95,10,142,24,0,1,96,46,134,6,0,0,
+44,140,29,0,3,46,45,45,39,128,5,0,4,46,95,44,39,34,128,9,0,1,96,46,
+139,31,0,130,56,0,0,46,128,33,0,133,73,0,0,39,139,31,0,130,89,0,0,47,
+135,15,0,0,44,140,31,0,128,33,0,4,32,32,39,45,45,129,38,0,2,44,45,34,
+142,29,0,2,32,96,34,128,32,0,4,32,124,32,32,92,143,182,0,1,32,32,128,55,
+0,3,92,44,32,124,145,26,0,4,32,96,45,45,89,133,153,0,2,95,95,95,140,184,
+0,137,0,0,0,92,130,5,0,0,76,128,227,0,143,101,0,2,95,46,44,138,203,0,
+0,60,128,2,0,131,47,0,137,36,0,139,53,0,2,44,39,32,135,17,1,128,55,0,
+0,44,131,58,0,0,124,132,104,0,132,0,0,2,40,32,96,136,54,0,2,46,46,47,
+132,38,0,137,25,1,128,247,0,128,26,0,0,92,138,23,0,2,92,32,92,136,111,0,
+128,107,0,1,44,46,128,30,0,137,33,0,128,179,0,130,127,0,3,124,124,92,108,137,
+80,0,0,41,128,106,1,0,34,135,7,1,0,44,129,60,0,133,253,0,133,77,0,4,
+46,45,46,96,45,129,237,1,132,124,0,135,231,1,2,95,46,95,134,253,1,128,30,0,
+132,212,1,128,141,0,135,251,1,128,246,0,128,117,1,129,25,0,138,235,0,0,47,130,
+44,0,1,46,46,131,92,1,129,147,1,134,17,2,0,92,136,184,0,7,124,92,95,95,
+32,45,32,95,128,93,0,0,96,129,252,0,137,60,0,129,125,1,132,125,0,128,150,0,
+136,93,1,129,251,0,134,240,1,4,46,46,46,45,34,130,33,0,0,96,129,181,2,137,
+62,0,130,195,0,134,65,0,136,145,2,2,32,124,76,128,118,0,136,14,0,134,4,0,
+142,64,0,130,2,2,131,67,0,0,44,138,66,0,130,196,0,136,129,1,140,67,0,138,
+66,0,130,216,1,129,249,1,138,21,0,6,44,46,32,44,96,46,95,128,183,0,133,139,
+0,133,67,0,129,15,0,0,44,128,205,0,139,66,0,129,68,0,128,78,1,0,47,138,
+247,1,4,92,34,96,95,47,128,161,0,128,67,0,1,92,95,128,81,0,131,223,1,1,
+32,43,129,183,3,129,15,1,128,223,2,134,53,1,0,44,130,114,3,0,32,128,90,2,
+0,10,128,8,0,135,80,1,2,46,45,102,132,224,1,130,128,2,128,26,0,133,97,0,
+128,157,1,128,12,4,132,87,1,129,149,0,130,92,3,131,14,0,128,5,2,0,10,138,
+162,0,0,96,131,121,3,131,126,2,128,11,0,136,26,0,0,92,133,178,1,2,44,95,
+124,129,22,0,130,117,4,128,241,1,130,131,3,2,96,10,124,133,178,3,128,202,1,128,
+251,3,131,250,2,0,92,128,187,0,128,23,0,134,20,2,131,19,0,128,48,1,0,95,
+128,147,2,1,39,34,128,249,1,129,146,1,129,50,1,132,54,1,2,92,10,124,130,9,
+0,131,1,1,132,184,1,134,174,0,129,10,1,128,43,2,128,111,1,140,106,3,1,96,
+47,129,33,0,129,10,0,131,40,0,1,46,124,130,71,0,133,69,0,132,73,0,2,59,
+46,44,131,9,1,134,23,0,130,91,0,0,96,128,216,0,130,103,1,0,46,129,174,1,
+0,95,132,22,5,0,59,129,100,0,0,124,130,71,0,137,20,4,128,0,0,0,86,145,
+29,2,131,237,4,129,5,0,130,92,0,129,74,4,130,1,1,0,33,130,100,0,130,71,
+0,138,9,2,1,95,44,128,137,0,129,0,0,0,55,141,94,0,128,45,0,134,7,3,
+135,6,4,130,60,0,0,96,128,71,0,130,30,0,136,69,4,1,46,45,131,7,0,131,
+55,1,138,16,3,128,19,4,140,41,6,133,242,5,128,71,0,129,246,3,135,69,0,130,
+177,5,131,28,0,143,71,0,136,63,0,130,87,2,0,45,134,56,6,138,54,6,132,223,
+0,133,92,1,142,71,0,131,24,0,0,92,128,237,3,128,197,1,1,39,47,137,58,0,
+131,93,0,136,241,3,141,18,1,136,240,5,1,46,39,135,57,0,128,91,4,139,106,0,
+139,137,5,136,161,1,0,58,128,136,2,0,46,137,114,0,129,134,2,128,218,4,132,19,
+3,129,182,0,135,45,1,136,24,7,0,47,128,207,2,138,221,6,129,101,5,128,239,3,
+128,146,3,130,64,1,130,96,5,0,62,129,200,1,0,39,129,240,1,128,75,0,129,149,
+4,0,47,142,180,6,135,82,0,1,47,34,136,240,1,128,185,0,130,14,0,0,39,142,
+221,7,2,47,95,124,128,121,0,3,92,32,44,34,139,210,0,128,197,0,5,96,95,95,
+39,45,40,145,89,7,0,47,128,46,0,2,39,34,92,137,247,2,131,180,0,128,8,1,
+128,184,0,3,124,34,32,10,0,32,139,0,0,2,95,44,46,132,0,0,2,95,95,10,
+137,24,0,2,44,45,39,137,14,0,3,34,96,45,46,136,31,0,0,44,138,28,0,132,
+0,0,137,34,0,146,32,0,130,0,0,0,92,132,35,0,151,33,0,128,0,0,133,72,
+0,2,46,39,92,140,25,0,3,44,34,34,46,133,111,0,131,36,0,4,46,95,46,39,
+124,138,35,0,1,47,32,128,15,0,0,96,139,111,0,129,33,0,138,37,0,128,173,0,
+128,129,0,0,124,133,19,0,0,96,132,114,0,142,39,0,5,39,45,46,95,44,39,134,
+39,0,0,124,133,80,0,2,46,96,46,140,194,0,1,96,46,128,17,0,129,84,0,131,
+168,0,1,32,124,134,16,1,0,108,149,230,0,1,39,96,128,204,0,1,95,47,131,114,
+0,133,130,0,128,54,0,3,46,95,39,45,130,67,0,135,168,1,1,32,95,129,89,0,
+2,45,34,32,128,17,1,131,1,1,4,96,10,96,46,34,129,0,0,128,162,0,129,51,
+0,2,46,44,45,133,0,0,0,39,136,154,0,128,98,0,128,153,0,129,224,1,1,46,
+10,134,157,0,2,32,96,34,129,101,0,1,95,95,132,93,0,128,226,0,136,105,1,128,
+10,0,131,13,0,3,92,10,92,95,132,109,0,134,29,1,0,96,130,114,0,132,89,0,
+136,203,0,134,50,0,139,24,0,139,154,1,141,26,0,131,13,0,0,76,130,248,0,135,
+26,0,128,57,1,129,207,0,128,158,0,130,0,0,1,46,39,134,25,0,0,106,134,81,
+0,0,124,132,34,2,1,96,46,130,195,0,133,217,0,136,110,0,132,79,0,0,46,129,
+18,0,131,73,1,133,51,0,130,100,1,1,45,44,133,241,0,137,198,0,2,32,96,55,
+129,221,0,128,51,0,132,124,1,136,51,0,129,29,0,133,87,2,133,94,2,132,112,2,
+132,122,0,132,125,0,130,6,0,0,95,128,66,3,128,41,1,139,56,3,130,92,1,133,
+152,0,141,64,0,129,55,0,135,198,0,137,93,2,133,26,2,137,161,1,0,118,128,31,
+1,136,68,0,133,45,0,129,16,0,130,216,0,1,47,124,133,86,0,141,122,3,135,16,
+0,130,32,0,128,208,1,0,92,130,71,2,128,172,0,133,78,0,129,65,0,128,3,0,
+2,47,46,39,142,166,3,139,16,1,138,11,1,134,140,0,129,148,1,128,184,1,1,44,
+106,128,17,0,3,96,47,32,46,129,204,2,131,85,4,128,216,1,148,69,0,0,44,128,
+41,1,135,124,0,132,80,0,0,34,134,201,1,0,124,134,204,0,129,3,2,132,116,0,
+142,69,0,131,208,0,131,71,0,133,70,0,135,5,1,0,92,136,11,0,131,170,1,130,
+15,0,0,106,140,69,0,134,19,4,130,144,0,0,55,129,40,3,138,4,3,131,148,0,
+138,117,1,128,73,0,148,68,0,130,143,0,0,47,130,163,2,0,96,136,19,0,138,22,
+3,131,92,0,128,131,3,140,67,0,138,96,3,0,47,129,179,2,1,45,45,137,67,0,
+129,36,3,134,0,0,129,29,0,141,64,0,137,75,1,133,10,0,137,64,0,141,46,0,
+138,209,4,0,41,141,131,0,143,179,1,0,55,129,158,3,0,44,128,67,6,128,122,0,
+141,108,1,144,46,0,145,51,6,128,16,2,128,66,0,128,5,0,1,39,10,0,32,129,
+0,0,1,95,95,130,6,0,152,0,0,7,95,46,45,45,39,34,55,10,129,11,0,6,
+96,46,32,96,45,45,46,150,51,0,5,44,45,39,95,44,45,128,7,0,0,39,130,46,
+0,128,7,0,128,51,0,1,45,46,128,2,0,144,44,0,3,47,39,32,46,128,31,0,
+128,37,0,0,124,131,45,0,128,93,0,134,100,0,132,156,0,3,46,46,46,95,130,162,
+0,0,47,130,2,0,128,0,0,2,45,32,106,131,45,0,135,47,0,129,9,0,2,45,
+34,34,133,87,0,1,34,32,128,23,0,131,44,0,128,7,0,133,44,0,2,32,32,92,
+131,16,0,141,134,0,0,96,145,43,0,130,44,0,142,42,0,135,231,0,132,223,0,130,
+0,0,3,39,46,95,39,141,17,1,128,8,1,132,9,0,132,219,0,133,0,0,0,124,
+132,134,0,133,39,0,0,124,129,18,0,1,32,32,128,231,0,0,45,137,83,0,129,41,
+0,0,124,129,217,0,134,39,0,0,95,132,41,0,137,21,0,131,158,1,128,33,1,138,
+57,0,0,47,128,57,0,129,41,0,134,113,0,134,57,0,129,123,0,1,95,44,130,171,
+0,128,48,1,131,253,0,1,45,46,137,60,0,0,124,128,205,0,134,186,0,129,15,0,
+2,95,124,95,128,196,1,2,95,95,33,129,27,0,0,47,131,73,0,137,23,1,0,92,
+129,61,0,1,44,45,132,167,1,1,46,61,143,43,1,0,46,128,161,0,128,81,0,7,
+47,96,46,124,32,44,96,44,132,9,2,1,95,44,128,49,0,130,28,1,130,154,0,128,
+13,0,132,24,1,129,49,2,134,128,0,128,83,0,1,95,44,130,70,2,128,118,2,0,
+39,129,77,2,130,216,0,132,128,0,128,61,0,0,44,128,191,0,129,93,0,1,95,41,
+128,104,0,129,11,0,129,48,0,0,45,128,43,0,129,57,2,1,46,95,128,40,0,131,
+98,2,128,87,0,129,163,0,129,11,0,132,26,1,1,47,10,128,183,1,4,95,39,32,
+34,34,132,32,0,1,96,46,129,56,0,129,59,0,133,17,0,0,44,138,0,2,128,135,
+0,130,37,0,128,207,0,128,142,0,129,53,1,132,127,2,135,59,1,129,27,3,132,0,
+0,128,0,2,138,29,0,135,12,0,131,230,0,130,55,1,129,125,1,139,34,0,0,39,
+129,132,0,132,202,2,136,195,1,128,1,1,134,54,2,132,22,0,134,182,1,134,133,0,
+131,173,0,136,53,0,0,76,136,63,0,128,62,0,133,39,0,128,33,0,130,234,0,136,
+248,1,0,96,130,210,3,132,246,0,137,119,0,134,117,0,129,73,1,134,81,0,128,9,
+2,131,58,4,130,6,1,136,74,3,134,206,0,137,67,0,132,93,0,130,63,1,0,108,
+133,10,1,0,106,130,34,0,129,236,1,0,46,135,202,0,140,60,0,138,68,0,129,71,
+0,128,152,1,129,188,0,133,27,0,128,132,0,132,178,0,128,145,1,140,103,3,150,68,
+0,131,124,0,131,22,0,131,203,2,0,44,129,160,0,129,229,2,142,172,3,134,91,1,
+136,73,1,134,118,3,131,121,4,129,76,0,1,44,39,137,50,3,142,68,0,3,32,124,
+96,34,129,110,1,1,46,92,129,157,2,130,210,2,130,32,2,128,52,0,132,150,3,128,
+88,3,132,64,0,134,113,2,134,228,4,134,101,4,150,207,0,130,63,4,129,58,0,132,
+26,0,134,139,0,137,207,4,138,133,2,140,141,5,129,146,0,129,225,0,0,92,128,57,
+0,128,26,1,128,99,5,0,39,131,236,2,144,66,0,0,47,133,19,1,136,67,0,1,
+95,44,131,176,2,129,44,2,130,26,2,128,252,2,130,78,1,141,41,5,134,225,0,129,
+67,0,1,44,39,128,46,2,131,55,5,135,103,3,128,66,0,0,105,128,3,3,128,69,
+6,134,217,1,139,63,0,133,118,0,133,153,1,132,255,3,137,14,1,128,0,4,132,17,
+0,128,169,3,141,125,5,139,147,2,141,79,1,1,39,39,132,138,0,129,67,0,149,58,
+0,133,76,4,0,95,138,201,5,1,32,96,129,215,1,128,212,1,138,54,0,133,198,0,
+133,12,0,130,162,4,139,55,4,138,253,2,131,26,0,133,148,7,133,115,0,1,34,39,
+137,50,0,140,95,2,1,96,45,129,175,4,1,96,34,128,0,0,138,8,1,0,55,136,
+84,0,142,8,2,145,0,0,128,189,4,1,45,39,128,167,2,2,44,39,34,128,129,5,
+0,10,0,32,147,0,0,1,95,10,138,13,0,12,44,46,46,45,34,34,34,45,45,39,
+32,96,44,128,10,0,0,46,136,30,0,1,44,39,132,36,0,3,95,46,46,32,128,33,
+0,3,44,32,32,124,134,30,0,1,95,47,129,4,0,128,49,0,2,39,32,124,129,15,
+0,0,46,129,7,0,130,9,0,130,49,0,0,95,129,103,0,129,80,0,128,31,0,128,
+0,0,6,96,45,34,43,46,46,95,131,31,0,0,96,130,43,0,10,96,45,46,46,44,
+39,44,45,45,46,96,128,116,0,129,25,0,1,44,46,147,178,0,130,65,0,2,106,32,
+55,129,6,0,2,108,32,92,129,90,0,1,124,46,128,176,0,152,0,0,0,47,132,139,
+0,1,106,124,128,6,0,128,94,0,0,96,145,90,0,133,173,0,128,46,0,4,32,76,
+96,46,96,128,171,0,6,44,39,124,92,32,32,92,129,229,0,1,96,46,128,155,0,128,
+157,0,128,182,0,134,15,1,3,96,34,39,45,128,73,0,130,24,1,1,92,32,129,48,
+0,129,69,0,128,71,0,0,108,131,23,1,0,89,133,80,0,0,96,129,58,0,134,162,
+0,0,118,130,8,0,128,62,0,1,44,46,129,75,1,131,49,1,133,105,1,146,154,0,
+129,92,1,131,5,0,131,9,0,1,96,46,129,50,0,135,125,1,143,52,0,131,39,0,
+0,108,130,41,1,132,174,0,0,94,128,36,0,1,124,76,136,208,1,0,96,134,202,0,
+130,0,0,0,76,132,7,0,1,43,46,128,79,1,129,25,0,128,153,0,0,92,128,103,
+0,0,124,131,0,1,134,0,0,0,46,128,205,0,129,6,1,130,44,2,0,39,128,244,
+0,0,45,129,45,0,0,108,129,63,0,128,58,2,132,73,1,128,2,0,137,53,0,128,
+74,0,1,32,44,129,226,1,129,0,0,0,76,133,118,0,129,91,1,129,4,0,130,58,
+2,129,33,0,0,39,128,162,0,132,59,1,128,13,0,1,45,34,128,215,0,0,47,128,
+7,0,0,46,129,120,1,128,31,0,133,230,0,128,50,0,0,76,128,123,0,129,108,2,
+129,115,2,0,94,130,13,1,128,55,0,129,95,2,1,46,39,129,53,0,129,122,1,128,
+222,0,129,104,1,131,112,2,131,57,0,129,156,1,128,182,0,128,138,1,130,167,0,130,
+120,1,129,69,1,132,42,0,129,183,0,2,44,45,39,132,8,2,129,60,1,132,57,0,
+128,55,0,0,34,128,244,2,138,42,2,129,167,0,130,176,0,131,55,0,132,66,0,135,
+71,2,129,56,0,128,55,0,129,37,1,129,191,0,128,26,1,2,34,34,96,130,103,1,
+0,10,130,157,1,129,38,0,3,106,32,95,124,129,106,3,131,90,0,133,128,1,0,124,
+128,23,0,0,44,135,141,2,136,169,0,128,121,1,9,44,34,46,95,44,45,43,39,32,
+47,129,84,2,0,94,129,79,1,0,47,128,139,1,128,0,0,2,44,46,76,128,176,2,
+141,11,2,129,192,2,130,40,2,0,124,133,191,3,133,102,0,143,251,2,128,160,1,137,
+18,0,1,92,106,139,247,1,145,89,3,131,189,1,128,58,0,128,13,4,134,74,0,135,
+152,2,138,35,0,135,102,4,3,95,96,46,89,133,124,2,132,115,0,129,166,2,140,55,
+0,138,56,0,0,95,128,29,4,140,183,2,130,30,0,128,110,0,139,166,0,131,56,2,
+130,112,3,129,114,1,137,23,4,128,164,1,132,55,0,129,60,4,140,109,0,128,147,1,
+135,58,1,138,77,4,129,203,2,131,55,0,130,183,1,138,54,0,132,56,1,137,116,3,
+137,26,0,130,55,0,130,6,4,145,54,0,131,30,0,139,87,1,131,229,0,129,31,0,
+0,76,128,218,2,1,39,41,139,164,0,132,187,1,131,91,2,142,238,3,1,32,93,132,
+42,1,128,23,2,139,216,5,131,106,0,129,91,0,1,96,45,130,56,5,132,40,1,132,
+231,0,0,47,129,77,0,133,95,1,128,5,2,140,60,0,1,95,44,135,42,4,130,35,
+1,128,129,2,134,33,1,128,180,5,2,94,46,45,137,46,0,129,192,5,142,99,0,0,
+118,129,169,2,129,155,0,128,52,5,134,43,2,128,15,0,1,58,39,130,77,4,129,79,
+4,132,197,2,1,45,39,134,62,0,133,20,0,0,46,132,0,5,1,39,44,128,78,0,
+2,34,39,96,129,51,0,132,90,0,138,108,0,132,0,0,131,107,3,135,48,2,128,102,
+0,0,92,130,17,2,128,102,0,1,39,32,143,47,0,132,0,0,130,51,2,130,54,2,
+3,39,10,10,10,0,32,143,0,0,2,95,44,46,132,0,0,1,95,10,141,26,0,2,
+46,45,39,130,7,0,1,95,95,129,6,0,1,96,45,140,34,0,0,44,131,30,0,128,
+8,0,129,7,0,0,92,132,21,0,2,96,46,10,131,84,0,134,25,0,136,42,0,0,
+124,128,10,0,9,34,34,34,58,96,46,95,46,10,47,131,47,0,2,45,45,43,129,43,
+0,128,51,0,132,44,0,7,95,46,39,44,39,44,124,34,128,44,0,5,96,32,92,96,
+10,92,130,126,0,131,44,0,0,34,131,35,0,2,95,44,45,129,9,0,2,124,32,47,
+128,63,0,129,18,0,3,108,32,76,92,128,156,0,4,96,34,45,45,45,128,202,0,133,
+117,0,0,34,132,55,0,0,124,128,32,0,133,9,0,128,1,0,132,198,0,129,128,0,
+0,96,129,123,0,128,105,0,133,0,0,0,39,131,17,0,130,186,0,0,59,133,41,0,
+0,106,133,188,0,137,41,0,128,40,0,1,95,96,128,204,0,0,39,130,229,0,1,124,
+95,132,28,1,132,33,0,128,214,0,0,39,128,56,1,135,186,0,129,17,0,128,19,0,
+129,9,0,128,232,0,129,37,1,134,45,0,129,205,0,0,34,130,170,0,128,99,1,142,
+161,1,130,34,0,129,220,0,130,230,0,131,181,0,137,132,0,140,46,0,0,70,131,40,
+0,132,226,0,1,96,46,131,46,0,1,95,95,129,225,1,143,49,0,133,160,1,133,18,
+1,131,162,1,133,55,1,131,42,0,1,124,32,132,57,0,128,152,1,134,37,0,134,47,
+0,0,46,132,29,1,131,0,0,129,5,2,129,15,0,0,47,129,25,1,132,206,1,129,
+60,0,136,55,1,1,44,34,133,252,0,130,98,0,137,81,1,0,124,129,5,2,128,47,
+0,134,19,0,129,158,0,128,132,0,136,35,0,130,132,1,136,134,2,129,149,2,132,10,
+0,0,47,132,100,2,1,96,76,134,154,0,130,67,0,128,211,1,150,62,0,130,49,1,
+128,49,2,132,234,2,132,83,0,136,120,1,0,44,138,111,1,145,62,0,137,192,0,128,
+58,1,129,128,2,132,60,1,0,46,128,47,1,138,173,1,145,62,0,0,46,133,47,0,
+134,103,2,134,171,2,134,157,1,136,62,0,0,106,139,62,0,130,49,0,133,239,0,132,
+137,0,1,124,39,130,208,0,1,45,60,140,25,2,128,102,0,0,47,139,61,0,131,232,
+0,133,192,0,0,46,128,170,1,1,44,44,130,77,1,129,189,3,138,215,0,129,218,1,
+140,60,0,129,122,1,1,46,39,130,85,2,128,55,0,132,63,1,128,255,1,128,55,0,
+1,124,47,128,27,3,138,101,2,0,96,141,92,4,132,119,0,133,36,2,129,6,1,128,
+232,1,128,35,3,0,44,129,68,1,128,59,1,129,60,3,1,46,46,130,1,1,141,50,
+1,130,0,0,133,244,0,134,17,3,0,92,128,159,2,133,164,3,128,134,0,2,46,45,
+46,130,146,4,140,48,1,131,108,0,0,39,135,158,0,131,108,1,131,43,0,129,162,3,
+0,39,130,192,0,128,2,0,0,124,128,182,0,145,120,0,128,100,0,132,158,0,0,44,
+129,106,4,129,19,3,135,237,0,129,179,4,4,45,45,59,34,73,146,58,0,129,27,0,
+128,47,4,139,179,3,0,44,129,71,1,2,46,95,47,128,79,0,2,46,45,49,147,115,
+0,138,238,2,131,112,1,132,139,3,128,32,1,128,2,0,1,95,45,155,54,0,131,59,
+0,128,172,1,129,183,0,6,46,46,96,39,45,45,94,129,234,0,0,10,0,32,159,0,
+0,5,44,45,45,46,46,10,159,39,0,0,47,130,5,0,0,96,160,42,0,1,47,124,
+132,8,0,160,44,0,1,47,32,133,44,0,1,32,124,157,44,0,128,129,0,0,106,165,
+44,0,128,43,0,134,88,0,1,32,96,155,44,0,0,39,128,4,1,128,3,0,133,0,
+0,0,92,153,45,0,137,40,0,131,0,0,0,76,152,46,0,131,51,1,138,0,0,0,
+43,150,46,0,2,46,58,46,145,21,0,154,194,0,2,44,34,96,128,32,0,129,3,0,
+131,14,0,4,46,46,45,46,95,152,102,0,128,19,1,0,124,129,45,0,0,76,133,248,
+0,3,32,95,46,39,130,62,0,148,170,1,128,112,1,3,96,46,44,92,130,42,0,128,
+61,0,2,44,46,39,129,67,0,0,43,128,49,0,147,97,0,131,76,0,1,32,124,131,
+39,1,5,124,34,32,96,34,34,130,8,1,1,96,44,147,98,0,129,165,1,128,35,0,
+0,39,132,42,1,0,96,128,191,0,128,0,0,128,102,0,129,137,1,144,229,1,1,44,
+39,131,215,1,143,136,1,130,0,0,0,89,142,49,0,133,9,2,144,139,1,130,176,0,
+142,99,0,129,40,0,128,49,0,148,96,0,128,22,0,141,249,0,130,89,0,1,92,45,
+147,47,0,131,29,0,140,190,1,130,19,0,148,144,0,134,120,0,139,51,0,131,226,1,
+3,44,96,39,45,143,37,2,136,170,0,140,141,2,0,92,134,103,0,129,9,0,150,154,
+2,143,153,1,133,142,1,140,22,0,138,69,0,141,57,1,0,96,136,83,0,1,95,44,
+138,25,0,137,171,0,141,107,0,135,167,3,141,0,0,133,54,0,155,51,0,0,34,139,
+120,1,130,128,2,143,49,0,134,57,4,1,32,45,140,48,0,129,18,3,0,45,141,47,
+0,149,156,1,130,27,0,1,39,47,144,206,1,133,171,0,142,72,1,139,44,0,138,88,
+0,140,136,0,0,106,138,43,0,128,3,3,128,9,3,150,180,4,137,42,0,0,124,130,
+124,2,1,96,34,128,61,3,156,41,0,137,231,4,142,106,4,135,4,1,0,44,129,180,
+3,134,0,0,0,108,137,215,1,0,46,135,43,1,128,58,6,128,59,6,135,133,0,131,
+85,4,0,95,134,33,0,134,201,2,132,35,0,130,236,5,0,44,132,29,0,136,8,1,
+128,231,1,0,95,129,43,0,0,59,130,26,0,1,44,39,128,85,0,134,97,0,0,96,
+133,50,0,131,47,0,129,98,0,130,43,0,0,95,128,243,0,1,10,40,133,202,0,128,
+255,0,0,95,130,37,0,1,96,46,130,0,0,0,94,128,131,0,3,32,10,10,10,0,
+32,131,0,0,2,44,45,46,132,9,0,162,0,0,8,95,95,95,46,46,95,10,32,95,
+130,13,0,1,96,46,129,2,0,161,54,0,4,44,45,34,34,34,131,11,0,1,39,44,
+128,64,0,1,96,46,133,56,0,2,96,46,92,159,61,0,0,39,135,11,0,2,46,46,
+45,128,13,0,2,96,46,10,129,4,0,0,95,133,59,0,155,134,0,137,63,0,3,44,
+39,95,44,128,66,0,129,246,0,0,92,128,67,0,138,60,0,151,69,0,135,65,0,2,
+44,45,39,128,204,0,132,12,0,128,126,0,129,136,0,140,61,0,148,208,0,0,47,130,
+7,1,128,0,0,0,34,128,65,0,135,145,0,2,32,32,76,128,2,0,134,69,0,135,
+71,0,145,70,0,128,135,0,1,95,46,128,65,0,129,190,0,0,91,139,26,0,0,124,
+128,2,0,136,69,0,134,71,0,143,211,0,0,47,135,206,0,0,124,129,54,0,132,86,
+1,3,45,45,46,46,128,163,0,140,69,0,133,64,0,128,164,0,140,68,0,129,43,0,
+133,69,0,1,106,32,129,84,1,134,121,0,144,69,0,131,206,0,140,140,0,0,39,136,
+68,0,129,67,0,137,21,1,144,209,0,147,70,0,138,68,0,138,12,0,151,69,0,130,
+70,0,0,108,148,206,0,1,32,47,140,136,0,130,156,0,1,32,39,143,69,0,5,32,
+76,95,95,76,46,131,12,3,141,68,0,0,43,132,67,0,0,95,128,111,2,132,0,0,
+128,17,0,0,106,142,68,0,130,107,0,128,3,0,0,34,131,175,1,137,67,0,128,48,
+0,129,172,2,1,45,39,133,111,2,132,185,0,142,207,0,2,47,44,34,130,18,2,132,
+246,1,0,39,129,79,0,132,125,0,0,47,136,151,1,137,20,1,0,70,140,67,0,0,
+47,129,8,2,0,47,134,19,1,0,46,134,134,0,143,11,1,135,59,2,139,67,0,130,
+76,2,128,54,0,131,82,2,2,32,32,93,132,57,0,150,65,0,143,67,0,128,27,4,
+1,92,34,129,46,0,133,67,0,131,7,0,1,44,39,128,3,1,137,0,0,0,39,129,
+71,3,128,137,4,131,49,1,139,67,0,128,50,0,1,92,96,128,27,0,134,118,0,0,
+70,139,66,4,141,0,0,0,96,128,96,1,143,59,3,129,172,1,135,53,4,128,50,3,
+0,58,128,251,4,0,95,134,234,1,143,9,2,144,243,2,128,69,0,136,70,3,134,135,
+1,0,96,128,189,0,132,187,0,142,14,1,139,31,2,128,253,1,128,219,1,129,234,0,
+147,90,4,128,186,0,137,98,0,144,81,1,128,251,0,2,60,106,45,130,204,0,129,149,
+3,130,136,0,143,121,0,0,96,128,61,2,134,21,0,141,234,2,128,79,1,2,60,124,
+96,128,137,0,136,150,1,0,96,136,245,2,142,240,0,1,95,44,128,176,1,137,65,0,
+128,22,0,128,65,0,0,46,128,62,1,135,134,1,0,124,128,41,0,0,96,146,124,6,
+0,89,128,0,2,0,95,135,86,5,133,112,0,142,42,1,130,47,3,128,66,0,129,87,
+0,135,0,0,0,44,128,95,6,0,45,143,170,3,139,218,5,1,46,89,135,75,1,3,
+96,34,34,46,130,83,2,128,33,0,1,46,34,145,228,3,135,59,0,128,190,0,0,124,
+129,54,0,135,17,0,1,96,43,129,57,1,145,147,3,131,30,0,128,188,1,1,46,32,
+130,249,1,0,124,131,181,4,135,108,6,130,12,0,142,68,3,135,44,6,128,4,0,130,
+5,0,129,207,2,130,48,0,132,235,0,131,152,3,148,56,0,128,188,1,128,198,0,131,
+197,3,129,172,1,130,109,0,128,4,2,130,66,0,129,114,0,128,11,0,146,56,0,130,
+217,1,0,124,131,223,1,130,5,0,130,159,0,133,108,5,2,96,32,44,128,142,0,156,
+55,0,129,102,0,131,146,1,131,70,0,0,46,130,118,3,0,95,145,82,1,130,54,0,
+128,184,3,138,83,2,1,46,95,128,207,2,128,0,0,128,45,1,139,63,2,136,52,0,
+132,94,4,137,228,5,131,52,0,128,54,0,145,50,0,0,108,130,42,0,0,92,128,136,
+0,146,102,1,2,34,32,10,0,32,139,0,0,3,44,96,46,10,140,18,0,3,76,32,
+32,92,140,19,0,0,44,129,4,0,140,20,0,0,106,131,6,0,140,21,0,130,41,0,
+142,22,0,132,43,0,128,0,0,0,96,138,23,0,133,45,0,128,0,0,2,46,95,95,
+135,26,0,3,44,45,39,89,135,26,0,0,96,128,2,0,0,45,133,166,0,2,46,45,
+39,130,19,0,0,46,128,48,0,1,95,46,132,13,0,136,32,0,2,47,95,95,137,96,
+0,1,45,46,135,12,0,131,147,0,4,47,40,95,95,41,137,91,0,0,32,132,66,0,
+131,86,0,129,35,0,0,124,140,17,1,1,96,34,136,34,0,129,33,1,129,36,0,2,
+96,46,45,130,0,0,0,46,137,111,0,136,0,0,3,124,10,32,44,137,89,0,148,36,
+0,0,70,139,15,0,147,36,0,139,22,0,148,36,0,0,96,136,137,0,137,121,0,137,
+135,1,130,184,0,0,43,131,184,0,147,34,0,1,32,47,131,71,1,0,92,147,29,0,
+131,34,0,150,25,0,0,124,128,132,0,132,168,1,0,96,136,121,1,139,34,2,148,120,
+0,133,218,0,135,58,2,137,209,0,132,0,0,0,95,128,26,2,152,153,0,131,27,1,
+138,124,2,2,96,45,44,129,42,2,130,0,0,0,44,131,47,2,150,154,0,135,93,1,
+130,226,1,154,240,0,156,197,0,130,0,2,149,65,0,128,136,0,129,217,0,146,200,1,
+133,151,3,128,161,1,1,44,39,136,18,3,0,39,138,45,0,130,79,0,128,198,0,135,
+89,3,140,0,0,0,46,133,24,3,136,223,3,0,46,129,219,3,140,193,0,0,124,137,
+132,3,138,129,0,3,45,39,34,39,128,86,3,129,43,1,137,202,0,1,46,44,138,26,
+2,128,167,0,0,39,128,141,0,142,82,1,129,157,3,133,244,0,0,44,128,140,0,137,
+203,0,144,95,2,131,20,2,0,92,136,188,3,133,232,1,0,34,131,194,3,2,124,32,
+124,140,65,0,129,243,3,138,215,1,130,60,0,3,124,32,96,39,128,23,0,2,46,44,
+45,128,82,4,134,140,0,129,125,3,2,96,34,89,141,234,4,138,129,1,1,46,34,130,
+149,0,131,18,0,132,158,0,131,214,0,129,156,0,129,16,0,141,195,0,140,64,0,132,
+79,1,0,59,133,108,1,135,7,0,128,200,2,1,46,47,128,163,0,142,62,0,0,55,
+137,54,1,0,96,128,112,1,130,74,1,128,84,4,130,88,0,128,223,4,133,96,0,130,
+185,3,139,253,0,128,252,0,136,91,4,0,95,130,46,1,129,45,0,0,124,128,19,2,
+129,121,1,0,124,131,58,0,0,46,143,117,0,132,60,1,2,46,46,44,138,65,5,1,
+45,39,129,54,0,128,87,0,2,44,32,94,130,32,4,146,56,0,131,84,0,138,190,1,
+0,95,133,11,3,143,32,1,135,246,4,128,87,0,133,175,1,128,15,2,129,189,0,130,
+182,1,1,10,10,0,32,135,0,0,5,95,44,45,45,39,34,130,0,0,6,45,45,45,
+46,46,95,10,134,26,0,1,44,39,136,39,0,131,0,0,0,96,135,31,0,144,29,0,
+132,34,0,131,33,0,149,31,0,129,0,0,0,92,130,34,0,0,46,151,32,0,132,35,
+0,1,44,39,144,35,0,2,44,45,96,134,21,0,128,36,0,0,47,129,6,0,141,34,
+0,130,123,0,0,44,135,37,0,0,124,129,50,0,0,124,138,38,0,1,44,96,131,7,
+0,0,124,134,17,0,2,124,10,76,129,190,0,0,124,136,18,0,1,46,39,131,197,0,
+0,95,135,205,0,2,95,39,10,131,111,0,0,34,134,18,0,6,44,96,39,95,46,46,
+45,132,43,0,131,46,0,128,189,0,135,166,0,129,0,0,128,100,1,137,117,1,1,46,
+39,133,41,1,2,47,46,95,142,227,0,129,78,0,133,46,0,130,44,1,129,229,0,137,
+79,0,128,64,0,0,45,139,96,1,129,38,0,129,37,0,129,10,0,5,45,46,95,95,
+95,46,128,216,1,132,16,0,140,39,0,132,223,0,1,44,47,131,80,0,3,46,45,94,
+43,128,248,1,140,39,0,0,70,128,79,0,0,76,130,213,0,128,170,0,128,240,0,128,
+5,0,131,44,1,1,96,39,129,39,2,128,0,0,128,99,0,129,61,0,134,119,0,130,
+163,0,131,10,0,135,65,1,132,20,2,2,34,45,59,131,170,1,2,32,32,106,134,4,
+0,128,20,1,142,220,1,128,56,1,131,231,0,130,66,0,133,71,0,128,152,1,135,26,
+1,2,45,39,89,129,27,2,128,139,2,140,108,0,130,55,0,135,25,1,129,153,0,129,
+75,0,0,39,138,74,0,128,1,1,128,235,2,137,245,1,132,28,0,140,37,0,134,18,
+0,153,37,0,130,22,2,144,37,0,130,175,0,0,43,138,40,3,144,37,0,131,71,2,
+130,43,0,0,44,132,155,2,132,23,1,133,37,0,131,247,0,129,27,0,129,47,0,128,
+238,0,130,27,1,136,213,1,0,106,130,66,2,130,60,0,0,106,128,5,0,128,37,0,
+130,28,0,128,38,0,136,36,0,132,145,3,128,76,0,128,61,0,0,96,128,36,0,133,
+27,0,136,16,3,0,47,131,35,0,128,179,0,130,227,1,0,124,144,57,2,132,34,0,
+128,53,0,0,124,129,101,1,137,50,2,132,72,0,133,33,0,2,32,46,47,132,217,1,
+0,96,128,138,2,135,34,0,130,22,3,131,0,0,0,108,138,50,4,130,6,0,1,94,
+95,134,63,0,133,59,1,133,32,0,137,91,0,128,200,0,0,45,129,172,4,133,13,3,
+0,46,136,85,0,133,101,1,132,81,0,0,44,135,24,0,135,50,4,138,134,0,131,91,
+0,131,87,2,137,21,0,128,65,0,128,0,0,128,72,2,0,10,0,32,145,0,0,9,
+44,45,45,34,34,43,45,45,46,10,145,29,0,0,47,130,5,0,0,106,129,9,0,0,
+96,146,33,0,0,124,134,38,0,129,9,0,151,35,0,1,44,39,129,9,0,130,4,0,
+1,32,92,145,36,0,2,106,44,45,131,29,0,3,39,96,46,46,149,37,0,0,43,131,
+6,0,0,95,131,151,0,3,96,46,95,47,146,38,0,133,148,0,1,39,45,130,73,0,
+130,15,0,145,153,0,130,39,0,131,226,0,129,10,0,130,9,0,0,124,148,39,0,135,
+9,1,129,3,0,150,39,0,131,28,0,130,49,0,131,133,0,2,124,46,95,146,41,0,
+0,46,131,237,0,0,55,135,175,0,128,5,0,130,63,1,2,95,95,95,132,230,0,1,
+46,46,129,9,0,0,124,137,84,0,132,2,1,130,60,0,129,45,0,10,124,46,45,45,
+45,61,45,46,44,39,43,128,236,0,3,96,46,32,124,131,168,0,2,32,32,70,130,5,
+0,0,76,133,122,1,0,44,128,87,1,128,46,0,9,124,44,61,61,45,45,39,124,95,
+39,132,173,0,0,92,137,232,1,1,32,124,130,44,0,1,44,96,130,50,0,4,76,10,
+32,39,89,129,9,0,0,124,129,43,0,0,39,128,79,1,3,44,46,45,46,130,48,0,
+131,145,0,2,44,44,94,128,165,0,128,50,0,131,68,0,4,124,10,96,46,124,132,249,
+0,0,96,129,223,0,132,165,0,130,94,0,0,95,131,223,1,131,89,0,129,150,0,1,
+32,70,128,235,0,130,46,0,0,96,130,18,0,128,38,0,0,44,130,175,1,0,96,128,
+146,2,131,37,0,138,128,1,129,112,1,131,61,0,129,81,0,0,47,129,118,0,131,217,
+0,1,32,96,128,2,1,136,0,0,0,34,128,0,0,1,39,89,135,116,1,5,95,58,
+34,39,95,46,134,82,0,5,47,95,62,58,45,46,133,99,1,131,18,0,132,44,0,4,
+96,45,34,46,96,128,44,0,2,95,44,96,128,81,1,128,36,0,132,21,1,3,96,46,
+34,34,132,100,0,1,34,39,133,43,0,2,46,124,32,128,43,0,133,159,0,0,124,128,
+173,1,128,182,0,128,121,0,1,45,45,134,146,2,128,221,0,133,141,1,128,32,0,1,
+39,34,130,219,1,0,44,130,213,1,133,35,0,3,95,124,124,124,133,139,0,2,47,32,
+47,128,96,1,133,167,0,1,96,45,132,179,2,130,229,0,128,243,0,130,203,2,3,47,
+44,39,47,128,15,0,0,95,128,158,0,128,230,0,128,182,3,0,95,129,70,1,132,71,
+2,131,168,1,3,46,39,44,76,128,224,1,138,67,1,131,173,2,131,59,2,129,36,0,
+128,106,0,128,205,1,129,190,0,129,113,0,128,181,0,128,240,0,0,95,132,210,2,129,
+155,1,128,186,1,1,124,46,129,188,0,128,240,1,134,229,0,137,247,2,129,145,1,0,
+106,130,6,2,128,251,1,128,60,0,0,39,132,71,2,131,37,3,131,35,0,129,110,0,
+129,108,0,129,33,0,130,216,1,130,6,0,128,213,2,128,224,3,0,44,132,255,0,128,
+108,0,130,180,0,129,62,0,131,35,0,1,32,92,128,39,1,136,148,1,0,124,129,0,
+1,129,110,0,134,202,2,0,92,131,49,2,133,209,3,128,63,0,130,66,0,129,110,2,
+131,73,3,128,42,0,129,33,0,133,162,3,3,96,46,47,124,131,176,2,133,69,1,129,
+8,0,0,92,133,166,0,130,53,0,134,117,1,132,32,0,128,174,1,1,92,96,145,167,
+4,2,92,32,39,129,33,0,128,213,0,146,48,5,130,137,0,0,47,128,235,2,146,29,
+0,5,106,32,108,32,32,34,144,26,0,0,95,129,207,2,143,23,0,0,39,128,240,0,
+0,10,0,32,143,0,0,2,46,44,10,137,14,0,7,44,32,95,46,45,39,44,39,136,
+20,0,3,34,34,124,34,129,7,0,1,96,34,128,0,0,137,46,0,2,47,39,47,132,
+9,0,0,95,129,52,0,2,45,34,47,134,27,0,128,65,0,128,21,0,3,44,45,45,
+34,130,58,0,128,16,0,2,45,46,95,130,29,0,4,95,46,46,46,96,128,3,0,1,
+39,46,129,78,0,128,80,0,3,92,34,34,45,129,0,0,128,114,0,1,44,45,128,53,
+0,133,0,0,4,96,45,46,41,32,128,96,0,6,96,46,32,32,92,10,43,128,33,0,
+2,46,34,45,128,11,0,2,32,32,124,131,31,0,130,11,0,130,28,0,130,15,0,0,
+92,131,18,0,131,28,0,130,14,0,130,11,0,0,76,132,147,0,1,96,118,128,220,0,
+1,45,106,135,231,0,0,46,129,107,0,0,124,131,29,0,2,46,39,92,128,176,0,133,
+205,0,1,32,47,129,189,0,129,0,0,133,180,0,1,44,95,128,0,0,130,48,0,131,
+46,0,137,49,1,128,167,0,134,246,0,133,124,0,128,66,0,141,103,1,136,38,0,136,
+27,0,131,196,0,149,41,0,139,68,0,128,43,0,135,95,0,153,64,0,0,95,132,63,
+0,142,26,0,0,96,143,63,0,0,44,131,82,1,136,59,0,2,45,34,32,131,63,0,
+134,43,1,135,0,0,143,63,0,128,17,0,129,105,1,133,60,0,130,34,1,131,6,2,
+144,152,0,141,62,0,131,46,0,131,63,0,134,251,1,131,61,0,143,105,0,139,18,0,
+128,183,0,132,119,0,128,6,0,133,174,1,128,188,0,147,60,0,1,46,32,128,33,0,
+134,42,1,129,30,0,0,96,133,21,2,130,167,2,128,244,0,132,118,0,130,58,0,135,
+209,0,129,43,0,10,96,32,124,40,96,39,45,96,46,44,46,135,18,1,0,92,128,78,
+0,128,242,2,128,0,0,130,153,2,131,60,0,0,39,129,61,0,1,124,76,132,66,0,
+0,124,131,104,0,129,4,0,0,92,136,215,2,129,0,0,2,76,32,92,128,80,2,137,
+239,0,0,39,128,19,0,128,50,0,131,150,0,0,76,132,59,0,146,222,1,0,124,130,
+152,1,129,140,3,129,50,3,133,50,2,2,39,124,124,130,181,0,128,56,0,0,124,133,
+165,0,134,60,0,0,46,130,106,0,2,96,32,39,135,169,2,128,14,0,7,92,32,39,
+34,96,94,34,45,129,27,1,142,78,2,131,76,0,0,47,132,31,3,134,29,0,132,179,
+0,140,174,2,134,49,0,0,89,132,80,3,0,95,128,82,1,128,83,1,0,34,128,232,
+3,149,51,0,128,21,0,128,129,0,1,96,46,130,48,0,0,43,128,16,4,2,46,46,
+62,129,74,1,0,45,128,20,2,131,17,4,130,19,0,129,0,0,130,70,4,0,34,128,
+52,0,128,27,0,0,46,134,243,0,128,244,1,0,95,129,251,1,128,104,0,0,45,128,
+107,0,128,13,0,1,95,62,129,70,4,134,212,3,0,32,131,125,4,128,25,0,128,24,
+2,3,34,32,125,60,133,139,4,131,129,0,129,29,0,128,156,0,138,224,0,129,142,1,
+128,112,0,128,39,0,0,76,128,239,3,128,142,0,129,203,0,128,97,0,129,0,0,0,
+39,128,2,0,141,44,0,129,46,0,128,70,0,130,7,5,0,92,129,194,2,143,32,0,
+132,231,2,0,44,129,38,0,146,29,0,128,65,0,2,39,32,10,0,32,148,0,0,1,
+124,10,144,20,0,0,95,128,0,0,2,32,65,44,141,26,0,4,95,44,45,39,92,128,
+50,0,6,124,32,47,96,39,96,46,140,30,0,2,47,45,46,128,5,0,3,39,46,39,
+124,129,13,0,2,44,39,45,139,32,0,1,46,39,128,4,0,7,96,46,32,124,47,106,
+32,124,128,30,0,130,19,0,138,34,0,9,46,34,34,124,46,95,32,32,92,96,132,32,
+0,4,95,46,44,92,45,139,70,0,1,39,47,128,27,0,10,32,124,34,92,92,44,124,
+32,124,44,34,128,4,0,128,14,0,128,51,0,137,36,0,21,124,46,39,95,46,46,124,
+40,41,46,92,46,46,47,40,41,124,95,47,92,32,124,128,2,0,0,39,138,37,0,129,
+55,0,130,169,0,129,152,0,129,9,0,5,76,32,92,124,32,89,139,35,0,130,167,0,
+6,47,46,45,34,34,45,46,130,36,0,0,124,128,254,0,139,110,0,128,211,0,129,23,
+0,128,29,1,129,0,0,0,46,129,12,0,0,106,129,36,0,0,96,139,73,0,129,29,
+1,0,46,130,5,0,131,115,0,3,47,44,39,47,135,33,0,1,95,95,129,86,0,128,
+8,0,4,92,32,92,95,95,128,26,0,128,32,0,2,47,32,106,131,32,0,128,15,0,
+0,34,132,167,0,128,32,1,128,3,0,0,95,129,77,1,129,16,0,0,124,129,113,0,
+0,95,129,37,0,132,81,1,133,79,0,1,96,34,129,140,0,1,34,34,136,21,0,130,
+177,1,0,44,132,178,0,147,0,0,130,225,0,130,185,0,128,127,0,129,248,0,130,172,
+0,128,70,0,136,0,0,129,112,0,131,170,0,129,143,1,0,10,131,69,1,0,106,134,
+129,0,141,81,0,0,46,132,84,0,2,124,10,124,128,27,2,130,172,1,131,91,0,145,
+43,0,130,75,0,128,41,0,129,54,0,128,117,1,145,80,0,132,0,0,129,135,2,128,
+41,0,0,76,128,53,0,1,39,118,129,45,1,151,0,0,128,159,1,0,44,128,230,2,
+129,177,0,131,155,2,150,0,0,128,238,1,132,113,1,132,27,2,150,82,0,1,47,32,
+129,187,1,129,217,0,152,163,0,130,23,1,130,227,1,128,40,0,132,90,1,147,0,0,
+131,78,0,130,45,1,149,154,1,136,37,0,129,39,0,129,32,1,147,36,0,0,44,136,
+229,2,0,92,146,38,0,1,44,39,137,218,3,133,160,1,138,223,0,0,45,137,187,2,
+129,68,0,0,43,133,72,0,3,95,44,46,45,128,65,0,138,219,3,2,124,96,45,128,
+178,1,128,25,2,129,111,2,0,96,128,250,3,138,85,4,130,167,2,0,32,128,51,2,
+130,62,0,130,176,3,130,176,2,128,72,2,2,46,46,45,130,63,1,8,96,39,32,124,
+62,32,60,40,34,131,78,0,128,24,0,128,3,3,129,29,4,131,83,2,2,95,46,43,
+128,115,0,129,132,0,131,18,2,128,57,0,130,195,2,129,9,3,128,87,0,2,39,10,
+96,129,159,3,1,45,58,128,76,0,128,48,0,129,122,3,133,173,0,129,198,1,1,96,
+46,130,122,3,2,124,124,95,132,182,3,3,47,34,124,95,131,76,3,0,44,128,183,0,
+133,40,0,0,95,129,125,2,1,96,45,128,59,4,0,92,133,186,3,135,128,2,133,44,
+4,130,203,1,0,124,143,52,5,136,5,2,3,86,39,32,10,0,32,143,0,0,8,46,
+46,45,96,34,45,46,95,10,142,25,0,1,44,39,133,7,0,1,96,46,141,29,0,3,
+44,102,32,92,129,60,0,6,32,47,32,44,45,39,45,141,31,0,128,57,0,3,96,46,
+32,124,128,1,0,1,32,44,129,63,0,0,124,139,31,0,6,96,46,45,46,32,32,92,
+129,31,0,2,44,46,39,128,65,0,1,46,92,140,64,0,0,47,128,27,0,2,46,32,
+96,128,32,0,7,47,46,39,34,124,124,89,32,140,98,0,128,93,0,12,95,124,85,95,
+92,46,124,47,47,95,85,95,124,128,45,0,140,100,0,2,124,32,106,130,73,0,130,44,
+0,128,0,0,3,92,32,124,39,140,101,0,0,76,133,32,0,129,29,0,129,39,0,1,
+106,96,141,232,0,128,58,0,7,96,34,96,46,95,44,45,45,128,204,0,0,47,128,44,
+0,141,170,0,130,102,0,128,237,0,131,48,1,0,44,130,73,0,0,76,136,35,0,0,
+95,128,0,0,131,99,0,128,73,0,131,82,1,0,92,129,121,0,134,174,0,128,64,1,
+136,109,1,134,0,0,4,92,124,39,45,43,133,245,0,130,64,0,142,34,0,134,218,0,
+131,37,0,130,36,0,132,106,0,140,0,0,0,96,131,118,1,130,39,0,129,152,1,131,
+27,1,144,0,0,130,7,1,132,80,0,1,124,70,130,70,1,148,0,0,129,140,0,0,
+92,132,150,1,0,124,128,37,0,129,44,0,147,0,0,129,66,0,1,124,92,131,239,0,
+129,41,0,150,82,0,131,41,0,132,25,1,167,41,0,3,96,46,46,95,130,202,1,149,
+41,0,128,56,1,132,250,1,129,46,1,150,84,0,1,124,44,128,143,2,133,35,2,128,
+49,1,146,40,0,1,39,124,129,152,0,1,106,47,133,189,1,0,96,128,192,2,133,135,
+1,139,58,3,128,137,1,136,112,2,0,92,130,89,1,128,73,2,139,94,3,128,63,3,
+137,149,2,0,46,131,127,1,130,10,0,0,95,133,240,1,0,47,138,34,0,130,107,0,
+0,44,129,6,0,1,39,124,129,174,1,0,40,129,33,0,134,142,0,131,145,2,3,95,
+124,39,95,129,60,0,128,169,0,3,46,95,39,96,128,101,0,139,194,3,0,39,129,25,
+0,130,222,0,131,71,1,1,32,89,136,31,2,2,44,46,95,128,164,0,1,96,59,130,
+35,0,4,45,34,34,34,94,128,3,0,129,76,0,1,46,45,128,13,0,128,33,3,128,
+11,3,129,166,0,128,21,0,130,135,0,129,132,0,0,47,128,4,0,1,44,45,130,91,
+0,128,22,0,2,34,45,45,128,18,4,0,39,128,47,0,5,96,118,46,61,58,46,129,
+224,2,128,180,0,2,76,46,34,128,1,3,0,34,129,59,0,128,55,0,2,96,46,44,
+128,183,1,1,32,47,133,153,0,0,46,130,194,1,1,106,45,128,109,3,129,139,0,130,
+8,1,128,165,2,0,124,129,14,0,1,34,39,130,122,0,0,45,132,7,1,0,47,128,
+252,3,131,27,1,0,76,129,60,4,129,195,0,0,40,128,71,0,0,41,128,54,0,1,
+45,92,128,109,0,131,190,2,0,96,128,50,0,135,113,4,132,205,1,0,108,132,32,3,
+128,28,0,134,78,0,143,41,3,129,31,0,1,32,10,0,32,162,0,0,8,44,39,34,
+34,96,45,45,46,10,162,45,0,0,124,130,5,0,3,95,95,32,96,170,49,0,4,47,
+32,32,96,46,129,3,0,163,51,0,1,32,92,134,157,0,128,3,0,166,53,0,130,99,
+0,130,62,0,0,95,131,13,0,165,55,0,133,57,0,0,124,132,7,0,0,92,167,56,
+0,128,58,0,2,45,45,34,134,66,0,0,96,169,57,0,139,126,0,144,58,0,2,44,
+46,46,130,201,0,158,44,1,142,59,0,2,47,95,44,130,111,1,177,60,0,0,106,128,
+173,1,0,32,129,57,0,134,133,1,135,0,0,0,95,128,250,1,139,61,0,141,43,1,
+130,239,1,129,4,0,0,96,128,43,0,135,44,0,4,95,44,45,45,39,136,162,1,130,
+0,0,128,11,0,0,76,141,185,0,0,76,128,188,0,129,82,1,129,44,0,2,32,96,
+39,128,153,2,0,95,128,163,2,129,12,1,3,45,96,39,92,132,128,2,134,63,0,0,
+124,142,52,1,1,124,45,141,17,0,128,206,0,1,44,39,130,78,0,1,32,124,138,62,
+0,0,124,133,62,0,1,45,118,133,103,1,129,250,0,143,33,3,134,48,0,147,62,0,
+129,213,0,128,15,3,0,95,135,40,0,133,244,0,139,204,2,1,124,106,131,9,1,1,
+46,46,129,4,1,136,62,0,128,64,0,1,44,46,139,60,0,128,47,1,0,46,132,57,
+0,132,116,0,0,47,128,65,1,1,45,34,130,106,2,128,115,2,138,62,0,140,59,0,
+2,32,44,34,130,96,0,131,56,0,0,96,128,68,2,2,95,95,47,139,156,0,1,96,
+39,136,62,0,129,39,0,129,104,3,132,121,0,128,126,1,128,43,0,140,48,0,142,177,
+2,136,62,0,128,250,0,5,95,46,45,39,34,39,128,74,4,2,39,32,34,132,0,0,
+2,45,45,96,130,234,0,128,181,0,128,250,1,128,0,0,128,202,1,129,13,0,133,49,
+1,136,252,0,129,160,0,129,43,0,139,98,0,130,235,0,130,23,0,130,248,0,131,249,
+0,135,125,1,136,249,1,133,150,1,0,96,139,34,0,129,69,2,150,1,3,137,245,2,
+131,63,0,128,240,0,128,137,0,142,32,3,149,6,1,139,64,0,128,66,0,1,46,94,
+130,108,0,140,116,3,145,81,2,134,247,0,135,66,0,5,44,39,95,93,95,95,128,69,
+0,129,243,1,0,47,138,68,0,136,65,0,0,47,129,40,1,139,163,0,128,178,0,133,
+69,0,137,177,1,1,92,32,130,108,2,134,17,0,137,68,0,140,45,5,136,141,0,130,
+134,1,137,6,1,2,95,95,76,130,46,0,133,247,5,136,97,0,131,70,0,1,95,44,
+128,8,0,139,40,4,1,124,10,129,12,3,133,206,3,1,44,46,131,187,1,130,108,0,
+128,161,0,129,41,2,137,168,0,0,47,131,31,2,1,45,46,129,79,0,129,136,6,139,
+225,1,129,41,0,0,47,137,217,0,4,39,46,46,39,34,132,106,3,135,212,0,0,70,
+129,11,0,2,46,34,39,136,131,3,0,124,128,85,2,131,49,0,128,71,0,128,66,0,
+1,46,92,141,209,2,133,82,2,135,70,0,3,47,32,40,44,128,100,4,135,79,3,129,
+189,0,128,12,0,129,42,1,0,106,128,70,0,130,194,4,148,16,2,134,69,0,132,102,
+0,0,96,135,176,2,0,47,128,57,1,4,47,39,32,46,45,128,27,0,153,32,6,128,
+219,1,1,39,34,131,150,1,143,54,2,129,149,3,0,124,128,111,1,0,76,153,67,0,
+1,46,39,132,200,3,0,96,129,138,3,146,0,0,0,39,129,72,4,152,133,0,128,172,
+0,128,98,1,128,104,0,154,171,0,129,44,3,129,26,1,0,10,0,32,148,0,0,1,
+124,46,130,6,0,2,46,124,10,147,31,0,0,96,128,31,0,10,96,46,95,46,39,32,
+124,44,39,89,39,130,19,0,1,95,46,131,0,0,132,50,0,1,43,45,132,0,0,0,
+46,128,43,0,2,95,92,34,128,36,0,0,34,130,0,0,0,39,128,18,0,5,61,45,
+95,32,44,45,128,18,0,4,44,46,45,45,32,131,63,0,133,56,0,6,32,124,32,32,
+39,34,34,131,98,0,3,96,45,46,95,136,119,0,2,46,45,34,129,30,0,0,32,128,
+120,0,128,0,0,0,40,132,47,0,0,96,133,57,0,0,106,132,7,0,0,92,129,193,
+0,0,46,128,104,0,128,100,0,130,130,0,128,103,0,2,93,46,46,128,57,0,0,47,
+136,192,0,2,32,32,76,130,116,0,0,95,128,0,0,0,40,128,3,0,133,124,0,131,
+204,0,2,39,32,45,128,158,0,1,32,96,131,192,0,129,24,0,0,95,131,225,0,1,
+45,47,128,17,0,6,95,95,124,76,10,46,39,128,7,0,130,0,0,129,215,0,129,104,
+0,128,49,0,129,153,0,130,19,0,131,184,0,0,96,129,231,0,1,58,44,129,55,0,
+130,0,0,129,41,0,0,105,135,235,0,128,87,0,130,59,0,128,98,0,129,14,1,128,
+249,0,131,121,1,1,47,96,130,12,0,0,32,133,67,1,0,106,132,158,0,128,134,0,
+132,147,1,0,46,131,218,0,130,116,0,131,0,0,0,47,129,247,0,130,4,1,0,76,
+132,228,0,0,61,128,117,0,131,152,0,130,91,0,134,59,0,131,0,0,2,44,45,95,
+128,126,1,134,56,1,0,76,129,31,0,129,88,0,131,59,0,128,228,0,0,58,128,124,
+1,133,125,1,137,59,0,2,44,43,43,129,176,0,132,42,1,129,6,0,3,47,45,43,
+45,129,7,0,132,18,0,128,7,0,0,96,128,211,0,0,95,128,34,2,139,59,0,6,
+46,43,34,34,32,39,45,132,191,1,130,168,0,128,122,0,0,124,130,176,0,133,188,1,
+131,13,0,129,128,0,129,164,1,1,70,45,131,59,0,130,87,1,128,255,1,3,41,32,
+96,44,133,229,1,0,95,131,205,1,0,92,134,213,1,129,67,0,130,3,1,130,120,1,
+128,167,1,130,59,0,132,107,0,130,157,0,131,220,0,130,0,2,131,0,0,136,61,1,
+128,62,0,133,237,0,128,71,0,0,106,135,42,1,128,186,1,128,58,0,1,44,92,137,
+137,2,137,71,1,2,39,34,46,128,62,0,0,41,131,12,0,0,94,132,117,0,134,103,
+0,1,96,44,134,99,0,141,0,0,128,115,0,0,47,128,1,0,0,44,130,39,1,0,
+44,129,155,0,0,70,133,58,0,128,20,2,0,124,129,185,0,2,46,39,96,133,44,1,
+139,129,3,3,45,39,92,32,129,84,3,2,92,32,92,128,16,1,128,3,1,132,57,0,
+2,124,32,106,131,220,2,131,139,1,129,250,2,128,43,2,129,195,2,0,44,128,100,0,
+132,220,1,129,248,0,128,14,3,129,230,3,1,44,39,132,56,0,128,81,0,128,142,0,
+1,34,34,130,76,1,128,110,1,128,118,0,0,92,129,129,0,2,96,47,46,128,27,0,
+132,118,0,0,89,130,111,3,0,34,129,21,0,136,228,0,128,46,1,0,47,145,164,0,
+136,184,3,129,143,0,0,92,135,108,0,132,184,1,133,172,1,149,134,4,129,2,0,139,
+51,0,0,39,135,206,1,147,0,0,3,106,32,106,45,138,49,0,128,237,0,154,102,0,
+1,44,46,139,46,0,1,95,43,130,120,2,146,0,0,0,95,130,117,3,128,254,3,130,
+12,0,129,54,0,0,44,130,96,3,0,46,130,158,2,130,43,4,140,36,2,2,44,58,
+58,128,10,3,134,189,0,128,254,4,1,32,45,128,253,3,129,211,1,128,78,4,135,188,
+3,128,41,0,1,96,34,128,64,0,133,37,4,129,120,1,131,75,0,129,165,2,0,60,
+128,15,5,1,45,34,130,169,0,128,7,0,130,98,4,129,120,0,129,68,0,130,70,5,
+145,31,2,129,164,4,128,8,0,0,118,129,69,0,0,96,130,112,4,128,105,2,1,45,
+39,128,222,1,128,51,0,0,96,156,69,1,128,62,0,128,156,1,128,5,0,130,203,2,
+129,98,0,1,124,95,131,130,3,159,0,0,128,150,0,0,10,0,32,139,0,0,2,95,
+44,10,138,15,0,3,46,39,46,39,128,21,0,0,46,137,21,0,10,44,39,32,46,95,
+44,45,39,95,34,39,134,22,0,0,95,128,20,0,1,32,32,128,3,0,0,45,130,0,
+0,5,34,34,39,96,46,95,132,29,0,130,26,0,141,102,0,0,46,128,36,0,140,23,
+0,2,95,95,95,135,10,0,1,44,46,133,115,0,0,124,132,48,0,0,46,133,126,0,
+0,45,139,55,0,131,75,0,130,76,0,0,55,136,87,0,0,44,133,156,0,1,106,46,
+128,197,0,0,68,132,71,0,133,79,0,135,203,0,0,34,133,70,0,0,46,134,87,0,
+128,10,0,128,79,0,128,111,0,129,117,0,128,78,0,0,10,128,115,0,0,45,129,29,
+0,1,96,43,129,220,0,133,38,0,0,124,128,226,0,133,48,0,135,146,0,142,236,0,
+0,39,134,88,0,2,47,10,106,134,21,0,0,96,140,206,0,4,96,39,45,45,44,133,
+139,0,145,0,0,134,69,1,128,48,0,0,10,131,19,1,130,125,0,132,206,0,2,39,
+45,46,128,148,1,131,178,1,159,69,0,128,38,1,1,39,10,128,130,0,128,14,0,2,
+40,39,84,135,210,0,1,32,46,131,130,0,0,47,151,65,0,130,235,0,128,254,1,1,
+45,34,128,95,1,0,96,129,185,0,128,117,0,135,47,0,0,95,130,216,0,135,231,0,
+142,62,0,1,39,44,128,193,0,0,34,130,224,1,1,44,45,133,227,1,2,96,45,34,
+134,16,1,1,32,92,130,16,0,0,46,138,167,1,139,240,1,1,39,34,128,0,0,133,
+179,0,0,108,137,155,2,1,96,46,130,3,1,131,68,0,2,32,32,76,151,194,0,134,
+102,2,128,49,2,135,199,2,130,67,0,128,76,1,130,11,1,129,221,0,129,82,0,134,
+150,2,134,111,2,0,39,129,17,2,130,133,0,139,46,3,128,87,0,0,92,128,130,0,
+131,124,0,130,60,0,130,49,2,128,218,1,134,238,2,0,47,139,49,0,131,171,0,1,
+41,96,132,145,0,134,220,2,135,81,1,144,48,0,130,119,1,130,133,1,134,20,2,135,
+244,1,145,47,0,128,135,0,135,48,1,136,5,2,136,38,3,141,48,0,134,142,1,133,
+44,0,129,6,0,138,7,4,138,46,0,2,45,46,95,128,207,1,133,188,0,0,46,128,
+99,1,1,44,106,149,44,0,129,0,0,2,34,34,96,130,24,1,129,138,1,128,2,0,
+146,180,0,138,0,0,0,47,130,18,1,128,3,0,147,42,0,0,95,128,200,1,129,0,
+0,128,210,1,2,39,32,47,130,5,0,146,218,0,129,155,1,128,140,1,129,245,1,132,
+170,4,128,221,1,130,56,0,143,44,0,128,146,3,4,34,40,95,44,96,128,137,2,129,
+8,4,0,39,130,15,4,129,98,0,128,117,3,150,9,1,129,137,3,0,47,129,85,2,
+134,89,4,1,32,96,128,39,2,2,45,32,10,0,32,128,0,0,8,44,45,45,45,46,
+46,46,95,95,129,12,0,1,32,44,128,9,0,7,10,32,32,46,34,34,34,95,128,21,
+0,128,17,0,1,34,34,128,32,0,7,92,46,44,95,96,34,45,46,131,36,0,140,0,
+0,1,95,95,128,53,0,129,54,0,128,74,0,130,48,0,129,0,0,0,58,129,85,0,
+129,29,0,0,34,129,19,0,0,96,129,58,0,128,38,0,133,50,0,6,44,45,34,34,
+32,46,46,128,89,0,1,45,39,128,44,0,2,44,10,96,131,133,0,130,0,0,0,95,
+129,0,0,0,32,132,107,0,130,57,0,4,32,96,46,32,124,132,58,0,3,47,32,47,
+39,131,9,0,129,57,0,129,156,0,128,57,0,2,10,92,34,130,13,0,2,34,34,39,
+129,7,0,3,39,34,45,96,136,160,0,128,67,0,129,65,0,132,62,0,0,106,130,7,
+0,4,46,92,32,124,92,128,7,0,8,45,46,44,58,44,45,32,46,10,129,37,0,134,
+127,0,131,54,0,138,238,0,128,44,0,129,47,0,1,32,93,128,56,0,129,63,0,6,
+32,124,76,32,124,124,47,129,19,0,128,91,0,3,96,32,46,96,128,67,0,138,18,1,
+1,61,61,128,221,0,1,47,32,132,173,0,133,68,0,6,76,32,32,65,124,44,39,130,
+206,0,1,92,124,128,66,0,128,0,0,128,66,0,129,63,0,0,46,128,141,0,129,125,
+1,128,93,0,0,45,129,32,1,135,192,0,134,56,1,130,0,0,128,120,0,129,197,0,
+0,47,128,230,0,128,172,0,4,92,86,32,39,47,130,68,0,128,22,0,129,138,0,128,
+182,0,134,139,0,128,84,0,131,102,1,128,205,1,4,45,96,34,96,47,136,73,0,128,
+124,0,131,72,0,128,174,0,132,236,0,128,16,0,2,39,95,96,128,27,1,130,114,0,
+129,117,1,135,211,0,129,44,1,0,34,133,204,0,130,10,1,134,71,0,2,96,95,124,
+129,87,0,0,108,134,54,0,128,20,0,130,144,0,0,96,129,28,0,129,46,0,0,39,
+138,71,0,129,212,1,129,51,2,128,228,0,0,92,129,30,2,133,71,0,137,8,0,129,
+68,0,0,47,129,74,0,128,106,0,2,46,46,89,132,5,1,0,92,138,71,0,131,74,
+0,1,46,44,128,149,0,0,46,135,240,1,135,112,1,0,76,130,60,0,129,36,0,2,
+45,34,96,128,96,1,0,96,128,89,0,129,87,0,128,21,0,139,216,0,134,212,0,129,
+74,0,129,37,0,129,163,2,136,184,1,128,17,1,2,43,45,39,129,32,2,2,45,94,
+46,128,32,1,129,40,1,129,222,2,2,44,92,32,139,217,0,133,149,0,131,31,1,128,
+125,1,0,95,132,111,2,133,0,0,0,47,133,214,1,129,131,0,0,92,129,33,0,0,
+45,128,4,0,0,39,128,4,0,145,71,0,129,243,0,128,135,0,0,124,129,181,0,134,
+30,1,129,143,0,136,155,0,129,143,2,128,189,1,137,126,2,138,0,0,0,43,132,234,
+1,137,135,0,0,47,139,100,0,130,77,0,129,32,1,148,66,0,128,27,0,4,43,46,
+95,106,95,132,117,0,0,95,128,76,2,0,41,149,40,0,150,67,0,128,255,3,0,45,
+129,64,0,1,46,44,128,4,0,0,106,129,241,2,128,170,3,128,153,1,139,219,2,131,
+69,0,147,67,0,0,95,128,246,0,0,46,129,67,0,2,47,44,39,129,141,4,128,127,
+1,128,69,0,3,92,32,92,96,147,49,0,130,23,2,0,39,129,49,4,0,96,131,204,
+1,3,124,124,39,96,128,21,0,5,96,84,124,46,96,45,144,1,2,128,249,3,2,44,
+39,47,128,154,2,0,95,134,32,1,0,76,132,236,3,4,39,45,39,92,34,150,218,0,
+139,145,2,130,105,0,131,137,2,0,10,0,32,132,0,0,12,95,44,45,45,34,34,39,
+34,34,34,45,46,10,131,18,0,1,44,39,128,4,0,3,46,44,45,46,130,13,0,0,
+96,132,22,0,8,39,96,46,46,46,40,32,124,32,129,2,0,129,0,0,0,92,130,23,
+0,132,12,0,2,96,45,45,129,53,0,130,0,0,131,48,0,2,39,95,44,128,48,0,
+1,95,95,130,77,0,132,0,0,0,96,131,74,0,2,96,46,95,135,19,0,139,26,0,
+130,29,0,128,53,0,129,0,0,134,27,0,0,124,134,27,0,131,14,0,131,152,0,131,
+171,0,141,27,0,128,137,0,128,118,0,0,46,128,190,0,0,34,142,55,0,137,12,0,
+0,106,139,27,0,0,94,135,83,0,1,95,70,138,26,0,0,47,129,220,0,130,82,0,
+2,45,39,47,137,25,0,128,24,0,134,133,0,0,39,136,24,0,136,23,0,136,47,0,
+146,21,0,0,106,133,114,0,2,46,45,45,132,54,1,136,168,0,131,50,0,3,44,43,
+45,45,130,127,0,128,17,1,134,33,0,0,76,136,32,0,136,89,0,3,32,32,34,34,
+129,172,0,135,40,0,1,32,92,134,102,0,133,108,0,139,118,1,134,245,1,131,122,1,
+132,123,0,138,42,1,0,46,135,193,1,135,165,1,130,13,0,0,43,130,150,0,0,124,
+134,170,1,0,46,128,172,0,0,46,135,73,1,140,127,1,137,164,0,3,46,95,46,108,
+134,115,0,146,145,1,135,92,1,0,46,128,202,1,128,52,0,132,143,2,130,250,0,138,
+112,1,137,135,1,135,11,0,130,39,0,0,58,128,90,1,146,42,0,138,52,1,129,237,
+0,1,95,58,145,39,0,136,105,2,128,12,0,2,124,44,45,146,76,0,138,37,0,129,
+190,2,129,36,0,0,39,129,121,1,140,106,1,139,15,0,130,113,3,1,44,96,136,94,
+1,150,43,0,2,32,76,10,129,165,0,0,41,146,32,1,129,44,0,0,95,130,137,1,
+132,117,1,1,46,39,135,140,3,142,0,0,132,67,0,130,118,1,1,106,10,129,206,3,
+143,140,3,132,25,4,128,21,4,131,157,1,0,92,129,179,2,128,255,2,129,241,1,141,
+45,0,1,95,44,129,157,1,133,82,0,0,124,129,220,2,129,249,0,128,88,0,2,34,
+96,44,129,0,0,130,58,3,136,30,4,130,28,0,131,149,1,128,185,0,129,22,0,138,
+140,1,138,152,1,0,43,132,110,1,128,94,4,0,43,147,164,0,128,149,0,137,192,2,
+128,42,3,135,57,4,0,95,129,87,3,145,178,1,0,96,128,238,4,128,0,0,1,32,
+10,0,32,143,0,0,3,95,44,46,45,128,0,0,4,39,34,34,34,39,128,7,0,4,
+46,46,46,95,10,141,33,0,128,29,0,144,57,0,0,96,128,44,0,137,42,0,2,95,
+44,39,144,37,0,137,46,0,135,45,0,155,42,0,142,48,0,159,46,0,128,198,0,128,
+185,0,1,32,96,133,50,0,0,47,156,47,0,1,44,46,131,210,0,4,96,58,45,32,
+76,130,51,0,156,99,0,1,124,46,135,31,0,3,47,32,124,124,129,51,0,138,100,0,
+129,72,1,128,129,0,137,0,0,0,76,133,8,0,6,46,45,39,32,45,44,39,128,51,
+0,134,50,0,129,46,0,132,85,1,1,96,46,138,246,0,131,30,0,129,73,0,0,46,
+128,49,0,0,106,133,46,0,137,130,1,3,124,124,92,124,137,50,0,3,46,32,44,45,
+128,35,0,128,47,0,131,74,0,128,203,0,129,157,1,0,95,132,0,0,129,126,0,137,
+47,0,2,32,124,39,128,48,0,1,39,10,129,19,0,128,214,0,3,96,45,45,44,129,
+43,0,135,199,1,2,124,32,47,135,148,0,1,96,32,131,41,0,131,65,0,0,96,129,
+227,0,129,45,2,128,47,2,129,62,0,3,32,96,95,89,134,42,0,2,89,95,10,130,
+31,0,137,34,2,128,89,0,133,165,0,0,96,128,135,0,133,129,0,128,27,0,130,178,
+1,0,95,130,110,2,0,96,130,13,0,137,57,0,1,34,34,129,140,2,0,95,136,27,
+1,128,127,0,131,61,1,2,95,44,43,128,88,0,131,166,2,131,149,1,128,185,2,140,
+122,1,2,96,45,43,132,205,0,128,185,1,130,54,0,134,64,1,0,92,129,56,0,0,
+44,132,50,2,129,54,0,1,96,46,138,128,1,129,181,0,4,58,76,95,44,118,128,246,
+2,128,10,0,0,47,130,66,1,131,207,1,128,57,0,1,46,44,133,182,1,129,39,0,
+128,198,0,128,73,0,139,0,0,0,41,133,227,1,0,92,130,5,0,0,34,129,208,1,
+129,46,2,132,201,1,135,205,0,1,92,96,131,33,0,133,138,0,0,46,128,78,0,134,
+28,0,133,11,2,129,57,0,133,14,0,131,171,3,4,94,46,118,91,92,129,144,0,129,
+152,3,136,78,0,138,7,0,128,124,0,129,110,2,131,14,0,134,250,0,1,95,62,128,
+234,0,128,185,1,140,136,0,139,57,0,1,95,86,128,56,0,130,88,0,134,22,1,128,
+209,0,1,124,39,134,173,0,134,17,3,130,115,1,132,55,3,128,53,2,129,87,1,128,
+50,0,133,231,0,131,24,0,128,86,0,138,18,2,130,103,0,130,221,1,128,0,0,0,
+34,130,51,0,128,171,0,132,124,0,132,58,0,131,81,0,128,150,2,3,46,46,44,44,
+128,26,1,0,106,131,212,3,0,89,140,169,0,139,143,0,0,47,132,249,3,132,49,2,
+136,8,1,143,35,0,132,37,0,131,106,3,137,130,3,132,197,0,134,21,0,129,81,4,
+136,23,2,128,144,0,137,31,0,131,19,0,129,227,2,130,166,0,128,208,3,3,39,32,
+10,10,0,32,169,0,0,3,44,45,46,10,167,45,0,5,95,46,124,32,32,39,166,48,
+0,6,46,39,32,32,124,32,47,164,47,0,0,44,128,45,0,128,47,0,164,94,0,0,
+47,132,6,0,149,45,0,3,95,46,46,45,128,0,0,1,34,34,128,4,0,129,135,0,
+132,44,0,128,22,0,128,0,0,129,25,0,130,0,0,128,11,0,0,44,128,35,0,145,
+140,0,8,10,32,96,45,46,95,32,32,92,158,137,0,131,130,0,128,45,0,0,43,128,
+46,0,136,129,0,137,13,0,0,44,128,107,0,0,32,137,106,1,128,46,0,129,93,0,
+129,37,1,4,58,32,32,41,46,133,23,0,1,40,96,128,180,0,2,124,32,92,141,215,
+0,0,55,130,28,1,2,32,96,34,128,4,0,134,67,0,128,190,0,128,218,0,142,43,
+0,131,33,0,128,72,0,131,247,0,1,39,43,134,224,0,2,44,34,46,128,3,0,1,
+34,45,145,49,0,129,26,1,134,185,1,0,95,128,0,0,132,25,0,0,124,130,106,1,
+137,150,1,0,95,129,39,0,128,50,0,130,46,0,0,96,128,5,0,0,39,128,179,0,
+135,147,1,1,96,46,131,8,0,0,106,135,50,0,1,92,39,129,240,0,129,60,2,134,
+110,0,129,55,0,133,49,0,133,8,0,136,205,1,131,40,0,128,52,0,129,199,0,130,
+93,0,130,14,0,134,201,0,142,48,0,134,168,1,130,88,0,141,13,2,131,92,2,139,
+46,2,134,217,1,0,96,150,192,2,138,39,1,158,9,2,136,240,0,160,47,0,141,186,
+2,145,183,0,148,137,0,129,0,0,0,43,151,44,0,142,16,2,136,51,2,143,0,0,
+0,76,170,45,0,0,124,145,45,0,3,95,32,47,44,166,45,0,4,124,32,76,41,39,
+135,106,2,156,45,0,130,39,0,128,247,2,161,45,0,129,11,3,129,231,1,0,76,144,
+91,0,144,86,4,128,159,1,129,162,1,144,237,0,140,200,1,133,158,1,2,96,95,95,
+132,73,4,152,198,1,129,108,2,128,96,4,129,99,4,130,107,4,128,0,0,133,9,4,
+142,42,0,129,35,0,0,44,128,60,3,0,45,135,222,0,129,141,0,2,45,106,34,142,
+84,0,0,46,129,204,3,128,54,1,135,77,0,130,229,0,141,4,1,129,239,4,131,91,
+1,1,95,44,132,254,3,129,229,0,1,108,124,143,45,1,129,148,4,128,33,0,136,16,
+5,128,225,0,0,124,143,127,5,133,59,3,151,243,0,143,32,0,141,34,0,129,227,0,
+131,0,0,1,43,45,151,56,1,137,216,5,149,32,0,133,203,5,147,31,0,136,29,0,
+143,30,0,138,166,0,140,29,0,0,95,130,90,1,131,49,6,128,0,0,1,32,10,0,
+32,164,0,0,15,95,44,45,45,34,34,96,45,45,45,46,46,46,95,95,10,154,43,0,
+0,46,128,38,0,0,34,128,0,0,3,96,45,39,46,128,15,0,0,46,129,12,0,1,
+39,96,128,57,0,0,95,128,4,0,143,59,0,1,95,44,129,48,0,128,89,0,2,44,
+45,34,134,20,0,3,46,34,46,32,128,45,0,136,38,0,0,34,128,34,0,1,96,46,
+139,61,0,2,95,44,39,130,62,0,5,46,46,44,39,95,95,135,23,0,5,96,46,39,
+32,32,44,128,46,0,129,173,0,131,18,0,0,44,128,131,0,129,132,0,137,64,0,128,
+61,0,1,44,45,128,41,0,128,0,0,2,47,32,40,128,116,0,129,19,0,134,116,0,
+0,124,131,73,0,128,3,0,128,181,0,131,28,0,131,17,0,135,66,0,1,44,39,135,
+179,0,0,47,129,27,0,130,12,0,1,96,34,131,83,0,1,32,32,132,7,0,130,58,
+0,0,95,128,74,0,0,92,133,58,0,128,56,0,133,35,0,128,129,0,0,55,128,252,
+0,142,70,1,0,96,128,103,1,1,46,34,129,132,0,5,40,32,96,32,96,106,132,58,
+0,2,39,46,58,132,45,0,130,65,0,129,31,0,134,176,0,0,92,138,64,0,130,96,
+0,128,178,1,0,39,131,57,0,0,47,131,38,0,0,124,131,55,0,131,57,0,130,226,
+0,129,37,0,133,140,0,131,174,0,130,48,0,133,18,0,2,124,39,44,128,139,1,129,
+8,0,0,46,129,110,1,145,0,0,0,96,135,248,1,129,247,1,0,34,129,229,1,130,
+250,1,133,31,0,128,160,1,131,141,0,143,230,0,131,3,1,1,32,32,128,187,0,129,
+139,1,128,67,0,132,66,0,129,104,1,128,247,0,144,45,0,2,70,32,32,144,47,1,
+129,127,1,129,219,0,0,46,132,209,1,133,153,0,1,96,10,128,91,0,143,70,0,0,
+106,132,100,1,140,136,0,130,88,0,0,46,131,76,0,137,18,1,129,70,0,145,192,0,
+131,65,1,0,46,128,106,2,138,45,0,1,32,39,129,72,0,0,86,142,117,0,131,71,
+0,129,141,0,133,48,0,132,6,0,0,124,131,8,0,128,5,1,135,196,1,131,162,0,
+2,32,92,47,133,166,1,138,220,1,130,165,1,130,52,0,131,74,0,0,124,132,6,0,
+1,45,46,128,57,2,0,47,129,98,0,134,146,0,130,63,0,129,187,1,0,65,143,72,
+0,2,124,32,124,130,217,0,131,118,0,128,67,0,128,93,1,130,12,0,0,124,128,110,
+3,128,117,3,129,250,2,134,127,0,128,200,1,130,239,2,0,47,135,91,0,142,72,0,
+133,192,0,131,134,1,128,80,0,135,61,0,134,23,3,142,64,1,139,222,1,132,177,2,
+136,10,1,130,62,0,0,43,149,62,2,147,72,0,128,164,0,133,110,3,139,72,0,129,
+174,1,146,66,0,130,94,0,132,117,1,136,70,0,0,44,134,240,3,140,71,0,129,14,
+0,142,147,0,131,233,2,141,64,2,132,175,1,139,70,0,128,178,1,129,157,4,130,14,
+0,130,31,5,136,152,4,134,5,0,137,174,4,0,46,133,25,1,136,160,3,129,247,0,
+130,165,4,134,160,4,1,60,96,129,65,3,130,30,0,131,140,0,137,47,5,138,66,0,
+132,23,3,131,58,1,129,110,5,131,144,0,128,0,0,0,41,135,218,0,136,224,0,2,
+95,46,39,128,2,0,138,131,5,130,65,0,136,32,2,0,45,131,249,0,0,47,137,52,
+5,129,202,4,1,95,46,128,29,4,128,61,0,0,34,139,193,5,129,62,0,136,185,1,
+132,60,0,130,133,0,128,197,0,132,129,0,128,6,0,129,229,5,140,58,0,129,59,0,
+135,58,0,132,57,0,131,131,0,129,247,5,128,6,3,133,124,0,141,114,6,0,96,134,
+55,0,132,98,1,140,173,1,0,46,132,63,1,141,110,6,136,41,5,0,44,130,176,1,
+1,44,55,146,10,5,129,71,1,144,59,0,137,101,2,136,96,5,137,242,5,131,13,2,
+1,96,118,148,59,0,0,106,128,32,0,128,43,5,142,93,2,132,61,0,2,46,95,76,
+141,158,1,136,31,3,131,98,4,0,47,148,30,0,1,96,34,128,157,1,5,95,47,32,
+10,10,10,0,32,134,0,0,4,95,46,46,46,45,129,0,0,4,39,96,46,95,10,132,
+19,0,2,44,45,39,129,6,0,8,96,46,32,46,34,34,46,32,92,133,26,0,0,44,
+129,22,0,0,32,131,29,0,0,96,128,1,0,7,124,32,32,92,47,45,45,46,128,28,
+0,2,44,58,95,133,25,0,129,0,0,128,29,0,128,28,0,0,124,128,65,0,1,32,
+96,128,30,0,0,47,129,18,0,2,39,45,46,128,14,0,133,31,0,1,32,46,129,44,
+0,128,7,0,3,32,92,10,106,134,142,0,0,96,128,140,0,0,44,129,8,0,0,92,
+135,40,0,2,32,58,10,128,75,0,132,0,0,0,39,128,169,0,129,119,0,136,33,0,
+1,46,95,128,89,0,3,10,124,95,95,128,129,0,128,0,0,131,43,0,131,5,0,0,
+76,131,34,0,0,46,130,150,0,128,136,0,129,21,0,4,96,45,46,32,47,129,45,0,
+128,21,0,129,159,0,131,42,0,1,46,39,133,155,0,131,37,0,133,236,0,132,19,0,
+2,32,32,106,128,3,0,130,198,0,132,39,0,1,92,10,128,8,0,0,95,137,36,0,
+128,73,0,129,14,0,134,32,0,129,67,0,0,60,129,253,0,131,126,0,136,114,1,0,
+45,135,219,0,128,0,0,0,106,129,31,0,0,92,134,207,0,144,0,0,0,44,129,97,
+1,132,45,0,5,32,44,118,45,34,34,129,81,0,132,48,0,4,41,95,95,44,43,132,
+97,0,128,171,1,149,66,0,128,53,1,129,195,1,131,157,0,0,47,129,244,0,128,205,
+0,128,191,0,129,16,0,129,182,0,128,56,0,133,59,0,0,47,133,194,0,140,182,0,
+0,58,129,226,0,131,35,2,0,96,128,234,1,0,45,128,145,0,0,47,133,38,1,0,
+92,130,6,0,0,106,128,187,1,130,247,0,130,242,0,132,125,1,135,131,0,130,30,2,
+2,46,32,70,131,67,0,128,59,0,0,46,128,135,0,0,47,129,93,1,134,50,1,132,
+43,1,2,92,46,45,131,141,0,135,249,1,4,95,44,46,45,34,132,153,0,2,96,44,
+39,131,67,0,5,40,95,92,47,124,39,129,36,0,134,248,0,130,65,0,128,194,2,0,
+34,134,98,1,0,43,128,227,2,129,228,2,133,37,1,132,74,1,132,66,0,129,51,1,
+0,124,131,86,0,130,67,0,2,44,46,94,128,43,0,1,96,60,131,77,2,130,130,0,
+2,44,39,124,133,135,0,134,102,0,129,8,0,0,47,132,48,3,1,96,46,128,130,0,
+0,92,130,48,0,1,58,118,134,3,3,135,10,2,0,124,128,240,1,128,32,0,0,32,
+128,115,2,128,135,0,131,66,0,128,122,1,0,92,133,197,0,130,29,3,1,47,96,130,
+134,3,129,99,2,136,0,0,129,150,2,131,98,1,128,129,0,0,89,132,20,0,0,76,
+131,161,3,136,62,0,133,152,0,138,61,0,128,227,2,128,136,1,131,24,0,129,98,3,
+133,195,0,132,240,2,136,60,0,130,61,0,4,46,34,96,34,44,128,90,2,0,34,129,
+3,0,131,34,1,0,124,130,155,1,130,81,1,136,60,0,138,119,0,130,59,0,129,28,
+0,135,169,1,130,9,0,0,124,129,60,0,0,39,128,17,2,1,46,45,133,25,0,1,
+106,45,139,56,0,129,31,1,128,163,0,129,139,3,130,0,0,0,47,129,167,1,3,46,
+124,95,89,128,111,0,130,200,0,129,56,0,128,45,3,137,53,0,128,210,0,128,250,0,
+143,229,2,130,99,0,130,52,0,1,95,106,128,33,0,135,49,0,128,48,4,130,133,1,
+142,210,2,0,96,128,107,0,0,43,128,113,1,1,34,34,135,132,1,130,134,0,128,92,
+0,128,250,4,0,46,131,78,4,129,66,1,128,119,2,140,184,0,129,188,4,2,95,124,
+46,128,33,0,0,96,128,45,1,133,7,1,139,35,0,1,44,32,131,9,2,136,120,0,
+128,226,0,139,35,0,0,34,130,122,5,132,0,0,128,73,0,129,76,0,1,10,10,0,
+32,144,0,0,2,44,92,10,141,18,0,8,95,44,45,39,46,43,46,46,45,128,0,0,
+2,34,47,95,129,0,0,139,35,0,2,95,44,39,128,26,0,0,44,133,14,0,0,47,
+131,6,0,3,96,34,34,44,137,39,0,1,46,39,130,95,0,128,5,0,2,95,95,46,
+128,0,0,1,47,95,134,93,0,136,38,0,130,60,0,128,36,0,2,44,45,34,133,145,
+0,129,92,0,2,43,45,45,128,50,0,136,120,0,129,71,0,0,32,129,145,0,130,85,
+0,134,17,0,135,0,0,1,96,34,133,43,0,139,23,0,135,41,0,130,201,0,128,132,
+0,128,106,0,2,96,45,46,133,90,0,128,128,0,2,44,43,34,128,187,0,129,178,0,
+128,0,0,1,45,94,129,122,0,1,60,34,132,142,0,0,96,129,42,0,130,8,0,1,
+45,46,130,49,0,128,76,0,1,46,39,129,133,0,132,246,0,0,124,134,128,0,131,39,
+0,132,12,0,1,45,46,129,113,0,1,96,45,129,51,0,130,41,0,128,30,1,0,34,
+133,153,0,0,96,137,183,0,129,40,0,134,12,0,0,44,129,197,0,134,82,0,149,37,
+0,132,12,0,128,73,1,0,34,128,172,0,128,49,0,141,242,0,1,44,45,132,144,0,
+128,235,0,1,34,34,128,8,0,1,95,58,129,204,1,1,34,39,131,204,0,128,16,0,
+129,151,0,0,96,129,79,1,128,236,0,129,20,1,128,211,1,131,181,1,1,45,34,133,
+106,0,137,208,0,131,114,0,0,96,130,2,1,131,18,2,128,0,0,2,46,39,34,132,
+4,1,128,6,0,0,106,134,43,0,0,124,129,253,0,133,58,0,134,56,0,0,92,128,
+20,0,129,136,0,129,14,0,1,41,95,128,67,0,130,109,0,128,13,2,135,237,0,131,
+9,0,134,234,0,1,96,46,129,50,1,1,10,32,132,15,0,129,64,1,0,34,129,101,
+0,128,8,0,0,96,129,172,0,141,56,0,138,58,0,2,10,32,92,135,191,0,132,165,
+0,131,0,0,0,76,134,9,0,135,53,1,0,96,129,249,1,129,240,2,128,223,0,128,
+156,1,128,14,0,128,222,0,140,84,1,0,92,132,90,1,133,167,2,131,46,1,134,21,
+1,132,123,0,137,218,1,129,1,2,1,46,92,128,3,0,128,219,2,136,18,1,133,44,
+0,131,55,0,130,43,2,128,26,0,132,94,0,131,33,3,0,34,128,62,2,0,39,134,
+223,0,0,46,128,33,0,129,199,1,2,34,96,96,131,37,0,133,57,0,131,22,1,1,
+45,94,129,169,0,128,101,0,134,176,0,135,25,1,128,47,0,133,20,1,129,237,1,129,
+228,0,140,239,3,1,92,46,138,208,0,136,123,2,129,40,1,133,213,0,136,112,0,143,
+81,1,138,245,0,131,64,0,132,205,0,141,55,0,135,36,2,142,215,2,132,120,0,1,
+96,44,129,137,1,2,95,95,96,139,56,0,144,18,3,133,48,1,134,252,1,129,19,0,
+140,166,0,137,53,3,139,18,0,0,70,137,70,0,134,166,0,0,95,129,125,0,0,44,
+128,40,1,138,111,3,136,170,0,0,106,135,177,0,0,76,129,78,1,131,166,0,2,44,
+34,44,128,60,2,129,93,3,129,164,4,142,58,0,0,95,128,51,0,129,165,0,132,144,
+2,134,71,4,133,129,0,128,186,1,128,112,0,131,30,2,129,124,0,128,237,1,0,60,
+128,68,0,0,86,135,75,4,0,95,128,41,3,130,122,3,129,163,2,1,34,34,130,13,
+2,1,32,41,134,22,3,132,74,0,128,102,0,128,43,0,137,181,3,0,39,133,234,3,
+133,7,5,129,139,2,130,17,4,140,162,0,132,122,3,128,119,2,132,162,3,137,242,4,
+130,43,3,133,16,5,136,121,1,131,47,1,135,118,2,132,142,0,131,84,4,128,23,0,
+135,140,1,129,210,5,133,0,0,128,218,5,130,131,0,4,34,32,10,10,10,0,32,132,
+0,0,3,46,39,45,46,133,11,0,145,0,0,8,44,46,46,32,95,44,46,95,10,128,
+10,0,5,45,45,34,34,46,96,128,46,0,129,3,0,148,46,0,3,39,32,32,47,128,
+3,0,128,35,0,1,45,46,130,53,0,2,92,95,95,130,13,0,0,96,128,5,0,0,
+92,150,51,0,128,3,0,0,95,129,0,0,130,16,0,128,58,0,128,56,0,128,0,0,
+0,124,128,115,0,128,69,0,147,57,0,129,54,0,0,32,128,155,0,130,6,0,130,32,
+0,128,63,0,1,46,39,131,57,0,0,106,128,59,0,129,73,0,128,3,0,0,76,140,
+55,0,0,46,130,48,0,132,54,0,130,100,0,1,32,124,130,52,0,0,46,128,53,0,
+133,75,0,130,61,0,135,0,0,0,47,133,50,0,133,162,0,134,52,0,0,124,129,10,
+0,3,46,34,34,34,128,6,0,129,109,0,129,44,1,0,45,128,180,0,2,46,46,39,
+129,67,0,4,47,45,39,34,34,129,136,0,129,49,1,128,16,0,131,158,0,0,124,128,
+104,0,130,107,0,129,49,0,0,96,128,85,1,135,105,0,128,99,0,134,153,0,130,133,
+0,2,124,32,70,131,51,0,129,114,0,139,185,0,136,0,0,130,122,0,136,51,0,132,
+156,0,128,118,0,130,133,0,132,49,1,128,190,1,133,4,1,133,51,1,134,51,0,0,
+39,132,51,0,128,73,0,129,172,0,1,47,44,131,29,0,129,26,0,131,9,0,0,47,
+131,100,0,133,52,0,3,124,44,45,39,132,154,0,130,48,0,1,96,47,128,43,0,130,
+28,0,130,159,0,129,96,0,0,47,128,4,0,130,178,0,130,156,1,1,44,45,129,130,
+0,0,45,132,160,1,130,229,1,129,4,1,0,124,133,80,0,129,4,1,1,47,46,133,
+229,0,3,32,96,34,34,128,206,1,0,46,135,47,0,129,184,1,4,124,95,32,124,40,
+134,235,0,128,9,1,3,41,124,95,95,132,15,1,1,96,46,130,65,2,0,10,128,126,
+1,130,0,0,0,39,129,130,0,2,96,45,39,130,121,2,131,112,0,134,105,1,128,175,
+1,135,94,0,130,12,0,0,34,128,180,1,152,6,3,128,32,0,0,40,131,136,0,130,
+100,2,134,146,0,142,40,0,130,122,0,128,253,1,129,250,2,128,23,2,129,145,0,128,
+65,3,134,219,1,0,32,128,52,1,140,88,0,128,150,0,2,45,45,96,130,47,0,133,
+168,0,131,48,0,128,120,3,130,251,2,1,95,44,140,145,3,128,32,0,128,108,1,136,
+48,0,2,32,32,62,134,56,0,128,139,2,140,149,0,0,92,129,81,1,2,92,32,106,
+137,48,0,132,233,2,128,49,0,130,177,3,141,237,0,129,164,0,0,89,136,47,0,136,
+32,0,0,96,128,217,2,146,34,1,139,144,0,159,0,0,136,47,0,154,129,4,128,182,
+2,130,154,1,136,47,0,140,157,3,141,88,0,132,194,3,165,47,0,130,170,2,168,47,
+0,129,84,2,143,143,0,151,19,5,129,194,0,129,253,1,135,47,0,131,146,4,147,13,
+5,0,32,128,242,1,129,110,1,0,47,132,3,5,136,42,0,139,48,0,132,164,0,0,
+40,129,121,3,130,212,4,0,96,137,49,0,132,99,0,138,149,0,133,214,0,3,34,47,
+32,95,130,209,1,0,95,136,195,0,1,95,44,133,30,0,1,45,44,131,227,4,136,49,
+0,2,106,45,39,130,139,2,128,199,0,136,101,0,1,39,46,129,174,3,131,133,0,128,
+20,3,129,247,2,128,35,0,133,111,5,2,124,45,43,128,13,0,0,46,128,48,6,2,
+44,46,96,137,153,0,132,51,0,133,130,2,129,3,3,131,1,2,1,95,95,130,72,1,
+0,34,136,41,1,129,103,4,128,85,0,1,95,60,139,250,0,2,34,96,44,128,201,3,
+0,92,139,85,0,5,95,44,120,46,46,41,137,39,0,0,39,128,168,1,128,149,0,138,
+79,0,128,103,4,0,10,0,32,151,0,0,0,95,138,12,0,0,10,151,40,0,2,47,
+32,41,130,45,0,7,95,44,46,45,34,34,32,41,150,42,0,5,44,39,32,47,46,46,
+128,4,0,0,34,129,81,0,7,44,43,39,45,45,34,96,46,149,46,0,0,47,132,5,
+0,1,106,95,128,86,0,0,39,131,64,0,1,45,34,147,45,0,128,89,0,134,5,0,
+129,91,0,129,0,0,2,32,32,96,145,44,0,1,95,43,129,26,0,1,32,46,131,12,
+0,1,46,45,131,51,0,0,92,128,45,0,0,46,128,0,0,141,231,0,2,44,39,34,
+128,210,0,128,0,0,1,34,34,128,143,0,134,46,0,130,0,0,131,66,0,128,59,0,
+138,51,0,134,132,0,128,0,0,128,10,0,3,39,44,45,45,128,67,0,1,96,45,132,
+45,0,0,76,142,198,0,0,46,130,95,0,136,15,0,135,64,0,128,149,0,128,0,0,
+0,124,128,5,1,134,47,0,128,94,0,138,152,1,139,0,0,130,48,0,2,124,32,106,
+140,180,1,0,47,131,149,0,128,114,1,137,191,0,133,16,1,130,27,0,129,155,1,132,
+192,1,0,124,130,54,0,0,95,128,135,0,128,24,0,2,46,43,39,128,185,0,131,136,
+0,136,228,0,1,45,34,128,97,1,0,46,129,186,0,133,81,0,2,44,39,10,129,22,
+0,132,11,0,128,21,0,128,182,0,128,2,0,135,214,0,128,28,0,2,34,39,39,128,
+54,0,1,44,46,135,70,1,1,47,10,132,171,0,128,127,1,128,105,1,1,34,45,128,
+45,1,138,105,0,1,39,34,128,61,1,133,66,0,130,249,0,0,44,129,134,1,3,45,
+34,46,10,129,148,0,0,44,152,192,2,138,0,0,1,96,45,128,205,0,0,96,129,65,
+0,129,168,0,141,207,0,139,16,1,138,229,1,129,160,1,0,96,129,188,1,129,194,1,
+129,87,2,128,37,2,128,165,0,128,204,0,129,94,2,0,96,128,49,1,1,45,46,130,
+210,0,4,45,45,43,32,43,144,7,2,0,96,135,131,0,133,218,1,130,79,0,135,0,
+0,131,112,1,137,22,0,0,92,131,252,2,140,78,2,137,78,1,0,32,128,171,1,0,
+45,128,145,0,137,201,0,135,74,3,130,232,0,138,0,0,128,245,2,128,164,0,0,46,
+130,251,2,131,71,0,131,58,1,131,11,0,128,5,0,129,152,2,132,127,2,137,207,2,
+0,96,128,100,0,128,220,0,130,193,2,129,59,0,133,152,0,1,96,44,130,149,1,133,
+158,0,131,228,0,135,242,1,129,100,1,148,212,3,1,96,46,134,220,0,130,8,0,136,
+225,0,130,204,0,128,16,2,130,17,0,139,135,0,139,22,4,134,52,2,130,13,0,133,
+54,1,130,243,0,128,250,0,133,44,4,146,64,0,131,58,0,134,127,2,136,4,1,128,
+205,2,135,171,1,148,61,0,5,124,44,32,46,60,40,135,222,3,136,224,1,1,92,95,
+133,215,0,147,252,0,0,124,129,72,1,0,43,128,129,1,128,136,1,0,47,128,165,0,
+130,0,0,139,136,2,147,56,0,128,54,2,129,57,2,129,19,2,0,86,128,164,3,0,
+47,129,58,0,131,44,2,131,228,1,128,192,3,152,157,5,133,67,0,128,0,0,2,92,
+95,96,128,132,3,128,111,1,3,124,44,45,46,135,82,4,158,59,0,1,34,34,129,177,
+3,128,110,2,2,96,32,10,0,32,166,0,0,2,46,34,10,165,42,0,4,44,39,32,
+32,124,164,45,0,10,95,44,46,46,46,32,39,46,95,95,95,155,49,0,4,43,45,45,
+46,95,129,91,0,4,46,45,34,43,46,131,19,0,3,34,96,45,46,151,53,0,5,95,
+44,45,45,45,92,128,8,0,8,96,34,32,47,32,124,112,124,46,128,151,0,129,53,0,
+129,6,0,0,92,149,55,0,4,44,45,32,95,46,128,56,0,0,34,129,99,0,1,124,
+95,129,203,0,131,22,0,0,34,128,0,0,128,130,0,148,216,0,128,39,0,0,44,131,
+95,0,132,101,0,132,53,0,134,12,0,1,44,39,145,56,0,129,54,0,2,39,32,124,
+130,55,0,136,107,1,0,94,128,128,0,129,237,0,129,0,0,139,112,0,2,124,46,32,
+128,23,0,1,96,46,128,209,0,132,50,0,129,60,0,129,233,0,1,46,43,133,107,0,
+128,29,0,141,55,0,1,44,124,128,39,0,2,96,47,92,128,62,0,129,32,0,132,55,
+0,132,114,0,128,69,1,133,120,0,2,32,32,47,133,54,0,129,4,1,0,46,129,98,
+1,4,96,46,44,92,32,129,71,1,129,40,0,130,219,1,134,86,0,128,16,0,129,165,
+0,1,124,32,135,220,0,1,96,46,136,243,0,0,32,130,52,1,4,45,39,46,46,45,
+128,114,1,137,199,0,0,96,129,21,0,0,76,136,162,0,136,254,0,0,124,131,192,0,
+131,166,0,128,80,0,132,8,1,134,214,1,129,95,0,138,247,1,132,47,0,131,212,0,
+132,253,0,129,88,2,131,161,0,129,91,2,128,0,0,130,151,0,128,19,2,128,9,1,
+3,46,32,44,34,140,0,2,132,2,1,129,85,1,130,107,2,0,39,130,9,0,135,88,
+0,130,35,0,0,44,130,58,2,128,78,2,1,32,34,128,77,0,141,207,1,2,96,45,
+43,133,250,0,128,134,0,131,73,0,137,66,0,1,39,92,136,57,1,128,193,0,0,76,
+138,241,2,0,45,128,39,1,1,46,44,128,108,1,0,95,128,16,3,129,227,0,0,106,
+142,223,0,128,196,2,0,32,136,92,2,1,32,40,128,38,0,136,66,0,131,37,0,0,
+106,133,127,1,1,96,45,138,110,0,130,126,1,128,83,0,132,33,1,130,101,0,1,95,
+95,139,196,0,129,86,2,1,95,95,128,200,2,129,28,0,128,49,0,138,63,0,129,57,
+0,129,2,0,128,27,0,1,45,96,141,12,4,0,106,129,86,0,133,243,2,0,47,138,
+54,1,129,8,1,128,26,0,0,59,128,82,0,136,52,0,0,44,128,112,1,0,124,129,
+95,0,0,124,129,85,3,131,84,2,0,96,129,146,0,129,124,0,132,193,0,0,92,130,
+6,0,0,96,137,234,1,129,99,0,1,124,47,128,60,2,133,173,2,139,162,0,131,112,
+0,128,184,2,128,151,2,0,95,138,225,1,128,253,0,135,148,0,1,96,39,134,158,1,
+139,167,0,132,43,0,138,220,0,128,167,0,137,72,3,139,18,2,131,236,4,129,149,2,
+128,96,2,0,46,129,163,4,138,59,0,0,43,128,109,2,139,8,1,135,142,2,128,199,
+4,131,64,0,128,6,0,130,84,0,128,122,1,138,33,1,138,105,3,136,13,2,131,149,
+0,130,118,0,133,157,4,1,96,34,130,41,0,134,187,3,2,44,45,43,139,83,3,128,
+82,3,136,69,3,1,44,43,130,12,0,136,3,1,129,151,0,130,11,2,131,38,3,131,
+119,0,133,234,0,131,10,3,128,116,1,128,0,0,1,58,61,130,2,3,130,7,4,136,
+194,5,1,39,10,134,234,4,0,76,135,82,0,128,70,3,135,115,0,135,49,0,133,213,
+0,128,50,0,1,10,92,134,150,0,135,30,4,132,171,0,128,87,0,136,63,0,130,22,
+0,129,54,1,129,166,0,129,41,2,139,28,4,128,25,0,2,43,39,34,133,206,2,129,
+171,0,129,87,6,128,144,1,128,183,5,1,32,10,0,32,142,0,0,2,46,34,92,143,
+20,0,135,0,0,1,95,10,143,19,0,0,124,128,1,0,2,32,44,46,146,46,0,4,
+44,45,34,32,47,144,51,0,6,106,32,96,45,39,32,47,143,48,0,1,46,39,128,5,
+0,2,47,46,46,142,51,0,0,44,129,24,0,129,108,0,145,23,0,1,95,46,128,126,
+0,0,124,141,51,0,133,94,0,0,96,136,155,0,2,46,34,39,129,49,0,0,44,128,
+125,0,2,32,32,92,128,26,0,141,106,0,130,128,0,132,0,0,133,10,1,128,49,0,
+129,2,0,130,51,0,132,131,0,0,95,139,213,0,139,201,0,131,55,0,130,19,0,132,
+182,0,132,54,0,138,162,0,141,253,0,129,166,0,130,19,0,137,24,0,128,52,0,0,
+39,136,52,0,142,254,0,128,54,0,142,51,0,128,37,0,0,96,134,213,0,3,46,45,
+46,96,143,52,0,129,46,0,136,154,0,130,145,1,136,93,0,134,230,1,145,12,2,1,
+47,86,143,188,0,129,1,2,131,78,0,129,37,1,135,230,0,142,21,2,0,95,143,173,
+0,130,62,0,131,44,1,130,97,1,135,89,1,141,237,0,130,15,0,139,182,0,130,185,
+0,0,47,128,0,2,131,156,1,0,44,135,44,1,145,60,0,143,112,2,3,39,32,34,
+34,133,215,0,131,58,0,3,96,34,45,45,143,58,0,143,57,0,135,96,0,129,145,0,
+2,95,44,46,128,105,1,132,124,0,143,53,1,0,124,130,95,1,141,107,3,133,201,0,
+3,45,45,45,34,131,11,0,134,251,0,141,66,0,128,62,0,144,251,1,142,149,0,136,
+255,0,133,65,0,0,95,128,28,3,2,46,45,45,129,32,3,143,63,0,128,27,0,128,
+124,0,130,29,0,139,127,0,131,63,0,0,44,134,28,1,129,188,2,130,104,3,145,125,
+0,132,8,0,136,124,0,129,249,1,136,156,0,131,61,0,128,16,0,138,51,1,138,60,
+0,138,79,3,0,89,139,102,1,0,124,130,41,1,0,70,132,81,4,135,255,1,1,47,
+95,128,118,1,0,95,130,196,3,129,0,0,134,65,0,0,95,142,35,2,130,15,0,129,
+38,2,0,43,129,9,0,128,149,4,0,34,134,242,0,135,134,1,132,191,0,133,75,2,
+144,106,3,1,45,39,130,236,4,1,32,44,139,221,2,0,45,128,132,0,130,189,2,0,
+10,147,59,0,136,84,5,131,63,0,0,32,131,48,0,136,201,0,128,133,0,0,10,128,
+122,2,128,151,0,128,140,1,128,0,0,129,31,0,131,25,0,0,68,135,53,1,132,60,
+0,0,32,128,179,2,0,39,132,124,0,0,95,128,40,0,0,96,128,50,0,133,251,0,
+0,47,130,138,3,132,207,0,128,248,3,1,96,45,133,60,0,0,96,130,130,1,130,11,
+4,131,120,0,0,47,128,219,1,131,151,0,134,45,4,128,83,0,0,96,131,161,3,130,
+151,1,0,96,128,138,0,135,52,2,128,9,0,131,157,5,135,174,4,133,28,0,0,92,
+132,63,0,136,105,4,0,39,130,198,0,0,46,136,78,5,132,44,0,135,65,2,129,2,
+6,132,0,0,0,76,153,112,4,139,50,2,144,72,3,129,92,0,134,252,1,144,237,4,
+135,89,6,148,67,5,130,38,5,134,65,0,131,139,4,139,199,6,138,215,1,146,65,0,
+128,31,0,133,6,1,1,32,106,135,191,1,131,215,4,130,118,2,136,79,0,0,95,144,
+66,0,1,44,94,129,26,1,133,67,0,129,235,1,1,96,43,129,167,2,129,0,0,128,
+251,0,137,152,6,132,41,5,0,96,138,102,0,129,123,2,128,64,2,128,68,2,133,66,
+0,0,44,128,101,0,0,95,128,167,1,131,108,0,1,44,43,137,208,0,135,77,0,129,
+240,4,130,0,0,0,34,133,191,3,128,27,0,130,248,3,131,252,3,0,124,129,6,4,
+130,46,3,128,53,0,144,203,7,129,104,0,0,96,129,90,3,0,45,128,0,3,147,25,
+1,128,174,2,0,10,0,32,128,0,0,3,96,46,95,10,129,7,0,1,32,92,128,10,
+0,131,9,0,128,10,0,135,11,0,1,32,46,130,36,0,133,13,0,0,106,130,5,0,
+1,58,45,129,0,0,4,43,46,46,46,45,134,25,0,5,47,32,32,95,44,39,129,8,
+0,2,34,34,95,130,17,0,0,96,129,58,0,129,21,0,128,39,0,132,100,0,129,32,
+0,129,35,0,129,87,0,13,45,34,99,124,34,96,43,45,32,45,43,45,45,34,132,21,
+0,1,96,45,132,43,0,130,74,0,134,0,0,6,34,34,34,43,95,32,124,132,13,0,
+1,95,44,128,48,0,1,34,45,129,42,0,128,48,0,129,7,0,128,49,0,131,47,0,
+131,121,0,134,54,0,132,68,0,0,39,128,209,0,133,0,0,128,48,0,128,54,0,130,
+210,0,130,79,0,0,45,138,104,0,135,0,0,1,95,46,140,24,0,128,154,0,130,53,
+0,0,40,131,30,0,129,105,0,1,44,46,129,7,1,129,134,0,132,0,0,1,92,96,
+129,37,0,140,0,0,128,102,0,131,101,1,129,16,1,1,47,95,129,204,0,130,64,0,
+2,95,46,124,128,65,0,134,87,1,1,96,46,130,48,1,0,44,136,113,0,130,28,0,
+132,124,1,2,96,39,124,131,176,0,131,25,1,7,39,46,39,47,39,34,34,39,130,226,
+0,0,106,128,41,0,1,92,44,128,32,0,129,85,0,131,0,0,6,124,124,34,34,96,
+45,39,134,185,1,2,96,95,46,129,4,1,131,191,1,134,7,0,5,95,95,45,39,124,
+95,128,72,0,3,46,95,58,46,128,149,0,130,213,0,133,245,1,1,32,34,133,219,1,
+130,196,0,128,224,1,134,233,1,132,48,2,134,18,0,0,124,130,170,0,130,3,0,128,
+13,1,135,46,2,129,26,0,133,181,1,134,64,0,136,74,0,128,11,0,130,30,0,0,
+58,131,108,1,1,45,47,137,56,0,130,18,0,128,235,1,134,135,1,0,124,131,33,1,
+132,4,1,129,56,0,128,62,0,0,92,131,90,2,131,184,0,0,124,129,222,1,132,9,
+2,1,44,45,131,200,0,128,87,1,128,164,1,131,54,1,129,120,0,128,55,0,1,46,
+92,129,103,2,130,55,0,2,124,96,118,128,97,0,128,146,1,0,39,128,18,0,128,207,
+1,134,108,0,128,178,1,128,204,1,129,15,0,131,214,2,129,55,0,0,124,129,26,3,
+2,44,39,10,128,127,2,128,46,0,134,108,2,0,92,129,22,0,137,0,0,129,152,1,
+1,39,96,133,74,0,0,96,130,64,0,4,43,45,10,32,45,131,230,0,133,45,0,0,
+46,134,209,2,142,0,0,1,47,96,131,230,0,129,94,2,128,55,0,0,96,130,50,0,
+133,45,0,2,124,32,76,149,55,0,128,242,1,134,129,0,4,96,92,10,32,39,130,159,
+2,1,46,58,132,170,0,0,47,141,169,0,140,167,2,129,209,2,128,11,1,1,46,124,
+136,135,1,129,66,0,0,43,129,85,0,151,58,0,0,39,135,174,3,0,96,136,57,0,
+131,27,0,1,96,39,128,94,2,149,230,0,136,10,2,136,101,4,139,0,0,147,119,0,
+0,106,139,60,1,0,39,148,60,0,133,133,4,141,234,0,140,121,1,128,42,1,148,0,
+0,0,92,140,83,4,129,61,0,136,180,0,129,196,0,0,92,137,46,1,142,225,0,0,
+34,129,135,2,131,176,4,128,72,1,133,158,2,135,31,0,0,124,151,61,0,1,96,118,
+129,153,2,128,57,0,0,46,131,196,0,132,180,0,0,96,128,99,3,0,95,130,172,2,
+128,178,2,0,44,151,123,0,135,227,0,129,219,2,137,119,0,128,72,3,0,74,131,126,
+0,161,61,0,141,12,0,133,85,2,0,39,157,60,0,131,181,0,157,99,0,128,180,3,
+128,244,4,0,106,150,37,0,128,101,6,128,128,2,128,62,1,128,136,1,152,75,0,128,
+227,0,131,117,0,0,92,152,151,0,132,1,6,129,133,1,0,10,0,32,142,0,0,7,
+95,46,95,95,95,46,46,95,139,21,0,1,44,39,138,13,0,1,46,32,128,36,0,1,
+95,10,143,61,0,1,32,92,131,6,0,1,39,45,134,66,0,4,124,58,32,124,32,133,
+62,0,11,95,95,44,45,32,95,32,46,46,46,32,41,145,62,0,8,106,45,34,34,34,
+124,34,96,45,128,61,0,3,96,46,39,46,128,62,0,2,32,92,124,128,4,0,129,117,
+0,1,34,39,128,61,0,0,45,128,19,0,128,0,0,1,96,46,144,62,0,130,38,0,
+132,5,0,1,96,46,128,2,0,4,92,45,39,32,106,128,12,0,2,46,45,46,128,129,
+0,131,132,0,128,24,0,129,36,0,131,62,0,0,95,131,77,0,131,0,0,0,96,136,
+62,0,130,201,0,3,34,32,32,47,133,212,0,129,64,0,135,31,0,131,62,0,128,28,
+0,133,45,0,134,251,0,0,76,133,201,0,136,24,0,0,41,135,24,1,130,23,0,0,
+106,129,61,0,129,89,0,137,61,0,131,33,0,130,157,0,1,44,39,129,34,1,129,116,
+0,128,47,1,2,46,32,44,134,155,0,129,51,0,1,44,39,128,61,0,129,8,0,137,
+97,0,129,33,0,129,51,1,128,63,0,128,26,0,0,47,128,69,0,133,111,0,3,47,
+32,47,34,128,67,1,128,2,1,128,192,0,129,59,0,128,87,0,1,44,46,138,120,0,
+130,8,1,1,96,43,130,113,0,3,32,124,46,41,131,107,0,129,47,1,0,40,130,122,
+1,4,96,96,46,95,46,128,57,0,0,124,129,66,0,140,57,0,131,24,2,0,47,129,
+162,0,128,47,1,0,96,133,36,1,2,39,45,45,128,60,1,130,44,0,0,39,128,170,
+1,131,170,0,139,58,0,134,81,2,4,92,32,39,46,47,137,135,1,128,41,0,129,184,
+1,131,213,0,0,10,137,212,1,138,231,1,133,52,1,0,96,128,125,0,0,46,130,1,
+0,2,95,45,124,128,254,0,134,29,0,1,95,92,128,60,0,0,44,128,81,2,138,92,
+0,0,96,128,16,0,132,68,2,0,124,129,51,1,0,96,128,29,1,8,45,45,124,39,
+47,124,44,32,44,131,206,0,0,95,129,44,1,2,47,10,124,130,252,1,134,73,1,128,
+188,2,0,40,135,169,1,0,44,128,47,1,128,60,0,0,45,128,144,2,0,46,128,46,
+0,128,50,0,130,104,0,132,38,2,129,121,0,135,84,2,128,131,0,129,22,0,128,70,
+1,130,188,0,133,116,2,0,96,128,135,0,130,60,0,133,42,0,130,23,0,0,44,128,
+73,0,1,45,46,131,63,0,2,44,45,39,128,70,1,2,39,34,39,133,131,0,1,76,
+44,128,169,0,138,205,0,0,118,139,23,1,133,168,3,1,96,10,129,136,2,130,192,0,
+0,46,128,78,3,134,99,0,128,34,0,140,193,1,137,14,0,1,124,124,135,13,0,0,
+96,129,241,1,131,65,0,128,153,0,134,66,1,130,59,2,0,124,140,174,1,138,15,2,
+0,39,133,14,0,0,46,128,16,1,1,92,10,128,72,0,133,37,0,131,76,0,129,25,
+0,129,235,0,0,124,132,240,0,129,89,1,128,215,3,0,43,128,245,0,130,50,4,1,
+44,39,128,246,0,134,68,0,128,175,1,0,39,129,109,3,131,148,2,2,46,44,34,128,
+52,0,0,44,129,142,0,0,47,129,18,0,128,188,1,130,249,2,136,69,1,130,87,1,
+128,190,1,129,72,1,134,186,1,128,4,3,0,34,130,49,4,129,17,0,130,141,2,0,
+124,129,129,0,1,46,45,129,46,0,128,124,2,132,137,0,128,249,4,128,124,1,130,210,
+1,0,95,129,139,0,1,44,96,130,178,0,128,184,1,130,14,0,129,61,0,131,249,3,
+130,152,4,131,249,0,128,158,4,132,222,0,1,92,92,128,138,0,0,32,136,136,0,133,
+58,1,133,203,0,129,75,3,2,44,34,34,129,217,4,131,126,4,0,96,130,26,0,0,
+106,129,78,0,134,34,0,129,172,3,146,218,4,134,69,0,128,3,2,128,96,2,133,165,
+1,130,28,0,133,226,2,128,57,1,129,203,0,133,132,4,136,0,0,129,32,1,133,216,
+3,130,37,2,132,1,5,131,119,2,129,91,0,130,118,0,131,162,1,0,46,128,180,3,
+140,63,0,132,88,2,132,66,0,130,38,0,135,65,0,133,187,2,1,96,34,130,232,2,
+132,32,0,131,145,4,133,88,1,0,39,128,85,0,132,226,4,128,0,0,131,54,4,137,
+195,5,139,98,6,128,141,0,129,98,6,128,5,6,128,16,6,128,0,0,129,148,3,128,
+32,0,134,65,2,131,66,4,137,63,0,0,39,128,252,0,128,46,3,129,236,2,129,174,
+1,132,78,0,128,235,3,130,0,0,0,39,130,14,0,128,87,5,130,109,2,131,223,1,
+128,38,5,138,68,6,130,71,2,130,0,0,139,138,0,141,102,5,134,175,3,1,44,34,
+145,195,6,159,0,0,129,211,0,129,147,0,1,32,10,0,32,144,0,0,5,95,95,46,
+46,95,10,141,21,0,3,44,45,45,39,130,8,0,4,34,96,45,46,95,130,39,0,2,
+44,46,45,128,21,0,131,0,0,0,46,130,48,0,0,95,132,0,0,128,45,0,131,44,
+0,134,0,0,2,96,45,34,129,17,0,0,47,131,97,0,4,46,45,39,124,10,131,36,
+0,131,39,0,0,58,145,136,0,128,0,0,0,46,130,122,0,130,35,0,2,39,10,124,
+130,6,0,130,23,0,0,106,132,170,0,128,169,0,139,48,0,128,35,0,131,46,0,3,
+32,106,10,76,134,112,0,129,22,0,128,76,0,130,24,0,0,96,130,83,0,134,47,0,
+131,20,0,128,40,0,2,10,32,92,133,86,0,131,46,0,1,96,46,130,73,0,130,11,
+0,133,4,1,133,213,0,130,86,0,129,36,1,0,46,132,30,0,2,44,39,92,134,37,
+0,132,115,0,130,0,0,1,39,46,129,14,1,130,20,0,128,245,0,1,34,32,128,246,
+0,128,89,0,134,141,0,128,75,1,129,0,0,141,45,1,130,25,0,1,32,43,131,22,
+0,128,153,0,131,182,0,134,125,0,150,0,0,132,219,0,1,60,95,133,191,1,139,236,
+0,2,32,46,92,128,228,0,141,0,0,129,193,0,130,179,1,0,39,132,52,0,131,210,
+0,2,124,32,35,132,14,0,0,124,138,3,1,133,10,1,1,34,34,130,12,2,131,248,
+1,142,52,0,2,96,39,95,137,6,1,138,207,1,130,151,0,131,54,0,132,210,0,136,
+166,0,3,44,45,34,34,139,180,0,128,0,0,129,201,1,138,56,0,131,91,0,3,40,
+95,95,41,133,180,2,128,139,0,130,145,0,140,0,0,3,58,34,34,45,132,78,0,130,
+57,0,139,148,0,3,92,34,39,117,135,219,0,0,124,138,28,0,130,23,0,131,45,1,
+129,180,1,141,147,0,128,25,0,136,57,0,138,55,0,133,10,1,132,57,0,131,14,0,
+136,167,2,0,96,135,238,1,133,112,2,132,211,0,131,42,0,130,29,0,129,57,0,132,
+246,0,140,196,1,142,114,0,129,182,0,129,14,0,132,76,1,130,198,1,133,230,1,143,
+59,0,136,69,2,130,239,0,1,124,95,133,17,0,134,104,2,128,36,0,1,46,60,142,
+108,2,1,96,43,128,230,3,136,65,0,133,45,1,134,55,2,5,96,46,47,96,46,95,
+143,164,2,2,39,95,46,128,23,0,133,101,0,133,186,3,0,44,134,98,4,0,47,130,
+26,4,144,0,0,136,207,1,130,164,2,134,105,0,130,123,0,128,83,0,147,92,2,134,
+122,3,128,87,3,132,48,0,133,103,1,133,187,4,133,14,0,137,47,0,131,254,0,136,
+89,1,128,111,0,1,96,34,128,243,0,132,0,0,0,43,135,95,0,133,42,0,0,44,
+128,92,2,128,217,0,145,190,3,128,44,0,0,46,128,108,0,133,41,0,0,39,128,35,
+5,149,190,3,2,96,43,95,129,29,1,0,10,0,32,163,0,0,3,95,95,44,46,131,
+0,0,1,95,10,130,15,0,132,13,0,131,18,0,1,95,95,137,41,0,0,95,130,28,
+0,0,60,136,20,0,1,96,34,131,54,0,1,39,46,132,19,0,2,96,34,44,131,7,
+0,3,39,45,45,46,128,90,0,1,45,39,131,57,0,132,28,0,1,45,46,132,73,0,
+6,46,46,62,45,45,45,44,128,3,0,131,0,0,2,46,46,10,130,96,0,2,32,45,
+46,128,143,0,2,45,45,34,137,163,0,4,96,45,32,32,44,130,73,0,0,96,132,17,
+0,3,46,96,45,34,129,15,0,130,11,0,0,39,135,143,0,128,37,0,0,10,130,139,
+0,2,34,34,39,131,107,0,139,0,0,0,46,131,52,0,128,126,0,136,216,0,137,104,
+0,128,23,0,129,180,0,129,211,0,130,12,0,128,6,0,141,42,0,131,86,0,0,44,
+130,73,0,0,96,144,99,0,130,133,0,131,211,0,131,82,1,129,112,0,0,62,129,40,
+0,139,145,0,131,203,0,0,124,131,12,0,132,6,0,136,109,1,131,240,0,132,0,0,
+1,41,10,131,21,1,1,34,96,129,4,0,128,0,0,128,156,0,135,29,0,0,92,132,
+187,0,143,72,0,2,44,46,43,128,196,1,130,78,0,0,59,128,145,0,4,34,34,10,
+92,95,141,107,0,136,195,0,134,10,0,0,95,132,40,1,132,137,0,132,118,1,1,96,
+34,129,150,1,0,96,128,170,1,1,32,34,130,115,0,143,206,0,4,32,32,47,32,95,
+128,231,1,128,0,0,136,190,0,0,32,137,11,0,132,38,0,0,45,129,70,0,129,93,
+1,138,100,2,133,0,0,128,163,0,0,35,131,9,0,1,35,39,131,223,0,146,0,0,
+0,96,128,22,1,130,172,1,131,118,1,128,119,0,130,181,2,137,209,1,128,59,2,131,
+0,0,139,145,0,136,213,2,136,67,0,128,52,2,129,38,1,128,40,0,137,36,1,130,
+147,2,131,0,0,131,221,2,134,93,1,130,83,1,1,34,32,130,202,0,141,191,0,144,
+12,0,0,92,139,129,0,1,92,34,132,176,0,0,96,155,63,0,134,0,1,0,47,140,
+36,0,142,54,0,140,142,2,131,207,1,140,53,0,144,54,0,0,32,138,214,0,131,54,
+1,142,44,1,0,106,142,54,0,0,106,152,153,1,134,231,1,145,218,0,146,53,3,137,
+46,2,130,99,2,140,0,0,0,76,128,39,1,153,56,0,128,178,2,0,44,144,218,0,
+128,110,0,2,96,46,58,131,203,3,143,253,1,128,198,3,128,2,0,144,54,0,4,96,
+46,44,39,124,128,70,4,0,34,129,161,2,139,50,0,0,60,129,63,4,129,86,2,134,
+121,2,141,58,0,128,30,0,130,173,4,134,222,4,132,14,0,128,74,0,4,124,96,39,
+32,10,0,32,139,0,0,4,95,44,46,43,45,129,0,0,0,95,128,9,0,1,95,10,
+139,28,0,0,47,130,2,0,3,32,32,44,39,130,14,0,1,96,46,131,31,0,3,44,
+43,46,95,128,6,0,5,46,47,46,46,46,92,128,9,0,129,35,0,2,44,46,46,128,
+5,0,0,92,131,32,0,0,124,128,42,0,1,96,43,131,52,0,128,54,0,4,45,39,
+32,46,39,128,33,0,0,124,128,25,0,133,32,0,4,32,124,40,32,44,130,76,0,1,
+46,96,129,7,0,128,17,0,128,39,0,0,44,128,70,0,131,0,0,129,96,0,130,159,
+0,0,95,132,15,0,132,154,0,7,92,32,124,46,46,96,47,44,128,83,0,7,32,39,
+34,34,34,39,32,96,128,4,0,0,34,130,200,0,128,197,0,1,34,45,128,76,0,2,
+46,45,43,129,30,0,130,62,0,6,46,45,34,34,96,45,45,135,218,0,1,46,34,128,
+106,0,131,221,0,2,34,92,96,129,180,0,129,132,0,133,47,0,128,203,0,1,46,39,
+132,238,0,136,21,0,135,218,0,128,30,0,133,21,0,0,124,129,216,0,129,184,0,129,
+25,1,130,39,1,130,63,0,129,1,0,134,62,1,128,222,0,134,68,0,132,251,0,3,
+106,96,118,43,128,175,0,131,25,1,129,178,0,132,30,0,131,117,0,1,44,39,128,74,
+0,128,45,1,134,64,0,133,173,0,128,9,1,0,95,135,61,1,145,0,0,129,22,0,
+1,95,44,128,189,0,0,106,134,34,0,130,137,0,0,76,132,7,1,130,84,0,129,11,
+1,134,74,1,145,0,0,0,96,130,176,0,131,66,0,129,57,0,2,32,32,70,132,46,
+0,137,13,1,136,16,1,128,71,0,1,46,45,132,71,1,134,0,0,132,66,1,132,67,
+0,130,29,0,137,73,2,131,215,1,132,112,0,134,116,2,0,92,128,124,0,138,219,0,
+1,95,47,132,6,2,129,53,0,128,174,0,129,28,0,130,84,1,133,69,0,0,44,130,
+60,1,132,197,1,0,39,135,189,2,133,215,1,132,0,0,129,46,0,0,96,131,163,0,
+1,96,46,128,70,1,129,72,0,128,71,0,134,70,0,140,82,1,132,102,1,132,74,0,
+128,82,2,141,221,0,130,183,1,132,84,0,130,219,2,132,126,2,129,143,2,1,34,32,
+128,97,1,133,4,1,140,79,3,136,101,0,142,83,0,130,179,0,138,113,2,133,20,0,
+0,95,140,70,0,0,47,135,70,0,133,105,2,139,152,1,136,67,0,129,102,1,130,67,
+1,0,92,130,68,0,129,76,3,128,158,0,0,46,128,178,0,0,43,128,106,3,130,248,
+3,140,113,0,134,69,0,130,28,0,1,46,95,133,146,0,130,45,2,128,25,1,131,52,
+1,131,130,0,134,126,0,147,74,2,135,24,0,133,177,0,128,86,2,129,68,0,128,193,
+0,134,218,2,128,18,0,130,7,4,150,214,2,130,44,1,129,195,0,131,212,1,131,142,
+0,2,47,10,92,130,230,0,0,95,129,207,1,128,57,0,132,59,0,0,95,131,177,2,
+1,32,124,130,188,0,138,149,0,128,61,0,130,15,0,128,48,0,131,247,4,128,16,1,
+128,26,4,131,21,3,0,32,128,8,0,129,10,1,128,16,0,1,46,95,128,212,1,134,
+245,0,141,73,2,133,15,0,128,1,2,141,220,1,134,0,0,130,111,4,132,181,4,128,
+0,0,0,58,135,65,0,130,43,5,134,55,3,149,0,0,130,93,2,128,65,0,2,32,
+96,62,131,71,0,0,96,131,141,0,158,56,0,133,63,0,0,124,134,21,3,0,96,128,
+122,3,128,49,5,164,56,0,130,28,1,0,96,129,28,2,130,133,0,0,34,150,225,0,
+146,245,0,2,39,32,10,0,32,132,0,0,9,44,45,34,34,39,45,46,46,95,10,128,
+12,0,16,46,45,45,45,39,34,34,32,34,62,96,32,45,32,96,45,45,129,20,0,1,
+96,46,131,41,0,3,96,45,46,95,128,34,0,128,6,0,129,21,0,130,15,0,132,67,
+0,0,92,128,21,0,2,32,58,32,133,24,0,3,32,95,46,62,129,42,0,128,0,0,
+15,47,32,96,32,96,58,46,46,44,10,32,44,46,46,46,47,128,3,0,6,46,95,96,
+34,45,46,47,129,29,0,6,39,46,124,44,32,96,10,128,103,0,129,128,0,129,134,0,
+131,99,0,2,32,32,124,129,4,0,128,16,0,134,82,0,129,140,0,1,46,92,128,138,
+0,4,96,46,95,44,39,133,188,0,128,13,0,128,59,0,137,0,0,132,200,0,134,0,
+0,1,34,45,129,68,0,1,95,95,131,142,0,131,173,0,1,96,39,128,128,0,128,19,
+0,135,69,0,128,33,0,138,53,0,136,95,0,3,34,96,45,92,131,10,0,0,32,128,
+183,0,128,55,0,128,16,0,0,46,134,62,0,1,96,34,134,160,0,143,58,0,134,58,
+1,1,124,96,128,181,0,130,193,0,129,106,0,0,46,129,255,0,3,95,96,46,92,135,
+220,0,143,0,0,129,115,0,128,42,0,2,46,46,39,129,50,0,130,106,1,130,27,1,
+133,9,0,0,92,128,91,0,151,61,0,130,43,0,128,160,0,0,96,130,57,0,131,53,
+1,130,146,0,133,64,0,130,3,0,152,63,0,133,68,0,1,46,96,128,246,0,130,65,
+0,132,203,0,130,9,0,132,248,1,0,92,157,64,0,131,109,1,128,27,2,0,96,137,
+14,1,130,5,0,131,67,0,159,131,0,132,74,1,2,96,45,39,129,54,0,129,21,1,
+131,123,0,136,74,0,162,134,0,130,44,0,131,65,0,129,68,0,131,210,1,134,69,0,
+0,44,128,142,1,164,69,0,130,210,0,129,63,0,131,191,0,130,16,0,0,39,132,33,
+2,0,46,129,1,0,148,73,2,148,73,0,133,213,0,132,145,0,129,225,2,129,48,2,
+168,67,0,1,32,39,128,71,3,139,68,0,130,7,0,0,76,169,67,0,132,52,0,130,
+88,3,128,172,1,129,154,3,130,220,0,165,91,1,134,99,1,129,53,0,130,133,0,133,
+69,0,131,62,2,172,70,0,130,52,0,0,44,131,40,2,136,4,0,0,95,174,71,0,
+129,104,2,128,197,0,132,253,2,134,176,1,1,34,96,175,72,0,135,223,0,131,70,0,
+176,139,0,137,89,3,1,32,96,128,4,0,0,58,153,2,4,162,0,0,128,27,4,1,
+46,32,128,207,4,0,39,188,71,0,130,203,4,128,149,0,0,10,20,32,32,32,44,46,
+46,95,95,10,32,32,124,32,32,95,32,32,96,45,45,46,128,6,0,157,0,0,8,95,
+46,45,45,34,34,34,96,46,131,56,0,1,32,124,131,52,0,2,96,45,46,134,33,0,
+134,0,0,137,52,0,0,39,129,7,0,4,44,124,39,32,124,133,56,0,128,52,0,131,
+51,0,128,59,0,130,84,0,0,95,134,66,0,2,96,34,34,128,19,0,0,44,131,52,
+0,128,54,0,128,53,0,128,48,0,128,56,0,0,76,131,56,0,134,58,0,129,28,0,
+133,37,0,142,169,0,128,54,0,130,45,0,129,56,0,0,32,128,47,0,130,56,0,129,
+76,0,136,6,0,132,0,0,134,77,0,128,0,0,0,39,131,12,0,133,56,0,129,7,
+0,136,47,0,0,47,140,101,0,0,92,137,12,0,130,149,0,136,56,0,0,46,134,54,
+0,139,110,0,132,95,0,139,71,0,128,89,0,0,106,129,55,0,0,96,128,3,0,0,
+34,133,220,0,143,214,0,141,72,0,129,46,0,0,47,129,55,0,1,32,96,135,45,0,
+140,92,0,145,127,0,128,73,0,0,43,130,54,0,136,209,0,139,54,0,131,64,1,143,
+0,0,0,96,129,54,0,131,53,0,0,46,129,11,2,0,39,129,149,1,136,141,1,128,
+18,1,128,6,0,128,24,0,0,34,136,21,2,132,55,0,0,106,132,140,0,2,44,46,
+43,128,111,2,134,60,1,130,104,0,0,39,130,23,0,2,44,45,34,129,137,2,135,224,
+1,128,27,1,132,50,2,2,47,32,46,128,40,0,130,109,0,135,30,0,2,95,46,39,
+131,23,0,132,188,0,0,92,137,146,1,128,165,2,129,113,0,0,124,128,1,0,128,223,
+2,131,206,0,1,124,96,128,122,0,128,0,0,128,13,0,4,46,32,106,96,46,135,230,
+0,0,76,136,0,1,128,194,1,129,12,0,0,76,137,26,2,129,70,0,143,10,0,141,
+14,0,132,57,0,0,96,136,136,0,0,47,131,247,0,164,57,0,129,195,0,129,19,3,
+3,95,44,46,45,138,111,2,0,46,130,236,1,132,11,0,128,180,0,135,158,1,128,57,
+0,0,108,132,100,1,129,56,0,129,57,0,139,187,1,1,96,46,129,24,0,128,0,0,
+128,23,0,128,49,1,136,4,2,0,10,142,81,2,142,239,1,132,57,0,139,82,0,129,
+171,2,137,221,1,132,0,0,131,43,0,153,78,0,130,28,3,136,50,2,135,102,0,140,
+97,0,142,175,2,130,174,2,138,112,3,162,0,0,131,29,3,128,59,1,166,58,0,129,
+72,3,0,44,131,110,0,130,58,1,130,207,0,142,83,3,135,221,1,135,98,3,129,22,
+5,134,172,1,128,193,1,150,4,1,136,50,0,133,104,0,138,214,2,145,135,1,0,46,
+131,71,5,128,92,3,130,49,0,0,95,128,42,3,130,100,3,150,101,0,133,198,3,129,
+77,5,129,233,5,137,208,3,130,40,2,147,253,0,135,134,1,129,230,5,139,241,4,129,
+45,3,0,96,130,79,0,132,223,5,128,107,2,129,189,5,139,185,0,128,55,0,135,46,
+1,142,141,2,128,222,5,0,34,135,16,0,128,136,0,136,135,0,1,92,10,131,110,2,
+157,12,2,143,197,0,130,87,2,172,0,0,129,244,6,0,46,128,14,3,0,10,3,44,
+45,46,32,173,0,0,5,46,10,46,96,32,96,171,55,0,3,46,39,124,10,130,52,0,
+3,96,45,46,95,146,33,0,3,95,44,46,45,140,27,0,6,47,32,32,124,10,32,96,
+128,61,0,129,108,0,145,113,0,128,33,0,130,0,0,135,27,0,6,44,39,32,44,32,
+39,10,128,18,0,129,2,0,129,23,0,143,113,0,3,124,32,39,34,131,48,0,0,92,
+134,70,0,0,47,128,214,0,131,72,0,128,56,0,131,79,0,137,112,0,6,44,34,39,
+45,45,45,39,132,204,0,132,103,0,1,39,39,129,159,0,130,127,0,132,44,0,130,111,
+0,133,54,0,139,175,0,0,124,132,102,0,128,4,0,0,70,131,52,0,129,41,0,131,
+35,0,129,50,0,3,92,32,44,46,128,1,1,128,38,0,137,52,0,128,102,0,131,51,
+0,0,47,132,51,0,129,40,0,132,97,0,128,5,0,132,45,0,132,198,0,131,169,0,
+129,28,0,140,50,0,128,49,0,0,95,128,2,0,128,8,0,0,106,129,55,0,128,201,
+0,1,45,46,131,15,0,129,119,1,0,96,128,70,0,1,44,34,128,49,0,0,44,129,
+55,1,135,0,0,129,52,0,0,34,128,13,1,3,44,39,44,34,128,0,0,129,50,0,
+128,5,0,128,4,1,8,44,45,34,58,43,46,45,39,46,139,47,0,129,171,0,130,150,
+0,0,124,128,57,0,0,41,130,9,0,0,76,131,197,0,5,124,95,55,92,43,45,138,
+45,0,133,185,1,0,124,133,195,0,134,9,0,0,46,129,205,0,0,92,130,141,1,140,
+43,0,129,32,0,132,84,1,134,54,0,5,92,92,95,44,39,106,135,44,0,136,116,1,
+128,224,0,0,96,129,234,0,0,39,135,64,0,128,15,0,0,34,130,29,2,131,0,0,
+129,13,1,135,0,0,128,219,0,129,129,1,132,228,1,134,115,0,133,45,0,0,44,139,
+154,1,137,248,0,0,45,132,78,2,134,45,0,128,10,1,149,45,0,129,139,0,133,27,
+0,131,137,0,129,17,0,140,116,0,136,131,1,0,46,130,26,0,130,91,1,0,92,129,
+46,0,129,45,0,139,183,0,150,22,3,0,76,128,47,0,130,42,0,150,185,0,139,51,
+1,129,188,0,128,42,0,0,95,131,114,0,151,0,0,131,78,0,0,44,130,47,0,0,
+96,128,47,1,157,10,4,129,47,0,129,192,0,133,120,1,156,142,0,128,244,0,132,132,
+1,133,4,2,157,48,0,142,172,1,166,48,0,133,57,2,156,241,0,136,251,4,133,163,
+0,162,46,0,135,130,3,161,47,5,132,45,0,0,95,130,0,0,156,47,0,131,171,3,
+132,114,3,145,228,4,135,86,5,2,39,34,34,128,247,2,0,46,129,186,0,135,84,0,
+128,97,0,2,44,43,32,128,21,0,1,46,46,131,111,0,129,16,0,128,12,0,0,60,
+136,70,0,130,111,2,129,30,0,128,154,5,0,34,152,33,1,135,124,0,134,44,3,160,
+0,0,128,53,0,128,0,0,2,39,32,10,0,32,164,0,0,7,96,34,45,45,46,46,
+95,10,165,47,0,8,32,39,32,32,44,95,95,96,45,169,51,0,3,32,96,32,124,129,
+5,0,2,45,46,96,170,54,0,2,32,124,96,133,64,0,3,46,95,96,46,162,57,0,
+3,46,47,34,92,129,57,0,128,50,0,134,125,0,128,118,0,160,59,0,2,46,39,47,
+129,5,0,129,59,0,0,95,146,61,0,0,47,129,196,0,148,0,0,0,47,128,1,0,
+130,118,0,1,32,124,128,122,0,129,232,0,135,252,0,0,46,131,63,0,0,47,130,4,
+1,148,123,0,131,62,0,132,63,0,132,117,0,136,65,0,0,96,129,65,0,128,34,0,
+128,125,1,131,0,0,4,95,46,44,46,95,128,0,0,132,13,0,3,44,46,39,46,131,
+11,0,128,33,0,0,106,135,54,0,136,130,1,130,133,0,2,106,32,44,128,155,0,134,
+116,0,0,34,129,253,1,129,204,1,7,32,44,39,44,46,45,43,43,129,117,0,0,44,
+128,66,0,0,47,131,142,0,132,56,0,141,69,0,0,47,129,101,0,0,92,133,70,0,
+129,110,1,130,26,0,3,32,39,46,39,128,188,0,0,39,133,28,0,136,68,0,129,31,
+0,136,208,0,128,44,0,0,10,128,139,0,130,31,0,0,92,133,23,0,132,71,0,130,
+64,1,133,231,0,1,124,92,140,69,0,134,143,0,0,95,128,243,0,128,0,0,129,72,
+0,0,124,132,64,0,134,51,1,132,6,0,131,73,1,130,0,0,2,91,124,39,141,71,
+0,129,113,0,3,92,95,44,34,134,87,0,128,72,0,133,48,0,1,124,44,129,169,2,
+130,21,0,0,45,128,0,0,2,46,96,95,130,84,2,2,95,46,45,128,46,0,134,198,
+0,128,126,1,129,130,0,129,0,0,3,92,124,10,106,133,118,1,133,1,2,128,89,1,
+130,0,0,2,32,96,47,128,69,0,0,39,133,104,0,132,72,0,1,39,10,133,182,0,
+134,168,0,128,37,0,128,138,3,2,95,95,34,134,147,0,132,167,1,0,44,128,44,0,
+134,203,0,136,213,0,129,0,0,1,34,34,139,15,0,0,89,151,42,0,135,98,1,131,
+178,2,149,41,0,130,213,0,0,92,135,173,1,1,44,92,136,41,0,129,225,1,132,22,
+0,0,45,133,165,1,0,96,130,139,2,128,64,2,2,46,32,46,136,42,0,1,32,76,
+132,40,0,134,181,2,130,10,4,132,234,2,0,96,139,43,0,0,39,130,78,2,140,163,
+1,134,31,0,140,44,0,2,32,92,124,139,85,0,139,195,0,129,47,3,135,13,0,128,
+154,0,0,124,143,251,1,135,199,0,128,96,1,128,69,2,131,47,0,0,95,132,212,0,
+144,169,3,132,204,0,138,142,0,142,131,0,147,143,0,132,49,0,128,3,0,143,135,0,
+150,49,0,130,50,0,2,32,96,86,156,33,5,139,169,0,130,51,0,158,85,5,140,221,
+0,0,96,130,93,4,171,51,0,179,52,0,2,32,96,92,177,53,0,128,15,4,161,54,
+0,195,35,0,0,33,160,35,0,3,95,47,32,10,0,32,151,0,0,8,45,45,45,46,
+46,95,95,10,95,129,0,0,151,38,0,3,96,46,95,34,128,3,0,0,10,130,9,0,
+5,96,34,45,45,95,46,148,45,0,1,96,46,130,35,0,130,43,0,131,56,0,129,5,
+0,0,45,129,17,0,148,45,0,128,4,0,131,90,0,136,18,0,132,50,0,148,48,0,
+140,49,0,134,51,0,129,53,0,131,112,0,145,51,0,0,45,128,52,0,136,51,0,136,
+53,0,146,54,0,0,92,133,36,0,140,53,0,134,25,0,133,29,0,147,28,0,143,110,
+0,139,57,0,129,59,0,139,58,0,135,28,0,144,115,0,140,59,0,141,60,0,139,146,
+0,142,59,0,140,60,0,1,95,58,138,181,0,0,124,139,87,0,143,61,0,1,32,76,
+133,56,0,6,44,45,34,34,32,106,106,137,27,0,131,61,0,128,61,2,0,46,130,0,
+0,0,58,144,62,0,131,34,0,1,44,39,132,13,0,137,111,0,129,27,0,2,44,46,
+34,133,13,0,1,46,39,148,62,0,133,60,0,142,62,0,0,34,134,24,0,128,0,0,
+2,47,32,92,147,63,0,0,47,135,34,0,0,124,133,204,0,1,44,34,129,4,1,0,
+93,136,10,1,129,37,0,0,76,145,64,0,135,125,0,3,32,46,32,96,133,77,1,128,
+46,0,0,34,128,14,1,0,32,128,25,3,131,16,0,130,23,1,0,124,144,64,0,0,
+47,136,92,2,128,141,0,1,96,46,130,65,0,0,40,128,5,0,2,60,46,41,130,207,
+0,131,82,0,130,10,0,145,64,0,130,79,2,137,77,1,0,92,129,115,0,0,124,130,
+181,3,132,9,2,129,65,0,131,152,1,147,64,0,129,67,0,0,44,136,142,1,129,100,
+2,0,92,130,10,0,0,86,130,59,0,1,46,39,128,5,0,131,26,0,150,64,0,132,
+167,0,133,129,1,128,52,3,133,10,0,2,124,32,60,128,15,0,132,128,0,0,106,151,
+63,0,130,116,3,136,193,1,133,58,1,128,18,0,134,126,0,153,127,0,130,130,0,137,
+1,2,133,206,1,128,6,0,0,76,129,16,1,159,63,0,0,32,131,245,0,140,78,2,
+128,6,0,128,2,0,1,95,95,128,144,0,153,190,0,129,0,0,0,89,138,62,0,0,
+46,130,152,1,130,62,0,129,74,0,128,157,0,156,62,0,3,32,92,44,45,128,70,3,
+128,0,0,128,211,1,0,124,128,111,0,131,248,0,1,124,47,130,137,0,144,188,3,140,
+0,0,136,240,2,130,53,1,1,96,46,130,17,0,157,181,0,137,0,0,0,40,130,174,
+0,0,44,130,188,4,0,47,164,55,0,3,95,46,45,34,128,29,1,128,241,1,3,124,
+32,96,39,158,54,0,0,44,131,14,4,0,47,128,185,3,0,34,129,40,2,2,95,46,
+39,128,61,4,145,222,3,139,229,2,129,0,0,128,98,6,133,222,4,1,34,34,164,158,
+0,4,96,46,74,32,10,0,32,151,0,0,8,46,45,34,45,45,46,95,95,10,135,18,
+0,0,95,141,35,0,7,47,32,39,43,46,45,45,39,136,35,0,2,32,92,46,128,53,
+0,135,14,0,0,106,128,36,0,0,124,137,31,0,5,32,92,96,45,46,96,133,34,0,
+0,46,128,32,0,140,31,0,5,32,92,32,32,96,46,129,2,0,128,0,0,0,124,128,
+1,0,1,32,76,149,163,0,6,95,44,44,45,45,43,61,138,127,0,128,0,0,129,47,
+0,129,65,0,1,45,46,131,63,0,129,81,0,142,58,0,3,46,45,43,39,130,195,0,
+140,60,0,129,47,0,131,49,0,129,153,0,133,11,0,136,114,0,4,45,39,34,32,46,
+130,58,0,0,44,141,120,0,130,178,0,130,48,0,128,56,0,135,72,0,131,0,0,0,
+44,129,51,0,0,95,130,5,0,143,57,0,133,39,0,0,96,128,116,0,132,57,0,133,
+18,0,130,107,0,131,54,0,143,173,0,130,232,0,133,182,0,132,55,0,130,56,0,130,
+48,0,133,53,0,144,54,0,132,94,0,137,54,0,128,17,0,0,47,131,213,1,136,53,
+0,129,239,0,1,39,34,128,0,0,128,4,0,128,2,0,0,96,128,19,2,129,24,1,
+136,53,0,1,32,86,136,52,0,3,95,44,43,46,137,0,0,4,95,10,45,61,96,128,
+7,0,0,45,129,0,0,129,15,0,131,247,1,0,96,130,61,0,135,66,0,129,195,0,
+129,65,0,128,149,1,133,178,0,128,74,0,128,53,0,6,34,34,44,46,46,61,46,132,
+190,0,129,209,1,133,245,0,129,72,0,140,69,0,1,32,76,129,240,0,134,244,0,129,
+64,0,131,109,1,137,161,2,132,47,1,131,9,0,141,64,0,128,10,0,131,218,1,137,
+137,0,140,172,1,134,63,0,0,92,130,56,0,134,175,0,128,126,0,130,4,1,129,49,
+1,136,34,3,139,121,1,134,248,2,131,134,0,134,217,2,130,252,0,134,185,0,145,118,
+0,132,255,0,130,62,0,129,186,1,0,96,135,86,2,139,55,0,145,56,0,132,60,0,
+128,19,3,134,87,2,0,47,138,166,0,130,239,0,146,54,0,129,79,0,0,34,129,58,
+0,131,164,1,128,84,1,129,204,1,2,34,96,43,130,21,2,147,50,0,134,65,2,139,
+31,1,128,244,0,146,47,0,130,79,2,148,133,4,145,48,0,134,129,1,144,0,0,140,
+75,4,135,211,3,128,150,4,133,207,0,138,63,0,150,48,0,0,32,134,31,1,0,96,
+132,19,2,152,48,0,133,141,1,145,0,0,148,142,1,132,133,0,128,77,1,139,207,0,
+148,190,1,133,49,0,128,65,2,136,176,2,138,218,2,139,206,1,129,146,0,128,172,1,
+0,95,130,0,0,128,191,1,128,61,0,128,2,2,144,45,0,134,62,2,139,8,3,148,
+176,1,136,108,2,136,21,1,134,58,0,143,49,0,135,12,2,139,167,2,135,245,0,142,
+50,0,131,161,2,139,72,3,139,62,3,143,132,1,128,153,4,142,46,0,136,249,2,0,
+46,128,195,1,0,10,0,32,152,0,0,10,44,46,45,45,34,34,43,96,45,44,10,145,
+30,0,10,95,95,95,44,46,46,45,39,32,32,67,128,3,0,6,96,46,39,32,96,45,
+46,143,41,0,2,46,34,124,131,8,0,128,71,0,0,46,128,0,0,0,95,131,58,0,
+0,58,143,42,0,1,47,39,130,42,0,129,85,0,0,94,128,39,0,4,95,32,95,39,
+34,128,89,0,130,58,0,142,45,0,128,109,0,6,34,32,44,45,96,99,46,129,99,0,
+128,4,0,0,96,129,8,0,128,180,0,1,34,34,130,12,0,140,47,0,1,47,44,128,
+26,0,131,76,0,129,29,0,0,95,129,10,0,5,96,46,124,41,32,32,131,98,0,1,
+47,92,137,178,0,136,60,0,128,141,0,4,124,39,45,32,47,128,21,0,0,45,131,97,
+0,133,0,0,135,49,0,0,96,129,114,0,133,0,0,1,124,92,132,61,0,0,95,130,
+27,1,0,32,128,210,0,129,213,0,128,67,0,133,81,0,131,38,0,136,73,0,136,11,
+0,1,124,32,131,62,0,134,171,0,132,62,0,135,117,0,128,103,1,153,62,0,131,188,
+0,128,237,0,134,204,0,139,63,0,143,51,0,1,32,106,138,10,0,0,124,128,63,0,
+0,47,129,187,0,2,34,34,34,128,127,1,2,58,46,43,156,63,0,128,26,1,133,48,
+2,130,239,0,0,10,128,200,1,133,16,0,130,1,1,136,41,1,142,51,0,3,95,44,
+39,45,129,235,1,129,244,1,131,53,0,2,106,10,106,133,92,0,134,37,0,132,219,1,
+134,103,0,128,30,2,130,0,0,1,45,43,143,89,0,1,10,124,132,62,0,131,61,0,
+3,95,44,45,46,128,200,0,131,100,0,131,176,2,0,45,130,131,2,140,195,1,134,61,
+0,130,19,0,0,44,130,67,0,128,207,0,130,148,0,131,140,1,135,131,0,134,142,0,
+0,92,128,164,2,134,148,0,2,45,39,10,128,35,0,3,96,45,39,46,129,60,0,128,
+125,0,128,2,0,0,95,132,212,0,138,194,0,133,116,0,129,44,0,2,45,45,43,128,
+145,0,129,115,1,128,148,2,0,44,128,213,2,129,140,1,3,106,32,39,34,137,149,0,
+128,38,0,129,225,2,135,69,0,0,124,134,13,0,129,57,0,132,77,0,129,117,0,145,
+170,1,135,8,2,129,32,0,133,33,0,0,96,135,57,0,0,96,130,182,1,0,44,128,
+139,0,128,102,0,130,162,3,0,95,133,168,3,133,107,3,137,57,0,136,115,0,131,14,
+0,128,185,0,2,61,45,61,129,0,0,128,97,1,0,39,128,94,1,129,175,3,135,38,
+2,0,47,135,149,0,128,33,1,137,88,3,0,76,130,59,3,1,34,34,129,121,0,1,
+45,45,129,187,2,128,6,0,132,48,1,128,13,0,4,47,96,45,43,95,131,49,0,3,
+44,39,34,96,130,207,1,138,176,1,139,27,3,2,124,46,39,130,117,0,128,81,0,128,
+131,0,131,55,0,129,30,0,128,164,1,3,44,46,39,96,138,55,0,136,242,2,130,139,
+0,0,43,133,19,2,132,219,0,130,86,0,131,50,0,128,221,0,135,55,0,139,95,1,
+131,101,3,129,196,1,0,34,132,216,0,131,128,0,128,60,1,129,249,2,0,43,133,57,
+0,0,96,138,54,0,0,47,133,4,1,134,18,2,128,107,3,131,228,4,131,164,2,133,
+168,2,129,68,1,1,96,46,128,9,0,135,53,1,131,254,0,151,229,1,133,31,2,136,
+103,1,130,191,0,152,23,2,131,254,4,139,210,1,130,17,2,145,242,5,128,18,6,145,
+47,0,147,62,6,133,202,1,162,46,0,134,12,1,128,17,4,160,92,0,128,162,0,129,
+51,2,2,39,32,10,0,32,148,0,0,3,95,46,46,45,132,0,0,4,46,46,95,95,
+10,145,35,0,3,44,45,34,39,130,43,0,0,95,134,18,0,2,96,45,46,143,42,0,
+1,44,45,130,38,0,0,46,130,46,0,0,124,130,9,0,1,45,46,130,45,0,0,46,
+128,59,0,143,92,0,0,44,128,38,0,128,127,0,129,32,0,1,34,34,131,98,0,0,
+96,129,66,0,3,95,46,45,39,132,14,0,0,34,128,65,0,140,55,0,0,46,129,25,
+0,1,96,46,129,6,0,135,143,0,128,11,0,128,77,0,4,44,34,34,96,44,134,16,
+0,1,95,96,134,58,0,128,81,0,0,45,128,98,0,129,78,0,129,230,0,4,32,32,
+39,46,34,130,34,0,128,126,0,1,44,39,130,215,0,0,96,131,113,0,132,174,0,130,
+2,0,130,60,0,0,46,131,30,0,131,216,0,129,92,0,3,96,39,45,43,129,78,0,
+134,53,1,128,11,1,129,22,0,1,61,96,133,62,0,130,73,0,0,92,128,61,0,3,
+44,39,40,95,129,151,0,131,169,0,129,113,0,129,0,0,1,124,40,129,41,1,128,240,
+0,128,2,0,128,59,0,1,96,44,128,42,1,129,160,0,129,162,0,2,39,34,96,129,
+82,0,4,46,47,10,32,47,134,218,0,2,124,95,41,135,231,0,0,124,129,123,1,129,
+170,1,129,0,0,0,44,128,5,1,0,124,131,117,1,134,61,1,133,158,1,0,106,147,
+240,1,128,207,0,0,44,128,63,0,132,0,0,132,158,0,2,32,32,99,130,168,1,133,
+231,0,130,208,0,1,46,10,129,195,1,132,92,1,129,166,1,2,96,43,39,129,9,0,
+128,187,0,134,41,0,130,109,1,128,109,0,137,137,1,129,0,0,2,92,95,95,131,192,
+1,134,67,0,0,96,129,174,0,129,19,0,130,4,0,3,46,58,34,39,131,169,1,131,
+76,0,130,90,1,131,72,1,129,71,2,132,8,0,132,224,1,3,124,10,32,92,142,56,
+2,130,0,0,0,34,134,137,0,131,99,0,134,191,1,129,76,0,131,12,1,128,43,0,
+130,130,0,128,68,0,131,24,0,135,66,0,0,46,128,129,1,136,18,0,2,32,58,34,
+133,60,2,130,242,1,136,115,0,131,110,2,128,172,0,130,18,2,128,87,2,131,253,0,
+131,252,0,132,104,0,133,0,0,134,230,1,131,111,0,139,185,0,129,120,0,133,206,2,
+129,141,2,0,43,145,146,3,136,76,1,132,149,2,136,164,0,129,232,2,137,16,3,134,
+163,1,134,0,0,0,40,128,50,0,136,48,2,132,38,0,128,236,1,0,44,129,248,1,
+128,189,1,138,79,3,137,0,1,133,193,0,138,207,0,139,180,0,135,255,3,128,59,2,
+149,84,4,142,164,0,135,55,0,0,43,129,50,3,0,61,128,225,1,132,0,0,129,74,
+3,128,5,0,0,34,143,46,0,0,44,128,11,3,131,3,3,136,228,1,129,10,0,2,
+44,45,46,129,92,3,140,112,2,134,4,0,136,56,2,128,0,0,128,65,0,2,124,32,
+43,142,172,4,0,46,139,246,0,0,39,133,108,3,129,7,0,0,124,128,1,0,140,96,
+0,130,112,2,0,65,129,40,0,140,71,0,130,55,0,0,106,131,235,1,138,50,0,130,
+40,0,0,47,130,145,0,139,1,2,130,150,3,2,47,32,47,130,128,0,140,102,0,132,
+179,2,142,52,0,129,227,1,0,106,130,131,0,0,96,128,174,4,146,88,1,129,35,2,
+0,124,129,24,4,131,0,0,1,44,46,130,127,5,148,42,0,128,195,4,138,13,0,129,
+70,4,0,10,0,32,135,0,0,0,95,128,0,0,136,14,0,145,0,0,129,34,0,0,
+10,131,10,0,4,44,45,34,124,34,129,8,0,3,34,34,44,46,146,55,0,13,95,44,
+45,45,34,39,32,124,32,32,96,96,45,46,131,54,0,0,47,128,3,0,1,92,46,130,
+28,0,0,39,128,5,0,128,23,0,140,52,0,129,22,0,0,92,132,7,0,130,100,0,
+131,56,0,129,55,0,129,47,0,128,79,0,132,0,0,128,86,0,137,0,0,131,32,0,
+1,92,46,132,31,0,129,29,0,0,76,129,57,0,0,47,131,154,0,2,46,45,46,130,
+105,0,3,44,39,34,34,139,57,0,129,13,0,1,95,44,131,28,0,0,45,128,142,0,
+4,96,46,95,95,124,128,57,0,0,106,131,135,0,130,87,0,128,35,0,133,7,0,132,
+4,1,129,85,0,0,96,130,36,0,129,37,0,130,23,0,129,45,0,131,116,0,128,14,
+0,129,17,0,128,31,0,128,15,0,133,70,0,1,95,46,132,121,0,2,46,34,39,128,
+103,0,0,95,130,11,0,129,27,1,128,111,0,131,188,0,129,117,0,128,16,0,130,193,
+0,128,24,1,130,20,0,3,96,46,43,45,131,16,0,1,46,46,131,8,0,129,40,0,
+129,53,1,134,197,0,3,44,34,96,46,129,58,0,0,96,134,31,0,134,72,1,0,41,
+130,173,0,2,44,46,46,128,99,0,132,22,0,0,96,129,90,0,132,12,0,129,97,0,
+0,124,129,58,0,1,32,96,128,250,0,133,138,1,129,56,0,1,46,39,128,188,1,134,
+78,0,129,190,1,130,240,0,128,6,0,0,95,128,124,0,3,46,46,47,95,128,4,0,
+0,39,130,153,1,128,20,0,7,46,44,92,46,45,45,39,47,128,162,0,0,96,129,128,
+1,128,7,0,131,0,0,129,120,0,128,85,1,128,241,0,132,232,1,0,96,132,6,2,
+136,186,0,129,153,0,130,53,0,128,6,0,128,5,0,129,197,0,1,46,40,128,12,0,
+0,41,129,48,0,131,83,1,0,46,130,153,1,133,120,2,130,55,0,0,124,128,56,0,
+128,221,0,1,96,46,129,7,1,132,206,0,129,196,1,2,124,96,45,129,191,0,131,23,
+0,129,222,0,131,196,0,136,119,0,128,137,1,128,26,0,130,141,0,0,124,128,1,0,
+133,53,1,129,6,0,132,23,0,128,64,0,0,124,128,120,2,0,34,128,204,0,130,17,
+2,137,62,0,2,47,34,34,129,92,0,128,136,2,129,48,0,130,58,0,135,53,3,128,
+24,0,130,160,2,133,132,2,130,77,0,0,73,129,65,0,133,64,0,131,213,2,132,52,
+1,129,208,1,128,101,1,129,68,3,134,7,3,128,87,0,128,17,0,132,237,2,132,0,
+1,0,92,131,113,0,137,7,3,135,255,2,136,16,0,0,34,135,76,3,135,21,0,130,
+149,0,130,153,0,2,46,32,92,130,16,3,136,250,2,132,5,1,128,26,0,129,196,0,
+0,44,129,183,0,133,86,2,129,217,2,136,133,0,129,203,2,129,65,0,0,32,129,200,
+0,137,27,0,130,61,0,0,40,128,141,1,129,170,0,0,46,129,203,0,2,95,44,123,
+135,72,2,136,0,0,0,76,130,137,0,128,19,1,0,92,132,232,2,135,67,0,128,41,
+0,130,1,1,0,96,129,238,0,0,34,130,121,2,0,124,129,182,2,1,45,39,140,229,
+3,130,214,3,131,37,3,141,67,0,135,88,1,129,152,1,129,245,2,133,192,2,144,67,
+0,128,133,0,128,132,0,0,47,138,25,0,128,87,0,133,131,1,0,34,135,102,4,141,
+10,1,133,64,0,128,59,2,1,10,106,139,90,0,140,103,0,150,24,0,131,79,0,129,
+64,0,129,128,2,146,130,0,155,64,0,131,230,1,2,39,32,106,128,64,0,0,91,153,
+40,0,148,23,0,133,2,2,128,67,1,0,45,131,148,1,170,63,0,0,47,131,247,3,
+131,42,3,1,34,34,128,113,3,150,248,0,128,8,4,133,123,4,131,53,0,134,235,3,
+133,219,3,144,0,0,133,123,1,128,126,3,131,98,4,134,110,0,150,53,0,133,106,2,
+129,181,4,136,97,4,132,52,0,138,226,0,137,48,0,140,46,0,131,62,2,128,174,0,
+140,100,0,0,60,128,29,3,128,140,2,2,34,32,10,0,32,163,0,0,0,95,131,0,
+0,0,10,161,42,0,3,44,34,34,124,131,10,0,2,96,45,46,160,50,0,1,44,34,
+128,52,0,1,46,39,135,16,0,1,96,46,158,52,0,3,44,39,34,34,136,49,0,163,
+54,0,0,44,133,49,0,2,44,46,45,128,0,0,3,46,95,32,32,128,8,0,2,46,
+32,92,155,55,0,0,47,134,96,0,129,2,1,129,8,0,0,92,128,2,0,2,95,32,
+41,155,56,0,134,109,0,132,0,0,3,34,34,96,45,130,18,0,128,238,0,1,32,76,
+151,57,0,141,55,0,140,0,0,0,124,149,57,0,1,44,39,137,67,1,145,0,0,148,
+116,0,1,44,39,131,151,0,2,95,44,46,128,0,0,130,224,0,134,0,0,0,46,128,
+181,0,0,46,148,117,0,0,95,132,169,0,0,44,131,62,0,130,129,1,134,96,1,132,
+13,0,128,3,0,0,39,140,58,0,1,95,46,133,47,0,132,175,0,131,90,2,133,101,
+1,2,96,95,41,131,74,0,1,95,59,128,101,1,137,59,0,135,103,0,131,91,2,0,
+34,128,3,2,153,238,0,136,60,0,130,169,0,130,245,1,0,44,164,240,2,136,61,0,
+129,153,0,130,170,0,0,95,146,60,0,128,238,2,128,217,1,136,55,1,0,46,129,14,
+0,135,245,0,0,55,128,168,0,2,45,43,45,132,188,0,132,65,2,138,200,0,0,46,
+129,19,0,134,59,1,130,8,0,0,96,132,62,0,133,12,2,0,92,130,35,1,130,133,
+0,0,96,129,179,2,128,250,0,134,48,0,131,67,0,135,27,1,128,12,0,0,46,132,
+189,0,134,186,2,128,53,0,128,81,1,131,150,3,0,124,128,1,0,131,8,0,0,96,
+128,73,0,1,46,46,130,23,1,136,76,0,136,76,3,133,126,0,2,46,32,96,129,55,
+0,131,250,2,129,137,1,131,65,0,128,114,2,0,46,137,253,1,0,44,139,219,0,129,
+132,0,131,129,0,133,167,1,0,124,128,108,0,1,46,95,128,184,1,130,200,0,128,124,
+0,128,7,0,139,181,2,3,92,32,96,34,128,23,0,132,72,0,1,95,95,128,67,0,
+135,196,0,132,190,0,0,39,128,32,0,1,34,34,128,36,0,132,0,0,0,46,141,33,
+0,2,46,46,45,128,31,0,2,32,96,43,128,213,0,0,40,128,166,0,1,10,106,141,
+68,3,1,32,76,128,164,1,128,120,1,130,241,2,129,126,1,140,66,0,1,32,124,129,
+26,0,128,163,0,128,23,0,128,242,0,129,207,1,132,52,1,134,65,0,134,70,1,130,
+72,0,128,227,0,141,66,0,1,32,106,128,154,0,0,46,128,56,1,131,8,3,0,45,
+138,66,0,128,44,0,2,106,32,39,133,66,0,131,36,1,134,199,0,0,44,131,19,1,
+2,34,32,47,128,64,0,128,62,2,129,116,1,0,92,130,68,0,136,66,0,1,47,39,
+128,68,0,0,47,134,133,0,140,171,4,128,91,0,130,116,1,128,37,0,133,88,1,128,
+3,0,131,137,0,2,10,32,76,134,46,0,1,124,86,128,135,0,139,68,0,141,199,0,
+137,144,4,130,69,0,130,5,0,129,70,0,132,53,0,128,93,1,128,9,0,130,68,0,
+133,88,0,130,20,0,151,213,4,130,98,0,0,124,130,71,0,129,89,4,131,53,0,130,
+67,0,128,2,0,129,164,0,130,102,2,132,20,0,150,26,5,130,98,0,129,74,0,128,
+45,0,129,70,0,130,195,2,129,20,0,128,65,0,129,82,0,128,241,2,132,36,3,136,
+140,0,133,181,4,135,0,0,129,15,0,131,19,0,0,46,131,231,4,130,150,0,132,210,
+2,131,136,0,1,96,34,128,198,1,135,140,0,138,173,6,136,210,0,132,57,1,128,9,
+1,130,126,3,129,150,0,133,27,3,140,41,0,128,107,5,138,205,4,144,69,0,128,180,
+0,132,208,6,0,92,139,5,1,132,41,0,129,24,2,147,127,7,129,89,0,134,229,0,
+1,47,44,133,138,4,156,29,6,139,19,1,129,32,7,128,95,0,0,10,0,32,167,0,
+0,2,95,46,45,128,0,0,1,46,10,165,46,0,2,95,44,39,129,6,0,2,44,45,
+39,160,50,0,3,95,46,46,34,128,3,0,128,96,0,0,34,158,46,0,2,95,46,39,
+129,85,0,0,95,137,0,0,1,44,46,130,0,0,146,58,0,3,96,46,32,46,128,6,
+0,2,46,95,44,128,194,0,2,39,44,45,128,3,0,1,46,45,131,47,0,130,0,0,
+131,173,0,0,59,143,59,0,1,95,95,128,60,0,7,47,32,41,44,96,39,44,39,128,
+117,0,1,46,46,129,60,0,128,107,0,128,166,0,0,59,132,91,0,2,34,34,34,140,
+56,0,1,96,46,128,140,0,1,96,34,128,252,0,0,44,128,50,0,0,45,130,115,0,
+128,217,0,1,39,34,128,27,0,141,12,1,129,183,0,135,109,0,1,95,45,129,49,1,
+133,0,0,0,44,136,42,0,128,55,0,129,6,0,0,124,132,24,0,129,101,0,0,45,
+134,56,0,1,32,39,130,152,1,134,252,0,130,31,0,133,46,0,134,12,0,1,32,92,
+138,165,0,0,92,133,46,0,0,47,135,70,0,137,12,0,2,32,32,76,138,212,0,0,
+45,131,46,0,131,129,0,132,87,0,0,106,137,33,0,135,25,0,132,5,1,136,48,0,
+2,95,44,43,130,162,0,134,35,0,137,48,0,0,46,129,160,1,129,7,0,133,91,2,
+129,24,0,0,47,130,173,0,128,29,1,0,92,137,134,0,137,216,0,129,51,0,1,124,
+96,128,85,0,132,52,0,5,96,45,124,32,44,92,128,68,1,128,28,0,0,124,128,222,
+0,133,51,0,134,210,0,129,52,0,128,3,0,128,188,1,137,133,0,2,46,44,124,135,
+117,0,0,86,132,49,0,129,194,0,0,39,131,34,2,130,182,1,138,64,0,132,174,0,
+133,237,0,128,217,1,0,96,132,169,1,0,124,133,98,1,0,96,138,200,1,138,27,2,
+0,95,131,30,1,1,95,92,131,50,0,0,39,138,18,1,154,0,0,1,96,32,128,142,
+2,129,37,1,128,35,3,0,46,129,245,0,130,60,2,165,63,0,2,44,46,47,128,152,
+2,129,12,1,129,177,0,2,10,46,39,131,64,1,131,141,0,149,51,0,128,93,1,131,
+32,0,1,34,46,129,123,0,129,27,1,0,10,128,112,0,0,96,133,86,3,149,0,0,
+129,102,0,132,30,0,128,67,0,131,18,0,131,61,4,128,66,3,0,10,136,137,2,139,
+147,2,137,158,2,129,234,0,130,122,1,128,117,3,132,123,0,133,134,1,128,250,0,135,
+123,0,138,165,2,139,106,1,128,188,1,130,6,0,128,118,0,2,32,45,34,129,94,4,
+132,61,4,130,122,1,133,66,0,2,39,46,44,152,201,0,0,32,128,68,0,3,45,46,
+96,44,132,130,0,0,96,135,158,4,133,186,0,2,92,96,32,128,83,4,147,59,0,131,
+5,2,132,234,1,135,114,0,128,179,0,129,10,0,139,117,0,129,150,1,0,34,134,84,
+0,135,250,3,131,18,0,130,230,1,2,39,96,46,129,203,4,128,206,0,129,191,4,128,
+253,1,0,39,129,66,0,144,51,0,129,29,4,131,126,5,133,165,4,128,100,3,128,50,
+0,139,95,1,137,166,3,165,131,2,128,73,1,130,55,2,170,53,0,130,76,3,128,1,
+4,2,39,32,10,0,32,146,0,0,5,44,45,34,34,45,46,141,21,0,4,95,32,95,
+44,46,129,0,0,1,95,10,146,52,0,0,39,130,6,0,0,124,138,50,0,128,73,0,
+3,95,46,46,45,128,0,0,128,81,0,1,34,92,140,56,0,129,98,0,0,44,133,61,
+0,135,56,0,1,95,44,128,52,0,0,45,131,78,0,132,0,0,0,124,138,57,0,5,
+44,39,47,32,32,47,130,48,0,129,117,0,132,57,0,3,44,45,39,95,132,132,0,149,
+57,0,0,47,128,1,0,2,32,47,106,131,10,0,132,172,0,143,54,0,0,95,129,231,
+0,2,45,45,39,136,57,0,131,56,0,0,32,129,38,0,130,56,0,128,66,0,128,51,
+0,137,54,0,128,177,0,133,178,0,0,47,135,56,0,132,55,0,129,51,0,130,55,0,
+1,32,124,128,51,0,0,46,135,54,0,128,124,0,136,100,0,134,55,0,130,49,0,0,
+106,136,54,0,0,47,137,53,0,138,52,0,136,54,0,131,103,0,0,124,129,222,0,128,
+8,0,1,95,95,128,49,0,134,161,0,141,25,1,0,44,133,221,0,130,52,0,2,44,
+34,44,128,10,1,0,47,128,173,1,137,51,0,2,44,58,95,139,0,0,132,105,0,0,
+47,128,180,1,3,44,39,44,39,128,104,0,2,47,34,44,128,54,0,0,34,131,139,1,
+134,3,2,142,156,0,128,98,0,1,124,39,130,5,0,0,95,129,111,0,0,47,129,204,
+0,134,190,1,145,49,0,130,200,0,129,28,0,131,46,1,132,15,1,145,47,0,2,95,
+44,96,128,48,0,129,27,0,128,20,2,129,25,1,129,39,1,132,9,1,142,46,0,128,
+164,1,0,34,129,17,2,130,75,1,0,106,129,5,0,130,119,2,131,46,0,139,206,1,
+0,44,134,207,1,1,106,10,128,73,0,128,57,0,129,21,2,128,232,0,0,124,133,46,
+0,132,243,0,1,95,44,128,117,0,0,34,135,97,0,128,191,0,129,29,2,8,40,32,
+41,95,95,32,96,46,47,131,45,0,130,103,0,139,213,2,131,13,0,1,124,10,129,5,
+3,8,124,32,96,40,32,32,41,32,124,134,43,2,2,44,96,43,136,139,0,134,56,0,
+1,39,10,129,118,0,129,3,0,0,34,130,249,2,129,41,0,132,191,2,0,96,128,72,
+0,128,112,3,137,242,0,0,46,130,45,0,2,46,96,46,128,188,1,2,44,39,45,128,
+211,3,0,47,135,221,1,0,43,134,180,0,134,42,3,128,45,0,128,137,0,131,114,2,
+129,0,0,0,92,133,111,2,1,34,34,128,2,0,0,45,128,250,3,135,90,0,128,64,
+2,1,46,44,131,163,2,135,46,0,137,126,0,128,60,0,0,96,133,69,4,129,212,1,
+0,96,128,2,2,131,12,0,129,169,0,3,32,32,89,45,129,84,0,0,34,128,27,4,
+128,87,0,131,76,1,130,24,0,130,0,2,131,15,0,128,172,0,2,47,32,55,141,85,
+4,0,124,132,86,0,0,92,132,42,0,130,220,0,130,197,1,129,63,0,0,124,135,163,
+0,131,55,0,129,20,0,131,238,2,130,7,1,0,46,133,79,2,128,2,0,1,46,44,
+128,17,0,135,41,0,129,33,0,131,226,2,130,41,0,0,95,129,44,1,0,95,130,243,
+3,129,67,0,0,39,128,118,0,133,168,0,1,32,89,133,116,3,2,96,45,43,129,222,
+4,129,37,0,130,90,1,0,55,128,36,0,130,32,4,132,250,0,132,80,0,132,98,0,
+128,126,0,132,34,1,0,45,130,154,0,1,45,46,129,229,1,130,207,0,136,168,4,0,
+124,129,219,1,130,255,0,4,46,39,96,32,39,129,34,5,128,172,0,128,147,0,130,153,
+0,137,40,0,128,17,0,128,127,2,133,26,4,1,124,96,130,123,0,133,72,1,137,250,
+4,0,46,135,162,2,131,168,0,0,92,133,223,5,128,42,0,128,217,1,136,42,0,0,
+96,134,38,0,3,46,47,34,124,129,2,2,0,92,134,126,1,130,96,1,137,81,5,5,
+96,118,46,94,46,44,131,208,1,0,124,130,47,2,0,41,131,59,0,131,45,0,139,183,
+5,132,194,0,129,141,0,130,12,0,2,47,95,92,130,101,3,131,138,0,133,123,1,137,
+47,0,132,89,1,137,0,0,143,100,5,153,0,0,128,153,0,128,28,2,163,43,0,128,
+83,3,1,32,10,0,32,145,0,0,16,95,44,46,45,45,45,39,34,34,39,34,45,45,
+46,46,95,10,144,35,0,1,44,34,141,17,0,2,96,45,46,143,40,0,1,44,39,146,
+97,0,0,96,143,42,0,0,47,131,122,0,133,55,0,0,46,153,44,0,131,43,0,1,
+124,124,131,13,0,1,124,34,132,8,0,131,0,0,0,92,140,45,0,131,44,0,135,45,
+0,128,1,0,152,46,0,132,45,0,1,32,46,132,184,0,1,96,95,140,193,0,0,76,
+138,47,0,0,106,146,222,0,137,0,0,0,124,138,47,0,134,123,0,0,95,128,100,1,
+128,0,0,133,239,0,156,47,0,0,46,134,109,1,0,96,136,24,1,151,47,0,137,179,
+0,0,41,161,143,0,128,188,1,128,140,0,129,248,1,141,176,1,148,191,0,173,239,0,
+161,47,0,128,130,0,167,47,0,0,95,130,90,2,163,47,0,1,95,44,129,214,0,2,
+95,95,95,161,47,0,129,251,2,3,45,45,95,10,128,50,0,129,7,3,129,112,1,0,
+92,160,54,0,131,193,0,128,78,2,130,107,0,129,194,2,128,20,0,1,45,45,128,5,
+0,157,55,0,131,201,0,2,96,45,32,130,120,0,134,110,3,128,21,0,131,61,3,131,
+24,0,138,247,1,129,60,2,133,10,0,2,124,46,39,141,100,0,128,211,2,1,44,45,
+128,190,3,2,32,46,45,139,23,0,130,4,1,129,115,2,0,96,129,15,1,2,45,39,
+96,128,102,0,132,174,0,141,88,2,2,96,45,10,128,62,0,128,5,4,128,35,0,128,
+36,0,1,45,58,134,32,0,0,45,130,84,0,3,44,34,39,46,130,160,0,3,44,39,
+96,44,135,34,4,1,95,39,128,69,2,0,39,131,214,0,2,46,46,39,130,223,2,1,
+44,58,129,117,0,128,23,0,131,141,0,137,203,0,0,95,135,219,3,3,45,95,95,46,
+129,112,0,133,188,2,0,96,128,15,2,1,96,76,131,57,0,128,59,0,129,183,0,0,
+95,131,232,0,130,166,2,145,148,4,152,0,0,1,39,34,128,87,0,0,10,0,32,164,
+0,0,3,95,46,46,45,129,0,0,2,46,95,10,162,47,0,4,44,45,39,95,95,132,
+58,0,3,95,96,45,46,161,53,0,3,44,39,32,32,128,2,0,0,96,129,11,0,6,
+47,32,32,124,32,32,92,145,54,0,0,95,129,0,0,135,14,0,128,41,0,4,32,44,
+46,46,46,137,34,0,141,55,0,4,95,46,45,34,34,130,9,0,128,138,0,131,18,0,
+128,93,0,130,58,0,2,32,96,46,128,172,0,1,34,34,128,6,0,143,56,0,130,32,
+0,134,0,0,131,34,0,128,56,0,129,59,0,128,165,0,2,124,124,32,133,17,0,1,
+32,32,139,225,0,0,106,140,126,0,1,32,92,131,39,0,6,96,46,46,95,95,46,39,
+129,230,0,134,57,0,0,124,137,57,0,131,157,0,132,223,0,1,44,39,128,112,1,128,
+58,0,133,77,0,129,230,0,0,46,128,66,0,128,139,1,130,64,0,138,57,0,130,75,
+0,0,32,129,165,1,0,46,132,69,0,2,124,32,92,131,20,0,1,32,40,131,80,0,
+0,41,135,44,0,141,57,0,128,147,0,129,124,0,128,210,0,129,8,0,128,17,0,0,
+89,134,30,0,2,34,34,34,132,174,0,146,57,0,132,98,0,0,124,129,90,1,130,151,
+0,132,16,0,142,0,0,143,173,0,129,49,0,2,46,39,44,128,179,0,133,176,0,132,
+59,2,0,45,129,19,0,128,118,0,0,34,128,32,0,2,95,32,106,143,230,0,129,172,
+0,130,208,1,0,95,131,66,1,132,18,0,1,45,34,131,10,0,0,44,128,179,0,2,
+96,46,96,144,31,1,130,117,0,128,91,0,132,209,0,131,210,1,130,230,1,129,17,0,
+131,239,1,129,167,1,146,57,0,138,0,0,0,76,129,47,0,129,57,2,130,188,0,0,
+95,134,130,2,134,66,2,0,95,128,186,0,130,37,0,143,9,1,128,32,2,130,84,0,
+0,95,128,10,0,131,115,0,131,136,0,0,76,131,59,0,129,8,3,128,166,0,149,119,
+0,128,164,1,132,70,0,128,8,0,132,174,1,130,94,1,128,56,1,131,229,2,0,95,
+133,34,0,141,120,0,128,73,2,129,254,0,129,166,1,130,102,3,134,59,0,131,55,0,
+129,122,0,1,44,58,147,59,0,131,221,0,130,240,0,1,45,46,128,68,0,0,32,131,
+131,2,128,64,0,132,18,4,0,44,128,28,4,129,193,3,138,137,3,139,67,1,130,240,
+1,1,95,95,135,135,2,2,106,39,34,129,20,0,130,64,0,0,58,128,66,1,1,95,
+58,129,61,0,131,12,1,139,77,4,148,85,2,0,124,129,120,1,1,95,32,129,245,2,
+141,43,4,128,75,0,130,0,0,128,26,0,128,35,0,130,173,0,149,68,0,134,130,1,
+1,44,96,137,70,0,0,96,130,250,2,129,67,0,3,47,95,95,44,128,9,3,130,1,
+5,2,34,39,45,128,205,3,0,95,128,147,0,128,99,2,136,136,4,128,70,0,130,9,
+2,159,33,5,0,39,129,41,3,130,87,0,129,6,0,130,20,1,130,130,4,2,45,44,
+124,128,218,4,162,43,5,139,79,0,130,152,0,128,212,2,2,46,32,10,0,32,164,0,
+0,1,46,10,150,26,0,0,124,140,14,0,165,41,0,0,44,143,41,0,1,44,95,133,
+41,0,0,92,137,22,0,1,70,39,129,27,0,4,46,45,34,34,96,142,135,0,5,47,
+32,32,96,45,46,129,55,0,1,124,96,137,22,0,8,47,32,44,45,34,95,44,46,46,
+143,145,0,129,134,0,5,95,95,95,32,96,46,128,10,0,3,92,32,44,34,128,87,0,
+8,45,46,32,47,46,45,39,32,44,129,106,0,5,32,39,32,124,95,46,129,0,0,0,
+95,143,58,0,128,112,0,129,113,0,128,60,0,1,32,76,130,35,0,6,46,124,106,32,
+106,95,46,130,56,0,128,26,0,134,229,0,0,96,144,61,0,132,27,0,2,95,44,39,
+128,11,0,128,131,0,128,0,0,0,124,128,108,0,1,32,39,131,194,0,128,34,0,128,
+33,0,128,233,0,128,92,0,129,64,0,141,236,0,0,76,130,63,0,130,163,0,134,75,
+0,2,124,32,106,132,111,0,129,53,0,128,63,0,130,136,0,129,158,0,3,32,32,92,
+10,129,231,0,138,129,0,0,92,128,123,0,133,140,0,2,96,34,45,128,0,0,134,73,
+0,130,54,0,129,128,0,136,130,1,6,92,10,32,34,34,61,43,129,10,1,131,72,0,
+0,96,130,62,0,132,162,0,0,124,131,36,1,130,80,1,129,9,0,130,33,0,0,89,
+128,83,1,130,0,0,2,106,95,41,128,127,1,3,43,61,45,45,131,199,0,128,110,0,
+2,46,95,34,129,232,0,129,40,0,128,71,0,128,55,0,129,179,1,130,46,0,128,86,
+1,131,17,0,132,61,0,2,92,32,106,128,60,0,128,194,1,128,65,0,1,45,34,128,
+250,0,136,11,1,129,240,1,2,45,43,46,130,248,0,0,33,132,49,0,1,96,45,128,
+189,1,130,88,0,129,17,0,129,18,0,129,48,2,129,150,0,0,60,129,113,0,130,213,
+0,142,8,2,128,196,0,129,24,0,130,28,0,0,76,137,30,2,130,67,0,129,9,0,
+2,46,45,47,133,216,1,0,46,128,46,0,1,44,45,142,67,0,128,23,1,129,33,0,
+130,37,0,134,72,1,131,161,1,131,214,0,128,4,0,129,10,0,2,96,44,32,132,110,
+0,0,106,134,66,0,128,157,0,128,182,0,0,34,129,90,1,129,211,0,0,95,133,155,
+1,133,63,2,128,16,0,129,87,2,4,95,95,47,95,124,128,35,0,129,76,0,0,47,
+131,91,0,129,66,0,2,95,46,45,130,64,0,128,23,3,128,10,0,138,49,3,142,190,
+3,128,75,1,128,78,0,0,34,128,240,1,3,46,47,76,47,130,46,3,1,10,32,128,
+122,0,0,34,131,112,0,128,3,3,128,4,0,0,45,130,66,2,128,45,0,128,120,0,
+132,49,0,1,95,44,131,175,2,1,46,43,128,32,0,129,0,0,128,44,3,128,45,3,
+5,43,45,61,61,43,43,132,215,1,132,135,3,129,137,3,129,62,0,0,41,128,230,1,
+5,46,95,96,118,32,92,130,1,1,0,86,128,23,0,0,47,129,155,1,128,148,1,0,
+46,128,72,0,128,41,3,128,32,0,132,24,1,137,212,1,130,61,0,0,41,128,206,0,
+131,70,2,4,96,34,34,92,92,129,25,1,1,47,32,133,91,3,132,78,1,130,233,0,
+0,89,128,72,2,1,46,39,137,140,1,3,96,34,39,96,131,164,0,132,198,0,128,119,
+1,128,111,2,1,34,95,130,52,0,133,208,1,130,17,4,1,32,95,129,10,0,151,169,
+4,128,123,0,128,24,1,128,34,0,132,30,1,133,144,1,128,89,0,128,16,0,4,40,
+95,124,44,45,139,123,0,145,0,0,141,144,1,134,159,4,1,46,96,137,56,1,148,129,
+0,131,193,0,132,48,0,1,32,106,128,12,2,141,48,1,149,100,5,0,96,128,125,1,
+132,93,2,128,101,4,131,205,0,161,55,0,130,95,0,128,247,0,129,67,1,129,249,2,
+0,34,128,118,0,158,54,0,128,7,5,1,95,95,132,128,4,130,243,0,0,96,128,172,
+1,152,2,6,132,0,0,130,49,0,136,14,6,128,69,0,159,80,1,131,199,1,157,92,
+0,0,47,128,177,2,128,2,0,128,184,4,155,157,1,129,0,2,129,246,3,157,117,0,
+128,78,1,129,12,6,2,39,32,10,1,10,32,133,0,0,6,44,45,34,34,45,45,46,
+134,16,0,0,47,132,7,0,0,92,134,17,0,5,124,32,44,34,96,46,128,8,0,0,
+76,136,18,0,132,5,0,0,124,134,18,0,1,92,95,132,60,0,135,18,0,4,32,32,
+96,45,39,139,37,0,134,62,0,160,18,0,0,106,128,2,0,139,18,0,128,132,0,135,
+168,0,147,35,0,142,34,0,142,88,0,159,16,0,0,76,142,139,0,4,92,95,124,46,
+95,133,18,0,2,95,46,45,128,52,1,131,223,0,0,34,132,108,0,4,44,39,32,46,
+39,137,48,0,130,22,0,128,14,1,133,78,1,135,23,0,0,95,128,43,0,143,25,0,
+2,92,10,60,147,49,0,0,124,128,25,0,2,43,45,39,128,164,0,128,235,0,139,25,
+0,1,47,10,128,96,1,1,45,43,132,142,1,1,95,95,129,129,1,131,150,0,130,9,
+1,0,46,133,213,1,0,92,129,32,0,0,44,129,229,1,130,198,1,131,208,0,5,95,
+47,44,34,34,46,133,231,0,3,96,45,92,124,130,69,0,3,96,46,92,45,128,17,2,
+4,34,34,39,32,47,130,137,0,136,9,1,0,124,130,87,0,0,47,131,94,0,132,71,
+0,129,250,0,136,43,1,2,92,124,46,128,32,0,0,44,128,102,0,1,44,45,128,4,
+0,5,95,46,46,32,92,39,128,153,0,0,46,133,148,1,128,11,0,4,95,95,124,32,
+89,129,146,0,0,96,128,143,0,0,47,129,239,0,5,124,32,59,46,61,34,135,70,0,
+5,34,45,43,61,43,46,128,33,0,0,33,129,96,0,2,47,95,33,128,36,0,0,124,
+130,57,0,136,106,0,4,95,124,95,76,44,128,129,1,6,34,34,32,46,95,46,32,128,
+6,0,2,32,46,45,133,0,0,134,171,1,7,43,61,61,43,45,96,92,46,128,35,0,
+11,95,44,46,124,46,46,46,44,45,61,43,92,133,205,1,128,3,1,130,1,2,1,46,
+43,128,71,1,128,107,0,128,0,0,1,41,47,130,201,1,0,92,128,132,0,137,4,2,
+1,44,43,128,21,0,128,1,1,130,36,0,128,26,1,130,7,0,135,36,3,1,32,32,
+129,162,1,129,74,0,128,65,1,2,46,46,39,129,59,1,142,34,0,131,168,1,129,4,
+0,128,182,0,131,46,2,130,35,0,135,88,3,137,35,0,138,101,1,2,32,124,44,135,
+129,2,134,33,0,136,137,1,129,236,0,0,106,130,132,2,1,39,62,140,39,0,2,44,
+46,46,131,218,0,139,225,3,1,32,47,136,246,3,128,37,0,0,94,128,60,0,128,66,
+2,136,122,0,129,46,2,128,83,1,129,84,0,135,101,3,129,190,2,0,124,128,124,2,
+128,5,0,0,45,131,23,4,130,102,0,7,39,45,39,34,34,96,96,45,129,149,2,133,
+19,0,129,144,2,128,111,1,128,65,0,130,199,2,135,184,2,3,95,44,96,45,128,138,
+1,7,45,94,46,46,96,39,32,10,0,32,154,0,0,2,44,45,39,129,5,0,3,34,
+34,44,10,154,39,0,0,47,128,1,0,128,43,0,2,46,45,39,145,39,0,4,95,44,
+46,46,45,129,0,0,4,43,45,34,46,34,128,36,0,129,16,0,137,40,0,128,14,0,
+3,46,44,46,34,129,107,0,135,0,0,2,96,45,45,129,53,0,136,81,0,0,47,128,
+39,0,0,44,139,36,0,134,44,0,134,79,0,129,32,0,0,46,147,36,0,138,40,0,
+0,106,130,182,0,153,0,0,134,42,0,0,124,129,122,0,129,191,0,1,46,95,138,180,
+0,130,18,0,132,13,0,132,43,0,0,44,131,88,0,0,32,129,40,0,0,92,133,41,
+0,129,142,0,0,46,128,25,0,128,81,0,131,79,0,129,43,0,130,200,0,128,89,0,
+134,98,0,0,95,128,0,0,136,17,0,128,9,0,1,46,34,128,50,1,1,44,94,129,
+90,0,131,169,0,2,124,96,45,128,41,1,128,64,1,131,151,1,128,79,0,0,95,129,
+37,1,130,18,0,1,32,95,132,205,0,128,93,0,133,9,0,132,125,1,136,13,1,130,
+46,0,129,103,0,0,96,133,17,0,1,39,10,130,176,0,130,46,0,1,44,45,131,131,
+1,130,28,0,136,68,1,128,183,0,134,47,0,128,21,1,134,163,0,0,46,134,226,0,
+143,16,2,136,201,0,0,92,135,49,0,1,32,96,147,50,0,139,13,1,139,50,0,137,
+23,0,139,20,0,1,44,45,137,26,0,128,153,0,133,141,1,132,80,0,143,52,0,130,
+224,0,139,79,0,1,92,10,134,169,1,148,15,2,131,182,1,140,133,0,129,149,1,0,
+96,129,49,0,148,145,2,133,49,0,134,56,1,134,157,1,130,103,0,152,122,2,131,104,
+0,139,39,1,129,54,0,138,83,1,149,54,0,138,55,0,0,47,131,10,2,160,53,0,
+133,154,2,129,46,2,132,69,1,135,75,1,141,0,0,138,25,2,0,95,128,204,3,0,
+39,131,11,3,0,44,133,180,1,134,76,0,144,228,1,136,70,0,2,45,34,34,133,167,
+0,134,162,0,128,80,0,141,61,4,142,205,3,134,44,0,136,55,0,131,219,2,130,11,
+3,129,76,4,1,45,45,132,90,0,144,55,0,2,44,39,10,151,31,4,144,0,0,130,
+44,0,128,52,0,140,146,1,156,16,5,131,50,0,167,51,0,130,73,2,129,28,2,164,
+49,0,128,112,5,131,26,5,148,108,1,140,122,1,0,43,133,71,5,0,62,157,46,0,
+130,86,0,0,95,129,81,4,128,81,1,128,44,4,147,37,0,0,95,128,130,4,128,15,
+5,1,10,44,129,76,4,134,129,1,1,34,44,133,129,1,131,134,1,129,22,2,133,136,
+1,131,78,5,0,92,130,10,6,0,46,130,63,0,152,27,2,137,209,5,128,0,0,142,
+204,1,0,39,130,227,1,128,124,2,128,71,0,1,34,34,128,39,5,128,77,0,0,10,
+0,32,140,0,0,2,44,124,10,140,16,0,2,39,32,124,134,12,0,2,46,39,44,139,
+30,0,0,47,128,3,0,130,30,0,2,47,92,95,128,41,0,0,106,138,29,0,129,28,
+0,129,29,0,133,66,0,137,90,0,128,19,0,130,18,0,130,7,0,129,29,0,0,46,
+135,28,0,130,55,0,128,0,0,130,34,0,0,106,132,3,0,5,32,95,44,46,45,47,
+134,36,0,132,35,0,133,70,0,129,3,0,3,46,46,45,34,129,17,0,133,35,0,133,
+70,0,132,0,0,135,197,0,140,24,0,133,0,0,0,96,132,56,0,141,30,0,133,56,
+0,132,89,0,0,40,128,114,0,0,40,142,60,0,5,44,34,34,96,45,46,147,88,0,
+128,82,0,132,250,0,0,124,128,1,0,140,36,0,132,193,0,1,32,92,148,57,0,133,
+53,1,128,58,0,0,112,132,42,0,141,198,0,135,217,0,140,30,0,133,58,0,1,46,
+96,139,26,0,133,71,0,2,44,39,124,144,179,0,130,145,0,132,69,1,7,47,96,34,
+96,34,34,34,39,133,220,0,133,115,0,128,12,0,7,124,46,32,96,46,95,95,95,141,
+145,0,131,163,1,133,159,1,5,45,34,39,95,124,46,129,27,2,135,172,0,0,124,128,
+56,0,130,112,1,3,34,45,45,46,135,86,0,129,60,2,132,39,0,1,44,39,129,56,
+0,1,44,45,137,240,0,131,42,2,0,32,135,101,1,0,124,134,253,1,0,10,132,110,
+0,2,46,39,46,129,17,0,128,12,0,128,58,0,133,21,1,0,92,135,68,0,131,118,
+0,1,44,39,132,156,0,1,106,10,130,35,0,128,212,2,130,34,0,128,21,0,133,206,
+2,0,44,129,100,0,137,145,1,2,96,43,45,132,37,0,130,27,1,128,35,0,1,46,
+39,132,14,0,2,46,46,95,129,54,0,133,3,0,128,53,0,138,56,0,130,145,0,131,
+29,1,2,10,32,92,135,91,2,0,124,129,91,1,0,45,129,29,0,0,47,128,217,2,
+3,46,34,92,44,147,1,2,135,242,2,130,122,0,131,83,3,1,34,124,133,129,2,0,
+92,141,79,2,136,169,2,140,0,0,1,46,124,134,153,0,0,96,139,73,2,143,103,0,
+135,41,2,0,95,133,51,0,128,126,3,128,0,0,2,34,34,45,132,16,0,145,100,0,
+128,118,1,0,34,128,131,3,130,33,0,135,242,1,128,111,0,147,47,0,134,184,2,128,
+212,1,140,145,0,144,45,0,137,232,0,137,43,1,1,95,46,144,137,0,134,32,0,128,
+161,2,135,44,0,0,96,136,101,4,140,21,2,128,183,0,128,8,0,136,87,0,0,92,
+138,42,0,2,44,45,47,128,7,3,2,34,39,46,133,239,2,1,92,95,131,55,0,133,
+87,0,135,98,3,2,95,46,96,131,6,1,136,92,1,128,44,0,147,90,0,6,47,46,
+45,110,43,61,61,133,61,0,1,95,44,129,66,1,140,225,0,138,137,0,128,38,2,1,
+95,95,128,233,4,130,149,3,136,23,0,0,41,137,208,0,128,151,3,136,51,0,1,40,
+44,141,93,1,131,107,0,135,140,2,128,48,0,129,16,0,0,92,137,53,0,145,50,0,
+128,230,4,131,136,5,130,47,0,128,36,3,2,96,95,47,128,1,4,139,42,1,145,138,
+4,3,41,44,43,46,129,0,0,128,139,1,0,44,128,244,3,130,184,0,0,96,146,165,
+2,136,198,0,0,34,137,65,2,129,162,0,157,103,0,142,65,0,2,39,32,10,0,32,
+156,0,0,6,44,46,45,34,34,46,10,157,37,0,2,124,32,46,128,6,0,0,96,130,
+40,0,0,44,128,49,0,4,34,34,39,34,96,129,18,0,139,0,0,3,39,47,32,124,
+128,6,0,3,47,32,32,92,128,41,0,1,44,39,130,20,0,0,95,128,39,0,0,92,
+138,114,0,3,32,32,40,47,130,29,0,0,96,129,15,0,141,70,0,129,95,0,8,45,
+45,46,10,46,39,106,32,44,128,14,0,0,34,130,105,0,135,65,0,129,93,0,3,32,
+32,45,46,129,17,0,0,124,129,4,0,0,76,139,62,0,128,87,0,1,44,46,128,49,
+0,128,173,0,1,124,40,130,143,0,129,3,0,129,51,0,3,92,124,96,45,128,24,0,
+3,44,47,47,34,131,80,0,0,96,128,104,0,0,39,130,9,0,137,160,0,0,106,129,
+100,0,0,45,128,130,0,129,156,0,7,10,96,45,92,124,95,46,46,131,203,0,128,38,
+0,6,124,124,46,32,96,47,96,131,133,0,0,92,128,38,0,128,163,0,129,108,0,139,
+68,0,128,114,0,0,39,130,216,0,128,8,0,0,124,140,94,1,0,92,128,67,0,131,
+43,0,128,142,0,128,31,0,2,96,32,39,128,136,0,128,70,0,130,167,0,135,14,1,
+129,114,0,130,18,0,2,124,95,95,141,67,0,3,32,96,124,124,128,130,0,132,11,0,
+133,7,0,128,246,0,131,48,0,136,39,0,129,225,0,147,135,0,133,160,1,137,0,0,
+1,95,95,128,16,2,133,193,0,141,0,0,144,67,0,134,131,0,135,83,0,131,62,0,
+130,199,1,143,95,0,129,212,0,140,67,0,129,66,0,138,137,0,134,11,0,1,44,39,
+139,218,1,136,48,0,0,39,138,67,0,3,47,46,32,46,131,110,1,140,0,0,130,182,
+1,144,201,0,129,66,0,0,47,137,66,0,128,76,1,1,47,124,128,150,1,141,13,1,
+132,152,0,143,135,0,141,65,0,9,46,45,46,39,124,76,124,39,95,95,137,37,0,1,
+45,45,136,245,1,142,8,1,137,64,0,129,97,3,141,34,0,140,241,1,137,224,0,131,
+152,0,136,63,0,128,68,2,129,45,3,153,0,0,0,46,133,39,2,132,213,0,0,44,
+137,68,1,2,96,45,43,155,61,0,129,17,3,130,0,0,130,59,0,128,66,0,138,129,
+1,139,186,0,141,138,1,0,123,136,183,0,128,95,2,137,57,0,1,44,34,138,58,0,
+133,12,0,131,65,0,128,66,2,130,114,0,129,111,4,133,52,0,128,65,0,129,129,0,
+138,13,1,0,41,134,159,2,128,177,1,133,205,4,134,154,2,128,211,2,141,174,2,1,
+124,45,133,79,0,130,228,3,3,46,45,45,43,129,49,4,2,47,96,118,128,13,0,131,
+36,0,130,230,4,128,134,4,134,31,1,132,240,4,131,161,0,128,255,3,137,183,0,139,
+12,1,130,101,4,134,30,0,0,96,129,46,5,128,77,4,0,46,128,25,2,131,65,5,
+137,0,0,128,186,0,1,92,95,139,52,2,129,38,0,0,95,142,42,0,0,95,133,187,
+0,130,93,0,139,26,0,129,48,0,131,45,0,1,46,39,130,108,0,130,11,2,129,193,
+0,128,18,4,137,90,3,129,76,5,130,5,2,133,93,0,0,92,128,158,5,0,44,128,
+156,0,128,48,0,144,172,3,1,32,40,128,68,0,130,109,0,1,95,95,129,88,0,134,
+147,0,0,34,128,221,4,128,181,0,132,42,1,146,228,3,128,5,0,128,9,4,131,172,
+0,0,39,158,97,6,137,99,4,128,219,5,132,231,0,0,95,138,163,3,158,55,0,167,
+45,0,0,39,130,242,0,1,10,10,0,32,163,0,0,8,95,46,45,34,34,39,45,46,
+10,131,13,0,131,0,0,149,44,0,2,44,45,39,133,10,0,0,96,130,49,0,3,44,
+34,32,46,128,5,0,129,14,0,144,45,0,0,46,129,28,0,136,0,0,0,92,128,50,
+0,0,47,128,22,0,128,113,0,131,15,0,132,39,0,0,118,132,8,0,128,28,0,2,
+39,92,124,139,68,0,1,96,39,128,104,0,2,47,32,32,131,22,0,130,153,0,0,124,
+129,160,0,0,106,131,63,0,1,47,124,128,28,0,128,101,0,140,53,0,4,32,124,46,
+92,10,129,34,0,7,96,46,95,44,46,43,46,46,131,186,0,0,92,129,23,0,6,32,
+44,96,44,96,39,47,129,58,0,134,130,0,130,202,0,2,34,45,32,128,22,0,1,124,
+10,134,227,0,128,32,0,0,47,128,32,1,1,44,95,128,21,0,3,124,32,92,44,128,
+24,0,128,54,0,1,32,96,130,187,0,130,138,0,7,95,46,58,45,46,46,46,43,128,
+25,0,5,124,10,32,96,45,46,130,21,0,1,96,45,128,149,0,0,46,128,227,0,128,
+111,0,0,39,132,77,0,128,32,1,0,95,129,108,0,4,39,46,96,45,45,128,51,0,
+3,124,96,45,34,128,26,0,1,95,47,131,120,1,129,20,0,0,39,128,36,0,0,76,
+130,144,0,0,47,129,52,0,128,113,0,0,95,128,217,0,128,21,0,136,215,0,0,39,
+128,59,0,129,41,0,130,75,1,139,92,1,128,226,0,129,7,0,0,46,128,28,0,128,
+144,1,143,0,0,132,34,1,142,56,0,1,32,86,131,57,0,3,45,46,32,108,138,25,
+2,133,6,2,133,91,1,132,35,2,135,49,1,0,39,129,17,1,129,109,0,134,49,1,
+132,40,0,129,113,1,128,0,0,135,72,1,139,57,0,0,47,131,25,0,0,46,141,180,
+1,128,6,1,140,185,0,132,29,1,134,136,0,129,55,0,128,60,0,143,56,0,135,107,
+0,130,149,1,0,39,140,55,0,128,255,1,1,39,33,143,37,2,130,119,1,129,169,0,
+0,44,128,3,0,0,45,129,91,1,128,165,1,137,58,0,2,95,124,95,128,212,1,128,
+113,1,131,176,2,139,0,0,135,12,3,130,0,0,1,60,95,137,58,0,0,47,148,20,
+3,147,87,3,138,176,0,0,92,131,253,1,161,188,3,0,44,138,232,0,128,125,2,131,
+145,1,156,0,0,0,60,139,142,1,135,3,3,153,162,0,1,45,96,140,254,1,160,54,
+0,1,60,34,141,52,0,128,126,3,158,0,0,138,161,2,128,226,0,149,106,0,131,159,
+2,129,174,4,0,44,128,160,1,135,52,0,133,11,2,140,53,0,128,100,1,9,45,45,
+96,124,58,46,95,46,46,95,128,154,1,136,154,0,133,108,1,2,95,92,39,128,237,3,
+134,107,3,2,124,32,96,128,19,4,128,5,0,128,24,2,128,10,0,137,203,0,135,91,
+0,0,41,128,230,1,130,206,3,1,96,44,128,246,3,132,235,3,0,46,138,69,2,128,
+69,0,131,9,2,0,92,130,7,0,131,22,2,136,168,1,1,96,44,141,147,3,2,106,
+95,95,128,184,4,0,45,128,129,0,136,168,2,132,68,0,129,124,0,138,94,0,129,192,
+0,128,21,4,129,80,0,0,95,140,254,1,0,96,132,36,1,2,32,41,124,141,189,3,
+128,25,5,128,8,1,129,116,4,134,87,0,133,0,0,0,43,129,26,0,129,119,1,140,
+183,3,129,242,3,135,224,2,140,180,1,130,75,0,128,33,0,131,24,6,131,50,2,0,
+34,128,180,0,133,37,3,128,246,5,140,48,3,130,69,5,0,95,129,230,0,134,79,6,
+132,88,0,128,33,6,131,89,4,143,49,0,135,190,0,134,8,0,135,108,1,129,171,3,
+0,76,129,192,6,155,6,3,0,106,135,219,4,143,226,0,155,0,0,130,144,1,133,123,
+0,172,59,0,1,32,96,130,153,0,131,113,4,2,39,32,10,3,10,10,10,32,143,0,
+0,1,95,44,143,21,0,5,46,39,44,95,46,46,142,24,0,1,44,39,130,6,0,3,
+47,44,45,45,139,26,0,0,46,131,24,0,128,33,0,4,46,47,46,95,95,139,28,0,
+4,124,95,44,46,45,128,0,0,5,47,44,44,39,96,46,128,112,0,138,30,0,3,46,
+39,95,95,131,85,0,0,47,129,5,0,4,96,46,46,46,62,133,32,0,0,95,128,0,
+0,5,47,47,124,41,32,124,130,26,0,131,20,0,2,47,46,39,132,31,0,0,40,131,
+49,0,5,45,46,45,39,46,46,131,68,0,1,95,44,130,42,0,139,181,0,130,125,0,
+128,0,0,128,36,0,132,57,0,128,133,0,136,0,0,129,148,0,129,192,0,0,92,140,
+56,0,130,94,0,134,36,0,0,45,134,61,0,128,163,0,129,77,0,131,113,0,128,223,
+0,136,70,0,135,0,0,0,106,142,135,0,1,96,46,134,248,0,7,62,45,44,45,34,
+96,34,34,130,54,1,134,177,0,3,124,96,34,43,129,164,0,130,88,0,140,199,0,1,
+45,46,129,129,0,133,64,0,2,40,32,47,135,31,0,0,47,129,38,1,133,137,0,131,
+2,0,3,92,34,34,124,130,74,0,133,70,1,133,159,0,136,131,0,0,34,129,80,0,
+133,34,0,3,34,45,45,44,133,118,0,128,2,0,129,106,1,0,124,130,130,0,0,124,
+128,50,0,2,45,46,34,130,34,0,129,43,0,128,19,0,1,45,96,139,223,1,132,21,
+2,128,0,0,2,39,95,62,129,68,0,0,106,130,18,0,7,39,46,32,44,96,32,124,
+44,131,202,0,128,124,0,128,72,0,0,118,128,40,2,2,96,45,43,129,118,0,136,137,
+0,130,58,0,135,60,1,0,62,133,18,0,132,211,0,128,62,0,0,39,128,155,1,0,
+76,131,185,1,0,46,133,173,1,132,83,1,140,108,2,134,71,0,138,188,1,128,23,0,
+0,124,131,62,2,0,92,132,55,1,1,39,94,128,152,0,133,130,2,2,46,44,123,137,
+25,1,131,62,0,132,64,0,140,71,0,135,123,0,0,118,137,225,2,130,59,1,128,103,
+1,3,44,39,34,34,136,71,0,129,7,1,0,62,128,43,2,0,43,128,243,0,134,44,
+0,130,41,0,0,44,129,67,2,0,34,129,84,2,136,115,0,128,200,2,0,96,128,137,
+1,1,45,45,133,225,2,129,20,0,134,86,2,128,8,0,133,221,0,1,124,45,131,58,
+2,134,6,1,128,53,0,128,84,1,129,8,3,134,15,1,129,88,3,0,95,137,40,1,
+0,96,130,241,0,139,151,2,129,178,0,1,45,39,133,193,1,131,16,2,128,64,0,2,
+95,32,95,131,210,3,0,39,128,147,0,138,250,0,134,236,1,0,95,128,32,4,2,60,
+34,34,129,201,0,0,45,138,139,0,131,100,2,2,96,46,41,135,30,1,0,39,128,210,
+0,3,34,34,96,46,128,146,2,128,219,0,132,141,3,0,34,128,80,2,131,236,2,128,
+129,0,3,47,32,46,34,136,126,3,129,104,2,1,10,44,128,17,0,128,105,4,129,49,
+4,0,44,136,132,0,2,96,32,96,140,111,0,128,19,0,128,118,1,0,34,128,59,1,
+129,6,0,0,96,131,154,3,128,111,2,0,47,128,134,0,0,45,128,248,0,128,170,0,
+142,49,0,159,0,0,128,83,1,1,34,39,128,50,5,1,10,10,0,32,136,0,0,6,
+47,32,32,44,39,40,10,137,17,0,2,96,45,39,128,6,0,4,92,95,95,46,44,135,
+23,0,0,44,129,19,0,10,32,32,46,45,34,92,32,96,45,45,45,128,55,0,144,0,
+0,0,47,132,48,0,1,124,96,131,46,0,5,32,47,44,39,124,124,129,8,0,1,39,
+46,140,42,0,10,44,96,46,32,44,40,44,95,46,32,95,129,102,0,1,95,95,128,53,
+0,128,21,0,4,45,45,43,45,45,128,43,0,131,53,0,2,32,96,39,128,104,0,131,
+58,0,0,95,128,123,0,129,85,0,0,96,129,12,0,6,34,34,96,46,10,46,34,128,
+150,0,6,45,39,46,34,100,95,95,128,46,0,3,96,46,39,95,130,118,0,2,95,44,
+45,130,97,0,128,55,0,134,166,0,0,46,128,95,0,130,80,0,3,92,95,10,124,132,
+204,0,3,96,45,46,46,128,202,0,2,45,45,34,132,29,0,128,146,0,130,6,0,129,
+137,0,134,0,0,132,20,0,7,92,46,10,32,96,34,86,34,128,157,0,132,74,0,135,
+29,0,0,96,131,18,0,0,39,138,55,0,128,50,0,131,5,0,129,222,0,131,10,0,
+130,57,1,130,155,0,130,16,1,128,167,0,130,136,0,128,142,0,139,56,0,132,46,0,
+128,113,0,134,91,0,134,0,0,128,177,0,130,1,1,132,123,0,140,56,0,131,43,1,
+0,124,132,134,1,128,224,0,136,169,0,129,15,1,131,122,1,129,131,0,141,56,0,0,
+76,130,148,0,134,240,1,129,56,1,3,91,45,44,61,129,32,1,0,39,129,132,0,2,
+95,96,44,131,119,0,132,15,1,134,0,0,131,72,0,0,92,130,57,0,128,163,1,130,
+209,0,4,96,46,46,95,39,128,41,1,130,187,0,0,45,129,246,0,1,43,34,128,0,
+0,128,244,0,137,204,0,132,130,0,128,92,0,131,104,2,132,36,1,128,70,0,128,52,
+0,130,61,0,0,95,128,57,0,129,73,0,2,46,96,44,130,38,1,128,52,2,133,64,
+0,0,106,134,70,0,1,45,44,130,182,0,0,46,132,114,2,129,223,0,0,46,131,163,
+0,131,231,1,128,176,0,128,185,0,128,109,2,128,13,0,0,47,132,79,1,0,47,132,
+72,0,1,95,95,129,132,1,0,95,129,63,0,0,108,134,66,1,0,124,128,26,0,129,
+112,0,128,203,0,0,46,129,241,2,131,22,0,0,118,132,21,1,1,95,46,128,104,2,
+129,10,1,6,55,34,44,39,44,45,44,129,32,0,1,45,45,138,193,0,129,34,1,0,
+46,129,64,0,8,46,46,39,44,39,41,39,34,34,128,12,0,131,154,1,129,206,2,130,
+149,0,129,236,2,0,39,128,30,0,1,47,124,130,168,2,128,0,0,0,62,131,124,1,
+0,86,131,180,1,130,36,0,128,252,0,0,44,131,127,0,0,95,128,65,0,0,46,130,
+207,0,3,106,32,44,94,131,220,0,128,169,3,129,155,1,131,40,0,129,111,0,129,119,
+1,130,52,2,130,62,0,3,92,47,92,124,131,89,0,0,58,133,6,3,4,39,46,47,
+96,39,130,118,1,0,124,130,18,0,128,80,0,138,200,3,0,96,128,15,1,131,23,0,
+137,17,4,0,124,129,208,0,1,44,39,136,77,2,128,52,0,131,213,3,132,241,1,141,
+76,2,129,168,0,1,46,34,137,67,0,2,76,46,95,128,54,1,135,244,1,3,32,89,
+44,46,131,137,0,132,172,3,131,56,2,132,255,1,128,122,4,129,65,0,138,133,0,128,
+92,1,128,94,1,128,184,1,131,65,0,0,95,128,63,0,1,44,39,129,86,4,1,46,
+96,128,132,1,0,46,135,199,0,128,145,1,0,47,128,16,0,2,46,45,96,139,63,0,
+128,62,0,0,44,128,86,4,1,124,47,128,179,0,4,92,34,32,46,43,130,113,0,0,
+92,129,8,2,0,95,132,17,4,129,221,1,0,39,128,111,1,133,64,3,133,0,0,128,
+29,0,2,39,32,76,128,59,0,128,23,2,134,172,3,1,96,46,128,209,2,136,117,0,
+137,121,3,133,0,0,0,41,130,40,0,0,124,132,39,0,134,38,1,1,96,62,128,161,
+2,128,193,0,128,93,3,0,34,131,201,2,138,56,0,134,12,1,0,124,128,143,1,129,
+38,0,133,157,0,129,112,2,130,4,5,133,162,3,128,184,0,136,56,0,0,47,131,27,
+0,129,26,1,140,144,1,1,124,40,133,222,0,129,175,1,1,96,34,137,155,1,130,148,
+4,134,85,0,138,0,0,0,96,128,186,2,128,2,0,3,32,10,10,10,7,32,32,95,
+46,46,95,95,32,160,0,0,5,95,95,95,10,32,47,130,10,0,1,96,46,152,49,0,
+3,44,45,45,34,128,0,0,129,38,0,4,34,45,46,10,124,134,24,0,1,96,46,146,
+86,0,4,46,39,34,34,47,135,27,0,2,124,47,96,138,53,0,145,55,0,1,44,43,
+128,20,0,3,46,39,32,124,128,1,0,132,53,0,4,39,46,46,46,43,133,55,0,0,
+92,132,21,0,133,7,0,132,0,0,3,47,32,47,92,128,197,0,4,95,44,39,32,39,
+131,209,0,128,70,0,128,203,0,1,44,34,134,112,0,0,46,132,107,0,137,57,0,128,
+46,0,133,15,0,128,115,0,2,44,45,34,128,15,0,128,147,0,128,129,0,128,73,0,
+0,96,135,171,0,128,74,0,140,59,0,132,45,1,3,45,46,46,45,128,51,0,128,29,
+0,128,108,1,128,97,0,0,124,133,62,1,1,92,10,130,135,0,129,0,0,2,39,32,
+96,138,60,0,131,58,0,132,80,1,1,34,34,128,165,0,128,0,0,128,60,0,131,123,
+0,131,60,0,132,50,0,130,34,1,131,20,0,131,61,0,134,84,0,130,186,0,1,32,
+95,128,145,1,131,0,0,130,37,0,131,41,0,1,76,10,128,9,0,135,98,1,131,21,
+0,129,62,0,0,106,137,189,0,0,46,128,64,0,1,44,34,130,181,0,128,59,0,128,
+1,0,132,36,0,0,124,128,61,0,136,151,1,130,13,1,130,25,0,134,183,1,0,47,
+128,123,0,0,47,128,47,1,0,44,129,152,1,128,243,0,4,96,46,92,32,92,129,29,
+0,128,39,0,130,61,0,140,63,0,130,62,0,133,61,0,0,106,128,14,0,128,60,0,
+2,46,39,46,129,251,0,0,46,129,25,0,128,234,1,129,29,0,128,3,0,132,61,0,
+139,63,0,128,11,0,1,92,39,132,15,0,129,21,2,129,46,0,0,124,129,15,0,1,
+46,44,129,131,0,128,249,1,129,9,1,137,61,0,130,151,1,136,127,0,0,58,132,121,
+1,133,61,0,128,217,1,129,115,1,128,131,0,130,63,0,131,24,1,136,61,0,131,64,
+0,131,200,1,129,8,0,132,62,0,128,133,0,129,141,0,129,2,0,130,175,1,129,61,
+0,129,136,1,129,18,1,138,60,0,131,55,0,128,26,2,129,0,0,0,45,133,61,0,
+130,202,0,128,59,0,131,21,0,129,105,2,131,195,1,143,59,0,143,32,3,129,133,1,
+128,79,0,130,225,2,128,59,0,129,89,3,130,62,0,153,58,0,2,32,32,62,131,60,
+0,0,39,130,138,0,130,58,0,130,172,2,128,61,0,0,34,153,56,0,129,149,0,128,
+190,0,0,44,139,59,4,128,106,2,128,248,3,129,192,3,149,68,4,131,92,0,132,164,
+2,0,96,128,117,0,131,0,0,128,233,0,133,206,1,150,61,0,130,206,0,135,214,2,
+141,0,0,134,118,3,128,146,3,146,62,0,143,71,0,146,70,1,129,33,0,146,64,0,
+132,157,2,146,124,0,134,66,0,131,14,1,139,39,2,137,239,1,0,45,133,255,0,151,
+67,0,0,34,128,14,1,3,32,10,10,10,0,32,137,0,0,2,95,95,95,129,5,0,
+7,44,45,39,34,34,45,46,10,136,25,0,9,47,96,46,32,32,96,46,47,44,92,129,
+8,0,129,10,0,136,29,0,4,47,39,46,32,124,128,6,0,2,32,124,124,129,7,0,
+129,0,0,136,30,0,8,46,32,96,124,44,43,45,39,124,128,7,0,133,30,0,128,63,
+0,0,95,135,33,0,0,96,128,112,0,131,20,0,128,31,0,130,9,0,133,36,0,134,
+35,0,2,44,39,32,131,35,0,128,21,0,0,34,136,34,0,138,37,0,3,47,34,96,
+45,130,157,0,146,0,0,134,39,0,0,58,130,194,0,0,92,150,40,0,133,188,0,0,
+39,128,50,0,129,37,0,152,41,0,0,96,130,41,0,0,46,129,80,0,1,46,96,129,
+15,0,138,111,0,143,84,0,0,47,128,21,0,128,189,0,130,43,0,132,30,0,131,6,
+0,139,99,0,0,92,128,43,0,1,47,96,128,36,0,129,40,0,0,96,129,27,0,132,
+44,0,131,38,0,142,88,0,0,106,128,5,0,128,26,0,1,46,58,128,3,0,128,94,
+0,128,6,0,135,39,0,139,44,1,3,124,10,32,124,128,152,0,0,46,128,105,1,128,
+138,1,0,58,128,3,0,133,145,1,5,32,44,46,46,45,45,128,151,1,139,44,0,128,
+34,0,1,124,58,131,40,0,128,86,0,132,44,0,128,141,1,133,34,0,138,44,0,128,
+83,0,1,58,58,131,40,0,135,44,0,136,34,0,137,44,0,3,58,39,106,32,128,19,
+2,129,89,0,136,134,0,148,44,0,3,96,47,32,46,128,228,0,0,44,128,85,0,135,
+44,0,135,133,0,136,119,1,128,44,0,2,32,92,47,128,104,1,0,46,129,249,0,1,
+39,44,131,44,0,129,21,1,136,94,1,133,8,0,0,39,128,44,0,4,96,32,44,32,
+47,129,74,0,0,47,128,46,1,128,99,0,136,120,0,137,160,1,1,32,47,129,191,1,
+128,189,1,0,47,130,240,2,132,88,1,128,43,0,140,140,1,130,151,0,131,63,2,129,
+20,2,131,46,0,132,241,2,130,7,0,134,0,0,129,114,0,132,145,2,1,96,46,130,
+203,0,133,31,0,136,129,0,1,95,95,128,25,0,0,46,132,80,0,129,41,0,2,45,
+46,95,128,211,0,137,98,2,4,95,44,46,45,34,130,180,3,137,176,3,4,32,96,43,
+46,46,128,207,3,130,206,1,132,50,3,136,71,0,129,55,0,130,110,0,128,107,0,5,
+96,34,34,34,39,39,130,20,1,132,32,0,130,82,0,132,50,1,134,44,1,131,149,0,
+128,154,2,1,95,46,133,138,3,139,33,1,133,183,0,1,96,10,135,161,0,141,205,1,
+135,255,3,1,10,96,136,105,2,128,230,0,132,3,4,139,178,2,130,179,3,0,96,128,
+141,4,0,39,129,1,0,147,117,0,141,111,4,149,122,0,134,30,2,148,0,0,138,93,
+0,133,153,1,147,72,4,135,149,4,152,38,0,130,172,1,0,46,128,73,1,2,39,32,
+10,0,32,155,0,0,18,95,95,44,46,45,34,34,34,39,34,45,45,46,46,46,95,46,
+44,45,128,8,0,0,10,153,49,0,2,44,45,39,140,18,0,0,47,131,6,0,0,96,
+151,55,0,1,95,46,141,51,0,2,32,32,44,129,18,0,0,44,128,124,0,2,96,46,
+124,148,56,0,130,34,0,146,0,0,3,47,32,44,43,128,56,0,0,59,146,56,0,130,
+54,0,0,95,128,0,0,143,26,0,3,46,32,124,95,128,174,0,0,47,145,55,0,128,
+23,0,1,46,34,130,113,0,2,96,45,46,140,27,0,0,96,128,221,0,3,46,45,47,
+96,128,23,0,0,95,144,59,0,128,53,0,132,4,1,142,111,0,130,78,0,0,45,130,
+51,1,1,96,58,146,35,1,129,119,0,130,182,0,130,11,1,137,60,0,139,254,0,0,
+92,128,150,0,1,96,43,128,35,0,128,37,0,142,69,0,129,126,0,0,124,130,50,0,
+3,44,34,34,46,128,9,0,140,180,1,128,220,1,1,44,46,130,16,1,0,76,129,39,
+0,0,96,148,177,1,130,197,0,128,31,0,4,124,32,46,95,41,133,212,0,0,92,131,
+194,1,0,45,131,28,1,129,0,0,129,167,0,2,124,32,106,136,170,0,140,72,0,131,
+26,0,128,101,0,0,39,129,77,0,135,199,1,131,60,2,128,154,1,128,143,0,129,111,
+2,129,58,0,1,124,34,136,56,0,141,10,2,135,201,0,2,96,45,43,135,70,0,128,
+9,0,2,95,44,34,128,70,0,128,90,1,128,190,2,129,25,1,1,46,124,138,245,0,
+141,72,0,145,74,2,129,70,0,2,44,39,46,131,208,2,129,48,2,129,51,2,3,96,
+46,96,124,130,241,0,146,72,0,0,46,137,172,0,136,53,1,1,44,34,131,117,2,2,
+44,34,43,129,147,0,128,0,0,0,43,128,72,0,0,58,137,146,0,137,72,0,132,17,
+1,139,102,2,128,20,0,128,127,3,129,25,0,1,46,34,130,148,0,129,37,1,128,34,
+1,3,96,32,92,39,130,47,0,132,46,0,134,245,2,2,95,44,43,138,129,3,133,71,
+0,128,2,0,130,17,0,128,219,0,128,82,0,1,45,34,128,227,3,129,214,3,3,43,
+32,96,55,129,244,1,130,249,1,128,18,2,0,39,132,71,0,128,43,0,130,94,0,140,
+110,3,128,39,0,0,39,129,43,0,1,44,34,128,244,0,1,46,58,128,153,0,132,81,
+3,1,58,124,132,222,1,0,45,128,165,0,131,67,0,130,16,0,128,53,1,1,47,124,
+131,89,2,135,137,0,0,47,129,137,0,0,46,128,90,0,131,140,0,128,179,1,130,128,
+0,1,124,124,130,57,0,1,44,45,131,193,0,1,96,34,128,233,1,137,117,1,128,56,
+0,129,38,0,129,61,0,2,47,44,34,131,60,0,128,32,0,128,34,0,130,56,0,137,
+240,0,130,24,0,133,0,0,0,58,128,138,0,129,141,3,129,55,0,129,88,3,132,211,
+0,128,27,2,2,44,34,10,138,54,0,130,11,0,134,56,0,0,124,128,213,0,128,198,
+0,128,101,0,0,106,130,74,3,4,124,95,46,34,41,128,191,0,3,59,60,95,10,138,
+165,1,131,27,4,133,167,3,0,58,129,89,0,129,3,0,0,124,131,233,3,128,36,4,
+128,169,0,130,184,3,5,96,39,45,46,95,10,140,137,3,131,14,0,131,61,0,128,52,
+0,0,58,129,76,1,128,209,0,135,167,3,136,130,1,128,157,3,146,61,0,1,32,47,
+128,131,0,128,69,1,2,96,58,46,128,24,2,129,175,2,128,37,2,128,9,3,0,39,
+132,12,2,134,63,0,0,10,136,139,1,129,113,0,0,70,133,147,1,129,67,0,10,34,
+96,43,45,43,46,94,43,45,45,96,128,64,3,132,112,0,138,49,5,128,175,2,134,142,
+4,129,121,0,131,60,1,131,5,0,141,31,5,135,179,0,135,66,0,130,100,5,131,16,
+0,129,127,4,138,98,2,150,216,5,129,10,2,129,137,6,134,89,2,128,15,0,134,114,
+3,133,190,1,0,106,141,182,4,135,54,1,141,246,3,136,241,1,140,26,0,136,189,4,
+0,32,133,107,0,142,116,4,141,41,6,135,25,0,140,24,0,134,128,0,141,90,6,128,
+0,1,129,100,7,2,39,32,10,0,32,180,0,0,1,95,10,177,52,0,5,44,32,45,
+34,39,124,173,58,0,3,95,46,45,39,128,6,0,2,44,39,106,149,57,0,0,95,128,
+0,0,138,103,0,0,46,129,0,0,130,53,0,128,0,0,2,47,32,32,149,115,0,1,
+96,46,129,4,0,6,39,45,45,46,46,44,45,128,155,0,139,29,0,129,28,0,150,173,
+0,130,58,0,149,0,0,0,124,153,57,0,1,32,46,152,59,0,2,92,32,32,143,230,
+0,2,95,46,44,130,7,0,128,159,0,151,57,0,0,96,142,113,0,2,46,39,44,133,
+209,0,0,46,130,146,0,151,117,0,138,57,0,1,44,34,129,51,1,134,231,0,135,11,
+0,158,58,0,128,42,0,137,45,0,146,57,0,0,44,133,151,1,138,59,0,129,169,0,
+0,106,136,37,0,128,11,0,1,46,46,137,212,1,132,35,0,135,0,0,1,76,46,135,
+132,2,130,104,0,137,225,0,131,11,0,137,103,1,139,60,0,130,14,0,2,96,45,46,
+133,65,0,131,40,0,143,65,0,136,67,0,138,121,1,0,95,134,78,0,0,96,134,67,
+0,131,49,0,137,67,0,135,127,0,0,96,142,10,3,135,5,1,138,9,1,132,184,0,
+138,68,1,128,167,0,144,70,1,0,34,142,93,1,140,138,0,1,95,46,128,76,2,135,
+78,1,129,32,0,128,231,2,133,83,1,129,81,2,1,46,39,145,22,2,0,59,133,69,
+0,128,161,0,130,230,0,134,70,0,134,44,0,128,254,0,130,146,0,133,33,0,142,13,
+3,1,46,39,134,155,1,0,43,130,188,3,2,46,45,94,132,34,0,129,132,0,128,160,
+3,2,45,39,47,128,70,0,1,94,45,129,0,0,0,43,133,61,0,0,96,134,158,0,
+129,32,1,134,66,0,3,46,43,45,45,131,26,0,128,60,0,131,33,0,0,76,129,6,
+0,2,106,45,34,136,253,0,129,37,1,128,54,0,0,92,128,69,0,129,205,3,135,62,
+0,132,193,0,132,84,1,2,96,34,45,129,146,0,128,46,0,140,238,3,2,32,34,34,
+128,167,0,128,150,0,128,73,3,132,35,1,0,10,129,89,4,132,146,0,0,76,137,152,
+1,133,123,1,128,106,0,128,158,4,128,0,0,131,88,1,131,170,4,129,28,0,0,70,
+132,101,2,1,124,10,131,99,4,130,225,0,131,86,0,131,78,1,131,64,1,133,70,0,
+1,34,34,128,149,0,2,46,45,96,132,130,4,130,5,0,0,124,128,52,0,129,93,1,
+129,214,3,134,68,0,132,153,0,129,140,0,3,95,44,43,92,138,247,4,139,56,2,129,
+102,0,1,124,47,132,26,3,130,11,1,130,120,0,0,43,133,185,2,128,73,0,131,9,
+0,0,96,128,143,4,137,70,0,136,203,1,128,35,0,0,124,132,123,4,131,66,0,129,
+27,0,135,54,1,0,124,128,41,4,135,109,0,137,3,2,0,124,132,11,0,1,95,44,
+135,96,2,0,47,132,144,1,137,220,2,141,113,3,134,9,2,0,47,128,14,0,128,204,
+1,129,169,1,134,35,0,133,64,0,135,144,2,138,64,0,131,52,1,0,92,131,65,0,
+2,47,45,39,129,156,0,138,24,4,135,88,5,135,64,0,136,158,0,130,3,1,2,124,
+32,92,130,62,2,1,34,46,129,218,0,131,29,0,133,151,4,136,95,5,135,64,0,1,
+92,32,130,248,1,132,79,4,129,4,0,2,44,124,47,128,52,2,4,46,92,44,45,46,
+130,63,0,134,167,3,136,145,2,135,3,1,1,96,39,128,119,2,134,70,1,128,8,2,
+139,23,4,136,161,0,134,221,3,131,135,1,0,44,131,42,0,154,215,5,128,141,0,0,
+43,133,192,5,139,29,6,132,172,1,141,2,3,148,203,6,129,208,2,140,92,6,0,41,
+158,123,0,137,42,1,134,186,1,133,107,1,128,163,7,160,123,0,129,62,0,129,40,0,
+0,10,0,32,147,0,0,2,46,45,10,148,25,0,2,124,32,92,140,17,0,1,95,44,
+148,43,0,0,106,128,3,0,137,44,0,4,44,45,39,32,124,148,43,0,0,124,129,4,
+0,133,44,0,2,44,39,39,129,131,0,0,39,153,43,0,131,44,0,0,44,130,40,0,
+128,18,0,135,42,0,2,46,45,96,128,16,0,132,11,0,130,42,0,3,95,95,92,95,
+130,40,0,1,32,44,128,2,0,133,41,0,130,17,0,131,74,0,129,8,0,128,9,0,
+1,34,34,134,55,0,128,27,0,0,47,132,40,0,131,76,0,0,43,132,83,0,1,44,
+34,130,72,0,133,39,0,128,3,0,0,47,130,97,0,0,95,130,45,0,3,44,45,46,
+92,128,15,1,0,96,129,63,0,131,110,0,3,95,95,46,95,133,45,0,128,151,0,129,
+128,0,130,119,0,130,46,0,128,62,0,0,96,129,13,0,129,66,0,130,5,0,0,60,
+133,151,0,0,32,130,52,0,0,92,133,72,0,3,96,45,44,46,128,97,0,6,44,92,
+95,124,96,46,44,128,224,0,131,22,0,0,47,128,81,0,2,96,45,94,128,86,1,1,
+32,95,131,234,0,2,46,45,34,129,201,0,132,194,0,128,28,0,2,46,10,96,129,119,
+0,0,47,128,42,0,0,96,133,149,1,128,86,0,132,1,1,1,124,41,129,44,0,0,
+44,128,74,1,128,87,0,132,90,1,3,44,46,45,45,128,121,1,129,90,0,2,39,96,
+47,131,154,0,130,24,0,0,96,129,43,0,1,46,58,129,197,1,130,17,0,131,133,0,
+1,96,46,128,252,0,2,96,34,32,129,172,1,5,96,46,124,62,44,39,133,197,1,128,
+32,0,129,148,0,131,65,0,128,36,0,0,95,128,47,0,130,155,0,128,149,0,1,32,
+62,130,223,0,3,44,95,46,46,129,216,0,128,159,0,0,32,129,158,0,131,58,0,1,
+44,39,128,99,0,0,124,129,56,0,3,34,39,45,34,129,36,1,128,89,0,131,159,0,
+3,44,45,34,34,128,36,0,131,35,1,128,24,0,4,34,46,10,32,40,129,97,0,0,
+58,130,86,0,8,95,44,47,32,47,44,39,96,46,128,18,0,1,39,34,128,15,0,130,
+198,0,128,2,0,4,96,45,45,46,46,128,5,2,128,187,0,133,59,0,130,128,0,132,
+227,1,0,39,130,92,0,1,46,39,128,27,0,0,47,128,121,0,130,91,1,129,241,0,
+130,60,0,0,46,128,194,1,0,95,128,213,1,3,39,46,34,124,137,252,1,135,62,0,
+131,8,2,0,96,129,61,0,131,41,1,1,32,47,131,36,1,128,170,0,129,67,0,0,
+32,128,124,0,129,16,0,1,124,34,135,154,2,130,118,0,135,181,2,128,160,0,0,39,
+128,187,0,130,10,0,0,43,132,97,1,132,64,0,134,51,0,130,7,0,137,65,0,0,
+96,138,32,3,0,39,132,170,2,131,96,1,129,42,1,128,244,0,0,43,129,67,0,132,
+221,0,132,59,0,130,7,2,129,9,0,128,202,3,137,64,0,128,248,0,134,14,3,129,
+103,0,2,92,44,34,128,12,2,128,46,0,3,39,32,39,95,130,191,0,133,161,1,129,
+4,0,129,42,0,140,206,3,128,29,1,132,111,3,128,67,2,128,39,3,128,253,1,0,
+39,129,87,2,0,46,132,113,2,131,221,1,130,5,0,129,178,3,130,137,1,139,64,0,
+130,129,0,135,65,2,0,32,129,245,1,0,86,129,42,0,131,152,0,132,158,0,131,187,
+0,128,125,0,128,165,1,139,36,4,128,162,2,130,55,2,129,149,2,133,114,3,0,95,
+128,42,0,128,22,0,130,59,0,132,64,0,129,6,0,128,39,0,130,148,1,129,45,0,
+128,68,2,140,71,1,132,128,1,0,47,128,150,1,1,45,39,128,133,0,128,79,0,129,
+204,0,0,44,128,81,1,137,67,0,132,134,3,131,61,1,139,173,4,130,246,0,134,103,
+4,130,118,1,2,92,47,32,128,227,1,130,126,1,132,159,0,128,26,0,132,30,0,130,
+135,3,143,30,5,128,133,1,130,181,1,134,17,1,129,78,1,136,184,4,128,13,4,129,
+209,2,132,13,0,0,39,131,57,2,139,55,5,128,186,1,128,48,4,0,45,129,140,5,
+128,23,2,128,137,2,134,33,2,132,5,0,130,138,1,128,195,0,134,89,2,128,161,0,
+138,86,1,0,46,128,254,1,2,39,43,34,128,209,1,129,180,0,128,220,1,1,39,45,
+132,75,4,128,64,0,128,191,3,129,63,4,1,32,124,132,32,2,131,18,0,128,215,3,
+137,65,0,128,102,1,128,17,0,0,124,129,21,3,0,96,138,64,5,131,239,3,1,95,
+46,130,6,5,128,47,4,132,71,5,163,0,0,129,176,0,129,244,3,130,89,6,168,55,
+0,128,169,3,0,46,129,89,2,0,96,129,173,3,169,55,0,129,101,4,131,162,3,150,
+155,6,150,170,0,2,39,32,10,0,32,171,0,0,4,95,44,39,124,10,170,49,0,4,
+46,39,32,32,47,146,50,0,1,95,95,146,48,0,0,44,128,48,0,1,32,39,145,49,
+0,0,96,128,2,0,0,46,146,96,0,148,48,0,1,32,92,129,53,0,139,50,0,130,
+94,0,149,47,0,130,48,0,138,49,0,0,44,131,6,0,147,193,0,128,124,0,131,152,
+0,133,48,0,0,47,132,52,0,148,45,0,131,122,0,128,53,0,5,46,95,95,46,46,
+47,131,14,0,149,90,0,131,139,0,2,32,44,34,130,15,1,133,110,0,128,55,0,0,
+95,150,128,1,128,49,0,132,222,0,133,0,0,0,124,130,14,0,1,96,34,152,52,0,
+1,32,124,132,181,0,135,243,0,2,45,45,45,128,102,0,130,216,0,149,54,0,2,44,
+45,124,140,6,1,133,120,0,1,96,45,128,13,0,0,92,147,55,0,129,157,0,131,55,
+0,129,87,1,130,171,0,0,58,137,31,1,2,95,95,92,148,168,0,128,53,0,1,47,
+44,129,146,0,128,172,0,1,44,85,130,67,0,138,233,0,129,17,0,128,85,1,147,60,
+0,0,96,128,105,0,2,96,46,92,128,3,0,3,47,46,46,45,128,55,0,128,122,2,
+131,93,1,135,60,0,128,195,1,151,237,0,3,96,34,44,95,129,129,0,132,145,1,129,
+45,0,0,96,130,32,1,130,252,0,131,209,0,1,92,32,149,25,3,3,47,32,47,95,
+128,36,0,2,106,32,32,128,88,1,0,39,133,50,2,1,95,96,128,13,0,1,45,45,
+128,73,0,132,131,0,148,62,0,128,61,0,4,47,32,44,124,96,128,182,0,1,96,45,
+128,51,2,133,108,2,4,96,34,47,45,43,128,79,0,133,87,1,145,189,0,2,95,44,
+46,128,251,0,0,124,128,67,0,0,124,129,38,3,0,45,128,39,0,128,247,0,133,250,
+0,2,92,32,39,131,196,0,131,215,0,128,127,0,0,46,128,248,1,134,57,0,0,45,
+130,121,2,3,96,124,32,76,128,41,0,0,92,128,50,1,1,44,94,129,183,2,128,61,
+0,129,130,0,0,95,128,37,2,128,196,0,2,44,62,43,131,80,1,3,44,45,39,10,
+130,203,1,129,93,0,137,133,2,128,29,1,0,124,137,109,1,0,47,129,97,0,129,205,
+0,130,195,1,128,12,0,128,7,1,128,162,0,1,92,10,130,18,0,0,124,128,89,2,
+0,46,128,138,1,129,12,0,129,98,0,0,39,130,75,0,134,62,0,129,197,1,136,0,
+0,0,55,132,98,0,1,44,46,128,112,2,129,145,1,129,79,0,128,154,1,130,150,1,
+0,62,130,139,2,0,45,130,32,0,3,45,46,34,34,130,213,2,0,45,134,63,0,1,
+95,62,131,120,1,129,84,0,128,187,0,131,8,0,128,108,0,2,124,32,108,130,192,0,
+0,44,128,63,0,134,194,0,128,91,0,128,226,0,0,46,128,0,0,0,92,131,50,1,
+129,253,0,128,93,0,129,54,0,0,106,128,31,0,3,46,39,124,95,130,98,1,0,47,
+135,212,4,129,85,1,129,53,2,133,109,1,0,96,128,129,0,128,176,1,130,254,0,0,
+32,129,75,0,130,173,2,0,124,128,7,2,0,39,128,42,0,132,22,3,128,119,0,128,
+24,0,6,44,46,39,34,34,34,39,137,235,0,129,37,1,132,94,3,131,241,4,129,213,
+3,131,241,1,5,34,45,39,95,44,43,131,45,0,1,39,94,130,240,0,132,78,0,138,
+229,2,138,152,0,132,216,0,136,50,2,1,124,95,135,23,0,136,31,3,143,112,5,131,
+253,2,129,6,1,1,44,39,146,50,3,2,95,46,58,128,201,3,133,226,1,129,126,3,
+144,68,0,130,115,3,129,34,0,144,246,2,128,235,0,129,230,0,0,96,128,104,3,132,
+177,0,128,16,0,142,128,4,134,17,0,146,56,3,129,93,3,0,39,130,97,3,129,0,
+0,139,21,5,131,0,0,1,34,34,128,215,1,0,35,132,134,2,171,212,6,137,10,1,
+0,95,132,34,6,2,32,96,58,153,101,5,158,72,0,129,16,1,128,251,1,130,25,1,
+183,143,0,129,142,2,133,86,3,128,108,2,132,216,2,178,0,0,128,85,3,0,46,150,
+211,4,163,27,1,2,32,96,59,184,63,0,130,32,2,0,10,0,32,148,0,0,6,44,
+46,34,45,45,46,10,144,25,0,4,95,46,46,46,47,131,9,0,2,92,34,34,145,35,
+0,0,47,128,30,0,1,44,39,130,69,0,0,34,131,17,0,0,58,142,36,0,0,46,
+128,31,0,129,69,0,1,46,58,130,40,0,128,76,0,1,95,124,142,36,0,1,124,124,
+129,2,0,2,32,47,44,131,119,0,129,76,0,0,39,143,111,0,132,37,0,129,3,0,
+131,117,0,129,0,0,0,96,142,39,0,0,47,134,39,0,135,37,0,130,137,0,140,40,
+0,6,47,46,96,124,32,47,96,128,2,0,129,39,0,1,95,95,135,25,0,0,39,139,
+41,0,0,106,128,42,0,3,32,34,32,96,128,150,0,0,39,129,121,0,2,47,96,46,
+134,146,0,139,41,0,2,124,124,46,128,120,0,132,110,0,128,14,0,128,4,0,132,42,
+0,2,95,124,44,128,102,1,0,95,141,46,0,0,35,134,46,0,129,176,0,2,32,35,
+39,129,15,0,1,44,45,132,77,1,1,32,96,140,117,1,2,47,39,46,129,217,0,134,
+49,0,0,92,128,42,1,129,55,1,138,85,0,0,96,137,50,0,130,26,0,136,44,1,
+0,45,128,0,0,129,93,0,1,124,96,135,169,0,141,199,0,0,92,129,40,0,130,213,
+1,138,63,1,1,32,96,130,26,0,147,51,0,128,49,0,0,95,129,0,0,137,63,2,
+1,44,45,128,63,0,128,23,0,1,44,46,149,47,1,128,83,1,128,26,0,3,96,39,
+45,46,128,61,0,1,46,46,129,47,0,128,54,0,128,164,0,0,39,128,22,0,133,52,
+0,142,46,2,2,44,45,94,128,74,1,133,100,0,132,54,0,131,131,0,133,211,0,138,
+193,1,131,136,0,129,73,0,2,39,34,34,128,2,0,140,130,0,128,51,0,0,96,130,
+215,0,0,92,133,52,0,0,95,135,82,0,130,102,1,137,229,0,128,198,1,134,21,0,
+134,53,0,128,133,0,130,89,0,128,200,0,132,151,0,132,63,0,132,41,2,132,202,0,
+0,106,136,27,0,128,54,0,138,182,1,130,63,1,1,47,46,131,250,1,1,46,95,128,
+249,1,128,73,0,0,92,130,56,0,132,129,0,131,6,0,1,76,10,128,54,0,140,105,
+1,0,47,128,50,1,130,84,0,0,46,129,70,0,0,32,128,136,0,128,222,1,130,175,
+1,135,55,0,128,69,1,131,140,0,0,96,128,202,3,133,27,2,128,25,1,131,13,1,
+129,54,0,0,96,128,193,0,129,53,0,0,46,132,229,1,131,194,0,130,73,1,133,246,
+1,0,96,129,251,0,1,46,34,138,22,2,1,34,96,128,82,2,0,39,129,33,0,0,
+96,129,175,2,0,95,131,213,0,0,47,130,75,1,129,26,0,129,0,0,129,112,0,138,
+71,1,137,107,2,130,53,0,132,145,0,139,234,1,0,92,133,49,1,142,84,4,134,52,
+1,2,46,46,44,140,173,3,130,208,1,147,107,0,141,72,2,139,222,2,153,41,0,134,
+113,0,141,107,4,144,42,0,130,123,1,144,41,0,130,101,1,143,45,0,132,199,0,138,
+61,3,0,47,132,194,0,129,25,1,147,49,0,133,8,0,0,89,134,37,3,135,116,0,
+143,18,5,134,51,0,131,79,1,133,206,1,1,39,46,128,12,2,128,123,3,129,66,3,
+139,50,0,134,50,3,140,125,2,140,27,1,137,39,3,133,34,0,136,52,4,137,136,0,
+140,107,1,132,148,2,139,1,3,135,45,0,135,66,1,0,95,129,225,3,132,138,2,139,
+87,1,138,121,1,128,41,1,129,217,4,140,176,4,130,87,4,132,71,0,140,91,2,150,
+0,0,0,96,128,62,3,128,71,0,0,10,0,32,135,0,0,9,44,45,34,34,34,44,
+46,45,45,10,135,18,0,3,58,45,39,95,128,17,0,128,24,0,0,92,133,21,0,10,
+44,34,47,44,45,39,32,32,95,44,46,128,25,0,2,43,45,46,132,24,0,4,46,44,
+39,47,32,128,44,0,128,26,0,132,0,0,133,50,0,3,124,124,124,44,129,70,0,0,
+46,135,107,0,2,92,32,95,128,0,0,133,31,0,7,46,39,44,39,85,124,32,124,134,
+30,0,132,69,0,0,96,132,92,0,1,44,34,129,37,0,3,95,76,58,47,134,152,0,
+135,101,0,1,32,96,130,36,0,0,106,136,201,0,131,0,0,134,44,0,132,83,0,129,
+37,0,0,92,129,118,0,128,0,0,0,46,128,187,0,0,55,129,21,0,137,54,0,128,
+23,0,1,32,124,130,112,0,2,86,32,86,131,61,0,1,95,46,130,104,0,130,153,0,
+128,240,0,0,45,128,0,0,4,32,44,95,96,34,133,245,0,1,44,47,130,74,0,129,
+159,0,128,84,0,0,45,128,39,0,130,11,0,2,32,96,44,129,236,0,3,96,96,46,
+39,131,157,0,129,165,0,0,46,128,48,1,129,0,0,131,32,0,128,31,0,0,124,128,
+6,1,129,10,0,0,43,128,12,0,0,96,129,19,1,133,74,1,128,149,0,138,188,0,
+4,96,46,47,32,92,131,43,0,0,32,128,55,0,128,10,0,0,46,135,43,0,137,55,
+1,132,46,0,1,32,96,130,44,0,1,32,92,128,188,0,128,3,0,0,92,131,212,0,
+145,43,0,0,124,128,91,0,2,96,43,46,136,110,0,134,231,1,1,96,32,136,99,1,
+133,4,1,1,96,34,128,171,1,128,6,0,128,95,0,0,96,128,15,0,0,41,134,42,
+2,0,92,131,203,0,133,107,1,131,58,0,0,46,128,250,1,130,255,1,128,2,0,1,
+46,39,135,86,2,2,96,62,96,132,12,1,129,80,1,2,45,34,39,128,95,2,1,34,
+92,129,80,0,2,32,124,39,129,46,2,135,42,0,8,47,32,46,124,124,68,46,92,92,
+128,64,0,6,92,32,40,41,32,40,95,128,3,0,0,92,128,42,0,0,106,129,3,0,
+0,47,135,42,0,3,47,32,43,44,130,105,0,1,124,124,133,226,1,130,0,0,128,38,
+0,128,22,0,128,71,0,132,128,0,11,95,44,39,46,34,39,95,124,92,46,39,47,129,
+113,0,1,95,44,128,130,0,1,46,95,132,225,0,128,185,0,0,44,129,40,0,128,34,
+0,129,106,1,4,32,39,34,106,45,128,68,0,129,21,0,0,32,128,248,0,131,185,1,
+129,222,0,128,2,0,128,123,0,128,55,1,0,44,129,3,0,0,39,128,232,1,133,116,
+2,133,75,1,134,163,2,129,2,2,128,129,0,2,124,32,44,129,200,1,129,43,1,130,
+215,0,134,94,1,135,147,1,0,124,130,41,0,128,192,0,0,124,128,40,0,130,65,2,
+0,46,138,10,2,129,53,2,133,51,0,128,123,1,1,96,45,128,94,2,1,43,39,133,
+33,0,128,204,1,136,205,3,128,26,0,128,207,2,129,0,0,0,89,131,248,0,128,112,
+0,133,74,0,129,246,1,137,170,1,128,23,0,1,96,34,128,134,1,131,40,0,128,143,
+0,132,155,0,130,32,1,0,32,128,71,0,131,7,3,130,25,1,134,135,0,1,47,32,
+128,165,3,135,145,0,129,29,1,133,236,2,130,67,0,133,108,0,129,95,2,135,230,0,
+138,34,0,134,51,2,132,186,0,133,191,0,134,132,2,129,33,0,133,98,0,0,124,128,
+170,2,131,19,1,132,15,0,135,37,2,129,71,0,131,22,0,128,84,0,128,105,3,135,
+43,1,136,117,2,131,143,0,128,83,4,131,137,0,132,70,0,128,114,0,0,47,128,35,
+0,130,49,2,136,187,4,130,30,0,128,42,2,131,12,0,3,45,45,92,10,128,11,0,
+0,46,128,197,4,1,44,95,135,198,4,2,95,95,58,130,204,3,136,137,4,2,124,32,
+40,128,94,0,0,40,137,84,5,128,3,0,128,113,2,128,60,1,133,57,0,7,124,10,
+96,45,96,45,94,45,128,4,0,132,0,0,2,39,95,95,128,180,2,128,53,0,129,168,
+2,131,146,2,132,139,1,143,0,0,1,34,34,128,47,0,129,145,2,0,10,0,32,141,
+0,0,9,95,95,46,34,96,46,32,46,45,46,142,26,0,128,0,0,6,44,45,46,46,
+95,95,10,142,20,0,9,32,32,92,32,32,124,45,124,32,124,142,48,0,10,34,43,39,
+32,44,34,39,32,32,96,46,140,55,0,128,50,0,129,2,0,1,95,39,128,26,0,128,
+31,0,136,0,0,129,14,0,2,46,124,95,129,2,0,3,44,45,45,39,141,56,0,5,
+32,92,46,39,96,34,130,9,0,128,170,0,138,0,0,1,96,45,129,77,0,129,66,0,
+128,202,0,0,44,143,57,0,128,110,0,131,39,0,2,34,34,34,140,226,0,4,46,34,
+45,45,43,128,144,0,1,32,39,129,90,0,0,124,142,57,0,0,124,129,52,0,6,43,
+46,46,96,46,46,44,139,174,0,3,96,45,46,95,135,249,0,142,57,0,0,106,132,62,
+0,147,0,0,0,39,133,133,0,1,95,47,141,173,0,0,47,129,64,1,132,207,0,129,
+32,0,1,46,45,128,0,0,128,106,0,135,120,0,130,195,0,129,140,0,0,92,139,58,
+0,129,108,0,131,112,0,129,5,0,129,174,0,2,44,46,45,128,242,0,138,46,1,128,
+26,0,130,14,0,131,59,0,0,95,133,87,0,129,49,0,130,223,0,0,47,128,107,0,
+128,32,0,135,236,0,136,61,0,129,36,0,129,43,1,131,60,0,0,40,134,27,0,132,
+6,0,131,207,1,0,124,129,193,0,0,95,128,121,0,130,183,0,131,47,0,134,15,1,
+136,122,0,128,52,0,0,124,129,175,1,128,129,0,1,96,44,135,98,0,0,106,128,122,
+0,133,51,0,4,32,96,124,34,43,130,253,0,136,71,1,1,44,10,128,167,2,2,34,
+45,124,128,93,2,0,92,128,179,1,129,25,0,1,34,46,132,80,1,6,124,124,47,100,
+32,124,95,128,244,0,131,146,0,129,75,1,129,203,0,136,0,1,1,41,10,128,121,0,
+128,225,0,128,55,0,2,39,46,44,132,130,2,129,168,2,128,39,0,0,124,128,122,2,
+0,45,131,98,2,129,31,0,131,178,0,129,33,0,128,28,0,132,46,2,7,10,46,34,
+39,45,45,58,39,129,201,0,0,41,137,34,1,128,13,1,131,173,1,0,43,132,61,0,
+144,250,1,5,124,10,96,45,44,46,129,115,0,2,96,32,60,137,209,1,0,45,129,95,
+2,0,43,129,121,0,129,109,0,1,46,47,128,15,1,136,241,1,132,73,0,128,98,2,
+128,185,0,130,10,1,128,3,0,130,126,2,132,114,0,129,237,0,129,22,0,128,238,0,
+1,44,39,131,181,0,129,147,0,128,83,0,129,108,0,0,95,128,0,0,128,7,0,129,
+116,1,128,52,0,132,242,0,128,98,1,128,33,0,132,229,1,2,44,45,124,128,54,3,
+130,63,0,134,181,0,129,106,0,1,95,44,128,88,3,130,50,1,138,9,2,129,7,0,
+0,89,135,186,0,128,40,0,1,46,39,131,41,0,128,107,0,133,82,1,132,231,2,134,
+161,2,134,66,1,130,226,0,128,224,3,131,176,1,133,163,1,133,37,0,1,43,34,132,
+127,1,138,57,4,134,131,2,128,55,0,129,95,1,129,41,4,1,45,43,129,170,1,130,
+183,0,129,22,0,133,72,0,132,8,2,137,25,3,129,163,0,133,185,2,129,161,0,137,
+160,0,131,173,0,134,131,0,129,104,0,142,202,3,0,96,128,130,2,129,235,1,128,172,
+0,129,75,1,133,63,0,128,201,1,1,46,46,131,246,0,133,40,0,0,44,135,239,0,
+136,3,1,143,80,5,128,148,1,128,178,0,130,31,3,134,246,3,144,57,0,131,132,1,
+128,82,1,129,0,0,129,197,1,0,92,128,237,1,130,9,0,136,0,0,146,56,0,142,
+223,5,9,92,58,43,46,96,39,79,32,79,32,128,2,0,130,4,0,143,235,4,142,196,
+5,128,185,0,5,95,44,124,58,59,124,128,68,4,134,0,0,155,55,0,132,142,1,130,
+249,5,0,95,130,86,1,128,90,6,128,102,1,1,96,45,152,55,0,132,116,3,132,40,
+1,130,167,1,133,69,2,0,96,128,25,3,150,56,0,0,58,132,62,0,136,91,6,135,
+192,2,0,47,153,225,0,132,50,0,0,92,128,75,1,129,162,0,0,44,128,34,2,133,
+56,0,129,4,3,151,56,0,133,137,2,128,106,0,0,34,129,31,1,139,32,5,130,113,
+3,153,31,1,131,42,0,138,26,4,134,236,4,142,245,2,143,61,0,130,92,1,140,79,
+2,139,63,0,146,187,0,131,107,2,132,170,2,141,60,7,130,30,3,128,84,2,129,2,
+7,128,143,2,144,61,7,128,18,1,4,44,39,34,39,34,134,194,3,144,218,4,128,35,
+3,128,240,1,151,195,0,1,96,34,130,196,2,129,21,6,128,131,7,138,53,3,147,206,
+0,154,70,1,156,0,0,136,196,4,183,69,0,129,208,5,131,56,4,187,140,0,129,116,
+8,129,206,7,130,139,5,0,10,0,32,140,0,0,13,95,46,45,45,34,39,34,34,34,
+45,45,46,95,10,139,27,0,1,46,34,138,14,0,1,96,46,139,31,0,0,47,141,75,
+0,0,32,139,32,0,0,106,142,31,0,141,33,0,0,124,144,33,0,0,124,174,33,0,
+2,40,39,41,139,32,0,0,106,138,32,0,0,96,142,64,0,0,44,141,201,0,0,92,
+141,32,0,1,94,46,142,237,0,1,32,46,142,252,0,128,54,0,141,36,0,138,175,0,
+131,32,1,0,46,140,176,0,138,36,0,1,44,39,133,18,0,140,36,0,2,44,39,45,
+128,145,1,3,46,95,95,95,135,103,1,141,36,0,2,39,32,96,133,35,0,1,34,96,
+132,158,0,128,6,0,140,73,0,0,96,129,218,1,128,0,0,128,38,0,0,46,131,109,
+0,128,80,0,0,106,128,12,0,131,20,0,140,155,0,141,0,0,129,124,0,135,175,0,
+142,20,1,142,45,0,1,95,44,128,183,0,129,186,0,0,95,161,48,0,2,47,44,43,
+131,39,0,131,43,0,159,50,0,131,47,1,1,96,45,134,140,1,132,186,1,152,51,0,
+135,183,1,133,35,1,133,52,0,0,92,151,52,0,137,199,1,132,54,0,133,18,0,164,
+53,0,132,55,0,2,124,95,44,129,101,1,154,161,0,0,124,140,127,2,128,14,0,132,
+73,0,1,96,46,141,59,2,138,109,0,1,96,46,132,109,1,131,111,1,0,92,135,128,
+0,0,96,154,164,0,140,221,0,0,92,154,100,0,142,213,0,156,45,0,182,29,0,2,
+46,32,39,150,29,0,128,185,2,0,92,150,25,2,0,95,128,21,2,128,2,0,128,201,
+0,131,194,4,128,14,1,0,61,128,0,0,1,43,44,128,242,2,128,0,0,2,44,46,
+34,128,229,4,131,250,2,128,146,1,131,69,0,129,150,1,8,61,61,96,39,95,46,43,
+39,45,128,254,4,0,34,132,136,3,130,196,2,4,94,46,92,96,58,129,75,0,2,44,
+61,34,130,125,3,0,44,138,9,5,129,56,3,128,94,0,129,27,3,0,96,128,171,1,
+128,42,0,0,10,128,61,0,130,40,0,0,47,142,177,4,2,95,43,58,131,123,0,0,
+46,129,25,0,0,96,135,195,0,128,20,0,134,144,2,129,0,0,128,135,5,134,101,0,
+0,124,131,141,0,0,96,152,107,2,137,6,4,0,10,0,32,160,0,0,1,95,46,128,
+0,0,1,95,10,159,40,0,1,44,39,129,45,0,3,95,32,96,46,158,44,0,0,46,
+129,42,0,129,47,0,3,96,46,32,124,157,45,0,0,46,133,48,0,129,7,0,157,45,
+0,0,47,132,48,0,130,0,0,0,124,153,45,0,7,46,45,34,39,34,34,34,45,132,
+89,0,129,143,0,148,45,0,1,95,44,129,40,0,4,39,34,45,45,46,150,221,0,133,
+160,0,131,0,0,2,96,46,58,144,37,0,130,32,1,138,0,0,145,76,0,129,193,0,
+128,115,0,139,20,0,0,92,129,39,0,1,46,46,130,129,0,137,38,0,2,46,95,59,
+142,40,0,133,102,0,128,91,1,128,0,0,0,106,150,255,0,0,10,134,39,1,131,43,
+0,0,124,149,41,0,1,124,10,137,26,0,1,44,43,128,50,1,1,44,45,128,57,1,
+133,63,0,0,95,132,74,1,2,96,34,96,128,40,2,136,43,0,5,58,32,124,47,32,
+47,131,135,0,130,22,0,140,1,1,128,254,0,136,45,0,2,124,47,47,128,49,0,131,
+40,0,129,4,0,0,44,142,136,0,2,39,46,10,130,64,0,131,120,0,128,91,0,3,
+32,39,45,34,131,11,0,133,16,1,144,96,1,0,96,130,23,1,134,125,0,1,96,45,
+128,207,2,129,10,0,149,25,1,0,96,128,107,1,5,39,46,95,47,95,92,139,212,1,
+133,196,0,149,51,0,130,45,0,0,96,128,22,1,139,187,1,150,51,0,130,212,1,135,
+29,0,131,38,1,158,52,0,132,53,0,2,45,45,43,132,47,0,137,55,0,137,66,0,
+132,155,1,128,144,3,132,238,1,128,213,0,130,89,0,133,48,0,136,56,0,137,55,0,
+129,205,1,129,84,1,1,96,34,129,200,0,130,65,3,128,30,0,136,119,1,136,56,0,
+128,75,1,128,96,0,2,95,44,46,128,18,2,136,127,1,0,96,132,166,3,128,39,0,
+130,124,1,133,48,0,143,158,0,140,181,1,129,70,1,131,47,0,131,50,0,132,56,0,
+129,188,1,139,73,3,133,54,3,128,31,0,131,34,0,137,5,0,144,208,3,128,134,0,
+137,81,0,137,39,0,136,130,3,129,28,0,135,32,0,134,131,1,128,255,3,137,166,3,
+133,210,0,129,31,0,132,35,0,140,58,4,132,106,0,131,110,1,129,80,1,141,89,4,
+128,55,1,131,8,0,0,59,142,26,0,130,29,0,128,162,2,2,34,32,10,0,32,163,
+0,0,3,95,95,95,10,161,39,0,2,44,34,34,128,43,0,2,34,96,46,161,45,0,
+4,47,32,46,39,34,128,7,0,1,96,45,162,47,0,0,47,128,1,0,132,0,0,1,
+96,32,155,48,0,7,95,44,46,95,95,46,32,47,128,7,0,128,0,0,0,95,128,17,
+0,2,92,32,92,151,49,0,2,44,45,39,130,7,0,1,124,106,134,96,0,2,45,46,
+95,151,50,0,1,95,44,131,47,0,129,50,0,0,124,137,24,0,0,96,128,53,0,146,
+51,0,1,44,39,129,138,0,1,44,46,132,52,0,133,22,0,1,46,45,128,0,0,1,
+46,95,146,254,0,2,95,44,34,129,101,0,133,245,0,0,96,134,114,0,128,101,0,128,
+4,0,3,58,96,45,39,150,209,0,1,47,32,134,201,0,133,128,0,128,4,1,0,92,
+129,59,0,0,124,149,52,0,0,106,128,164,0,128,139,0,132,124,0,3,46,46,45,34,
+128,127,0,0,124,130,108,0,0,124,150,52,0,0,124,131,203,0,0,96,128,57,0,136,
+19,1,131,2,0,155,52,0,128,158,1,138,0,0,0,39,130,178,0,151,52,0,3,39,
+32,39,46,128,1,0,134,15,0,6,92,34,45,46,47,32,44,130,79,0,151,8,1,3,
+96,32,96,47,132,210,0,131,53,0,0,95,133,79,1,2,124,32,76,151,16,2,128,199,
+1,129,2,2,128,68,2,128,182,1,5,45,39,34,95,44,58,134,186,0,152,120,2,129,
+45,1,133,64,1,129,83,2,133,28,2,156,53,0,0,96,128,25,2,0,43,129,9,2,
+128,61,0,128,245,1,133,30,2,157,107,0,147,16,0,138,53,0,0,95,128,96,2,0,
+34,128,0,0,129,100,2,146,53,0,0,95,130,80,1,2,95,46,43,128,228,0,128,239,
+1,129,246,2,133,61,0,135,207,1,132,16,3,128,61,0,0,46,129,5,0,135,83,2,
+2,32,96,92,140,38,0,128,0,1,131,63,0,140,22,0,130,123,1,0,106,132,25,2,
+135,43,0,136,210,3,141,65,0,0,47,133,188,0,134,187,0,131,96,1,0,45,129,49,
+4,142,247,0,129,166,1,131,0,0,130,238,3,130,132,3,0,47,136,45,2,132,192,0,
+129,229,2,146,75,1,133,1,4,136,45,0,129,67,0,143,197,0,129,70,0,142,122,1,
+131,132,2,145,180,2,128,203,0,129,225,0,0,95,137,131,2,131,12,1,146,68,0,143,
+13,1,131,116,0,1,10,106,131,42,5,128,243,2,139,54,3,129,72,3,136,124,5,130,
+25,4,138,159,0,130,24,1,128,219,1,128,160,3,128,51,5,1,124,47,132,199,2,131,
+226,2,136,119,0,0,124,130,29,4,136,190,3,136,70,0,134,253,2,132,185,0,1,10,
+96,128,141,3,138,18,1,130,74,0,1,44,39,129,255,2,134,50,1,0,39,128,56,3,
+131,104,0,129,213,2,0,46,128,140,1,0,39,130,158,0,129,73,6,143,86,1,129,108,
+4,143,22,0,129,0,0,0,59,137,26,2,0,96,129,211,1,128,204,0,128,7,1,128,
+105,0,151,30,3,128,104,0,0,89,136,41,1,2,47,34,39,140,202,1,128,15,1,129,
+221,3,130,222,3,152,101,3,133,219,0,131,7,1,153,114,5,133,199,0,131,133,2,2,
+34,32,10,0,32,153,0,0,14,95,44,45,45,39,34,34,34,96,34,45,45,46,95,10,
+152,41,0,1,44,39,138,55,0,2,46,45,43,151,47,0,2,44,45,46,138,45,0,133,
+59,0,1,96,46,147,49,0,129,45,0,0,124,138,16,0,135,10,0,148,51,0,0,47,
+129,4,0,138,100,0,138,64,0,0,92,145,52,0,130,51,0,130,4,0,147,52,0,1,
+32,76,144,53,0,143,52,0,0,46,140,53,0,0,124,143,53,0,0,106,145,105,0,138,
+173,0,145,53,0,129,86,0,139,52,0,129,51,0,136,11,1,149,53,0,128,110,0,138,
+37,0,1,32,92,139,16,0,144,53,0,130,113,1,140,108,0,1,32,96,129,110,1,134,
+147,1,0,39,144,13,1,2,92,32,124,130,219,0,139,54,0,128,51,0,2,96,45,46,
+128,0,0,2,34,32,106,144,52,0,2,124,96,39,129,218,0,3,44,39,44,46,137,149,
+0,3,96,46,46,95,150,159,0,129,84,0,128,142,0,1,32,124,129,163,0,128,206,0,
+140,166,0,148,52,0,132,191,0,130,4,0,139,164,1,151,9,1,135,6,2,2,96,95,
+95,139,163,1,133,29,0,0,95,128,184,0,0,45,128,32,3,146,138,2,1,95,95,146,
+105,0,144,55,3,143,124,0,2,46,34,34,133,197,2,130,25,1,141,126,0,138,116,3,
+143,62,0,131,120,0,130,57,0,131,10,0,129,40,1,0,95,128,0,0,144,177,3,145,
+125,0,132,50,1,128,216,0,0,76,132,10,0,2,44,39,117,129,6,0,2,58,45,46,
+140,27,2,143,215,1,134,93,0,1,124,117,132,160,1,130,50,0,128,81,4,141,205,3,
+1,32,47,143,55,1,130,162,1,3,44,46,47,96,128,123,4,1,92,95,128,171,0,129,
+129,4,132,82,0,138,60,0,144,59,0,129,61,0,128,107,0,0,92,128,112,2,128,233,
+0,130,45,0,129,161,1,130,77,2,0,124,129,168,1,0,43,130,217,0,0,44,145,192,
+2,129,165,0,132,24,1,1,96,46,128,58,0,134,154,4,128,125,0,0,45,129,54,0,
+0,92,129,9,0,145,56,0,0,106,136,82,3,0,96,139,223,4,131,206,0,146,29,2,
+0,124,147,135,2,135,192,1,146,145,2,178,53,0,0,106,131,118,4,171,53,0,128,255,
+0,154,190,2,141,53,0,128,92,2,0,46,129,167,1,140,92,2,144,53,0,138,100,6,
+132,58,3,128,166,1,129,110,6,130,71,0,129,10,0,154,155,6,136,68,0,129,83,2,
+128,169,6,0,34,128,152,1,128,10,0,130,57,0,159,63,0,134,69,0,131,38,0,129,
+177,0,130,182,1,2,47,10,46,129,12,0,131,168,2,164,0,0,130,225,4,130,160,2,
+129,70,0,0,95,128,90,2,128,152,4,141,4,2,157,0,0,131,91,5,128,60,0,130,
+64,0,0,96,168,126,0,135,66,0,3,34,45,96,46,129,184,0,0,10,0,32,162,0,
+0,8,95,46,46,95,44,45,34,34,45,128,7,0,130,16,0,0,10,157,46,0,9,46,
+46,34,34,46,39,95,44,46,47,133,20,0,1,96,46,153,52,0,5,46,39,32,32,44,
+124,128,8,0,0,44,128,8,0,0,32,129,8,0,161,54,0,8,39,32,95,44,39,34,
+39,34,34,129,52,0,130,44,0,135,27,0,0,124,151,55,0,0,46,128,100,0,1,95,
+95,131,201,0,133,102,0,0,45,128,219,0,128,221,0,0,95,152,55,0,1,44,124,128,
+212,0,130,43,0,128,39,0,0,95,128,219,0,1,45,45,128,122,0,1,34,34,129,15,
+0,2,32,96,39,149,168,0,1,44,39,130,211,0,135,29,1,129,56,0,136,223,0,1,
+46,95,129,3,0,146,60,0,0,44,129,169,0,136,86,1,0,45,129,126,0,0,47,128,
+116,0,129,113,0,133,64,0,2,34,39,45,147,36,1,132,122,1,129,184,1,3,34,45,
+44,39,129,188,1,0,44,129,103,1,142,42,1,146,243,0,0,40,132,26,0,0,96,128,
+236,0,128,133,0,133,47,0,1,44,45,132,8,0,135,163,1,0,40,145,124,0,128,54,
+0,129,36,0,0,95,132,112,0,128,45,0,0,47,128,3,0,5,96,32,124,44,34,32,
+128,65,0,136,225,1,148,112,1,1,47,96,135,37,0,129,68,0,0,124,128,15,0,128,
+85,0,4,39,46,96,92,96,134,84,2,129,93,1,146,62,0,0,39,128,126,0,0,106,
+136,7,1,1,46,96,129,117,0,129,7,0,1,96,46,128,1,0,129,63,1,129,135,1,
+147,60,0,129,104,0,132,98,0,130,6,0,0,124,128,4,1,129,125,0,129,172,1,129,
+63,0,0,45,128,66,0,135,177,1,138,71,2,132,192,2,129,57,0,0,44,129,37,2,
+0,39,129,244,0,7,96,46,44,46,46,45,92,96,128,2,0,0,47,129,24,1,3,46,
+43,44,45,130,0,0,134,68,0,0,92,128,198,1,129,85,2,132,66,0,0,43,133,246,
+0,1,124,124,128,3,1,5,106,32,124,43,45,43,128,228,1,6,95,96,43,46,92,43,
+45,129,207,1,129,8,2,136,188,2,134,255,1,131,118,1,0,32,128,19,3,128,1,0,
+129,113,1,128,0,0,0,106,128,68,0,0,39,128,254,0,128,6,0,0,92,129,253,0,
+128,208,0,128,68,0,128,81,0,128,2,0,128,4,0,129,247,2,134,122,0,0,92,131,
+72,0,0,95,128,194,3,0,45,128,19,3,131,0,0,1,43,45,131,72,0,130,141,0,
+0,92,128,19,1,3,47,32,92,92,128,8,0,0,92,128,14,0,1,96,46,128,7,0,
+0,46,130,12,0,130,84,2,131,92,1,2,95,95,47,129,72,0,134,109,2,130,107,1,
+129,8,3,130,70,1,131,72,0,128,33,1,128,51,0,0,96,128,56,0,2,39,32,92,
+129,96,0,0,96,128,68,0,129,78,0,130,52,0,128,26,0,128,139,0,132,76,1,128,
+124,4,130,8,0,0,47,128,197,0,1,46,39,129,105,0,130,66,0,2,44,39,47,130,
+119,0,133,139,0,130,103,2,0,124,128,160,2,0,76,128,40,1,128,208,0,128,26,0,
+1,124,10,130,193,1,1,44,47,133,137,0,0,46,129,22,2,129,9,1,130,36,2,1,
+45,39,129,162,0,128,125,1,131,193,0,0,46,130,67,0,128,163,1,128,140,0,130,162,
+0,129,234,1,128,36,2,134,152,4,131,79,1,129,64,0,130,4,0,129,75,1,2,96,
+46,34,130,144,0,128,51,0,128,64,0,128,66,0,129,39,0,129,121,1,129,125,0,129,
+62,3,129,116,0,0,10,128,48,2,136,201,3,130,0,3,129,94,0,128,8,0,0,47,
+129,51,1,129,61,0,131,62,1,128,23,0,129,177,0,0,47,129,30,0,131,2,0,128,
+20,0,1,45,46,141,168,2,130,26,0,130,202,1,129,162,2,0,43,129,190,0,131,161,
+3,128,7,1,129,169,0,0,44,128,37,1,134,65,0,141,97,3,0,124,129,11,2,129,
+204,2,0,39,128,7,0,128,4,0,1,96,34,128,58,0,129,61,0,1,95,92,128,121,
+2,0,95,128,5,1,130,157,0,128,70,0,129,2,0,140,60,0,128,64,2,134,67,4,
+131,149,1,128,39,2,129,39,0,128,39,2,0,34,128,238,2,129,30,0,130,24,0,129,
+95,0,155,39,6,140,128,5,2,39,32,10,0,32,168,0,0,7,95,44,46,45,45,45,
+46,10,167,47,0,1,45,39,132,10,0,0,96,164,53,0,1,95,44,128,49,0,0,44,
+135,15,0,0,92,161,54,0,129,51,0,130,56,0,1,32,46,133,18,0,162,111,0,0,
+47,131,58,0,132,65,0,145,58,0,1,95,95,148,58,0,0,46,131,49,0,131,117,0,
+136,0,0,132,60,0,128,41,1,0,46,128,25,0,2,96,45,46,128,0,0,0,95,141,
+69,0,0,58,136,114,0,139,63,0,129,238,0,130,24,0,128,154,0,140,47,0,135,181,
+0,0,96,132,124,0,140,37,0,129,125,0,0,10,131,18,0,128,4,0,0,46,135,115,
+0,0,124,136,206,0,1,46,46,128,13,0,0,96,130,38,1,129,160,0,131,252,0,138,
+189,0,129,45,0,129,3,0,2,44,39,34,128,235,1,130,69,0,132,64,0,132,205,1,
+128,212,0,0,95,128,130,0,134,218,1,0,44,138,158,0,4,46,10,46,39,92,129,201,
+0,133,206,1,130,107,0,1,96,39,128,4,1,134,112,0,130,17,0,0,34,131,133,0,
+130,66,1,138,199,0,1,124,10,128,111,0,130,66,0,128,108,2,134,100,0,0,34,128,
+9,0,3,46,45,34,34,129,149,0,128,151,0,134,176,0,130,65,1,140,133,1,1,124,
+10,129,24,0,128,167,0,136,22,0,133,23,1,143,0,0,129,164,1,0,94,136,46,1,
+130,149,1,129,197,1,2,124,46,95,130,249,0,0,95,130,109,0,151,64,0,135,61,1,
+137,68,0,130,8,2,0,96,128,254,1,0,58,128,197,0,2,45,45,43,130,16,2,141,
+169,0,145,146,2,138,199,0,132,142,0,129,89,0,0,96,130,149,1,134,17,1,128,202,
+1,140,180,0,131,0,0,0,106,131,72,2,141,66,0,128,10,0,0,96,130,200,1,133,
+97,0,133,73,0,129,206,1,140,71,0,132,239,1,0,76,143,66,0,130,2,0,132,65,
+0,154,202,0,132,66,0,133,6,0,136,66,0,136,50,3,135,236,0,128,41,4,144,99,
+3,147,66,0,133,33,4,128,24,0,135,74,0,0,44,135,228,2,129,13,0,134,27,1,
+130,7,1,132,27,0,130,212,1,135,240,2,0,92,129,42,1,135,77,1,0,34,136,39,
+3,133,154,0,130,27,1,130,34,0,130,4,0,0,44,134,65,0,1,32,43,130,95,0,
+0,39,133,50,0,0,44,131,9,0,136,65,0,134,219,0,131,163,0,131,138,2,0,47,
+134,63,0,130,133,3,129,212,1,128,133,1,1,46,58,131,87,1,129,231,1,132,30,0,
+134,229,1,138,31,4,0,106,134,62,0,130,21,0,128,208,1,130,10,0,0,124,128,13,
+0,131,121,0,138,4,1,143,147,1,135,133,1,129,55,3,133,44,0,0,124,133,101,3,
+131,237,2,135,121,1,151,62,0,129,60,1,133,44,0,128,219,2,128,64,0,2,34,34,
+34,138,29,0,132,110,4,129,136,1,2,46,45,43,130,34,0,137,62,0,0,124,140,247,
+4,142,146,3,0,45,128,234,3,132,139,0,138,56,0,129,215,3,146,157,0,143,20,6,
+139,0,6,3,96,34,32,92,129,50,3,128,87,0,0,34,128,178,0,0,46,135,68,0,
+1,95,43,137,73,6,144,54,6,138,170,0,130,84,4,129,181,1,130,135,0,1,46,34,
+128,73,0,145,51,0,131,250,5,138,87,3,128,1,5,129,16,1,146,45,0,134,246,0,
+129,47,1,128,91,5,128,237,4,0,10,0,32,139,0,0,20,95,95,46,46,32,32,44,
+46,46,45,45,43,39,34,34,45,45,46,46,95,10,137,32,0,2,44,45,39,129,6,0,
+2,92,95,124,128,41,0,0,46,130,11,0,129,0,0,0,124,131,36,0,2,44,39,92,
+129,4,0,3,96,46,44,45,128,0,0,0,34,129,18,0,134,34,0,128,36,0,133,76,
+0,0,47,128,104,0,1,92,95,129,25,0,0,96,128,109,0,140,129,0,2,44,46,43,
+128,20,0,4,96,45,46,95,95,131,45,0,0,124,136,65,0,137,137,0,128,163,0,131,
+92,0,128,115,0,130,0,0,1,96,46,128,47,0,1,47,39,137,47,0,2,92,44,45,
+133,97,0,136,22,0,0,96,129,216,0,133,49,0,128,23,0,137,49,0,128,155,0,134,
+80,0,140,0,0,0,58,133,234,0,128,47,0,136,214,0,129,49,0,137,15,0,137,0,
+0,131,89,0,128,50,0,1,96,46,135,100,0,0,44,130,44,0,130,54,0,144,0,0,
+131,73,0,4,96,10,124,34,106,142,26,1,148,152,0,132,0,0,2,92,10,124,129,85,
+0,0,44,135,17,0,130,32,1,157,52,0,130,206,0,131,141,0,2,95,46,45,144,105,
+1,129,147,1,140,53,0,4,96,46,46,10,46,128,105,1,129,54,0,128,18,2,131,61,
+0,128,242,1,1,32,96,135,123,0,0,34,147,224,1,129,12,1,0,124,128,223,1,1,
+45,100,137,101,0,1,95,95,142,9,0,134,28,0,132,17,0,128,56,0,130,103,0,0,
+47,132,120,2,129,168,2,129,99,0,135,97,0,131,108,0,135,149,2,132,251,0,2,124,
+10,39,129,208,2,128,0,0,128,128,2,131,125,1,130,91,0,137,179,1,130,40,0,135,
+188,0,131,33,0,130,213,2,129,17,2,128,0,1,132,107,2,148,231,1,136,99,1,129,
+129,1,0,39,130,136,2,0,34,130,1,1,144,0,0,1,46,34,135,47,0,133,9,0,
+131,150,0,129,112,0,128,165,0,128,173,0,128,254,2,142,55,0,128,159,0,134,56,0,
+1,95,92,129,169,3,132,64,0,130,249,2,145,108,1,134,101,0,130,139,3,133,196,2,
+132,149,2,129,172,0,131,183,3,130,16,0,128,208,3,131,21,3,129,254,3,133,73,0,
+132,82,1,0,46,130,63,0,131,31,1,128,224,0,0,46,129,224,0,128,248,1,130,36,
+1,131,39,0,128,93,1,0,59,144,250,2,135,69,0,134,223,0,128,176,0,128,15,0,
+129,48,0,128,141,1,128,36,1,130,9,0,146,54,0,129,13,0,128,145,4,0,45,130,
+109,0,128,61,4,3,34,124,43,46,128,46,0,134,85,1,135,66,3,0,106,138,249,0,
+128,23,0,131,144,4,128,103,0,0,124,137,155,1,133,144,1,0,95,128,35,2,137,39,
+4,129,49,0,133,10,1,128,144,0,1,46,96,137,185,1,3,95,95,44,34,128,254,0,
+129,136,0,135,20,0,0,106,131,228,1,129,27,1,129,246,2,0,92,130,207,0,130,0,
+0,133,58,0,136,134,3,129,0,0,0,43,132,46,0,0,124,128,78,0,2,39,32,96,
+129,227,4,134,14,2,131,28,5,140,36,3,131,18,2,131,164,0,0,92,131,14,5,129,
+124,5,0,96,128,8,0,128,189,0,137,234,1,131,166,2,0,46,129,87,0,129,48,0,
+135,148,1,133,79,1,130,150,5,128,129,1,129,51,0,131,75,1,128,227,0,4,45,45,
+124,45,43,128,73,0,129,77,0,134,44,0,128,215,3,128,9,1,128,203,0,2,47,32,
+58,128,4,2,130,89,0,131,133,0,128,65,0,1,124,44,128,71,3,0,32,131,150,2,
+129,15,3,0,95,130,5,0,129,144,3,129,6,0,131,63,1,131,157,1,128,237,4,2,
+95,40,46,128,35,6,130,0,0,1,124,95,129,95,1,0,39,128,184,0,128,161,0,0,
+92,128,93,2,131,62,2,148,0,0,129,156,5,130,0,0,3,39,34,32,10,0,32,152,
+0,0,0,95,129,0,0,132,7,0,0,10,149,35,0,3,44,46,44,124,130,9,0,10,
+96,34,96,45,46,46,95,96,45,45,46,147,45,0,6,95,44,34,32,44,106,32,131,45,
+0,132,0,0,7,96,34,45,46,32,96,45,44,143,48,0,128,45,0,8,95,44,45,39,
+32,39,32,124,46,129,132,0,137,52,0,5,46,32,32,92,96,46,141,51,0,1,44,39,
+128,2,0,1,44,46,129,0,0,0,76,129,37,0,128,135,0,137,30,0,2,92,32,32,
+128,106,0,140,53,0,0,46,128,51,0,4,34,39,34,96,46,129,232,0,133,153,0,130,
+199,0,133,33,0,0,124,130,22,0,0,92,129,54,0,128,91,0,131,22,0,3,44,39,
+45,47,130,8,0,0,39,129,140,0,6,124,46,46,39,34,34,124,128,67,0,132,117,0,
+4,95,95,46,45,39,128,35,0,128,16,0,129,111,0,128,151,0,3,46,32,95,62,129,
+84,0,1,47,32,131,55,0,130,5,0,129,4,0,128,46,0,0,39,128,153,0,131,171,
+0,129,104,0,128,44,0,133,130,0,1,10,47,128,112,0,129,86,0,128,18,0,137,56,
+0,130,34,0,2,95,32,95,128,208,0,130,10,1,128,44,0,0,58,128,130,0,136,31,
+1,2,92,10,39,128,14,0,2,124,32,46,128,139,1,137,57,0,0,47,128,59,0,128,
+169,0,0,47,128,246,0,2,34,34,39,128,66,1,128,117,0,128,116,0,129,72,0,134,
+0,0,0,124,128,233,0,1,47,39,130,87,0,1,47,32,128,125,0,2,46,46,43,130,
+11,0,128,96,0,3,95,46,96,43,130,211,0,128,199,0,5,92,39,124,32,96,124,128,
+57,0,129,58,1,130,37,2,131,59,0,129,179,0,8,58,46,45,43,32,95,124,46,45,
+128,89,1,128,90,1,0,47,128,15,1,0,34,133,185,1,130,99,1,0,106,130,10,0,
+128,60,0,1,47,45,129,45,2,0,34,129,5,0,128,106,0,0,10,129,79,1,129,219,
+0,0,58,130,46,0,131,87,0,131,127,1,133,217,0,0,43,128,42,0,132,33,1,0,
+92,131,215,0,1,32,32,128,66,2,0,95,128,37,0,131,216,1,131,63,1,1,44,43,
+128,65,0,129,55,0,128,63,2,129,189,0,134,3,2,130,215,0,131,214,1,138,80,2,
+131,61,0,131,28,0,0,100,129,28,0,131,92,0,128,162,0,136,28,1,135,42,1,138,
+61,0,1,32,124,131,61,0,129,20,0,1,95,47,129,47,1,133,139,1,135,62,0,3,
+95,95,44,94,128,93,0,0,39,130,35,2,138,61,0,128,16,3,130,91,2,1,39,95,
+132,250,1,131,249,0,132,62,0,128,77,3,1,45,45,128,54,3,128,201,1,128,123,1,
+0,46,128,7,0,1,39,43,137,158,2,131,247,0,0,39,128,89,3,133,49,1,1,44,
+39,133,239,1,128,47,0,128,54,0,128,87,0,128,5,0,2,34,39,124,133,117,0,129,
+131,0,130,66,0,129,141,2,129,122,0,129,227,1,130,33,0,130,14,3,129,121,3,128,
+10,0,128,35,2,128,107,0,132,182,1,128,225,0,139,125,3,130,27,2,136,73,3,1,
+44,39,128,103,2,129,156,0,129,43,0,138,226,3,1,95,95,137,59,0,2,46,39,96,
+128,214,3,2,95,46,39,136,59,0,0,92,129,15,0,131,38,1,129,57,0,134,45,0,
+131,14,1,128,169,0,131,13,0,128,4,1,0,39,128,70,2,138,58,0,130,62,0,131,
+48,0,2,124,32,39,129,85,2,135,56,0,133,171,0,129,125,3,128,140,3,142,56,0,
+129,11,4,129,47,1,128,13,3,0,124,131,110,1,0,58,138,211,1,0,96,128,124,4,
+1,46,39,128,185,2,139,54,0,129,78,2,129,233,3,128,24,0,128,118,2,129,183,3,
+138,205,1,129,159,2,128,54,1,141,154,4,131,166,3,0,34,128,50,0,144,51,0,137,
+72,1,142,94,2,2,96,60,34,132,113,1,150,45,0,133,7,3,134,105,0,136,47,0,
+138,244,0,3,44,46,34,58,129,84,5,137,77,0,128,174,3,137,57,4,138,186,5,128,
+41,2,1,95,124,128,32,5,128,157,3,132,195,2,3,46,34,39,62,132,37,3,134,125,
+0,142,136,5,129,244,3,128,5,1,0,96,128,7,0,129,221,1,129,56,4,3,124,45,
+34,58,129,62,0,131,145,2,1,34,39,141,196,1,141,46,1,128,62,5,129,126,2,1,
+32,10,0,32,144,0,0,4,46,39,32,46,10,145,23,0,3,124,32,39,92,137,24,0,
+9,95,46,46,46,95,95,95,47,96,39,129,29,0,135,25,0,0,44,129,15,0,135,0,
+0,0,124,131,25,0,3,44,124,44,34,138,23,0,2,41,47,124,145,126,0,135,70,0,
+132,83,0,1,47,32,140,39,0,0,47,129,26,0,153,57,0,2,92,96,32,130,168,0,
+0,47,138,190,0,2,46,46,45,128,152,0,1,39,44,154,116,0,129,88,0,129,59,0,
+137,95,0,1,44,62,134,26,0,155,0,0,129,167,0,129,237,0,136,175,0,128,76,1,
+128,40,1,2,95,95,96,144,118,0,129,27,0,2,44,45,45,128,68,1,0,44,128,154,
+0,128,172,0,3,44,39,10,46,128,101,1,135,79,0,2,46,45,34,128,175,0,138,198,
+0,134,98,1,0,124,134,23,0,1,46,34,129,100,0,4,39,46,10,92,32,136,121,1,
+128,71,0,2,44,39,47,144,59,0,130,119,0,130,138,1,0,95,128,120,0,0,95,130,
+50,0,128,181,0,2,92,32,96,135,97,1,5,46,34,95,47,39,95,143,179,0,0,39,
+133,3,1,135,87,0,1,95,39,128,241,0,2,96,46,92,131,12,0,130,251,1,1,92,
+46,128,74,0,3,41,32,44,94,140,49,1,131,96,0,133,163,0,2,44,45,34,130,223,
+1,0,124,128,37,0,129,146,0,0,95,130,180,0,4,96,46,32,39,45,128,42,0,138,
+123,0,0,44,128,157,0,130,64,0,130,80,0,1,44,45,131,55,0,2,32,96,119,128,
+12,0,0,34,129,233,0,129,52,1,129,34,0,131,110,1,4,44,95,32,58,34,128,170,
+0,2,47,32,55,128,180,1,2,44,96,46,130,22,0,0,46,129,168,0,128,126,0,130,
+96,1,0,96,129,18,0,131,196,0,129,55,0,2,96,45,39,129,17,1,129,160,0,1,
+95,58,128,21,1,0,125,128,36,0,0,58,129,225,2,129,147,1,134,37,0,134,208,1,
+130,65,0,0,45,132,221,0,129,189,1,133,217,2,3,96,45,43,45,128,68,0,132,51,
+0,133,202,1,137,191,2,2,96,96,45,128,212,1,140,86,1,0,96,132,61,3,130,194,
+0,0,45,159,104,2,129,42,0,132,111,3,128,220,0,2,95,44,34,128,171,0,167,50,
+0,132,202,1,161,50,0,129,112,1,2,39,45,55,139,14,4,133,10,1,153,69,3,1,
+39,96,129,19,1,0,58,140,71,4,150,57,0,134,241,0,132,131,2,128,143,1,139,58,
+0,0,106,150,59,0,131,19,2,136,9,0,132,111,4,136,7,3,129,24,0,132,131,1,
+2,46,94,44,134,195,2,2,44,46,43,133,36,0,130,63,1,130,201,2,141,206,3,0,
+96,133,144,3,130,6,0,0,92,128,150,2,0,44,129,70,4,0,58,134,118,0,128,151,
+0,3,47,95,46,44,138,58,0,130,88,2,132,150,2,133,102,2,0,46,128,55,0,131,
+51,0,1,96,46,133,60,0,129,211,0,0,47,137,57,0,130,42,0,128,98,2,0,106,
+132,13,0,0,95,129,220,1,137,24,1,0,39,133,120,0,2,46,32,40,136,56,0,130,
+55,0,0,47,128,81,3,130,113,0,128,61,0,135,21,1,133,168,2,128,25,0,131,7,
+0,137,112,0,129,17,0,130,190,5,130,55,0,130,4,0,0,55,141,1,1,136,216,4,
+139,116,1,133,85,1,128,4,0,0,118,138,77,2,129,106,0,133,84,0,140,141,1,129,
+56,0,131,82,1,1,106,39,134,74,3,135,54,0,133,79,0,0,106,141,128,6,129,41,
+1,133,137,0,140,24,2,131,20,0,130,7,0,142,182,6,1,96,46,129,23,0,0,47,
+142,59,2,2,124,95,44,130,98,1,145,106,0,131,78,1,1,47,96,139,173,6,129,104,
+4,132,126,0,128,182,0,143,105,0,129,51,0,131,181,1,138,100,3,130,218,5,130,81,
+5,1,45,39,143,52,0,146,209,0,135,81,0,1,95,95,128,53,0,141,52,0,129,90,
+3,132,202,4,141,112,2,140,20,0,128,105,4,0,45,128,124,0,0,10,0,32,145,0,
+0,4,58,96,46,47,10,145,24,0,5,95,124,32,32,44,45,141,26,0,4,44,39,34,
+34,39,130,8,0,0,96,139,26,0,3,44,39,46,92,132,10,0,1,96,46,130,63,0,
+0,95,128,20,0,2,46,45,46,136,38,0,5,46,32,46,47,32,96,130,62,0,129,29,
+0,1,39,46,128,53,0,2,32,32,92,128,48,0,0,124,136,37,0,0,92,128,71,0,
+129,74,0,0,46,129,104,0,0,76,128,8,0,0,34,131,85,0,2,34,32,96,133,97,
+0,145,174,0,0,44,138,106,0,7,32,92,96,32,124,92,46,96,131,12,0,0,55,131,
+126,0,0,44,129,239,0,0,46,129,216,0,3,32,45,45,39,131,166,0,138,0,0,128,
+51,0,136,67,0,0,96,128,68,0,0,43,128,175,0,132,117,0,3,92,94,45,45,128,
+138,0,128,54,0,129,64,0,130,186,0,134,236,0,134,5,1,2,46,46,39,138,67,0,
+128,43,0,0,44,130,33,0,130,51,0,137,91,0,129,56,0,130,20,0,0,46,128,8,
+0,128,10,1,136,49,0,128,0,0,138,147,1,2,39,58,80,131,108,0,131,38,0,128,
+100,0,132,145,0,128,71,0,4,45,43,96,34,45,128,29,0,2,96,46,95,130,53,1,
+128,218,0,2,96,44,45,128,84,0,1,44,39,136,66,0,0,47,135,8,0,2,96,45,
+44,129,47,0,0,44,132,255,0,130,5,0,2,59,32,46,128,16,1,129,13,0,0,43,
+134,102,0,128,184,0,135,64,0,131,63,0,0,95,132,120,0,129,5,0,1,96,45,128,
+5,0,0,92,130,219,0,0,96,129,58,0,129,51,0,2,96,46,94,129,167,1,1,46,
+95,130,98,1,137,8,1,129,91,0,0,44,128,69,0,133,5,1,130,117,0,130,174,0,
+134,23,1,132,79,1,137,226,1,136,4,1,0,96,128,12,2,0,34,130,120,0,134,250,
+0,129,58,0,128,70,2,130,48,0,130,210,0,131,40,0,0,45,128,0,0,129,39,0,
+0,95,138,0,1,138,4,1,131,59,0,129,82,0,1,95,125,128,6,0,131,208,2,138,
+157,1,0,45,140,59,0,0,47,128,214,1,139,70,0,128,217,2,135,245,1,0,34,132,
+122,2,2,46,46,95,129,17,1,137,104,0,131,11,0,1,39,45,128,143,1,131,229,0,
+128,55,0,1,46,39,131,47,0,128,27,0,128,8,1,0,92,137,46,0,132,88,1,134,
+35,1,0,47,129,5,0,0,58,129,45,0,128,37,0,128,237,0,0,96,136,136,0,133,
+91,1,132,48,0,128,10,2,0,95,129,29,0,137,33,0,2,44,95,95,128,59,0,0,
+47,130,19,0,128,33,2,129,117,3,142,235,0,128,78,2,133,23,0,0,60,137,32,0,
+3,92,32,40,10,128,58,0,133,157,0,0,34,130,252,1,139,171,0,139,177,0,128,100,
+0,3,46,45,39,34,128,129,1,129,110,0,1,92,10,128,43,0,133,221,1,0,47,129,
+159,1,145,59,0,131,104,0,0,44,130,148,3,136,34,3,9,47,39,10,92,46,39,124,
+43,46,43,128,90,0,1,40,96,129,205,2,150,249,3,0,92,129,250,2,128,237,1,137,
+18,0,129,246,0,2,92,32,124,128,0,0,128,6,0,0,95,129,151,2,139,167,3,138,
+12,0,128,119,0,130,98,4,1,46,39,128,74,3,133,25,0,0,96,129,162,1,3,96,
+43,39,124,128,49,3,2,40,32,92,130,93,0,128,232,0,128,0,0,131,35,1,138,207,
+3,0,124,128,247,1,0,34,133,163,0,0,96,129,102,4,131,22,0,146,88,5,131,36,
+0,2,58,45,46,138,66,0,132,169,4,132,70,2,130,47,3,128,161,3,143,128,5,139,
+183,0,139,133,0,135,227,0,128,19,2,130,11,0,0,46,139,72,4,141,57,2,139,64,
+0,128,159,1,137,162,1,130,77,0,152,194,0,129,179,0,136,116,1,128,58,0,0,39,
+131,234,4,131,121,2,132,67,0,129,127,2,151,0,0,0,92,139,254,3,1,92,39,135,
+143,0,0,58,131,36,6,128,85,0,154,65,0,133,110,1,0,44,131,64,1,128,158,1,
+128,45,2,133,26,0,129,245,2,2,45,44,46,130,203,1,147,53,6,0,96,128,243,1,
+130,185,4,129,46,0,128,223,1,0,95,130,2,1,0,70,128,3,0,0,41,135,211,5,
+0,95,128,162,6,148,65,0,3,39,45,34,39,128,129,0,129,132,4,129,198,2,1,32,
+41,128,1,3,4,45,46,94,44,124,137,144,2,128,154,0,132,241,3,148,68,0,128,177,
+0,128,178,2,1,95,106,131,148,4,140,113,7,129,206,0,0,124,128,156,2,155,6,1,
+138,26,7,135,232,3,128,146,0,128,53,7,2,92,44,43,141,209,4,142,0,0,0,55,
+128,58,1,130,215,4,128,81,6,129,113,0,133,229,2,0,96,142,71,5,140,119,7,130,
+114,4,128,244,3,129,4,6,131,108,7,3,96,32,118,46,152,184,2,0,46,128,33,6,
+129,18,4,128,101,0,130,110,3,3,92,46,94,45,149,95,1,130,185,4,2,95,95,43,
+128,34,1,0,46,131,206,1,152,200,0,128,202,5,1,32,10,0,32,158,0,0,7,95,
+46,45,45,45,34,39,34,129,0,0,7,39,96,45,45,46,46,95,10,155,48,0,3,44,
+46,45,39,144,23,0,1,96,45,153,57,0,128,53,0,0,34,153,85,0,1,45,46,147,
+59,0,2,46,45,34,129,55,0,4,95,95,95,46,46,129,169,0,131,0,0,128,164,0,
+139,123,0,148,61,0,128,207,0,0,45,128,218,0,146,172,0,161,63,0,153,0,0,0,
+96,138,65,0,0,92,175,64,0,140,66,0,178,65,0,128,54,0,191,66,0,0,32,192,
+134,0,1,32,124,138,80,0,193,68,0,0,124,158,68,0,128,21,2,131,0,0,179,68,
+0,130,201,2,135,28,2,2,96,34,39,135,88,2,0,58,161,68,0,1,95,44,146,9,
+3,132,12,3,0,46,139,27,0,146,68,0,141,36,0,156,101,2,1,32,39,134,68,0,
+128,183,3,130,26,0,2,95,44,43,128,25,3,128,0,0,140,5,1,151,70,0,133,156,
+1,131,122,0,0,96,128,252,3,137,40,0,3,34,45,46,44,128,115,3,128,99,3,143,
+79,0,134,107,2,0,47,131,66,0,0,47,129,4,0,0,44,144,193,0,130,130,1,129,
+144,0,137,157,2,138,67,0,131,65,0,0,96,129,134,0,139,225,0,135,0,0,0,43,
+128,154,1,0,41,150,66,0,132,130,0,0,96,129,197,0,136,34,0,128,187,0,128,123,
+1,130,82,0,133,7,2,138,15,2,134,65,0,132,63,0,128,195,0,0,34,135,33,0,
+134,141,1,129,81,0,0,39,131,95,1,146,161,1,0,46,132,136,1,3,124,44,46,46,
+128,43,1,128,59,5,129,148,4,130,71,0,130,80,2,130,9,0,2,96,34,34,140,190,
+1,138,11,2,0,44,141,151,4,129,52,2,139,177,0,144,186,0,131,61,0,148,54,2,
+129,65,0,0,43,147,8,3,136,61,0,130,182,1,163,111,2,136,0,0,131,53,0,1,
+124,10,131,218,0,131,141,2,156,193,3,141,60,0,128,61,0,129,156,1,130,201,5,146,
+175,2,140,61,0,132,14,0,133,175,0,130,53,1,1,96,46,128,177,1,0,124,128,19,
+0,132,73,0,132,77,0,0,45,143,142,0,130,61,0,135,157,2,132,177,1,3,47,124,
+32,124,134,102,0,130,61,2,130,34,0,142,80,1,0,124,128,220,3,135,74,1,131,45,
+2,0,47,128,98,0,1,39,46,135,34,1,0,95,130,58,0,132,98,0,137,57,1,129,
+96,0,129,21,0,128,97,4,0,46,131,59,0,129,195,0,129,33,0,128,100,4,129,108,
+7,130,118,4,2,95,44,94,133,208,6,136,40,2,131,95,1,1,46,39,128,30,1,0,
+95,129,58,0,0,47,128,224,0,128,133,2,1,96,58,128,49,1,131,0,0,0,44,141,
+172,0,1,96,46,129,202,4,132,127,2,130,131,2,128,236,0,128,20,0,158,93,4,131,
+59,0,135,12,3,162,0,0,128,47,4,0,10,0,32,143,0,0,6,44,45,39,34,45,
+46,10,138,19,0,12,95,95,46,46,46,124,32,46,34,46,32,32,124,134,26,0,4,44,
+45,45,43,34,130,9,0,2,39,32,124,129,15,0,0,39,133,26,0,128,42,0,0,39,
+128,6,0,11,46,46,45,45,44,32,32,96,45,39,32,96,134,81,0,1,124,47,131,33,
+0,128,46,0,130,53,0,129,0,0,0,58,134,28,0,0,92,128,104,0,6,45,43,45,
+34,46,46,95,133,28,0,132,112,0,0,44,131,106,0,132,0,0,2,96,45,45,128,139,
+0,129,8,0,131,6,0,128,160,0,6,45,39,43,34,47,95,95,130,45,0,129,99,0,
+131,24,0,134,0,0,132,78,0,3,58,44,45,34,129,155,0,128,57,0,3,34,32,124,
+95,128,178,0,130,217,0,130,67,0,0,44,128,124,0,3,46,95,95,95,128,153,0,131,
+46,0,129,8,0,135,0,0,6,47,92,10,46,46,92,39,128,33,0,128,107,0,128,14,
+0,0,86,134,87,0,138,38,0,131,56,0,2,34,34,10,128,154,0,128,28,0,4,96,
+58,32,32,92,133,139,0,128,15,0,140,150,0,137,99,0,1,44,46,130,120,1,129,49,
+0,137,178,0,129,7,0,139,97,0,1,46,94,134,69,0,128,62,0,1,44,34,132,93,
+1,132,11,1,135,54,0,130,106,1,137,199,1,1,46,92,128,146,1,1,45,46,129,157,
+1,129,27,0,131,41,0,2,44,45,44,133,157,1,5,96,46,95,32,32,65,132,238,0,
+1,32,106,139,61,0,0,46,133,129,1,129,58,0,133,197,1,128,233,1,129,200,1,135,
+47,2,128,132,0,0,96,129,196,1,128,151,0,139,180,0,134,140,0,0,47,128,100,0,
+131,12,0,0,124,129,35,0,130,136,0,137,111,2,1,124,34,128,163,0,0,45,129,98,
+1,146,38,1,130,125,0,0,45,128,133,1,128,41,0,132,199,0,140,63,0,128,231,0,
+128,62,0,0,34,128,131,1,132,17,1,137,117,1,134,188,0,128,0,2,2,94,45,46,
+128,159,2,143,127,0,134,246,2,2,95,95,92,130,9,0,139,9,1,138,13,0,0,96,
+128,173,0,0,46,140,127,0,129,128,0,0,34,132,102,2,130,64,0,133,146,1,139,215,
+1,135,80,0,135,62,0,4,95,44,43,46,34,128,218,0,134,0,0,129,63,0,156,62,
+0,135,125,0,130,114,0,129,128,1,132,238,1,128,235,2,131,10,0,131,230,0,147,62,
+0,135,182,3,130,119,0,0,124,128,62,0,128,64,0,133,112,1,130,75,0,136,51,0,
+141,62,0,135,216,3,128,148,3,130,241,2,2,44,39,46,131,53,1,130,30,0,129,10,
+0,135,14,0,140,61,0,0,47,135,248,3,128,4,0,1,59,43,130,244,1,0,34,132,
+46,0,129,129,0,129,125,0,134,61,0,139,60,0,134,59,0,2,39,92,92,134,154,2,
+129,45,0,131,158,3,129,64,0,128,61,0,133,60,0,139,201,3,134,48,1,1,92,92,
+135,155,0,128,28,4,133,180,0,129,45,0,129,5,1,131,136,1,136,34,0,0,47,129,
+228,0,131,166,3,133,255,1,134,99,2,133,161,0,0,95,128,141,0,129,48,5,1,44,
+58,128,77,4,131,29,0,133,73,0,130,84,1,128,37,1,0,92,134,115,1,132,104,0,
+134,64,0,3,96,34,46,39,128,96,4,137,174,0,0,96,129,151,4,1,95,95,128,103,
+2,0,96,128,184,2,129,98,0,0,47,139,176,2,135,65,0,0,95,130,55,0,0,92,
+139,40,1,134,58,3,1,44,39,128,133,0,128,156,3,129,222,4,129,81,0,134,246,3,
+135,71,0,0,95,128,88,5,128,129,0,131,246,0,133,181,0,128,148,2,134,141,3,128,
+76,0,129,207,5,133,255,3,128,118,0,135,246,5,137,20,3,132,253,2,132,16,4,129,
+139,3,129,16,0,128,124,5,134,76,0,0,95,131,102,1,130,154,1,0,96,137,33,6,
+149,0,0,129,121,1,129,146,3,0,95,128,166,1,135,163,3,128,23,6,129,253,1,128,
+219,0,129,191,5,0,34,144,140,0,150,79,0,1,46,124,128,81,0,3,46,44,46,60,
+130,135,0,2,96,44,95,128,164,0,1,96,46,135,28,2,164,69,0,130,44,2,128,157,
+1,3,39,34,32,10,0,32,158,0,0,2,95,44,46,129,2,0,0,10,158,40,0,2,
+39,45,34,128,41,0,3,34,45,45,44,159,43,0,8,32,96,34,46,46,45,43,45,39,
+160,42,0,5,58,39,61,61,45,58,161,40,0,3,96,61,45,34,160,40,0,6,95,46,
+34,45,46,46,124,131,40,0,0,95,129,0,0,145,35,0,2,45,39,34,129,166,0,4,
+34,39,32,96,45,132,254,0,0,124,130,2,0,129,19,0,0,45,128,0,0,0,46,132,
+54,0,1,44,39,142,220,0,0,46,131,46,0,1,95,95,128,46,0,137,22,0,145,44,
+0,130,58,1,131,48,0,0,39,128,149,0,131,92,0,132,91,0,2,124,32,47,149,196,
+0,0,92,131,165,0,131,0,0,130,196,0,137,162,1,128,163,0,128,136,1,0,58,130,
+67,0,135,66,0,1,44,46,136,182,0,131,68,0,1,46,39,129,19,0,129,22,0,131,
+71,0,128,235,0,0,46,131,140,0,137,0,0,130,198,0,0,106,134,70,0,133,195,0,
+129,208,0,132,0,0,1,46,32,140,216,0,0,124,128,127,0,5,124,10,46,39,34,34,
+129,9,0,131,94,0,128,83,1,129,42,0,133,20,1,137,219,0,130,206,0,130,55,0,
+131,71,0,131,209,0,133,123,0,1,124,10,130,5,0,139,97,0,0,47,133,16,0,132,
+133,0,139,6,0,131,28,0,0,46,132,149,0,128,15,1,0,96,129,132,0,2,39,10,
+58,128,96,1,0,124,135,239,0,129,231,1,1,46,39,132,72,0,139,96,0,133,13,0,
+130,7,0,128,86,2,3,96,34,96,43,132,56,0,129,155,0,0,44,129,91,0,0,96,
+142,8,1,135,214,0,0,47,130,56,0,0,39,149,57,3,0,92,129,89,3,128,55,0,
+134,59,0,134,86,1,0,47,134,86,0,130,12,2,129,112,0,151,128,3,5,46,39,58,
+58,95,95,129,233,1,130,186,1,130,97,1,131,78,0,130,151,0,138,218,2,129,27,0,
+132,246,2,142,0,0,0,124,128,61,0,128,177,1,135,16,0,1,44,45,128,37,3,135,
+148,0,128,196,1,133,50,1,129,108,0,0,106,148,70,0,1,96,46,128,142,0,129,122,
+0,133,86,0,128,145,0,0,39,131,136,2,144,3,4,155,254,3,0,96,129,166,3,130,
+107,1,4,39,32,34,32,58,128,188,1,159,3,4,134,55,1,1,32,10,131,0,0,0,
+32,157,0,0,1,95,10,155,31,0,4,44,34,39,95,92,151,35,0,9,44,34,92,32,
+32,96,46,34,32,32,128,7,0,131,17,0,2,46,46,46,151,84,0,2,39,46,39,130,
+41,0,129,3,0,0,46,130,17,0,5,40,39,34,34,96,46,131,61,0,152,140,0,132,
+52,0,0,96,128,52,0,0,124,131,17,0,3,47,61,46,58,128,77,0,6,32,44,58,
+96,46,96,46,152,198,0,130,58,0,2,46,39,59,128,57,0,0,34,129,0,0,3,96,
+45,46,47,129,126,0,128,59,0,2,32,46,96,153,255,0,129,57,0,0,96,128,219,0,
+0,32,129,42,0,131,0,0,0,96,130,54,0,1,44,39,128,249,0,154,116,0,129,41,
+0,3,95,95,95,46,130,46,0,136,19,0,128,2,0,5,46,58,39,96,46,47,154,59,
+0,129,159,0,136,163,1,128,83,1,0,95,132,142,0,3,32,95,46,39,143,58,0,128,
+103,0,128,34,0,129,35,0,138,57,0,0,44,129,187,0,131,52,1,2,46,95,44,140,
+55,0,2,44,45,34,133,155,0,2,96,34,43,131,140,1,131,0,0,0,58,134,9,0,
+6,46,32,124,10,43,39,34,128,55,1,1,39,45,128,33,0,128,246,0,141,227,0,134,
+10,0,132,149,1,128,113,0,0,124,128,52,0,3,92,92,95,124,130,143,0,0,96,135,
+76,0,139,87,1,139,9,0,128,182,0,132,64,0,131,240,0,0,45,133,91,1,1,58,
+41,136,25,0,2,44,46,45,129,0,0,130,116,0,135,67,0,130,27,1,130,103,1,0,
+39,130,10,0,129,62,0,1,39,96,128,31,0,0,106,128,67,0,128,23,1,130,181,0,
+133,67,0,134,31,1,130,63,0,1,46,32,128,164,0,128,1,0,3,44,34,46,96,130,
+13,1,130,43,0,1,96,46,131,56,1,0,95,128,20,0,128,66,0,1,92,92,129,61,
+0,128,63,1,133,19,1,136,30,1,128,88,0,128,238,0,0,73,128,32,2,1,45,39,
+130,98,0,1,95,44,128,79,0,130,26,1,131,60,3,129,69,0,0,34,129,204,0,0,
+96,128,67,1,0,39,135,12,1,131,76,0,130,102,0,129,55,0,0,124,128,126,0,4,
+94,34,96,34,124,129,160,0,5,44,96,58,58,47,47,131,224,0,130,243,2,1,46,45,
+130,53,3,134,192,1,136,134,1,134,6,1,129,216,0,0,44,129,220,2,1,45,46,128,
+182,0,1,34,45,128,76,0,4,34,39,58,123,46,132,248,0,132,181,0,2,95,44,43,
+129,210,0,142,201,0,128,19,3,128,0,0,128,102,0,128,113,1,3,96,58,39,45,136,
+140,1,128,156,0,0,108,133,251,0,0,124,128,100,2,1,46,45,135,65,0,2,32,92,
+44,137,56,2,134,228,3,1,32,58,139,193,2,136,75,0,131,59,0,3,46,45,46,34,
+130,183,3,140,78,4,128,103,0,132,149,2,1,44,34,130,231,1,131,76,1,130,3,3,
+0,95,132,59,0,0,92,128,53,0,1,92,96,129,127,3,133,28,0,128,197,1,0,44,
+132,90,1,130,80,0,128,164,3,3,47,96,44,39,131,94,0,131,129,3,133,59,1,129,
+20,0,128,9,4,129,123,1,6,45,45,43,45,45,39,34,128,68,0,129,171,1,133,179,
+1,129,61,0,0,96,129,132,0,0,59,130,141,0,128,65,0,135,170,3,130,11,4,132,
+199,0,128,33,1,1,58,124,128,29,0,133,210,1,132,202,0,1,92,95,129,148,4,130,
+20,0,146,169,3,131,57,0,1,124,124,128,29,3,135,99,1,136,201,0,128,236,1,0,
+46,136,95,1,137,54,0,128,49,0,128,59,0,136,54,0,130,145,0,131,184,1,3,34,
+92,92,44,146,166,5,131,49,0,136,184,0,135,186,1,128,58,2,0,92,128,5,0,146,
+164,0,131,13,3,147,20,5,2,96,46,45,152,17,6,148,52,0,128,128,5,1,32,10,
+0,32,132,0,0,1,46,10,131,7,0,4,44,39,32,92,92,131,11,0,0,47,128,3,
+0,128,13,0,128,12,0,3,95,32,32,92,129,17,0,0,92,129,13,0,3,47,32,34,
+46,131,14,0,0,96,131,6,0,161,0,0,3,44,46,10,106,132,65,0,148,57,0,8,
+34,34,34,39,45,46,32,46,46,135,18,0,128,11,0,1,58,124,128,114,0,0,124,130,
+13,0,1,96,46,132,58,0,0,96,139,56,0,1,95,95,128,26,0,128,89,0,0,58,
+136,83,0,3,92,32,96,124,128,53,0,130,75,0,3,95,95,95,10,130,33,0,129,60,
+0,131,66,0,0,46,132,14,0,135,45,0,1,34,45,128,18,0,1,92,32,131,105,0,
+134,66,0,0,32,130,16,0,0,47,128,8,1,1,124,10,128,4,1,0,39,132,68,0,
+131,156,0,133,83,0,131,0,0,3,96,45,46,44,130,7,0,128,196,0,0,46,128,47,
+1,132,67,0,128,0,0,128,66,0,129,65,0,128,66,0,0,124,128,50,0,0,95,137,
+53,0,128,11,0,135,204,0,2,46,45,39,128,5,0,1,45,45,129,61,0,128,188,0,
+133,39,0,129,67,0,0,124,131,65,0,0,106,131,9,1,128,190,0,136,120,0,135,135,
+0,129,34,0,128,15,0,2,34,34,45,128,223,0,3,95,124,46,34,131,48,1,128,66,
+0,3,44,45,124,39,130,29,0,1,124,10,129,99,0,132,122,0,138,134,0,129,14,0,
+131,64,0,128,109,0,1,39,58,128,119,1,2,32,39,124,128,5,0,132,38,0,2,58,
+32,124,130,222,0,1,32,39,129,75,1,133,223,0,138,134,0,128,169,0,0,58,132,12,
+0,128,60,0,128,65,0,1,46,45,129,211,1,1,46,124,128,128,1,5,46,46,46,43,
+45,43,128,25,1,128,100,0,130,92,2,128,46,1,141,65,0,128,172,0,0,96,133,64,
+0,0,39,128,50,0,128,137,2,140,232,1,4,44,46,46,45,41,130,63,0,2,46,34,
+96,129,176,1,142,64,0,133,174,0,2,32,46,39,129,115,0,0,46,128,27,2,130,1,
+2,128,56,0,3,34,39,32,95,128,98,1,131,126,0,146,183,2,129,20,0,132,24,0,
+1,58,34,133,26,1,1,39,34,128,10,0,128,64,0,1,45,34,129,2,1,3,34,58,
+34,96,132,41,3,152,66,0,3,46,44,34,45,135,158,0,130,124,0,130,204,0,1,124,
+32,128,148,1,130,133,1,133,119,1,144,72,1,130,87,0,130,43,3,128,32,0,0,34,
+128,126,0,0,58,128,58,0,133,11,1,0,124,132,8,0,133,65,0,140,200,1,135,139,
+1,133,203,1,131,45,0,0,95,133,63,0,0,44,130,99,2,137,65,0,0,92,129,132,
+0,143,67,0,128,121,0,137,14,0,133,12,0,137,147,1,134,131,0,128,60,0,128,206,
+1,0,58,145,204,0,134,0,0,132,208,0,137,150,0,1,95,46,128,75,2,139,196,0,
+128,183,2,150,69,0,132,154,3,0,58,129,214,1,128,0,0,0,45,128,92,2,129,140,
+2,137,7,1,0,39,129,23,3,128,29,3,130,66,3,145,20,1,130,24,2,136,19,0,
+131,12,2,134,65,0,132,125,2,140,95,4,132,249,0,133,166,4,128,196,2,128,86,2,
+130,211,2,136,191,0,128,233,2,0,45,128,147,0,130,154,0,131,116,2,138,123,0,135,
+116,0,128,245,0,129,4,1,135,121,0,0,95,128,175,0,0,45,135,41,0,0,96,133,
+104,0,131,241,2,1,39,45,128,0,0,131,239,0,129,67,0,137,57,0,128,99,2,128,
+25,0,0,44,128,215,0,2,95,95,44,128,111,2,131,124,0,128,0,0,0,44,128,111,
+2,141,129,0,138,114,0,130,16,0,129,149,2,129,154,2,128,72,1,129,89,0,129,27,
+3,144,246,0,128,55,0,0,106,138,55,0,131,162,4,128,137,3,132,159,0,147,172,1,
+131,239,4,143,131,1,2,39,44,39,128,171,0,148,52,0,129,103,2,128,141,0,143,54,
+0,128,157,5,2,39,32,10,0,32,158,0,0,8,95,46,45,45,45,46,46,95,10,157,
+40,0,1,44,39,133,8,0,0,46,157,43,0,0,58,130,88,0,129,4,0,2,39,95,
+124,139,44,0,4,95,44,45,34,39,128,112,0,130,29,0,133,44,0,3,58,39,124,92,
+132,12,0,137,45,0,0,46,133,113,0,3,32,32,96,46,132,8,0,0,124,128,11,0,
+1,45,45,128,24,0,4,46,34,34,46,59,137,45,0,128,25,0,129,95,0,131,88,0,
+132,46,0,134,54,0,128,8,0,0,39,138,182,0,130,45,0,2,58,95,39,131,7,0,
+139,102,0,2,95,46,39,128,8,0,0,96,138,47,0,2,44,34,39,128,18,0,130,121,
+0,134,93,0,130,71,0,1,34,39,131,165,0,141,97,0,128,21,0,134,49,1,1,32,
+47,138,121,0,131,169,0,131,51,0,0,96,136,121,1,128,239,0,0,44,129,121,0,129,
+197,0,128,38,1,137,54,1,136,52,0,131,165,0,134,157,0,128,52,0,131,39,1,2,
+96,124,34,137,36,0,129,0,0,0,106,137,169,0,132,56,0,0,92,130,55,0,128,154,
+0,134,93,1,128,52,0,0,124,130,173,1,133,148,1,128,37,0,135,121,1,133,57,0,
+0,39,128,55,0,128,53,0,135,211,0,129,35,0,1,124,39,128,19,1,128,7,0,5,
+96,46,46,34,39,44,128,112,0,0,10,134,142,0,131,73,0,0,34,128,11,0,136,75,
+0,129,61,0,128,73,0,130,51,0,137,228,1,0,96,135,170,1,0,46,128,247,0,129,
+38,0,131,167,0,132,0,0,0,60,132,133,0,128,3,0,132,40,2,133,66,0,139,139,
+2,132,200,1,128,39,0,136,132,0,130,120,0,137,38,0,0,106,134,213,0,135,99,1,
+1,46,45,141,125,2,134,20,2,136,144,2,1,32,32,129,49,0,0,96,143,118,2,138,
+35,0,129,166,0,130,32,1,136,39,0,134,137,2,143,0,0,0,55,138,103,2,149,37,
+0,137,76,0,128,13,0,146,78,0,130,164,1,138,246,0,0,45,141,39,0,0,44,141,
+34,0,130,76,0,134,37,0,128,13,4,138,4,1,135,191,0,4,124,34,46,45,46,128,
+116,1,128,137,2,147,254,3,133,162,2,183,32,0,128,58,2,132,7,0,144,164,0,130,
+90,1,133,167,0,0,44,140,247,1,143,142,1,148,100,0,128,212,1,135,246,2,137,33,
+0,128,111,3,128,221,3,0,45,128,156,4,129,7,3,131,69,4,138,33,0,1,39,45,
+128,38,1,128,31,0,130,160,1,128,32,0,2,58,95,96,130,221,2,129,59,5,128,0,
+0,140,229,4,128,41,1,1,95,44,128,173,0,2,46,95,92,130,7,0,132,52,0,129,
+54,0,138,216,2,0,44,132,237,2,128,152,0,130,53,2,0,47,131,178,1,137,35,0,
+2,44,39,46,132,116,3,128,219,0,0,58,129,45,0,129,77,4,139,33,3,1,39,46,
+134,46,4,128,149,0,0,34,130,37,0,132,8,3,139,198,4,137,109,1,0,47,135,147,
+2,128,52,0,148,147,1,140,73,3,3,92,39,32,10,0,32,152,0,0,1,46,10,152,
+27,0,1,39,47,154,33,0,8,46,34,32,47,32,44,34,46,39,129,12,0,8,95,46,
+45,45,58,39,96,45,46,130,0,0,2,95,95,95,147,54,0,0,44,129,50,0,5,45,
+34,95,44,39,32,128,35,0,128,65,0,128,18,0,0,46,132,53,0,2,45,34,34,145,
+52,0,1,47,47,128,2,0,128,94,0,129,102,0,0,47,128,90,0,6,34,34,34,46,
+32,124,95,128,14,0,1,58,32,130,57,0,143,52,0,1,44,47,128,46,0,0,96,128,
+33,0,3,96,46,32,32,128,6,0,2,39,46,95,128,94,0,128,11,0,128,0,0,0,
+39,141,46,0,2,46,46,39,128,141,0,128,193,0,0,44,128,4,0,0,58,131,19,0,
+1,96,46,130,18,0,128,2,1,139,45,0,128,18,1,8,45,46,58,32,124,44,39,124,
+95,135,45,0,6,32,47,92,95,95,32,44,138,43,0,1,44,39,130,79,0,3,95,39,
+95,32,129,228,0,2,32,32,59,132,24,0,10,106,44,124,32,124,34,96,45,45,44,92,
+137,35,1,3,58,95,96,46,128,50,0,128,25,1,1,43,92,129,62,0,1,94,46,129,
+187,0,129,175,0,1,47,32,128,48,0,131,36,0,0,39,128,235,0,0,44,128,104,1,
+129,0,0,0,34,128,249,0,128,124,1,1,45,34,128,33,0,3,96,34,39,96,130,181,
+0,129,51,0,129,185,0,2,96,32,108,132,87,0,131,69,0,129,157,1,2,45,46,95,
+128,59,0,128,46,1,0,39,129,52,1,2,45,34,39,128,192,1,0,44,129,169,1,5,
+95,46,47,96,46,34,128,30,0,132,48,0,0,96,128,30,0,129,8,0,0,95,129,136,
+0,130,118,0,129,125,1,129,60,0,130,19,1,128,0,0,0,92,133,184,0,132,58,1,
+129,191,0,128,43,2,128,141,1,2,95,96,34,129,105,0,129,67,0,0,95,132,180,0,
+132,31,0,129,246,1,128,243,1,128,121,0,128,231,1,1,39,96,128,76,0,132,68,0,
+0,43,128,137,0,133,71,1,133,180,0,2,34,39,34,129,71,0,132,178,1,134,0,0,
+0,59,128,131,0,135,45,0,128,214,0,0,124,142,251,1,133,66,0,137,89,1,132,59,
+1,129,48,0,5,59,34,39,43,46,44,128,130,0,2,39,34,39,128,2,0,128,75,2,
+152,0,3,133,0,0,0,39,128,217,0,0,58,129,17,2,1,96,39,131,203,1,128,4,
+2,153,56,3,137,0,0,131,4,1,131,179,1,0,39,131,25,1,164,57,0,0,59,128,
+153,1,133,93,1,134,153,1,144,59,0,2,95,46,44,130,61,3,133,0,0,128,11,0,
+0,39,130,4,2,139,0,0,142,61,0,129,19,2,1,34,39,129,164,2,128,11,0,129,
+107,0,131,132,3,129,90,2,145,142,0,128,63,0,133,34,2,0,44,137,71,0,2,58,
+45,39,128,80,1,128,76,2,128,29,0,130,99,1,158,0,0,0,96,128,70,0,128,255,
+2,128,15,1,0,41,136,72,0,128,163,3,128,215,3,128,81,2,129,12,0,137,228,1,
+156,75,0,129,78,0,136,72,3,128,245,3,0,39,136,169,2,166,0,0,128,144,2,130,
+56,1,0,10,0,32,152,0,0,13,95,44,46,45,45,34,34,34,39,45,45,46,95,10,
+151,39,0,1,44,34,138,14,0,1,96,46,139,65,0,0,39,128,66,0,0,34,128,66,
+0,153,67,0,0,47,142,17,0,132,69,0,140,91,0,129,23,0,150,69,0,0,124,128,
+46,0,142,20,0,0,92,128,3,0,0,39,144,44,0,152,71,0,1,39,46,145,48,0,
+0,92,143,164,0,128,211,0,128,5,0,151,72,0,1,32,106,147,95,0,145,20,0,128,
+167,0,0,124,151,72,0,128,218,0,159,0,0,128,97,1,130,6,0,153,72,0,130,85,
+1,133,160,1,1,95,46,130,192,0,134,171,1,132,64,0,133,126,1,1,58,39,152,244,
+1,2,96,45,46,132,15,1,0,44,130,207,0,133,245,1,132,20,0,0,34,133,15,0,
+128,185,0,0,59,152,70,0,130,110,1,134,68,0,134,233,0,0,40,139,192,1,128,178,
+0,0,45,153,140,0,131,145,0,0,34,135,88,1,132,47,1,131,59,0,133,175,0,0,
+46,158,66,0,145,145,2,0,92,166,52,0,134,195,0,167,53,0,0,95,137,51,0,155,
+149,2,136,51,0,0,45,144,65,2,158,112,0,140,105,0,167,57,0,128,9,1,0,47,
+136,72,1,168,58,0,129,57,0,138,132,1,167,59,0,131,58,0,150,60,0,0,108,151,
+60,0,129,115,4,0,34,132,189,1,130,185,4,143,76,3,149,60,0,133,34,1,129,187,
+2,136,10,0,161,60,0,128,58,0,128,77,3,136,133,0,146,62,0,147,60,0,129,180,
+4,128,47,0,0,96,135,74,0,133,54,0,138,253,0,146,60,0,128,40,0,2,46,34,
+46,133,58,0,130,4,4,134,114,0,137,61,0,129,250,2,0,95,130,206,5,0,96,129,
+138,5,0,46,129,10,0,0,39,128,37,3,2,124,96,39,134,92,4,3,46,40,95,41,
+135,105,4,135,185,0,1,47,10,129,24,1,140,71,1,128,39,0,1,96,46,133,2,4,
+129,11,0,1,95,95,135,54,5,134,68,0,2,47,10,124,142,120,2,1,44,39,128,122,
+0,129,152,1,129,112,4,128,87,0,130,0,0,139,185,3,128,14,0,128,57,0,128,92,
+0,0,95,137,63,1,129,235,0,132,217,0,128,55,3,133,237,3,128,216,3,137,86,5,
+1,96,39,128,197,4,130,90,0,0,45,128,0,0,128,115,6,0,39,141,128,0,0,124,
+128,1,0,141,86,2,0,44,129,11,1,130,20,0,143,137,6,131,86,0,2,10,32,96,
+136,132,5,128,131,3,2,34,39,46,130,51,0,129,103,0,0,44,132,102,2,128,60,0,
+129,36,0,1,124,32,128,10,1,136,211,0,132,0,0,129,123,1,0,46,129,246,2,132,
+222,1,128,143,1,132,153,0,128,52,0,1,46,58,133,47,6,128,36,0,129,7,0,128,
+19,0,1,47,46,128,39,1,128,34,0,138,69,2,133,11,0,131,14,2,0,96,128,93,
+7,137,222,0,2,96,45,39,129,14,0,131,18,0,130,213,0,128,72,0,136,0,1,137,
+74,0,132,4,1,151,45,6,129,51,5,129,0,0,129,173,1,1,46,46,128,90,0,142,
+89,7,137,147,0,0,44,169,94,5,141,103,0,132,44,1,0,124,128,185,1,182,70,0,
+131,4,6,128,142,1,128,17,1,0,10,0,32,137,0,0,2,47,92,10,133,10,0,10,
+95,46,45,45,39,32,32,96,34,45,46,133,19,0,3,39,32,44,46,133,30,0,0,96,
+131,20,0,5,44,39,32,39,95,46,128,39,0,131,0,0,131,62,0,0,124,138,83,0,
+128,0,0,131,65,0,8,34,46,46,43,45,45,46,44,45,133,22,0,0,58,133,88,0,
+1,124,124,134,65,0,129,102,0,133,22,0,2,96,46,95,137,69,0,0,96,134,136,0,
+142,99,0,128,41,0,150,27,0,130,30,0,141,31,0,134,199,0,135,35,0,0,34,128,
+155,0,140,38,0,0,47,129,187,0,144,43,0,128,45,0,0,45,138,42,0,0,96,129,
+41,0,147,87,0,143,186,0,130,43,0,0,106,145,167,0,144,46,0,128,96,1,129,18,
+1,129,42,0,150,46,0,133,119,1,130,45,0,1,46,34,129,97,0,156,47,0,132,48,
+0,128,184,1,129,95,0,129,3,0,129,102,0,153,48,0,131,49,0,130,186,0,133,12,
+2,129,64,0,138,160,1,146,246,1,1,96,34,128,65,2,138,252,0,129,59,1,155,51,
+0,132,144,1,0,39,128,144,1,1,46,46,129,133,2,136,161,1,1,46,95,142,60,0,
+0,124,136,92,1,150,82,1,128,133,0,137,118,0,161,51,0,133,140,1,175,51,0,135,
+53,0,132,204,2,0,44,153,243,0,136,253,0,135,2,1,130,106,1,154,42,1,136,236,
+2,130,101,0,129,82,2,135,157,2,156,50,0,0,47,129,49,0,130,59,0,0,95,133,
+80,1,128,53,0,148,48,0,129,32,2,128,48,0,131,139,2,136,44,3,0,95,146,105,
+0,0,95,131,83,2,0,10,144,78,2,130,55,0,2,96,96,45,130,200,1,130,0,0,
+130,100,4,129,93,0,0,96,156,231,0,0,95,128,43,0,133,141,0,0,10,136,148,1,
+138,35,0,128,36,0,128,81,0,1,34,39,131,131,0,129,224,2,128,230,0,131,135,0,
+3,39,34,34,39,128,125,0,128,0,0,1,34,39,128,147,2,134,228,4,130,39,0,128,
+46,0,0,10,137,220,2,137,82,0,1,44,46,129,80,0,128,42,0,131,37,0,131,121,
+0,128,52,1,129,0,0,131,193,0,129,30,0,132,69,0,128,11,5,130,244,2,145,158,
+0,128,73,0,133,31,0,138,106,3,128,71,0,0,44,129,230,2,2,95,44,45,131,28,
+0,138,247,4,129,100,0,128,97,0,133,122,2,128,188,0,0,46,130,229,0,2,34,32,
+10,0,32,164,0,0,6,95,46,45,45,45,46,10,140,20,0,0,95,140,14,0,128,0,
+0,130,42,0,0,39,131,16,0,0,124,130,47,0,3,46,34,34,34,128,59,0,1,95,
+44,128,21,0,0,92,135,45,0,1,46,34,130,6,0,0,34,131,6,0,136,47,0,1,
+39,46,129,5,0,6,96,46,96,46,95,32,47,136,28,0,142,147,0,0,47,128,36,0,
+1,10,32,129,152,0,132,111,0,128,49,0,128,37,0,2,95,44,46,129,0,0,128,137,
+0,128,15,0,137,162,0,1,46,96,129,52,0,0,10,131,72,0,132,34,0,128,20,0,
+0,34,130,61,0,129,40,0,5,96,34,45,46,32,96,128,54,0,132,242,0,0,39,128,
+62,0,2,44,39,10,129,136,0,132,95,0,2,96,46,39,131,194,0,0,44,128,182,0,
+131,39,0,2,96,46,41,128,23,0,4,45,34,34,39,95,128,210,0,1,46,39,129,195,
+0,0,124,129,120,0,2,95,46,44,128,202,0,129,109,0,2,95,47,32,130,42,0,0,
+59,129,100,0,0,44,129,51,0,0,96,128,19,1,132,82,0,130,47,0,0,44,128,120,
+0,131,236,0,0,39,129,24,1,131,162,0,0,44,128,46,0,128,112,0,136,241,0,1,
+46,32,128,142,0,130,36,0,128,57,0,1,106,96,129,249,0,4,46,39,44,45,34,129,
+9,0,130,4,1,2,96,34,124,128,99,1,134,244,0,0,124,132,82,1,129,169,0,129,
+83,0,1,96,39,131,236,0,135,79,0,128,45,0,128,222,0,0,34,128,11,1,128,238,
+0,128,16,0,131,225,1,128,43,0,138,39,0,132,111,1,0,58,128,25,0,129,107,0,
+0,39,128,97,1,131,190,0,131,94,0,1,32,124,128,96,0,130,108,1,128,84,1,129,
+138,0,130,128,1,0,39,129,67,0,129,114,1,129,78,0,132,116,1,130,189,0,128,13,
+0,0,45,129,221,1,3,95,44,45,45,136,213,1,0,124,129,82,0,128,98,0,135,47,
+0,1,47,40,131,64,2,129,185,0,128,64,2,128,94,0,129,22,0,128,53,0,0,46,
+128,243,0,130,33,0,0,96,132,217,0,129,12,0,0,46,133,94,0,130,115,0,134,52,
+2,133,66,2,131,34,0,129,194,1,129,193,0,128,72,1,129,239,0,1,96,45,131,144,
+0,131,115,2,131,38,0,134,115,2,129,49,0,130,53,1,128,51,0,128,215,0,129,191,
+2,136,243,0,1,32,39,129,147,0,129,220,1,1,124,106,135,145,2,1,32,44,132,176,
+1,0,39,128,6,1,129,208,0,128,18,1,128,171,0,133,56,3,128,245,0,128,112,2,
+2,32,124,124,133,247,0,128,25,2,0,39,133,88,0,132,147,1,0,39,129,51,0,0,
+39,134,50,0,129,130,0,128,127,0,1,124,124,132,120,2,4,39,46,34,46,45,131,76,
+0,131,128,2,128,48,0,131,115,0,131,75,2,136,44,3,0,92,129,208,2,130,141,3,
+0,58,135,103,1,128,20,0,128,4,2,132,165,0,1,46,39,128,219,0,133,53,0,133,
+135,0,130,77,2,0,45,128,182,0,130,36,0,0,39,131,254,2,128,74,0,132,102,3,
+132,176,0,0,92,132,54,0,134,57,1,133,226,0,132,208,3,128,179,0,133,48,0,0,
+34,128,52,2,128,52,0,130,78,0,133,215,0,129,34,3,0,46,134,59,0,135,167,3,
+134,18,0,2,47,46,39,129,36,3,133,78,1,133,165,0,129,147,3,128,99,2,130,176,
+2,1,45,34,128,66,0,131,4,1,128,145,2,130,67,0,129,154,0,128,209,3,134,230,
+2,128,213,2,135,21,1,129,147,1,131,168,2,1,44,34,128,5,0,129,191,1,128,47,
+0,130,238,0,0,96,140,239,2,129,118,0,2,44,45,39,132,228,0,130,187,4,128,95,
+0,128,42,0,136,174,4,137,0,0,128,43,0,128,82,0,130,163,2,128,92,1,130,248,
+0,130,233,0,129,39,4,129,156,0,128,240,2,0,34,130,45,2,130,35,3,130,236,0,
+128,22,1,129,48,0,129,23,1,129,32,1,130,51,3,134,237,3,128,158,0,128,62,0,
+130,138,2,131,86,5,129,181,0,128,90,1,129,244,0,134,35,0,129,220,1,134,144,0,
+129,87,0,130,97,0,130,7,0,129,48,0,128,64,0,0,124,128,101,0,129,245,0,130,
+111,3,129,25,1,133,45,0,0,44,128,125,0,129,148,5,136,224,5,129,0,0,0,44,
+128,99,0,130,234,5,129,142,0,129,77,3,131,11,2,128,220,0,130,48,1,132,156,1,
+128,97,5,128,119,0,0,39,128,20,0,132,234,3,136,148,0,128,208,5,140,37,6,130,
+58,2,130,13,3,0,10,0,32,153,0,0,4,95,44,46,46,45,131,0,0,3,46,46,
+95,10,152,39,0,1,45,39,139,17,0,1,96,45,151,47,0,1,44,34,140,16,0,129,
+99,0,128,95,0,1,96,46,148,49,0,0,47,130,128,0,133,107,0,0,46,129,149,0,
+7,95,34,34,34,58,34,96,34,149,51,0,4,47,96,45,45,34,131,103,0,3,95,46,
+39,46,128,157,0,2,47,32,46,128,148,0,6,39,45,34,39,34,96,92,147,155,0,2,
+47,34,34,128,182,0,128,57,0,128,59,0,0,32,129,51,0,128,3,0,129,215,0,2,
+95,46,96,130,31,0,0,92,129,30,0,145,57,0,132,155,0,3,96,46,95,95,128,109,
+0,129,73,0,2,32,44,39,128,21,0,0,124,128,10,0,128,3,0,1,46,95,129,34,
+0,1,46,96,147,20,1,0,95,128,42,0,0,95,133,221,0,131,78,0,128,17,0,2,
+44,34,124,133,62,0,128,57,0,1,46,124,129,195,0,0,44,128,151,0,142,239,0,128,
+43,0,129,38,0,0,124,128,124,0,128,22,1,129,128,0,1,46,34,128,42,0,4,39,
+45,45,39,46,133,64,0,128,153,0,0,124,130,206,0,129,192,0,0,124,140,65,0,0,
+47,130,51,0,1,46,39,129,40,0,0,58,129,170,0,132,147,0,131,210,0,0,39,128,
+120,1,130,66,0,129,5,0,130,121,1,128,9,0,140,132,0,0,124,128,152,0,128,24,
+0,1,124,106,132,141,0,2,96,39,34,128,130,0,134,29,0,128,56,0,0,96,131,66,
+0,128,196,0,129,106,0,1,95,96,128,76,0,0,41,138,67,0,133,111,0,0,47,130,
+2,0,142,0,0,129,67,0,131,134,0,1,47,39,132,62,2,3,96,32,39,47,136,202,
+0,131,129,2,3,46,44,45,46,135,66,0,133,190,2,130,23,1,4,44,39,58,96,95,
+130,101,0,0,47,130,162,1,132,177,1,128,166,1,135,147,1,128,55,0,129,11,1,0,
+95,128,190,2,0,92,128,42,2,130,8,2,128,43,0,129,71,0,128,66,0,131,35,0,
+0,39,131,126,0,1,47,46,129,44,2,0,46,128,100,2,128,6,0,1,32,124,128,28,
+0,128,128,1,129,72,0,129,64,0,0,58,128,55,0,0,95,128,122,0,128,184,1,129,
+10,3,129,129,0,128,42,0,1,96,34,129,69,0,1,46,34,129,28,3,0,46,132,240,
+1,128,14,0,3,39,34,39,39,131,35,0,0,95,128,2,3,8,95,96,34,34,95,95,
+92,10,46,129,207,0,128,11,0,0,39,132,111,0,129,95,0,128,81,0,130,109,0,129,
+54,0,130,47,0,131,9,0,128,19,0,134,175,1,134,84,2,129,101,1,128,236,1,128,
+175,0,2,95,10,124,132,53,0,129,155,0,131,204,3,0,95,128,138,1,128,0,0,128,
+110,0,128,233,2,128,189,3,0,34,128,129,0,129,227,0,128,232,0,0,96,130,13,2,
+130,214,0,129,242,0,128,207,2,132,75,0,1,46,58,128,62,2,128,181,1,128,148,0,
+129,138,0,128,224,0,136,93,1,0,41,131,162,0,132,114,3,135,6,4,130,248,0,132,
+115,0,1,34,34,132,38,4,129,62,0,0,39,128,43,0,132,119,1,0,96,141,15,4,
+160,0,0,128,51,0,0,10,0,32,139,0,0,16,95,44,46,45,39,34,34,34,39,39,
+45,45,46,46,46,95,10,138,27,0,1,45,39,140,46,0,2,96,46,34,128,38,0,136,
+37,0,1,46,34,131,42,0,0,46,129,70,0,128,72,0,128,69,0,0,95,130,39,0,
+129,4,0,128,11,0,133,41,0,0,44,129,73,0,0,95,128,36,0,140,78,0,128,44,
+0,130,43,0,138,45,0,0,47,129,88,0,0,96,140,122,0,132,48,0,2,32,32,92,
+135,12,0,131,47,0,128,46,0,0,46,141,168,0,137,49,0,132,96,0,133,150,0,132,
+246,0,130,60,0,129,55,0,129,109,0,150,0,0,140,62,0,128,230,0,0,34,130,106,
+0,0,92,128,61,0,129,56,0,154,60,0,130,242,0,136,63,0,133,11,1,4,45,39,
+10,32,106,148,60,0,1,44,45,128,140,1,130,50,0,0,44,129,105,0,138,127,0,130,
+176,0,2,10,32,124,128,6,0,134,117,1,130,0,0,129,185,1,0,95,128,45,0,129,
+140,1,128,29,0,128,2,0,133,10,0,134,60,0,0,44,128,56,0,128,110,1,129,193,
+0,1,39,34,129,245,1,131,199,0,132,214,0,2,95,95,44,130,200,1,129,144,1,128,
+28,0,130,128,0,130,128,1,1,46,39,129,233,0,128,139,0,129,51,1,139,100,1,0,
+95,129,126,0,129,172,0,1,34,39,128,45,0,131,28,0,128,74,0,134,115,0,128,96,
+1,129,20,0,132,33,2,133,36,2,128,35,2,137,68,0,0,92,134,3,1,130,53,0,
+130,219,1,2,39,10,58,136,63,1,1,46,43,128,154,2,0,45,136,174,0,141,203,1,
+136,21,2,0,92,133,57,0,132,171,0,129,83,2,156,160,1,128,55,0,132,58,0,131,
+222,1,137,102,0,142,185,1,144,59,0,137,48,3,137,24,0,160,115,0,132,190,2,172,
+60,0,131,147,0,128,205,1,144,0,0,0,47,147,60,0,134,198,0,129,80,2,2,32,
+32,58,144,59,0,130,47,1,141,60,0,130,55,0,134,20,0,131,181,0,2,96,45,44,
+139,37,4,135,62,0,128,17,2,141,65,0,131,90,1,139,65,0,0,47,128,147,1,133,
+186,3,138,107,0,1,95,46,130,228,1,155,67,0,128,161,2,0,39,129,65,0,128,135,
+4,143,123,1,0,96,134,91,2,141,186,1,129,250,2,134,218,1,2,44,39,46,128,50,
+3,131,29,2,0,96,147,132,1,133,54,0,148,64,2,128,76,0,129,232,2,1,44,34,
+131,67,0,0,46,155,69,0,131,73,0,131,165,3,132,58,3,130,59,3,129,214,0,128,
+168,0,131,151,0,128,161,0,1,96,124,158,70,0,135,233,0,129,72,3,129,21,1,130,
+241,2,129,152,1,0,46,133,243,0,0,34,166,69,0,135,97,1,131,55,3,129,242,3,
+129,71,0,173,64,0,2,32,39,34,132,120,3,128,197,0,129,63,4,174,64,0,130,106,
+1,129,0,0,2,39,32,10,0,32,182,0,0,1,95,10,180,56,0,4,44,34,32,32,
+39,179,60,0,1,44,39,128,4,0,0,47,178,59,0,0,47,130,4,0,176,58,0,130,
+115,0,176,57,0,131,55,0,1,32,46,163,56,0,3,95,46,46,46,136,168,0,128,0,
+0,161,34,1,7,44,39,34,39,34,34,46,96,129,58,0,0,124,128,66,0,155,169,0,
+1,44,45,128,45,0,129,35,0,133,98,0,1,92,92,132,166,0,2,96,46,34,150,110,
+0,7,46,34,34,34,39,46,32,124,132,207,0,130,18,0,0,96,130,70,0,1,32,47,
+149,220,0,131,96,0,0,124,128,1,0,135,0,0,0,96,128,225,0,128,55,0,3,39,
+44,95,95,148,58,2,132,150,0,0,124,128,42,0,139,26,1,1,45,39,128,106,0,128,
+54,0,128,62,0,145,57,0,0,46,133,153,0,3,96,45,46,95,128,3,0,129,42,0,
+2,95,95,44,128,53,0,134,84,0,2,92,32,124,139,57,0,0,44,131,44,1,128,0,
+1,136,160,0,1,32,46,128,14,1,133,77,0,133,36,1,0,46,138,57,0,130,29,0,
+130,159,0,129,58,0,133,35,0,128,36,0,0,124,134,133,0,0,39,128,143,1,1,46,
+95,129,200,0,2,124,45,45,138,176,0,132,109,0,130,9,1,131,157,0,131,240,0,128,
+0,0,135,93,0,130,192,0,0,96,128,80,0,0,95,135,179,0,7,95,44,46,45,45,
+96,34,39,128,26,0,0,34,135,55,0,132,60,0,0,96,128,142,0,128,218,1,128,0,
+0,2,96,39,34,128,113,0,128,38,1,131,7,1,128,61,0,128,5,1,138,48,0,139,
+89,1,128,171,0,3,32,46,92,96,139,81,0,130,34,0,128,4,0,0,92,128,165,0,
+128,0,0,0,10,136,247,1,135,53,0,141,131,0,128,0,1,140,18,0,132,35,1,129,
+242,0,2,46,39,10,129,17,1,137,0,0,129,185,2,1,96,43,128,180,0,1,39,39,
+133,76,0,128,68,0,133,6,1,134,68,0,130,50,1,129,151,1,0,45,142,158,2,130,
+42,0,130,205,0,128,247,2,131,76,1,0,106,129,113,2,143,66,0,130,17,0,0,124,
+140,255,1,133,22,0,133,68,0,131,18,0,0,46,130,67,0,139,38,0,1,95,39,128,
+22,0,150,64,0,130,120,0,130,178,1,133,195,0,129,23,0,131,58,1,134,210,3,130,
+19,0,148,64,0,128,222,0,130,58,0,134,4,1,0,39,130,83,0,128,247,0,0,95,
+128,248,2,128,42,5,0,95,128,128,1,0,39,128,73,0,0,44,143,17,4,134,58,0,
+128,94,1,135,208,1,132,13,0,1,34,34,128,53,2,128,65,0,128,77,0,129,86,2,
+1,92,47,128,134,1,143,59,3,129,60,2,137,200,2,1,32,92,129,16,0,0,96,133,
+73,3,128,111,2,129,127,0,128,66,0,1,44,39,128,210,1,148,184,3,128,112,0,139,
+100,2,130,152,0,128,6,0,0,45,134,125,2,128,63,0,2,92,32,58,130,28,0,154,
+51,4,128,243,0,133,146,1,128,127,0,0,58,128,134,0,1,32,96,128,254,0,130,231,
+0,129,62,0,128,221,0,128,226,2,146,202,0,131,203,4,130,247,3,130,212,0,129,46,
+0,128,68,1,130,72,0,0,96,129,163,0,128,85,3,2,32,47,44,129,38,0,0,44,
+145,63,0,129,195,0,137,74,4,128,3,0,0,39,128,127,1,135,21,1,129,137,0,128,
+62,0,147,61,0,128,150,0,128,119,0,129,155,0,133,196,4,128,187,0,130,234,2,130,
+167,1,1,58,45,128,26,0,128,38,3,0,39,155,72,6,130,33,4,131,23,2,129,138,
+0,129,200,3,131,247,4,1,32,124,128,74,1,155,17,6,128,101,0,0,95,130,58,0,
+135,204,1,128,20,0,128,242,5,159,72,6,129,54,0,160,225,6,128,135,1,2,39,32,
+10,0,32,153,0,0,1,95,10,151,27,0,7,46,34,39,32,96,46,46,46,152,35,0,
+0,39,134,9,0,1,96,46,149,37,0,0,46,132,36,0,5,95,95,95,46,46,39,143,
+37,0,0,95,130,106,0,136,80,0,12,46,95,95,44,45,46,44,34,34,44,32,44,45,
+128,0,0,133,89,0,8,44,46,45,34,34,39,39,45,46,128,45,0,1,58,32,129,2,
+0,132,122,0,1,45,45,134,135,0,0,39,133,22,0,0,58,130,52,0,133,123,0,132,
+19,0,1,95,44,138,15,0,135,187,0,2,95,96,34,128,103,0,1,32,59,130,52,0,
+134,88,0,132,159,0,128,119,0,5,45,39,34,39,34,34,128,104,0,0,46,129,173,0,
+135,55,0,128,3,0,0,34,129,51,0,0,106,138,49,0,142,101,0,0,96,128,91,0,
+132,194,0,0,95,129,146,0,128,219,0,130,212,0,137,105,0,146,154,0,128,7,1,129,
+197,0,130,61,1,129,111,0,131,63,1,129,135,0,131,221,0,139,223,0,137,73,0,128,
+155,0,128,238,0,128,86,1,129,152,1,0,44,129,46,0,0,59,132,73,0,0,92,147,
+48,0,128,0,0,0,124,137,205,1,130,73,1,130,160,0,130,22,0,129,235,0,146,173,
+0,0,124,135,79,0,129,35,0,128,44,2,130,42,0,129,40,1,132,79,0,135,32,0,
+130,252,0,134,56,0,130,141,0,131,24,2,128,70,1,132,177,1,131,128,1,131,38,0,
+0,46,133,58,0,129,109,0,136,127,0,0,39,132,89,0,129,157,0,129,160,2,134,84,
+2,129,39,0,133,109,0,131,133,0,142,180,0,131,57,0,128,8,0,0,95,133,214,2,
+130,35,0,134,222,0,130,31,0,136,34,1,131,177,0,130,4,0,128,34,0,0,40,134,
+232,2,133,201,0,0,92,128,60,2,128,175,2,132,13,0,128,232,1,128,13,0,1,95,
+46,132,144,2,131,5,0,130,166,0,0,45,133,165,0,129,104,0,1,44,34,129,218,0,
+128,89,3,129,213,1,141,11,3,2,32,32,47,133,6,1,129,46,0,131,53,0,129,11,
+0,128,209,1,128,111,0,1,124,47,128,157,0,2,96,34,39,129,25,3,129,0,0,2,
+43,34,124,129,125,0,134,144,1,128,105,0,128,155,0,133,76,1,2,96,45,34,131,170,
+0,1,96,58,128,52,0,128,26,0,129,158,0,129,176,0,1,46,92,128,233,0,142,62,
+2,137,158,3,130,101,2,128,153,1,138,242,2,129,14,3,134,52,0,128,198,2,129,239,
+0,0,44,141,212,3,130,158,3,129,110,0,128,111,0,128,0,0,1,45,45,128,72,4,
+131,232,1,135,208,0,136,226,2,143,195,2,129,233,3,129,128,0,140,88,0,129,85,0,
+1,44,46,139,211,1,130,13,0,133,79,3,139,181,1,128,26,0,129,49,0,129,118,4,
+130,195,0,129,255,0,130,17,0,135,105,2,131,250,1,129,29,0,129,115,2,134,197,1,
+130,185,0,128,252,4,128,185,0,142,175,4,128,149,0,129,173,2,0,10,0,32,139,0,
+0,2,45,46,95,140,17,0,145,0,0,2,95,46,10,141,18,0,4,92,32,96,45,46,
+154,60,0,4,95,44,39,32,124,142,55,0,128,56,0,129,0,0,128,60,0,130,59,0,
+3,95,44,46,45,132,0,0,130,77,0,2,95,46,34,129,22,0,0,39,143,55,0,132,
+56,0,130,59,0,1,45,39,139,26,0,2,96,96,46,130,7,0,0,47,144,54,0,135,
+55,0,149,0,0,0,106,130,136,0,2,95,10,95,135,205,0,134,10,0,157,60,0,4,
+124,46,45,34,39,129,119,0,1,96,46,128,210,0,129,213,0,0,95,128,9,0,1,39,
+34,129,208,0,0,34,156,60,0,0,124,135,178,0,132,191,0,136,8,0,134,225,0,150,
+99,1,133,57,0,133,49,0,142,171,0,0,124,135,77,0,134,51,0,129,115,0,133,37,
+1,135,29,0,140,39,0,129,36,0,0,96,137,119,0,0,46,128,201,1,137,93,1,129,
+47,0,131,183,1,0,96,142,208,0,136,77,0,0,47,130,199,0,3,39,34,34,39,137,
+207,1,128,30,0,139,111,0,130,12,0,133,110,0,0,96,130,7,0,128,57,0,128,61,
+2,130,121,0,138,210,1,141,59,0,131,165,0,128,111,1,1,34,39,128,134,1,129,0,
+0,128,9,0,1,32,44,129,61,0,140,10,2,140,57,0,128,164,1,140,27,1,2,44,
+45,47,132,115,0,130,240,2,143,241,2,140,65,0,2,92,124,44,130,180,2,129,57,0,
+3,45,34,46,47,128,179,0,129,16,0,130,0,0,0,34,128,21,0,0,92,144,139,2,
+138,84,1,133,77,0,0,96,128,56,0,0,32,128,142,0,2,39,44,58,139,181,2,145,
+65,0,141,68,0,128,254,1,2,34,46,44,128,125,0,0,39,128,179,0,1,39,32,137,
+65,0,129,66,0,0,96,143,198,0,130,234,0,1,39,34,134,129,3,137,229,3,130,123,
+3,130,143,1,129,215,2,130,159,0,128,68,0,144,196,3,131,179,1,133,201,3,134,0,
+0,135,151,3,131,66,2,132,64,0,2,32,124,95,145,208,3,132,46,2,131,69,0,129,
+50,1,142,232,0,130,161,0,128,24,0,128,86,0,142,208,1,139,65,0,129,9,0,137,
+79,0,137,89,0,145,72,2,135,53,0,0,47,130,54,3,0,124,128,36,0,145,33,0,
+128,22,0,128,139,2,130,195,0,129,44,0,144,78,1,129,93,0,128,31,0,129,6,0,
+129,68,0,1,32,59,147,186,4,128,26,0,129,69,0,128,211,0,146,137,0,128,166,0,
+129,124,1,0,96,128,129,2,0,10,0,32,141,0,0,3,124,96,46,95,135,12,0,1,
+92,10,142,32,0,0,96,129,3,0,2,46,32,32,128,2,0,128,32,0,130,10,0,130,
+53,0,143,41,0,131,34,0,5,96,46,124,96,45,46,128,41,0,128,10,0,6,45,46,
+46,39,32,32,92,136,34,0,4,95,44,46,45,39,144,58,0,128,38,0,130,60,0,128,
+57,0,131,97,0,132,0,0,2,92,32,47,129,73,0,2,95,44,45,129,33,0,0,47,
+140,57,0,1,46,45,131,97,0,132,60,0,1,46,95,129,172,0,135,184,0,0,124,128,
+107,0,131,11,0,141,56,0,130,147,0,129,88,0,156,0,0,139,55,0,0,44,131,108,
+0,134,112,0,164,54,0,138,208,0,166,53,0,1,95,96,128,221,0,0,45,168,52,0,
+132,35,1,156,121,0,0,44,128,82,0,4,47,34,45,46,95,132,55,0,1,44,34,144,
+84,0,133,230,1,135,53,0,0,39,130,207,1,131,83,0,130,57,0,135,118,1,140,57,
+0,138,117,0,129,37,0,130,102,1,131,18,0,130,59,0,0,44,149,63,1,129,23,0,
+1,40,41,132,61,0,3,44,39,40,41,132,106,1,133,167,1,128,61,0,0,39,128,31,
+2,145,117,0,129,52,0,1,96,46,129,0,0,131,3,1,128,57,1,0,45,128,9,0,
+129,217,2,135,229,1,128,124,0,2,47,32,44,129,41,1,132,0,0,133,59,2,128,5,
+0,128,120,2,135,6,3,131,78,1,2,46,39,47,138,62,0,1,58,10,128,0,1,3,
+39,45,34,34,130,196,2,1,45,34,135,198,0,131,76,2,2,96,34,43,129,142,2,130,
+132,0,3,43,39,32,47,129,61,0,0,106,128,21,0,129,20,0,128,118,0,131,245,2,
+2,96,46,39,130,112,1,138,62,1,128,189,0,129,102,0,131,106,0,129,5,0,0,47,
+131,61,0,132,53,1,129,120,1,133,51,3,130,29,1,130,27,0,137,63,0,129,76,0,
+130,61,0,0,106,129,29,0,0,44,133,214,0,134,26,2,128,69,3,143,52,1,128,242,
+0,0,124,130,32,1,0,95,134,38,3,1,32,47,136,0,4,144,50,0,132,56,0,128,
+2,1,138,225,1,135,52,0,129,127,0,165,0,0,135,65,4,159,136,3,0,95,129,182,
+1,131,43,0,148,53,0,1,44,94,139,192,1,128,212,0,136,165,0,135,10,1,136,53,
+0,128,225,1,131,61,1,2,34,34,96,129,47,2,0,96,130,210,1,135,15,5,135,52,
+0,1,106,95,131,19,0,0,95,150,187,2,130,78,1,128,157,2,1,34,96,136,196,3,
+3,39,44,45,46,128,49,0,0,10,0,32,179,0,0,1,95,10,165,40,0,1,95,95,
+137,14,0,2,124,32,124,161,57,0,3,46,45,34,39,128,6,0,1,96,46,128,0,0,
+132,63,0,151,57,0,2,95,44,45,128,46,0,1,45,46,128,10,0,2,44,39,32,129,
+6,0,133,0,0,0,96,130,12,0,149,57,0,0,46,129,98,0,129,0,0,1,44,96,
+128,55,0,128,0,0,0,92,137,29,0,129,59,0,147,57,0,1,44,39,132,99,0,1,
+46,39,131,55,0,141,58,0,2,124,32,106,128,4,0,137,57,0,4,95,95,44,46,46,
+130,44,0,1,96,45,128,0,0,0,34,128,7,0,134,27,0,133,58,0,5,95,46,46,
+45,43,46,128,23,0,2,124,46,46,134,59,0,1,44,39,128,43,0,129,106,0,138,129,
+0,0,39,129,20,1,128,89,1,128,29,1,0,45,128,10,0,132,133,0,0,124,131,3,
+0,128,97,0,134,63,0,0,47,133,91,0,129,27,0,138,161,0,0,96,131,87,0,137,
+6,1,132,63,0,131,252,0,132,65,0,0,47,128,143,0,3,95,46,45,96,128,35,0,
+0,46,129,160,0,129,188,0,1,34,96,128,115,0,135,80,0,134,3,1,138,65,0,128,
+47,0,131,66,0,0,124,129,204,1,135,85,1,129,175,0,130,179,1,128,118,0,131,158,
+1,135,128,0,128,0,0,128,56,1,136,66,0,131,135,0,0,44,128,114,0,0,34,128,
+212,0,134,10,2,129,32,0,2,39,96,34,133,85,0,128,83,0,1,46,47,131,69,1,
+5,95,44,34,39,39,34,130,63,0,128,69,1,133,46,0,0,44,128,139,1,130,9,1,
+132,184,1,0,96,128,77,0,1,45,45,136,183,0,134,110,0,129,89,1,133,23,0,129,
+69,0,130,142,0,130,166,0,128,164,0,2,124,10,47,128,10,1,129,144,1,129,197,0,
+129,125,1,1,45,46,135,217,0,136,0,0,0,92,131,19,1,130,146,0,129,69,0,130,
+80,0,128,114,1,130,232,0,1,39,10,135,250,1,136,54,1,143,213,2,137,22,1,128,
+33,0,1,124,44,129,206,0,131,21,3,2,32,47,10,135,17,2,128,137,0,129,0,0,
+143,68,0,128,171,0,131,8,1,135,209,2,137,242,0,129,160,2,129,96,3,131,143,2,
+135,47,0,145,33,3,129,188,0,143,7,3,129,204,0,130,14,3,131,104,1,128,135,3,
+144,14,1,134,237,0,128,160,0,0,44,129,69,0,128,54,0,130,75,0,129,75,1,130,
+180,0,129,228,1,130,17,0,128,210,1,131,130,0,144,108,0,133,37,3,130,18,4,0,
+46,133,57,2,1,45,39,128,77,0,133,63,1,128,70,0,139,4,1,1,95,44,144,20,
+1,1,95,32,128,74,2,139,121,1,0,39,131,93,2,133,92,3,130,23,1,128,20,1,
+131,106,0,128,211,0,129,99,0,142,0,0,1,47,34,129,171,3,144,247,2,130,141,1,
+0,44,129,69,0,135,182,3,128,4,3,0,39,138,7,5,136,159,3,134,58,4,128,65,
+0,130,111,2,128,0,0,1,34,39,129,48,4,131,67,0,128,131,3,129,157,0,1,45,
+43,129,92,1,144,25,1,129,49,1,0,46,128,131,1,128,216,0,128,50,0,128,70,0,
+129,58,0,132,151,3,131,132,4,136,214,1,129,155,0,146,92,1,130,190,0,0,34,129,
+105,0,129,189,0,130,248,0,130,39,0,132,131,0,131,51,0,2,95,46,34,130,151,5,
+144,176,2,128,152,0,143,87,0,0,47,129,161,1,132,73,4,129,32,0,133,136,0,135,
+154,3,139,133,0,138,69,5,130,63,0,128,232,2,139,57,4,131,22,3,144,6,1,1,
+32,92,128,179,1,130,177,1,129,193,0,0,95,129,108,0,135,60,0,129,33,1,132,48,
+4,129,63,0,144,61,0,138,18,0,0,39,128,101,0,136,59,0,133,238,0,130,67,4,
+0,124,130,93,0,140,252,0,0,34,142,2,3,0,44,128,40,4,137,67,0,129,178,0,
+0,95,131,2,6,132,80,0,144,195,0,128,186,5,130,95,1,132,30,3,0,45,128,36,
+5,139,127,6,1,96,39,128,227,0,129,159,1,133,104,3,146,58,4,134,151,5,130,180,
+4,144,26,0,129,53,0,128,227,1,129,179,0,0,124,129,251,2,144,141,1,3,44,45,
+43,45,129,42,1,137,67,1,136,203,0,131,202,1,0,96,131,210,4,0,44,133,143,3,
+128,18,5,128,94,2,130,174,5,129,8,0,1,39,92,139,2,1,138,232,0,128,118,0,
+0,44,130,197,0,130,191,2,129,186,1,129,8,0,128,65,0,130,206,5,0,58,129,75,
+1,148,60,0,136,176,1,128,145,1,129,54,0,129,106,0,130,101,6,132,207,3,1,45,
+34,154,100,8,128,242,0,0,43,131,223,3,130,204,2,130,44,3,0,94,129,86,1,154,
+112,0,139,189,0,130,5,6,2,34,32,10,0,32,148,0,0,8,46,34,39,96,45,46,
+95,44,46,132,0,0,2,95,46,45,130,0,0,2,46,46,10,148,49,0,1,47,32,128,
+35,0,0,39,135,15,0,3,44,39,32,44,128,48,0,2,34,34,47,148,49,0,1,47,
+46,136,45,0,133,67,0,128,55,0,1,46,39,146,48,0,143,45,0,131,0,0,128,166,
+0,144,47,0,128,125,0,151,0,0,0,96,144,49,0,129,122,0,132,0,0,2,95,46,
+46,143,51,0,0,92,134,50,0,0,95,130,0,0,128,25,1,136,154,0,1,44,34,128,
+0,0,1,92,41,146,103,0,0,46,129,27,0,133,18,0,0,124,131,71,1,136,36,0,
+137,11,0,135,106,0,129,28,1,129,96,0,0,95,131,53,0,131,115,0,152,210,0,130,
+54,0,1,46,39,129,197,0,0,124,134,252,0,134,3,1,128,209,0,128,0,0,135,105,
+0,0,95,129,153,1,133,191,0,128,110,0,0,92,128,48,1,2,34,39,47,128,240,1,
+132,18,0,131,163,0,128,16,0,0,46,129,119,0,130,136,0,2,44,46,45,134,197,0,
+132,246,0,128,167,0,2,96,46,124,132,235,0,0,34,129,44,0,1,32,92,129,47,0,
+134,75,1,130,102,0,129,22,0,139,0,0,144,224,1,0,96,140,234,1,132,156,0,0,
+96,140,137,1,135,133,1,135,0,0,132,128,0,133,11,0,132,2,0,133,131,0,0,44,
+137,173,0,153,58,0,2,39,46,47,129,55,0,2,96,46,39,131,176,0,136,111,2,0,
+124,156,58,0,131,169,0,132,47,0,0,96,135,236,1,149,58,0,134,123,1,135,211,1,
+130,105,3,131,170,1,1,39,34,128,210,2,2,46,46,39,143,58,0,0,44,130,212,0,
+0,96,129,85,3,129,108,0,130,38,0,132,118,0,128,20,0,136,118,0,141,58,0,128,
+211,0,150,54,2,129,27,2,151,176,0,128,113,0,141,233,0,134,219,1,141,98,3,139,
+58,0,131,138,2,145,56,0,143,154,3,0,106,137,57,0,131,141,0,128,146,2,152,162,
+3,147,115,0,132,110,0,142,58,0,146,252,0,138,57,0,133,146,0,138,134,2,149,192,
+0,139,231,0,133,162,2,0,96,139,230,2,146,127,4,141,248,2,134,222,2,138,60,0,
+145,250,0,138,56,0,2,44,46,34,136,210,0,1,96,46,130,7,2,130,11,2,141,233,
+0,137,55,0,128,192,3,128,148,0,128,105,0,129,209,3,129,14,4,137,162,0,139,104,
+3,137,167,0,128,14,3,128,179,4,130,112,2,145,0,0,137,243,4,145,87,5,148,94,
+6,0,39,128,141,0,129,29,4,131,9,3,145,37,3,148,185,5,135,229,1,128,41,3,
+165,54,0,129,31,3,0,43,129,109,0,0,34,128,199,0,0,10,0,32,142,0,0,2,
+46,92,10,143,19,0,1,32,32,144,21,0,129,0,0,0,92,139,14,0,2,95,44,124,
+142,39,0,0,106,130,24,0,1,92,95,128,0,0,132,36,0,3,46,34,32,124,143,39,
+0,4,124,32,32,45,39,131,10,0,12,96,34,45,46,45,39,44,45,45,45,46,124,95,
+141,40,0,0,47,141,56,0,0,47,130,97,0,128,53,0,0,46,140,42,0,142,41,0,
+0,46,129,100,0,130,105,0,142,44,0,0,44,142,218,0,0,124,135,44,0,141,254,0,
+1,47,124,128,17,1,139,0,0,2,39,32,96,132,45,0,3,47,32,44,39,137,221,0,
+5,44,39,32,124,92,96,141,48,0,12,96,46,96,46,95,95,124,95,47,46,39,44,96,
+135,45,0,0,58,130,67,0,0,96,131,116,0,2,32,44,46,128,1,1,131,57,0,1,
+124,124,129,106,1,1,39,34,139,186,0,0,46,129,48,1,0,124,133,232,0,5,124,96,
+39,45,34,34,131,67,1,1,39,124,136,155,1,136,49,0,0,41,130,15,0,132,49,1,
+128,24,0,136,44,1,128,116,0,136,206,1,134,50,0,1,44,96,130,150,1,132,146,0,
+131,114,0,133,94,1,128,170,0,0,46,135,51,0,133,245,0,130,74,0,1,32,95,132,
+50,0,128,255,0,133,28,2,128,9,0,128,242,0,128,23,0,134,51,0,0,39,128,50,
+0,1,95,44,129,96,0,128,138,0,128,80,0,129,24,0,2,44,39,46,130,0,0,0,
+45,130,119,0,128,44,2,0,95,130,167,0,130,95,1,128,92,0,0,10,128,17,0,129,
+25,2,0,95,129,103,1,128,16,0,1,45,45,132,25,0,135,184,1,0,46,129,48,0,
+0,124,128,36,0,128,0,0,2,34,39,10,133,186,0,128,7,0,130,139,0,133,244,0,
+133,7,0,128,139,1,128,106,0,0,46,138,40,0,130,114,0,133,15,0,133,8,0,2,
+95,47,58,128,148,0,138,38,0,3,32,92,96,45,136,38,0,0,95,128,182,0,128,99,
+0,0,124,137,35,0,1,95,44,129,35,1,128,211,2,128,203,1,128,142,0,132,173,0,
+2,44,94,46,134,36,0,0,96,131,84,1,140,199,0,132,27,0,2,45,46,10,135,24,
+0,129,25,3,146,136,3,133,230,1,133,89,1,128,61,1,133,77,3,147,184,3,128,120,
+1,1,92,92,128,45,0,130,43,1,134,191,3,128,191,0,128,0,0,132,168,3,137,43,
+0,129,44,0,0,95,129,197,3,130,84,0,131,178,1,134,160,0,138,99,3,129,44,0,
+134,17,1,128,231,0,0,43,139,130,3,0,39,136,110,0,128,114,1,129,3,2,131,16,
+0,0,95,130,57,1,138,80,4,138,192,0,129,133,0,2,44,45,34,128,110,0,132,18,
+3,134,88,2,137,138,4,0,95,128,35,3,128,144,0,129,10,1,129,136,3,130,9,1,
+146,11,4,131,134,0,130,5,0,0,92,129,135,0,1,92,95,128,180,0,131,135,1,140,
+88,0,134,230,0,2,46,46,39,128,79,2,129,178,0,0,96,128,92,1,129,96,1,2,
+34,32,10,0,32,136,0,0,3,44,45,34,39,128,1,0,2,45,45,46,137,21,0,139,
+32,0,128,0,0,4,39,96,45,46,10,136,21,0,0,39,135,10,0,0,96,145,57,0,
+0,47,136,11,0,0,92,136,56,0,136,55,0,129,25,0,142,55,0,3,39,32,95,95,
+146,57,0,133,80,0,4,46,43,34,34,96,128,141,0,141,56,0,1,96,45,128,90,0,
+2,96,34,44,143,58,0,133,57,0,2,44,32,124,148,226,0,131,0,0,0,124,134,141,
+0,134,233,0,133,217,0,128,7,0,136,59,0,0,44,130,22,0,0,44,134,49,1,130,
+29,0,133,12,0,0,124,133,59,0,133,233,0,128,56,0,2,124,46,34,134,30,0,130,
+40,0,0,124,133,78,0,0,39,128,61,1,134,12,0,135,59,0,133,24,1,2,124,95,
+46,128,70,0,132,73,0,128,10,0,128,59,0,136,138,0,0,96,129,123,1,133,12,0,
+0,39,134,59,0,130,106,0,1,95,44,130,53,0,130,251,0,2,44,34,34,128,171,0,
+128,192,1,0,39,130,204,1,131,183,0,130,55,0,131,186,1,135,216,1,2,106,45,46,
+129,112,0,131,57,0,128,224,0,128,11,0,128,33,0,130,140,0,128,47,0,129,44,0,
+0,46,128,40,2,132,33,0,1,96,46,128,44,0,135,59,0,0,124,128,97,0,2,96,
+46,95,128,32,0,0,39,129,33,0,128,10,0,133,254,0,130,3,0,0,95,130,202,0,
+2,32,92,96,128,64,0,128,55,0,129,173,1,135,238,0,129,74,0,132,86,0,8,124,
+32,47,92,95,95,95,96,39,128,71,0,131,27,0,2,34,34,95,129,30,0,1,34,92,
+132,21,1,130,119,0,135,24,2,128,62,1,0,45,128,211,0,2,95,44,96,132,65,0,
+0,96,129,13,0,130,9,0,2,95,46,34,133,79,1,0,124,128,129,1,1,44,94,129,
+45,1,135,117,0,129,178,0,3,46,46,44,34,132,43,1,135,73,2,133,122,0,134,139,
+1,128,59,1,129,92,0,136,58,0,128,222,0,128,156,1,0,92,129,7,0,129,0,0,
+142,76,2,129,178,0,128,242,0,128,30,0,1,44,95,128,211,2,0,46,136,58,0,128,
+147,1,129,77,3,128,2,0,1,95,124,128,82,1,129,7,0,137,110,3,131,178,0,5,
+46,39,44,39,95,44,128,118,3,128,245,0,134,58,0,128,0,2,130,152,0,129,50,0,
+0,96,128,91,0,138,125,3,132,196,0,128,6,0,131,105,1,130,9,2,0,96,128,59,
+0,129,159,0,130,189,0,135,188,0,128,99,0,128,37,1,2,45,45,43,128,3,0,129,
+237,0,130,5,0,0,34,128,19,0,135,247,0,128,45,0,131,219,0,0,10,129,136,0,
+0,46,129,218,1,139,38,1,158,0,0,0,39,129,43,2,129,6,1,3,96,10,96,34,
+130,11,0,0,95,128,10,1,171,0,0,131,80,2,5,45,96,34,96,32,10,0,32,157,
+0,0,5,95,44,46,46,95,10,155,33,0,2,45,39,34,130,9,0,1,96,46,149,40,
+0,128,69,0,1,45,39,137,16,0,0,96,149,84,0,0,46,138,38,0,134,46,0,0,
+45,148,47,0,0,46,132,7,0,0,47,146,51,0,146,50,0,0,124,150,49,0,130,29,
+0,150,51,0,1,95,44,146,154,0,132,51,0,5,44,39,34,34,39,34,129,167,0,134,
+21,0,1,96,34,131,22,1,149,51,0,136,129,0,128,55,0,137,155,0,130,117,1,128,
+0,0,134,75,0,133,51,0,0,47,139,21,0,130,52,0,130,149,0,128,131,1,0,124,
+128,61,0,0,124,128,72,0,0,96,133,19,1,130,0,0,0,39,131,207,0,0,96,134,
+21,0,128,46,0,128,64,0,5,96,46,47,92,96,92,129,49,0,130,1,0,0,96,131,
+53,0,129,166,1,128,0,0,131,200,1,0,44,128,17,0,0,124,134,96,1,0,92,133,
+66,0,4,46,95,92,124,95,131,53,0,0,47,128,21,0,0,92,137,164,0,130,55,0,
+129,77,0,129,29,0,134,163,0,131,92,0,1,124,92,130,231,0,3,39,46,124,47,129,
+102,0,128,26,1,0,96,139,65,1,129,31,0,129,23,2,136,114,1,128,57,0,128,54,
+2,139,208,0,135,36,1,129,116,1,129,221,0,130,56,0,129,44,0,130,17,0,131,63,
+1,2,92,44,46,128,144,1,139,57,0,135,146,0,0,92,130,20,1,132,29,0,128,22,
+0,129,137,1,7,124,124,46,39,46,47,32,47,129,20,0,0,124,137,56,0,133,54,0,
+0,47,134,27,2,129,229,1,2,46,39,95,130,35,0,2,124,124,124,128,115,0,128,15,
+0,0,46,129,225,2,128,175,0,128,159,1,129,0,0,131,199,2,129,51,2,0,46,132,
+130,1,131,70,1,0,34,130,79,0,2,44,39,124,129,31,0,0,95,129,138,1,131,179,
+0,128,105,1,1,45,34,128,43,1,128,63,0,129,41,3,0,44,138,135,2,0,46,130,
+52,0,128,231,0,1,96,46,128,87,0,0,34,129,70,1,131,203,1,0,47,131,37,1,
+1,95,96,128,58,0,129,68,0,138,241,2,128,136,1,3,58,34,45,39,141,62,1,128,
+48,0,0,43,131,68,2,1,96,34,130,219,0,138,160,0,129,77,0,4,124,95,44,34,
+46,131,60,1,130,134,2,132,115,2,0,44,129,179,1,129,224,2,0,39,130,81,0,0,
+41,145,42,3,0,39,128,64,1,137,4,3,2,96,34,39,129,25,1,0,34,128,15,1,
+128,88,0,0,92,129,15,1,138,109,0,129,4,1,129,43,1,0,106,128,95,1,128,220,
+0,128,2,0,0,95,132,59,0,2,95,46,58,131,229,0,130,75,2,128,251,0,131,180,
+1,134,250,1,1,95,95,130,181,1,2,45,96,46,133,151,3,2,96,34,96,128,243,1,
+136,254,0,132,52,1,139,56,0,130,191,1,3,45,34,39,45,147,105,4,131,240,1,129,
+82,2,128,228,0,0,96,128,200,1,154,251,4,144,117,4,4,46,47,34,34,34,128,149,
+0,5,47,34,39,95,95,96,172,61,0,130,225,1,2,45,45,46,128,199,3,128,157,0,
+3,96,39,32,10,0,32,149,0,0,5,95,95,46,46,46,45,132,0,0,128,10,0,2,
+95,95,10,146,38,0,128,35,0,0,39,143,22,0,1,96,34,128,51,0,142,48,0,128,
+44,0,144,43,0,1,44,46,134,53,0,1,45,46,140,101,0,1,95,44,144,48,0,2,
+32,32,46,128,21,0,0,92,137,110,0,139,55,0,1,44,34,146,210,0,132,75,0,134,
+110,0,132,58,0,135,57,0,147,108,0,2,32,32,47,135,44,0,149,59,0,134,34,0,
+141,169,0,136,11,0,137,177,0,137,61,0,149,118,0,130,35,0,1,46,95,145,74,0,
+130,15,0,131,62,0,149,121,0,137,84,1,130,39,0,0,96,140,24,0,0,92,130,63,
+0,157,62,0,136,67,0,140,191,0,131,64,0,130,63,0,2,95,95,44,128,34,2,130,
+0,0,134,46,2,145,19,2,141,232,0,129,65,0,0,47,128,50,0,0,34,146,176,1,
+1,96,39,129,74,0,143,72,0,133,106,0,128,0,0,2,10,32,106,159,188,0,128,139,
+2,138,68,0,128,197,1,132,245,0,0,124,128,12,0,1,10,32,151,126,1,140,139,1,
+137,69,0,133,10,2,129,6,0,1,46,10,141,155,1,165,70,0,131,69,0,129,128,0,
+1,124,10,128,140,0,168,0,0,137,138,2,128,152,1,130,208,0,173,67,0,138,69,0,
+0,96,131,6,1,175,67,0,142,22,3,178,67,0,141,69,0,1,124,10,164,150,1,152,
+69,0,1,124,10,142,52,3,164,0,0,135,54,0,128,67,0,181,0,0,134,47,3,0,
+39,128,67,0,179,205,0,134,68,0,129,66,0,181,204,0,131,67,0,0,47,130,200,0,
+133,147,0,0,95,128,0,0,172,16,1,131,64,0,131,65,0,0,46,130,176,3,1,96,
+34,141,90,3,152,0,0,0,39,132,63,0,0,32,129,135,4,137,13,1,128,92,4,160,
+62,0,0,44,130,1,1,133,225,1,139,43,2,141,127,2,152,60,0,131,44,0,141,198,
+5,153,248,0,136,58,0,130,188,3,140,174,0,141,20,5,148,56,0,132,59,0,137,45,
+1,146,17,2,128,240,6,143,112,2,129,57,0,134,105,1,143,90,3,2,95,46,34,147,
+164,2,129,132,7,128,175,0,138,118,5,129,170,5,1,45,34,144,100,0,136,47,5,0,
+34,133,247,7,128,153,5,2,39,32,10,1,10,32,149,0,0,10,95,44,46,45,45,34,
+39,34,34,34,39,131,4,0,5,45,45,46,46,95,95,146,48,0,1,95,46,128,41,0,
+148,71,0,2,96,45,46,144,52,0,1,95,46,149,47,0,153,56,0,1,95,44,147,53,
+0,1,46,95,142,60,0,0,46,138,58,0,148,55,0,132,42,0,141,61,0,138,60,0,
+158,168,0,142,63,0,137,62,0,0,47,157,229,0,131,48,0,139,15,0,0,92,133,63,
+0,153,182,0,129,154,0,140,65,0,0,124,142,129,0,157,126,0,134,49,0,132,67,0,
+129,15,0,132,19,0,132,66,0,158,192,0,137,66,0,128,186,0,137,66,0,132,200,0,
+162,3,1,138,15,1,131,87,0,128,128,2,129,85,2,130,68,0,174,67,0,141,0,0,
+129,69,0,0,106,181,60,0,135,227,0,129,21,1,139,241,0,131,152,2,2,95,46,46,
+128,46,3,0,39,130,43,3,128,5,0,129,48,3,0,96,131,48,3,146,70,0,1,39,
+10,140,140,0,128,65,3,151,66,3,132,13,3,143,229,2,129,142,0,135,84,0,2,95,
+44,45,148,65,0,0,46,140,142,0,1,96,34,128,91,3,138,224,0,133,71,0,128,135,
+0,152,133,0,136,249,0,135,66,0,137,255,2,131,71,0,158,220,3,141,65,1,129,234,
+3,138,74,0,129,71,0,156,252,2,134,71,0,140,76,0,132,75,0,132,17,3,137,31,
+1,171,71,0,132,75,0,131,148,0,164,71,0,130,177,0,131,40,0,142,226,0,129,143,
+0,0,96,128,247,1,161,71,0,129,93,1,1,45,39,128,82,2,2,46,46,43,130,5,
+0,136,0,0,129,99,0,1,106,10,131,106,0,188,0,0,128,213,0,136,67,4,182,0,
+0,128,212,0,192,71,0,0,47,130,43,4,130,250,3,189,68,0,186,28,1,0,44,130,
+206,0,144,149,5,167,0,0,135,255,5,180,66,0,132,198,0,181,133,0,134,194,0,178,
+65,0,0,46,138,61,0,145,31,7,151,51,8,141,59,0,164,62,0,129,117,4,145,88,
+8,133,23,4,148,160,8,1,45,34,149,190,8,129,63,3,140,124,5,129,162,5,147,101,
+0,139,56,0,130,239,8,129,192,5,1,32,10,0,32,147,0,0,2,95,95,46,129,2,
+0,0,10,146,28,0,1,46,34,128,4,0,6,41,32,96,46,96,34,46,146,33,0,0,
+47,130,5,0,3,96,46,46,46,128,9,0,0,92,145,34,0,0,124,129,99,0,1,46,
+39,128,5,0,0,92,130,81,0,148,35,0,129,32,0,131,74,0,128,14,0,145,35,0,
+133,32,0,132,37,0,0,39,146,142,0,130,98,0,132,215,0,5,44,46,46,45,45,45,
+128,153,0,136,219,0,129,20,0,0,95,134,67,0,131,9,0,0,44,137,89,0,0,124,
+133,159,0,1,44,34,128,75,0,128,140,0,128,248,0,133,47,0,1,34,34,130,198,0,
+137,182,0,0,96,132,46,0,129,6,1,3,92,32,95,124,128,81,0,0,95,133,131,0,
+140,44,0,131,9,1,131,48,0,132,114,0,129,54,1,0,39,128,5,0,130,49,0,138,
+134,0,135,48,0,137,211,0,0,95,128,47,0,132,207,0,133,148,0,129,54,0,0,95,
+128,191,1,129,16,0,131,139,1,138,0,0,0,106,131,244,0,0,39,132,67,0,130,146,
+0,130,85,0,130,135,0,131,95,0,136,76,0,0,124,145,67,0,128,19,1,1,45,45,
+129,7,2,131,137,0,131,33,0,132,58,0,0,47,137,70,0,133,7,0,128,48,0,145,
+155,1,134,30,0,135,69,0,132,19,0,132,58,2,133,0,1,134,40,0,143,17,1,139,
+21,0,0,39,131,223,0,129,50,0,0,96,133,111,1,130,95,1,129,68,2,2,44,96,
+46,133,72,0,0,47,131,8,0,129,21,0,148,0,0,3,46,124,96,45,130,14,2,128,
+234,0,0,44,132,82,0,131,217,1,0,96,129,169,0,130,63,0,129,196,2,132,81,0,
+0,124,133,59,2,135,87,2,133,136,0,128,19,2,6,45,45,96,32,39,45,45,133,167,
+0,134,169,2,3,96,34,45,43,128,145,2,130,74,1,132,72,0,128,182,0,128,47,0,
+132,76,0,1,95,46,129,51,0,133,98,0,130,149,1,128,46,0,0,45,134,50,1,132,
+71,0,132,5,2,128,181,3,136,43,1,129,74,2,129,76,2,128,50,0,128,24,0,129,
+0,0,132,126,0,128,32,0,136,20,3,129,47,2,130,70,0,136,109,2,128,150,0,0,
+45,129,184,2,137,18,4,130,91,0,141,116,1,133,168,0,128,110,2,130,68,0,143,43,
+2,136,248,1,129,120,3,0,46,131,235,0,140,243,1,130,73,3,0,34,128,64,0,135,
+63,0,132,183,0,131,81,3,150,164,1,128,0,1,135,50,0,0,47,132,214,0,131,229,
+1,138,226,0,136,214,1,1,39,10,135,78,0,0,47,135,145,3,0,39,129,107,0,145,
+51,0,128,29,1,134,125,2,0,47,130,252,4,135,163,0,128,75,4,141,21,1,0,32,
+129,58,5,129,144,3,128,88,0,130,128,1,133,6,2,136,243,2,129,16,2,133,116,4,
+129,45,0,1,45,34,132,86,0,130,82,5,0,46,129,34,0,129,151,0,128,252,1,141,
+55,0,131,37,0,3,39,34,34,39,139,137,0,131,189,3,130,155,4,128,175,2,140,36,
+3,136,74,5,146,162,1,131,164,5,146,100,1,0,39,137,22,0,145,8,4,132,188,5,
+143,162,1,128,192,0,136,47,0,138,232,3,135,21,0,132,190,2,141,61,0,0,124,138,
+39,5,155,59,0,136,44,3,129,115,3,140,251,0,132,89,0,1,39,45,134,97,0,128,
+34,0,135,126,3,130,0,0,0,34,128,198,1,1,45,34,145,88,4,133,78,2,0,46,
+129,70,0,131,76,3,133,113,3,158,0,0,142,74,2,166,57,0,132,133,6,3,45,45,
+61,61,128,182,0,128,169,5,166,56,0,130,12,1,130,223,6,129,106,4,0,10,1,10,
+32,154,0,0,1,46,39,156,32,0,2,124,32,92,158,33,0,1,32,46,140,34,0,2,
+39,46,95,141,34,0,142,35,0,1,96,46,128,2,0,136,38,0,129,35,0,129,3,0,
+131,150,0,138,42,0,3,95,95,46,46,141,62,0,130,64,0,130,3,0,135,62,0,0,
+39,133,211,0,134,56,0,5,44,46,45,34,39,95,146,228,0,129,57,0,133,62,0,130,
+119,0,130,11,0,0,47,131,68,0,2,95,44,45,129,7,0,1,95,44,146,30,1,130,
+54,0,131,59,0,134,177,0,0,47,128,1,0,128,47,0,0,34,131,61,0,0,34,137,
+54,0,2,96,43,46,132,232,0,0,96,133,61,0,131,161,0,0,46,130,53,0,0,46,
+130,51,0,0,32,139,51,0,130,39,0,2,95,96,45,128,56,0,131,104,0,128,5,0,
+131,112,0,128,50,0,0,44,132,62,0,131,156,0,128,228,0,4,46,45,45,45,34,128,
+0,0,1,45,45,130,20,1,1,45,46,131,51,0,0,92,130,157,0,2,124,32,46,128,
+154,0,129,97,0,128,54,0,129,17,1,3,45,45,44,95,132,0,0,4,10,32,45,96,
+61,128,157,0,139,174,1,129,110,0,0,45,135,222,0,0,124,131,80,1,0,46,128,72,
+1,1,46,43,131,105,0,135,39,0,1,34,45,136,154,1,0,96,129,130,0,128,16,0,
+128,89,0,137,43,1,131,69,0,129,68,0,2,46,39,45,135,59,0,128,215,1,129,187,
+0,128,0,0,130,84,0,0,96,142,107,1,130,190,1,0,34,130,36,0,128,79,0,129,
+60,1,128,49,0,128,70,0,129,143,0,129,189,0,132,56,0,136,55,0,131,49,0,133,
+4,2,0,44,128,123,0,1,92,32,129,2,2,133,209,0,130,159,0,129,0,0,128,116,
+0,129,253,0,131,71,1,131,147,0,128,79,0,0,45,130,233,0,128,163,0,128,6,0,
+3,47,32,45,61,130,55,0,2,34,39,92,130,164,0,135,37,1,130,244,0,0,46,131,
+62,0,128,189,1,130,83,1,129,117,0,129,203,1,1,34,34,130,237,0,131,113,1,132,
+0,0,0,92,128,92,0,128,41,0,128,149,1,129,55,0,130,30,1,128,0,0,0,96,
+130,64,0,1,39,46,128,105,2,129,90,1,128,65,0,130,42,1,1,95,46,130,45,3,
+130,58,1,130,170,0,129,140,0,1,46,39,128,94,0,129,127,0,130,65,2,135,103,3,
+133,249,0,131,226,0,130,87,2,129,103,1,138,75,3,133,226,2,0,39,132,182,1,143,
+73,3,128,159,0,128,149,0,129,65,0,140,52,0,134,72,3,1,32,124,128,62,1,143,
+10,3,134,192,3,129,105,1,135,0,0,136,252,0,0,39,128,112,1,147,98,4,128,43,
+2,0,34,129,115,0,133,67,0,128,52,3,134,205,3,148,119,3,130,91,0,132,65,1,
+129,62,0,131,158,0,0,92,129,205,1,0,45,141,61,3,142,139,0,0,96,128,255,0,
+0,39,132,250,1,142,43,0,131,251,3,129,149,1,142,221,4,141,43,0,0,124,129,36,
+1,0,106,130,72,0,135,238,2,142,43,0,0,39,128,47,1,0,44,128,141,3,128,113,
+0,129,58,1,137,169,4,128,136,0,128,52,0,137,87,0,0,96,130,160,3,129,124,0,
+129,37,0,133,48,3,144,230,1,131,147,1,0,44,131,207,2,129,16,4,128,40,0,139,
+43,0,0,47,137,42,0,130,31,0,133,179,0,128,6,4,135,206,1,128,11,0,0,106,
+138,216,0,0,92,132,159,0,128,38,2,2,45,39,96,133,163,2,128,87,1,129,77,2,
+139,2,1,0,96,128,199,2,128,26,0,0,39,133,84,4,135,197,5,143,181,1,128,41,
+3,1,45,96,133,236,4,128,102,2,129,133,3,128,230,0,138,165,0,143,78,6,132,127,
+0,154,155,6,2,47,34,96,129,159,0,2,95,39,34,144,151,2,136,127,0,131,124,0,
+3,96,34,32,10,0,32,169,0,0,2,46,46,10,169,45,0,3,39,32,32,124,169,48,
+0,0,124,128,3,0,0,39,169,48,0,128,96,0,2,32,32,92,168,49,0,0,47,131,
+6,0,3,96,45,46,95,160,53,0,6,95,46,46,46,45,45,34,130,101,0,132,0,0,
+1,96,34,161,58,0,0,44,137,50,0,138,0,0,129,121,0,130,0,0,157,67,0,0,
+106,161,47,1,157,68,0,129,80,1,158,170,0,169,68,0,0,95,178,66,0,132,117,1,
+131,43,0,1,58,34,129,0,0,1,45,46,138,40,2,155,64,0,129,50,1,0,46,128,
+48,0,4,95,95,44,39,34,133,72,1,1,46,96,135,66,0,166,8,1,0,124,134,204,
+0,3,96,46,92,32,134,64,0,156,63,0,1,44,39,132,54,0,0,95,129,63,0,129,
+194,1,130,82,0,135,76,0,145,63,0,3,46,34,96,45,131,0,0,128,12,2,128,51,
+0,3,46,44,45,34,128,50,0,128,82,2,5,46,95,40,41,96,45,128,189,2,134,63,
+0,145,255,0,136,222,0,131,0,0,1,92,46,128,64,0,133,27,0,129,10,1,134,101,
+2,0,47,146,190,0,0,92,139,141,0,138,14,1,1,95,46,129,149,0,132,26,0,147,
+252,0,136,180,1,140,17,3,138,220,2,147,58,1,145,60,0,1,46,39,141,209,0,147,
+61,0,145,60,3,129,74,4,135,136,2,0,95,132,134,2,144,54,1,0,44,150,79,0,
+132,61,0,129,73,0,0,96,133,69,1,142,63,0,144,183,0,133,141,0,0,124,128,132,
+2,132,70,0,130,37,0,128,25,4,142,127,0,134,224,0,129,225,3,144,132,2,128,211,
+1,1,96,46,130,203,0,143,51,3,138,171,3,129,102,4,142,29,0,131,208,1,140,44,
+3,3,95,44,34,106,141,48,1,138,58,2,130,87,0,128,138,2,0,43,140,185,4,0,
+44,128,17,2,145,166,1,136,54,2,134,53,3,139,45,1,128,122,2,137,235,0,147,1,
+1,134,60,0,132,245,1,129,147,0,1,95,44,132,67,0,129,123,0,151,159,4,135,21,
+0,132,216,0,128,166,0,130,19,0,1,44,34,129,121,3,129,255,0,131,130,0,132,151,
+1,0,44,130,83,3,147,67,0,133,39,0,0,47,128,65,4,128,10,0,131,14,0,2,
+96,47,10,138,100,2,129,44,0,129,30,0,1,96,34,136,212,0,131,10,0,129,113,4,
+0,45,128,188,3,133,112,0,130,188,1,130,114,3,128,131,3,137,214,5,134,21,3,134,
+63,1,0,47,128,152,0,130,60,6,128,171,3,135,52,3,132,7,0,131,255,1,2,96,
+34,39,128,10,5,130,0,0,135,179,1,132,56,4,0,34,131,35,1,128,169,3,0,34,
+128,126,0,134,0,0,150,114,5,133,143,0,136,83,1,0,44,139,170,3,132,88,2,2,
+45,39,34,145,179,3,129,162,4,128,133,0,133,212,0,147,83,4,137,96,2,157,246,5,
+128,220,0,1,32,10,0,32,130,0,0,1,44,46,131,7,0,146,0,0,1,95,95,131,
+35,0,3,34,96,46,10,130,9,0,2,47,32,124,148,41,0,9,46,45,34,39,32,32,
+96,34,45,45,128,6,0,1,32,124,130,46,0,0,47,128,8,0,139,38,0,0,46,128,
+31,0,2,46,46,44,129,34,0,137,0,0,130,46,0,0,106,129,8,0,139,23,0,0,
+96,147,108,0,130,46,0,130,67,0,1,96,45,138,190,0,0,96,146,204,0,129,46,0,
+133,24,0,0,46,138,122,0,141,135,0,134,46,0,130,135,0,2,44,45,34,140,26,0,
+145,94,0,0,39,133,46,0,1,32,92,142,73,0,145,94,0,1,44,34,131,77,1,132,
+28,0,141,52,0,145,51,0,0,124,130,20,0,0,96,135,52,0,140,53,0,129,57,1,
+141,11,1,0,46,131,52,0,128,18,1,136,54,0,139,55,0,133,21,0,0,124,136,54,
+1,0,124,132,54,0,135,5,1,140,55,0,1,95,95,134,54,0,136,57,0,2,124,39,
+124,129,34,0,0,46,135,12,1,134,143,1,132,25,2,129,158,0,0,46,128,78,2,2,
+96,46,95,129,39,2,130,55,0,0,124,128,1,0,2,96,45,34,139,51,0,2,95,44,
+43,139,118,1,130,43,0,1,96,34,128,57,2,131,133,0,129,153,0,134,184,1,139,207,
+1,146,6,2,136,47,0,142,120,2,142,1,1,128,7,0,129,195,0,130,240,0,146,91,
+0,133,96,0,132,49,0,2,44,32,47,130,234,2,0,92,140,90,0,7,95,44,46,45,
+43,34,34,39,132,87,0,128,200,2,130,48,0,130,32,1,130,24,3,136,169,1,130,49,
+3,131,191,1,132,68,0,129,43,0,1,96,34,129,43,0,138,86,0,1,44,39,136,191,
+1,1,96,46,133,180,0,128,24,2,138,124,0,0,47,129,61,0,135,2,1,1,44,92,
+133,190,1,128,123,1,0,10,138,26,1,128,135,0,129,26,0,128,23,0,133,75,1,0,
+92,135,227,2,3,96,34,46,10,137,141,2,0,47,130,190,1,0,45,130,5,0,0,44,
+131,179,0,128,157,0,136,104,0,0,92,137,46,0,129,226,0,128,13,4,2,43,45,45,
+131,254,1,133,111,2,135,34,0,0,44,129,16,2,1,10,124,128,4,0,128,0,0,128,
+46,1,133,195,0,137,142,2,129,19,0,136,2,1,131,7,3,0,34,130,131,0,133,142,
+2,1,10,96,128,98,0,0,39,138,50,2,128,38,0,135,40,1,0,96,129,214,0,132,
+124,2,1,32,44,132,126,0,128,241,0,130,70,0,0,46,130,180,4,132,220,4,141,18,
+2,0,95,135,136,0,134,181,0,130,153,1,134,127,0,1,34,45,136,198,1,144,68,0,
+128,46,0,130,34,1,128,224,0,0,46,138,77,2,0,96,130,175,0,132,119,1,142,218,
+4,174,0,0,141,247,4,179,69,0,139,144,0,132,170,2,179,71,0,189,136,0,137,108,
+5,185,67,0,133,7,2,186,67,0,128,22,1,1,46,44,128,190,1,0,10,0,32,175,
+0,0,1,95,95,136,12,0,5,44,45,34,34,46,10,174,67,0,5,46,39,32,32,96,
+46,133,67,0,128,12,0,129,19,0,170,70,0,0,95,129,0,0,0,124,130,10,0,0,
+92,136,68,0,2,32,32,124,164,70,0,5,95,44,45,39,34,34,131,50,0,131,17,0,
+1,96,46,129,150,0,132,26,0,162,69,0,0,44,131,63,0,133,62,0,138,26,0,162,
+65,0,0,47,133,7,0,129,130,0,4,44,34,39,96,44,151,63,0,3,95,44,46,46,
+138,123,1,134,62,0,2,44,39,46,128,63,0,128,126,0,2,46,39,44,132,133,0,0,
+96,139,77,1,1,46,34,132,30,1,2,96,39,45,128,177,1,1,45,46,128,71,0,132,
+236,0,128,6,0,1,44,39,128,72,0,128,65,0,3,124,32,124,39,135,12,1,134,64,
+0,1,95,95,132,42,0,138,233,0,134,238,0,2,124,96,39,133,31,0,4,96,32,39,
+46,96,132,64,0,128,13,0,129,65,0,0,46,128,110,0,129,29,0,134,21,0,133,28,
+0,128,132,0,128,121,0,0,34,129,70,0,1,39,45,135,95,0,4,96,45,45,45,39,
+134,73,1,0,92,128,66,0,1,96,45,132,14,0,139,132,0,129,255,1,129,20,0,3,
+46,96,34,34,133,70,1,138,94,2,128,96,0,137,87,2,128,70,0,1,95,95,138,40,
+0,131,50,2,1,96,34,128,38,0,2,96,46,47,129,18,1,137,0,0,133,176,0,130,
+36,0,134,84,2,128,132,1,137,36,0,0,106,137,45,0,129,65,1,129,117,0,135,72,
+0,132,177,0,131,50,0,128,208,1,128,61,0,0,45,130,13,1,130,178,2,140,104,0,
+134,67,0,130,6,0,3,96,43,45,46,129,168,1,133,61,0,130,37,0,2,46,10,39,
+134,93,0,137,80,1,138,66,0,128,95,0,135,6,0,0,124,130,61,0,131,31,0,128,
+223,2,131,215,2,129,164,0,128,0,0,137,79,1,133,205,1,129,19,1,128,2,0,129,
+6,0,129,138,2,128,56,0,0,39,130,128,0,136,141,2,128,133,2,138,200,1,129,75,
+0,130,50,0,2,45,45,43,128,188,1,128,3,0,1,46,39,130,49,2,129,147,2,133,
+54,0,130,108,0,0,96,142,131,3,134,56,2,132,181,2,128,75,0,128,17,0,0,47,
+131,53,0,132,210,3,0,95,135,44,1,128,137,2,128,64,1,134,234,3,133,81,0,130,
+32,0,132,52,0,128,67,3,1,34,39,129,99,1,128,228,0,129,74,2,128,28,2,2,
+46,45,43,137,167,3,133,53,0,128,5,0,132,51,0,141,213,3,0,45,128,202,0,0,
+45,141,176,2,132,133,0,146,165,4,132,86,2,141,50,0,128,214,0,129,177,0,144,9,
+4,131,247,0,128,5,0,139,52,4,135,204,0,142,102,0,130,145,1,2,46,46,34,128,
+126,1,141,106,4,129,52,0,130,86,2,129,45,3,138,0,0,128,45,2,132,6,2,129,
+90,1,139,63,3,131,106,0,0,95,128,48,4,147,168,4,130,250,1,146,0,0,0,92,
+129,23,0,143,161,0,135,201,1,0,41,148,244,5,131,93,2,128,216,2,0,95,149,27,
+5,0,96,148,114,0,130,87,0,128,192,0,2,124,124,46,128,49,4,175,111,6,130,138,
+1,2,44,39,124,130,91,3,177,62,0,128,72,3,128,63,0,129,69,1,179,62,0,135,
+45,5,178,62,0,134,138,1,180,62,0,0,32,129,57,6,1,95,32,180,188,0,130,13,
+2,130,1,0,181,62,0,128,165,5,0,46,129,37,6,0,10,0,32,168,0,0,2,95,
+95,10,167,44,0,6,44,39,32,32,96,34,46,162,49,0,0,95,129,4,0,0,47,131,
+11,0,0,39,158,49,0,5,46,45,34,39,32,124,130,96,0,130,55,0,155,48,0,2,
+44,46,106,130,7,0,0,124,132,95,0,130,103,0,1,95,44,155,153,0,128,91,0,1,
+124,124,131,54,0,132,17,0,0,106,129,51,0,129,8,0,0,96,153,56,0,129,45,0,
+132,56,0,133,0,0,0,39,130,53,0,128,181,0,153,216,0,130,50,0,139,55,0,132,
+136,0,0,34,157,53,0,144,31,1,5,39,32,95,46,46,45,138,167,0,0,95,131,0,
+0,137,57,0,0,92,143,57,0,0,96,132,172,0,0,92,132,58,0,1,95,44,129,106,
+1,132,27,0,1,45,46,130,62,0,128,58,0,0,124,145,59,0,130,47,0,0,46,131,
+174,0,128,129,0,141,89,0,0,46,132,57,0,1,98,96,134,43,0,2,46,43,45,133,
+102,0,128,47,0,128,157,0,0,46,130,0,0,129,65,0,0,44,145,93,0,0,92,129,
+69,0,0,96,131,51,0,3,45,39,34,100,132,199,0,4,95,44,46,45,45,128,15,0,
+132,103,1,129,21,0,0,10,128,245,1,147,161,0,128,184,0,0,96,129,46,0,1,45,
+46,129,205,0,129,55,0,2,95,46,45,142,173,0,129,66,0,0,124,149,94,1,1,32,
+39,128,21,1,0,96,131,12,1,128,20,1,0,44,145,62,0,130,238,1,1,96,46,149,
+65,0,132,23,0,1,96,34,129,136,0,129,251,0,1,46,46,128,196,0,0,34,128,0,
+0,132,182,0,129,148,0,128,7,1,129,53,1,146,63,0,134,127,1,4,44,39,46,32,
+46,130,249,0,130,83,0,130,67,1,128,179,1,130,133,1,146,61,0,2,44,39,47,128,
+118,0,1,46,95,130,115,1,131,66,3,2,95,95,124,128,110,0,130,68,0,133,75,3,
+133,236,1,134,216,1,1,44,92,136,211,1,129,88,0,129,26,2,0,92,129,38,0,129,
+0,0,128,133,0,137,26,4,129,96,0,128,134,0,130,149,1,129,115,1,130,110,1,130,
+41,0,0,46,128,166,1,128,4,0,130,96,0,0,46,130,125,0,128,14,2,128,11,0,
+152,228,2,4,96,34,39,34,96,129,239,0,128,114,1,132,131,0,128,6,0,133,44,4,
+137,173,2,152,67,0,0,46,130,238,0,133,150,4,133,9,4,131,134,1,159,62,0,133,
+211,0,128,121,0,135,167,4,134,197,1,161,63,0,130,125,0,6,44,39,34,39,96,45,
+43,129,26,1,128,6,1,1,39,47,129,172,1,0,45,133,172,1,152,28,5,0,44,130,
+246,0,135,127,1,131,119,0,155,246,4,131,171,4,134,35,5,134,54,0,153,105,1,133,
+44,0,138,54,2,130,53,0,128,222,1,151,250,5,133,152,0,140,244,3,134,125,2,149,
+48,5,128,205,1,131,179,2,137,164,0,163,60,0,130,241,2,129,66,2,1,39,55,148,
+239,1,152,62,0,136,167,0,134,202,1,144,38,4,150,220,1,134,212,3,143,229,4,144,
+64,0,146,104,6,0,96,130,16,3,128,168,3,152,228,6,1,46,45,128,141,5,0,34,
+128,41,0,129,101,0,163,163,2,140,0,0,140,221,0,159,88,7,147,57,3,134,174,5,
+131,147,4,177,0,0,129,232,4,128,72,6,0,10,0,32,137,0,0,0,95,129,0,0,
+138,17,0,135,0,0,3,44,34,46,10,134,39,0,3,46,45,34,39,130,9,0,2,96,
+96,46,143,42,0,0,46,129,27,0,0,96,132,45,0,0,44,131,40,0,134,27,0,141,
+86,0,132,30,0,0,124,130,46,0,130,57,0,137,0,0,0,124,138,158,0,135,75,0,
+129,46,0,140,89,0,129,0,0,136,17,0,138,29,0,128,46,0,0,44,140,42,0,0,
+47,137,33,0,140,119,0,7,39,45,45,45,46,46,95,10,137,79,0,130,51,0,136,39,
+0,141,125,0,0,47,132,7,0,3,96,45,46,10,140,228,0,1,44,34,143,38,0,144,
+177,0,3,32,96,46,10,132,239,0,132,6,0,137,71,0,144,103,1,137,0,0,0,92,
+140,58,0,137,56,1,138,68,1,204,59,0,0,32,141,179,0,137,48,0,1,96,10,133,
+221,1,144,76,0,140,57,2,1,95,44,128,113,1,140,89,0,1,32,92,137,54,0,130,
+75,0,2,95,95,46,128,0,0,129,40,0,1,96,46,132,171,2,2,95,44,45,131,102,
+0,1,34,45,136,82,0,129,33,2,130,62,0,132,130,0,0,39,128,134,1,133,108,1,
+128,181,2,129,135,1,2,96,39,34,134,18,0,140,146,0,130,142,2,130,62,0,132,18,
+0,0,39,133,26,0,130,33,3,145,245,2,133,48,0,129,44,0,130,204,2,130,13,0,
+132,18,0,133,25,0,128,228,0,0,96,151,135,1,131,33,2,131,56,3,130,98,0,138,
+61,0,4,40,32,34,32,41,136,85,2,129,8,1,3,46,46,45,45,128,197,0,129,44,
+0,129,36,0,132,59,0,131,181,0,138,60,0,0,96,139,233,0,135,212,3,131,95,1,
+1,96,46,131,179,0,128,84,0,0,124,133,76,0,143,163,1,138,43,1,130,80,0,130,
+154,1,0,92,129,58,0,130,9,0,0,46,128,49,0,0,45,128,25,0,128,146,0,1,
+34,96,128,67,3,149,76,4,128,65,4,132,142,0,130,59,0,131,134,0,1,96,46,139,
+108,2,128,73,3,130,126,0,0,47,128,133,0,134,27,2,0,95,137,76,3,130,60,0,
+128,110,0,130,28,0,146,223,0,128,20,0,0,124,130,223,0,1,34,43,129,235,1,128,
+41,2,128,6,0,0,39,131,39,2,135,207,4,3,96,34,45,45,128,78,2,140,161,0,
+130,104,0,130,61,0,133,220,0,130,115,1,132,93,1,131,176,4,136,111,2,1,96,43,
+128,164,0,128,0,0,128,35,0,132,143,2,129,147,0,134,61,0,0,124,131,73,2,128,
+11,0,130,18,0,141,61,0,128,143,2,128,56,0,133,38,2,133,187,0,134,98,1,0,
+124,130,238,2,131,206,0,128,25,0,140,61,0,131,22,0,128,130,0,129,128,0,134,93,
+1,130,106,4,130,193,1,133,219,0,129,23,0,0,44,128,159,4,142,119,2,128,171,1,
+130,49,0,1,46,95,128,31,1,136,105,5,1,46,39,131,58,0,129,32,1,128,23,0,
+131,216,5,142,63,0,130,169,1,0,44,131,245,0,128,73,0,133,27,6,128,68,0,128,
+12,1,128,89,1,0,34,129,150,0,132,31,0,144,251,0,131,245,2,128,55,0,132,57,
+0,1,44,96,129,163,1,130,135,0,137,133,4,130,248,3,128,141,0,132,169,2,140,232,
+1,129,216,1,129,112,2,133,11,4,140,32,1,0,46,133,254,2,1,46,34,145,125,0,
+128,191,0,128,125,0,145,57,0,135,32,2,130,32,0,0,10,0,32,155,0,0,1,44,
+45,128,0,0,1,46,10,155,36,0,0,39,131,6,0,0,124,155,38,0,0,47,133,45,
+0,149,38,0,4,95,95,44,46,46,132,75,0,128,0,0,3,34,45,46,95,134,26,0,
+144,51,0,4,95,46,45,34,34,144,70,0,2,96,45,46,129,184,0,3,34,32,96,34,
+136,184,0,0,44,130,77,0,0,95,136,95,0,144,57,0,0,34,132,29,0,134,162,0,
+0,44,130,16,0,0,96,145,102,0,145,0,0,133,1,1,129,128,0,169,0,0,134,167,
+0,0,96,136,57,0,128,223,0,1,45,46,141,73,0,0,95,128,0,0,136,120,1,133,
+55,0,133,91,1,133,177,0,2,46,32,96,137,196,1,128,215,0,128,72,0,136,92,0,
+0,96,133,113,0,135,56,0,135,28,0,0,124,142,178,1,2,32,32,92,135,77,0,0,
+92,131,58,0,135,27,0,128,113,1,130,0,0,0,46,136,189,1,0,46,129,168,0,132,
+169,0,136,195,0,131,59,0,162,30,1,3,96,39,34,34,133,143,1,137,60,0,146,192,
+1,130,109,0,138,26,1,147,99,1,0,106,137,96,0,3,46,34,34,47,129,100,0,134,
+42,1,130,113,0,1,34,39,130,201,0,2,46,44,45,142,217,1,135,24,1,130,63,0,
+0,47,148,199,0,1,44,92,137,28,1,135,110,1,139,62,0,131,169,2,141,177,0,130,
+160,2,143,226,0,128,41,0,146,65,0,131,157,2,131,126,1,130,0,0,139,49,1,141,
+156,2,0,46,151,200,2,156,61,1,132,65,0,146,128,0,129,92,3,132,170,1,128,114,
+3,154,77,4,0,39,148,65,0,129,53,0,128,238,2,128,121,1,140,4,3,140,38,0,
+3,34,10,96,46,142,51,1,131,24,1,0,39,130,114,2,130,254,2,148,165,0,133,47,
+3,139,30,0,0,44,128,178,0,138,113,0,128,66,0,147,9,1,0,47,143,127,2,129,
+12,0,4,96,46,95,96,46,128,125,0,0,34,128,128,0,128,59,0,128,192,1,145,191,
+0,131,60,0,139,26,0,1,96,39,129,0,2,128,63,0,133,239,3,128,78,0,145,161,
+4,132,59,0,143,24,1,129,16,0,128,124,3,2,39,34,32,128,58,5,129,61,0,144,
+29,2,134,2,5,141,60,0,131,41,4,153,19,2,137,170,5,135,217,3,128,29,3,128,
+106,0,129,112,0,128,189,0,128,124,2,129,42,3,143,241,0,128,234,1,148,69,4,132,
+119,0,133,168,5,138,142,1,128,89,0,2,34,45,34,134,57,0,136,117,4,128,44,0,
+138,223,0,128,7,2,135,15,0,128,119,1,135,169,0,1,96,46,128,154,0,0,34,133,
+85,1,149,176,2,145,133,6,129,204,0,156,217,5,141,0,0,133,161,0,128,185,6,133,
+190,2,130,195,1,149,227,6,1,96,34,129,173,3,134,114,1,128,197,0,128,12,0,0,
+10,0,32,142,0,0,2,95,95,46,128,0,0,0,95,128,0,0,7,44,39,32,32,96,
+45,46,10,134,26,0,8,44,34,34,45,46,46,45,39,34,135,45,0,1,34,45,129,5,
+0,0,124,132,13,0,1,46,46,132,67,0,128,64,0,135,54,0,133,29,0,5,32,95,
+44,32,46,44,136,106,0,2,39,46,95,129,6,0,0,47,128,102,0,3,39,34,34,34,
+128,110,0,128,44,0,134,55,0,0,46,130,15,0,132,147,0,128,0,0,138,165,0,1,
+96,46,129,157,0,132,26,0,132,17,0,131,57,0,2,95,44,34,128,127,0,132,59,0,
+0,92,130,125,0,2,39,34,45,128,183,0,134,117,0,132,7,0,0,92,128,56,0,0,
+96,128,208,0,135,59,0,5,124,32,44,39,34,124,128,142,0,132,99,0,0,45,130,6,
+1,131,8,1,130,16,0,132,63,0,1,124,92,128,114,0,129,178,0,128,23,0,128,62,
+0,0,92,130,60,0,4,46,39,45,45,45,132,40,0,143,175,0,0,46,130,118,0,129,
+64,0,0,124,128,99,0,129,71,1,128,31,0,0,39,129,159,0,130,122,0,129,115,0,
+129,120,1,4,45,45,34,34,124,128,59,0,0,47,128,88,1,128,67,1,0,47,134,58,
+1,128,153,0,135,11,1,131,238,0,128,60,0,2,92,32,39,129,103,1,0,46,128,124,
+0,128,179,1,128,127,0,128,129,0,128,91,0,128,0,0,128,60,0,128,3,1,0,124,
+130,221,0,137,130,1,128,226,0,2,46,96,34,129,21,0,0,92,128,193,0,132,111,1,
+0,124,128,7,1,143,8,2,128,129,0,0,39,133,208,0,128,109,0,133,53,1,4,96,
+46,95,96,46,128,183,0,1,32,124,128,19,0,128,12,2,1,10,46,134,59,0,129,57,
+2,139,246,0,131,250,0,140,185,1,128,34,0,129,5,2,0,96,129,160,0,0,10,132,
+90,0,2,44,34,39,130,119,2,131,155,0,137,0,0,135,2,1,133,151,0,133,111,0,
+129,57,1,130,29,0,0,124,132,36,0,133,7,0,133,0,0,130,189,0,0,96,137,113,
+2,134,0,0,0,47,128,59,0,1,96,44,128,107,0,129,206,0,129,54,1,130,228,1,
+0,44,131,47,1,134,120,2,0,39,129,3,2,139,29,3,132,50,1,0,44,128,62,1,
+129,200,0,129,172,1,128,116,0,130,61,0,128,7,0,130,33,2,129,28,1,132,249,0,
+0,47,129,66,2,132,27,1,129,76,0,0,34,128,58,0,129,57,0,129,116,0,128,62,
+0,0,95,128,63,1,1,95,44,128,184,1,134,113,0,134,192,0,131,22,1,128,14,0,
+1,44,39,129,32,2,128,58,0,128,55,0,128,140,0,0,39,128,16,0,135,99,1,128,
+17,0,134,38,3,128,75,0,132,77,3,129,220,0,133,107,1,129,21,2,128,105,0,128,
+232,2,129,8,0,137,147,1,1,44,39,129,5,0,130,42,3,134,48,0,134,233,1,1,
+96,39,130,127,2,133,72,1,0,34,128,26,1,0,34,128,27,0,0,96,135,16,2,135,
+50,0,130,141,3,134,132,0,130,157,1,130,161,0,133,148,1,131,81,0,0,41,136,218,
+3,135,253,3,1,44,34,129,125,1,128,245,2,134,239,0,131,118,1,134,212,0,139,51,
+0,137,254,1,131,255,0,134,58,1,0,92,131,157,3,129,73,2,142,51,0,150,0,0,
+129,133,1,0,44,128,66,0,0,10,133,0,0,1,10,32,164,0,0,3,39,34,45,46,
+165,44,0,1,47,47,128,4,0,155,45,0,2,46,44,46,133,88,0,129,44,0,1,32,
+96,153,45,0,0,124,128,3,0,0,92,131,89,0,132,53,0,131,13,0,128,0,0,0,
+44,154,102,0,129,56,0,1,32,96,128,51,0,2,47,32,39,132,18,0,131,57,0,3,
+44,39,32,124,152,56,0,0,46,130,56,0,128,58,0,1,34,45,133,55,0,130,57,0,
+128,54,0,128,84,0,152,56,0,0,124,132,56,0,139,0,0,0,92,131,68,0,0,39,
+145,56,0,2,44,45,45,129,211,0,140,56,0,0,95,132,30,1,128,128,0,129,8,0,
+0,96,143,229,0,1,95,95,128,24,0,4,44,46,96,46,106,131,218,0,6,95,46,45,
+39,34,34,39,129,161,0,4,124,95,95,32,46,130,63,0,132,255,0,141,60,0,128,27,
+0,128,25,0,0,124,128,120,1,129,27,1,131,213,0,1,32,46,132,164,0,130,8,0,
+128,23,0,2,44,95,46,130,68,0,0,92,141,61,0,128,30,0,134,20,1,4,92,45,
+43,46,46,128,172,0,132,16,0,0,46,131,74,0,128,63,0,134,81,0,141,124,0,130,
+140,1,133,71,0,131,244,0,128,185,0,132,55,2,137,39,0,131,12,0,140,108,1,128,
+20,0,131,23,0,130,91,0,139,51,1,133,132,0,130,209,0,2,95,124,44,130,189,0,
+139,126,0,128,59,0,131,36,0,131,68,0,135,48,0,134,44,1,132,74,1,0,34,134,
+98,0,137,63,0,133,62,0,128,25,0,0,95,130,29,0,130,62,1,132,142,1,131,63,
+0,1,95,44,140,204,0,137,128,0,0,47,132,106,1,0,47,136,171,0,131,66,0,2,
+44,39,46,128,2,2,135,60,0,136,12,1,136,129,0,0,47,132,94,1,0,47,136,234,
+0,129,65,0,3,95,44,39,44,128,177,0,0,39,137,15,1,133,137,1,136,118,2,1,
+44,43,133,166,1,138,248,0,2,46,39,34,131,16,0,135,36,3,131,167,1,135,11,0,
+132,65,0,135,95,0,137,64,0,0,46,130,116,2,130,31,0,0,44,135,16,1,1,32,
+106,138,91,1,1,10,46,128,156,2,4,45,45,43,45,45,143,129,0,0,124,135,248,1,
+130,49,2,142,144,1,132,6,1,134,244,3,128,202,0,0,95,139,251,1,132,97,3,132,
+14,1,134,27,0,138,36,0,129,7,1,128,28,0,136,127,0,0,95,130,0,0,132,197,
+0,128,154,0,130,107,3,131,68,0,128,11,0,135,65,3,141,8,1,129,29,3,129,64,
+0,2,95,46,34,132,98,3,128,57,0,134,250,2,136,57,1,130,28,0,139,66,0,133,
+206,1,130,21,0,128,134,0,1,47,92,131,10,0,128,62,0,135,254,2,134,50,0,132,
+84,0,128,29,2,144,66,0,129,165,0,128,31,0,128,21,2,129,174,2,135,27,3,137,
+66,0,135,6,2,137,92,3,140,86,3,132,85,5,128,141,0,140,151,1,129,64,0,0,
+58,132,41,1,140,65,0,139,66,0,128,189,2,133,130,0,129,150,4,133,74,1,130,3,
+2,128,17,0,1,96,46,130,88,0,130,166,0,134,247,4,128,51,0,137,66,0,0,124,
+129,66,0,129,38,0,2,47,32,124,132,134,0,129,74,1,129,87,0,128,55,3,128,7,
+5,1,46,95,128,104,4,1,46,46,128,90,0,131,178,1,129,142,0,0,92,139,66,0,
+2,96,45,34,131,154,3,0,46,133,11,3,0,46,129,82,0,2,96,45,39,135,216,0,
+132,87,4,128,146,0,132,108,3,138,66,0,129,22,0,129,168,2,0,34,128,38,0,132,
+162,1,130,152,0,128,131,1,128,22,4,0,46,129,27,4,132,54,0,0,46,131,148,1,
+128,191,1,149,18,6,129,97,0,128,9,1,128,47,0,1,124,44,138,62,5,134,175,0,
+128,190,5,128,170,5,128,95,0,128,193,3,155,92,7,130,80,5,145,150,7,130,28,0,
+0,124,128,231,1,166,201,7,145,0,0,2,34,32,10,0,32,136,0,0,3,44,34,46,
+10,137,15,0,3,124,45,45,92,139,16,0,3,32,46,39,92,129,7,0,140,39,0,3,
+39,32,32,95,128,23,0,128,7,0,0,44,140,25,0,11,44,46,46,95,32,92,95,124,
+32,96,46,124,129,16,0,3,46,45,34,124,136,33,0,0,46,128,57,0,131,22,0,0,
+45,128,5,0,8,96,46,32,44,39,44,34,32,39,135,33,0,2,39,95,46,129,65,0,
+128,33,0,2,46,124,96,129,16,0,1,92,32,128,50,0,0,47,135,32,0,130,20,0,
+129,57,0,132,72,0,128,28,0,138,31,0,129,17,0,129,32,0,132,33,0,1,44,39,
+128,43,0,137,30,0,130,149,0,128,31,0,0,124,130,32,0,1,96,45,128,108,0,2,
+96,34,34,138,8,1,132,163,0,128,245,0,0,39,132,69,0,129,17,0,136,164,0,129,
+149,0,138,11,0,132,214,0,2,96,95,95,128,255,0,138,16,1,134,168,0,135,116,1,
+1,46,45,130,45,0,135,79,0,128,242,0,128,18,0,132,41,0,0,95,130,75,0,1,
+34,45,131,62,1,133,218,0,0,95,132,52,0,128,20,0,5,44,96,34,39,34,34,129,
+19,0,136,98,0,1,46,45,130,119,0,128,75,1,132,225,0,128,185,1,136,114,1,131,
+52,1,129,148,1,130,46,1,131,165,0,131,96,0,131,139,0,133,22,1,128,28,0,135,
+65,0,129,90,0,1,96,39,129,82,0,133,17,1,134,0,0,129,65,0,4,95,95,10,
+46,39,132,109,1,128,12,0,128,176,1,1,32,124,128,11,1,131,66,0,131,50,0,131,
+85,0,130,44,1,132,22,0,134,63,0,130,87,2,129,237,0,1,10,124,128,163,1,132,
+170,1,129,68,0,128,233,0,0,34,138,52,1,132,154,0,129,102,1,137,22,0,131,123,
+0,2,92,44,45,128,72,1,2,92,34,44,131,232,0,0,44,128,208,1,143,120,1,132,
+65,0,128,66,0,0,96,134,90,0,128,129,0,130,17,0,128,128,0,128,44,0,1,34,
+34,130,131,0,2,96,32,46,129,215,2,133,51,0,128,229,0,130,249,1,135,233,1,1,
+47,95,129,226,1,2,45,45,34,131,94,0,130,60,0,134,144,0,131,101,1,131,6,3,
+0,45,129,54,1,128,19,0,0,43,133,110,0,2,32,32,86,136,150,0,129,39,1,137,
+39,2,130,135,2,132,149,0,0,96,128,252,1,0,46,128,120,0,0,44,128,156,0,130,
+69,0,132,74,3,133,255,0,0,92,138,137,2,129,56,1,139,100,2,129,179,0,134,109,
+1,132,26,0,130,64,0,138,113,0,129,110,1,128,75,0,1,34,45,129,108,0,128,128,
+2,130,0,1,134,71,0,128,8,0,130,7,1,129,111,2,138,110,0,131,246,0,0,34,
+137,255,2,1,95,44,133,95,1,130,102,0,129,33,0,128,57,3,137,52,0,130,69,0,
+132,229,0,128,0,0,129,109,0,135,148,1,130,94,1,0,124,128,20,0,140,50,0,133,
+31,0,0,47,128,92,2,132,104,0,134,50,0,129,156,0,137,86,4,1,44,46,134,186,
+0,129,153,0,128,103,0,128,68,2,137,47,2,0,92,136,46,0,128,31,1,128,159,1,
+131,172,1,0,95,133,40,1,128,231,2,1,34,45,135,71,1,0,96,134,197,3,129,141,
+2,128,161,0,1,92,95,128,210,1,131,211,1,137,165,0,131,48,0,1,46,46,137,141,
+0,1,39,39,132,160,3,143,0,0,130,103,3,129,10,1,0,92,137,189,0,150,0,0,
+129,126,5,129,86,3,129,10,0,161,47,0,130,171,3,129,188,0,128,144,0,0,10,1,
+10,32,144,0,0,12,95,44,46,45,39,39,34,34,34,96,45,46,95,144,33,0,1,44,
+34,138,14,0,0,96,144,36,0,1,44,39,128,4,0,1,46,46,130,11,0,131,5,0,
+129,39,0,140,38,0,0,46,129,36,0,3,32,32,124,124,137,6,0,135,80,0,1,44,
+46,129,0,0,3,45,45,45,39,139,111,0,140,123,0,128,164,0,0,46,131,48,0,128,
+12,0,131,188,0,1,34,47,134,31,0,0,34,128,62,0,135,45,0,129,35,0,131,38,
+0,128,25,0,1,39,45,129,144,0,1,95,95,128,99,0,129,34,0,128,178,0,134,54,
+0,139,0,0,0,92,130,91,0,128,3,0,128,14,1,0,95,128,44,0,0,10,131,65,
+0,128,58,0,129,230,0,0,44,151,155,0,133,4,0,0,32,128,133,0,130,252,0,128,
+116,0,130,244,0,132,249,0,130,173,0,0,43,132,38,1,141,55,0,129,214,0,128,107,
+0,133,77,1,130,107,0,129,49,0,128,222,0,128,6,0,0,65,131,142,0,140,11,1,
+130,20,0,130,50,0,2,96,34,43,133,99,0,131,7,0,128,62,0,128,254,0,129,25,
+0,0,45,138,109,0,2,34,39,39,132,101,0,133,41,0,135,194,1,2,95,95,95,131,
+191,0,140,0,0,0,124,131,47,0,138,26,0,2,39,32,46,129,95,0,1,96,46,144,
+49,0,128,217,1,128,232,0,131,52,0,134,229,1,134,38,2,132,153,1,142,52,0,128,
+102,2,0,44,132,153,0,137,52,0,136,164,1,129,152,1,142,105,0,0,47,142,50,0,
+0,106,139,167,0,142,50,0,132,49,0,136,25,0,3,124,39,96,34,128,24,1,1,34,
+96,129,5,3,138,177,0,130,29,0,132,48,0,136,0,1,138,191,0,141,98,0,133,197,
+0,133,13,2,140,186,0,140,117,2,135,45,0,132,210,1,137,8,0,134,48,1,133,65,
+3,138,82,3,135,46,0,128,182,0,152,41,0,130,75,2,130,55,3,128,57,3,135,0,
+0,130,112,2,133,64,2,132,80,0,131,128,3,141,217,2,128,206,2,130,155,3,2,39,
+32,10,0,32,146,0,0,0,95,129,0,0,138,13,0,0,10,144,37,0,2,44,34,39,
+130,7,0,1,96,46,129,12,0,0,45,131,13,0,1,96,34,129,13,0,128,15,0,0,
+46,144,50,0,128,26,0,3,44,45,45,45,129,33,0,1,124,44,129,46,0,2,95,46,
+46,130,46,0,130,4,0,0,124,128,73,0,139,52,0,1,95,46,128,45,0,6,39,96,
+39,34,45,46,95,128,30,0,1,32,47,129,42,0,0,39,129,20,0,129,115,0,130,111,
+0,128,4,0,0,124,137,52,0,130,86,0,134,0,0,3,96,124,32,47,128,98,0,128,
+62,0,130,209,0,128,66,0,0,124,128,160,0,129,34,0,137,52,0,129,86,0,1,32,
+95,129,153,0,0,43,130,155,0,134,67,0,0,96,128,14,0,0,124,128,52,0,129,15,
+0,0,96,129,70,0,0,46,136,8,1,130,41,0,0,96,128,152,0,130,28,0,2,96,
+44,39,129,16,0,133,208,0,1,92,96,129,31,0,130,25,1,131,4,0,0,45,136,218,
+0,2,124,95,44,129,75,0,1,46,96,128,113,0,1,34,39,128,95,0,128,70,0,128,
+5,0,2,46,34,96,131,58,0,0,46,129,50,0,130,54,0,0,92,130,47,0,3,92,
+10,32,44,145,221,0,130,207,0,133,2,0,130,42,0,0,92,129,137,0,128,146,0,129,
+60,0,128,71,0,129,165,0,1,10,124,131,26,0,131,57,0,0,95,129,160,0,129,17,
+1,0,34,135,59,0,128,48,0,131,33,0,0,46,128,189,1,129,89,1,128,55,0,2,
+46,32,92,128,222,1,128,55,1,128,62,0,128,21,0,129,164,0,128,159,0,130,178,1,
+131,25,2,131,59,0,128,16,0,128,217,0,2,46,46,92,128,3,0,1,124,95,128,34,
+1,129,99,1,4,124,46,46,58,45,132,168,0,129,209,1,129,33,0,0,45,129,223,0,
+130,53,1,0,34,128,66,0,2,96,43,46,129,201,0,129,84,0,132,64,1,134,111,1,
+133,23,0,128,235,0,1,43,34,128,154,0,129,168,1,129,19,0,0,44,131,112,0,128,
+10,0,133,118,2,1,95,95,133,13,1,128,32,2,128,0,0,0,39,129,173,1,131,99,
+2,0,39,129,225,0,0,39,129,138,0,129,1,0,0,10,129,22,0,1,47,32,128,92,
+1,130,67,0,131,173,2,0,39,132,69,0,137,228,2,131,172,1,1,124,45,128,247,0,
+129,56,0,128,222,0,128,97,0,1,96,39,129,2,1,129,13,0,0,92,131,63,0,128,
+65,0,129,58,0,129,66,0,129,33,1,131,150,1,128,213,0,131,178,1,129,254,0,130,
+30,1,0,124,132,65,3,128,8,3,129,37,1,130,4,2,130,49,1,130,90,0,130,66,
+0,131,220,1,132,24,1,132,208,1,129,4,3,128,44,0,128,30,0,130,141,1,128,39,
+0,128,0,1,128,121,0,0,92,129,69,1,130,133,1,130,43,2,130,34,1,1,40,41,
+133,51,0,133,11,0,128,174,0,128,79,1,0,44,128,53,0,128,86,0,129,94,2,128,
+46,1,128,119,2,128,120,0,128,12,0,130,163,0,132,216,0,135,248,0,0,39,135,12,
+0,131,160,1,129,161,0,128,39,0,130,50,3,128,255,0,128,124,2,132,190,0,132,128,
+2,131,230,3,131,16,0,131,130,1,128,12,0,128,43,0,1,46,39,128,91,2,130,15,
+0,130,63,0,131,207,3,130,129,2,133,219,1,130,148,1,128,95,0,131,36,3,130,253,
+2,130,11,0,129,54,2,128,8,0,133,68,1,0,46,130,109,2,134,159,2,132,170,3,
+131,236,1,0,95,128,63,2,131,9,0,130,1,1,129,80,0,132,184,1,132,78,4,130,
+66,0,0,47,130,54,0,134,40,1,0,39,129,64,0,130,52,0,1,44,39,128,235,3,
+129,238,3,128,129,3,129,84,2,128,142,0,130,169,2,130,181,4,0,92,133,204,0,132,
+37,2,128,48,2,131,101,4,0,47,128,63,0,131,237,3,128,13,0,130,185,1,131,129,
+0,133,75,0,128,0,0,0,47,131,199,1,129,5,5,130,113,0,0,45,129,134,3,128,
+29,1,129,175,2,129,126,0,131,209,0,129,143,0,130,113,3,128,11,1,0,34,129,61,
+0,0,96,131,244,0,130,215,4,1,32,124,128,85,0,130,80,1,0,47,131,254,3,129,
+111,3,1,46,39,129,84,3,128,173,0,129,197,1,130,157,0,0,124,128,228,0,130,80,
+2,128,245,0,132,128,0,129,11,0,129,7,0,128,246,0,0,124,131,226,0,129,14,0,
+129,211,3,128,3,0,1,44,34,131,97,3,128,89,0,128,67,0,128,105,4,136,120,2,
+130,149,1,128,187,0,131,20,0,131,125,3,130,192,2,128,62,0,130,12,1,129,137,0,
+1,32,92,129,151,0,0,95,129,64,2,131,200,0,0,124,128,189,0,1,44,46,128,64,
+4,129,60,0,133,12,2,0,96,132,161,4,0,34,128,7,0,2,39,45,106,132,48,1,
+0,39,131,111,0,128,64,4,131,133,1,132,144,1,128,20,0,129,2,1,128,120,0,130,
+63,3,128,5,1,128,34,0,128,123,5,128,7,0,129,219,0,129,37,0,128,174,0,129,
+98,0,129,1,4,133,187,0,130,157,1,129,114,0,128,239,0,130,133,1,131,184,0,0,
+124,131,52,1,0,124,128,121,1,132,35,3,133,108,1,130,186,4,129,180,0,133,101,4,
+130,135,0,128,37,2,128,155,3,129,145,4,1,124,34,130,132,2,129,149,3,131,244,1,
+128,7,0,129,74,0,128,143,0,132,172,5,130,180,2,129,45,5,129,96,0,129,15,3,
+135,58,3,128,122,0,2,92,96,43,130,136,6,142,183,6,133,35,2,132,159,1,132,0,
+0,0,34,130,153,1,129,213,3,129,97,4,138,82,7,2,95,44,58,132,113,1,1,96,
+45,132,64,7,136,146,3,135,31,5,136,53,0,128,127,4,130,76,0,137,12,6,144,10,
+0,135,134,5,145,64,6,140,44,0,143,28,0,134,57,0,136,199,0,134,179,0,137,46,
+0,138,199,5,132,88,0,130,57,0,141,139,0,1,95,44,135,178,0,136,247,5,128,228,
+2,136,88,0,130,57,0,135,170,2,129,181,6,133,81,6,145,0,0,128,229,1,0,34,
+128,219,1,135,181,1,129,0,0,128,179,1,0,10,0,32,155,0,0,3,124,96,46,10,
+157,34,0,2,32,32,92,152,35,0,1,95,95,131,35,0,0,32,152,73,0,0,95,129,
+67,0,131,37,0,1,32,32,149,38,0,9,46,39,32,92,96,45,46,46,32,96,132,118,
+0,0,95,129,0,0,148,44,0,2,44,96,45,128,38,0,2,96,46,124,129,87,0,3,
+32,44,34,39,130,21,0,128,62,0,132,147,0,151,58,0,131,132,0,132,215,0,128,115,
+0,135,0,0,1,96,46,133,71,0,4,32,96,34,44,39,147,62,0,0,96,133,97,0,
+3,124,32,44,39,134,75,0,139,89,0,1,95,46,148,60,0,0,32,130,94,0,128,65,
+0,1,58,47,136,46,0,131,60,0,0,46,130,0,0,0,45,148,57,0,0,106,133,125,
+0,128,56,0,1,46,39,129,243,0,136,118,0,0,124,146,51,0,0,124,132,96,0,0,
+44,128,50,0,128,120,0,133,218,0,129,17,0,128,10,0,154,51,0,128,131,1,129,230,
+0,129,94,1,133,155,1,129,9,0,147,51,0,1,39,43,134,24,1,130,53,0,131,103,
+0,3,44,124,95,95,129,9,0,149,70,1,132,241,1,128,0,0,0,92,130,57,0,1,
+34,45,133,139,1,1,46,39,149,244,1,129,246,0,129,56,0,0,44,129,105,0,131,136,
+1,0,95,128,50,1,131,164,0,2,96,45,45,128,60,2,128,14,0,128,73,0,149,64,
+0,128,65,0,129,218,0,0,39,130,54,0,4,45,45,96,46,46,129,8,0,0,34,130,
+219,0,140,159,0,0,44,150,204,2,129,78,1,132,186,0,135,18,2,128,62,0,3,44,
+96,32,46,129,11,3,134,39,0,147,46,1,133,59,0,130,70,0,137,153,0,0,96,132,
+200,0,134,137,0,128,95,2,148,61,1,0,39,130,60,0,140,65,0,130,88,2,131,96,
+2,2,39,32,44,128,222,0,4,45,45,39,34,34,143,65,0,2,95,32,44,128,102,2,
+137,64,0,128,4,1,132,184,0,129,123,0,0,92,128,29,0,128,58,0,140,55,0,1,
+46,34,138,0,1,7,44,46,46,34,39,96,92,47,134,172,3,142,29,2,0,47,135,81,
+1,128,188,2,2,95,44,96,130,109,0,128,54,3,0,34,130,185,1,130,49,0,139,87,
+4,0,106,134,191,3,128,26,0,128,163,2,131,225,1,0,124,131,132,2,131,99,1,1,
+32,46,139,101,0,130,26,0,132,31,0,132,6,2,128,210,1,128,73,1,132,147,1,130,
+19,0,139,202,0,133,50,0,0,95,128,186,0,133,162,0,128,8,2,2,39,34,96,128,
+44,1,128,134,1,132,73,4,136,165,4,0,95,128,16,1,0,34,128,0,0,0,39,128,
+47,0,2,96,34,92,131,241,0,141,120,1,132,196,3,132,53,0,1,44,45,130,48,3,
+0,46,130,235,0,130,199,0,130,229,2,144,12,4,130,29,1,131,54,0,1,95,39,128,
+136,1,129,20,0,129,58,0,1,58,45,128,161,2,128,13,0,129,232,2,137,85,2,129,
+187,3,133,199,0,129,11,1,138,136,2,1,43,39,128,42,0,134,181,3,0,95,129,223,
+2,129,0,0,128,141,0,128,34,5,131,128,0,128,77,0,1,47,10,136,58,2,130,32,
+0,130,57,5,0,95,130,20,3,0,34,135,231,1,128,19,0,131,160,3,131,111,0,0,
+10,131,112,3,128,60,2,133,109,5,130,49,1,145,220,3,128,136,3,0,45,128,71,0,
+128,89,0,4,47,92,10,39,46,129,127,0,162,0,0,2,46,39,44,131,115,0,149,248,
+2,148,12,6,129,50,0,130,241,1,169,53,0,133,172,0,2,34,32,10,0,32,150,0,
+0,4,95,44,46,46,45,128,0,0,10,46,46,95,10,32,44,34,39,39,45,46,141,33,
+0,2,46,45,39,136,14,0,2,96,34,45,128,42,0,1,46,44,130,39,0,2,96,46,
+95,135,25,0,0,44,130,38,0,0,44,129,76,0,137,47,0,139,79,0,129,111,0,5,
+10,124,124,32,32,92,132,29,0,131,64,0,131,59,0,2,46,39,32,128,25,0,0,32,
+138,49,0,132,63,0,128,55,0,2,45,34,39,128,6,0,0,39,130,61,0,134,35,0,
+0,96,128,141,0,132,11,0,2,124,46,39,129,25,0,129,3,0,136,188,0,128,222,0,
+128,55,0,130,65,0,2,39,10,39,129,9,0,137,32,0,132,217,0,128,18,0,139,25,
+0,0,45,134,243,0,6,95,44,45,39,10,32,92,128,174,0,138,88,0,132,62,0,128,
+177,0,141,114,0,132,207,0,0,10,128,163,0,0,96,131,30,0,140,0,0,131,209,0,
+142,25,0,0,40,128,49,0,129,15,1,128,0,0,144,51,0,135,144,0,139,21,0,128,
+183,1,128,184,1,134,16,0,129,157,1,137,147,1,155,0,0,0,96,142,64,0,132,0,
+0,1,124,34,165,66,0,133,72,0,0,46,142,67,0,0,96,154,49,0,128,116,2,128,
+108,2,3,34,34,34,39,128,131,0,131,0,0,129,50,1,146,42,1,148,0,0,0,92,
+131,47,0,0,44,128,72,0,129,5,2,135,15,2,144,70,0,130,19,0,132,164,0,0,
+47,140,93,0,2,44,46,95,128,53,0,137,54,0,128,42,2,130,73,0,129,167,0,129,
+50,0,130,39,0,133,96,0,129,12,0,128,240,1,130,7,3,131,227,0,133,97,2,132,
+127,0,132,103,0,131,20,2,130,38,0,131,54,0,0,124,130,108,1,133,141,0,131,255,
+2,137,233,0,136,53,0,135,202,0,0,96,132,70,0,130,11,0,130,91,0,140,55,0,
+130,53,1,134,107,1,132,232,0,0,47,135,44,2,132,52,0,131,250,0,135,116,0,129,
+151,0,128,36,0,0,46,128,146,0,129,1,2,132,130,0,0,96,128,178,2,131,85,1,
+136,102,0,130,47,1,133,80,0,134,96,2,0,124,133,127,1,135,146,0,0,47,131,199,
+1,138,217,0,128,153,0,129,236,3,134,218,1,130,224,2,0,46,135,130,1,140,79,3,
+133,113,1,136,73,3,142,198,1,131,244,1,131,120,3,139,43,0,0,124,129,137,1,128,
+84,2,0,39,130,105,1,128,170,0,128,84,2,0,34,133,107,0,141,43,0,128,209,1,
+130,0,0,136,215,0,134,150,0,140,43,0,0,46,133,223,1,1,96,34,134,235,0,135,
+179,0,137,43,0,131,199,4,134,55,0,140,42,0,137,218,0,140,199,1,130,211,4,135,
+60,0,0,47,136,41,0,133,18,2,132,91,0,128,228,0,136,100,0,145,40,0,132,7,
+0,138,138,0,138,165,0,136,60,5,128,49,1,138,247,2,138,248,0,145,126,3,2,95,
+44,34,140,167,3,138,4,6,128,220,1,146,200,3,128,146,1,129,0,0,128,72,1,0,
+10,0,32,156,0,0,0,46,141,16,0,2,44,39,10,156,50,0,1,47,124,141,16,0,
+0,44,156,50,0,1,39,106,141,49,0,1,32,124,155,50,0,128,32,0,141,16,0,0,
+106,154,49,0,128,199,0,139,49,0,0,47,128,16,0,139,49,0,140,234,0,128,46,0,
+132,49,0,0,95,133,48,0,141,166,0,4,32,95,44,46,46,129,68,0,0,44,135,53,
+0,0,92,137,31,0,129,48,0,129,68,0,4,95,44,34,44,39,131,67,0,138,134,0,
+6,95,46,45,34,39,44,45,130,82,1,1,39,96,135,121,0,0,96,132,139,0,0,44,
+132,182,0,0,124,128,118,1,128,33,0,132,134,0,135,135,0,128,63,0,1,39,44,128,
+5,0,131,147,1,0,92,133,54,0,129,50,0,2,96,46,46,128,92,0,129,51,0,129,
+13,0,0,34,128,7,0,130,129,0,130,63,0,131,131,0,129,60,0,129,59,0,133,209,
+1,0,92,128,1,0,134,28,0,132,0,0,0,92,133,13,0,130,54,0,132,5,0,0,
+76,130,57,0,128,212,0,1,39,32,132,121,0,129,40,0,128,124,0,1,44,34,134,195,
+0,129,0,0,0,118,131,6,0,2,96,46,95,128,65,1,131,58,0,133,67,2,134,179,
+0,130,58,0,130,120,0,137,126,1,134,130,0,1,46,39,136,56,0,129,112,0,136,126,
+2,128,52,0,128,110,0,130,212,0,133,71,2,134,94,0,135,53,0,129,12,0,134,52,
+0,2,46,45,45,131,35,1,135,112,0,132,5,0,3,39,45,45,45,132,51,0,128,143,
+1,128,5,0,0,40,133,103,0,129,48,0,1,92,124,128,146,0,133,66,2,0,124,129,
+17,0,128,152,0,133,15,1,129,150,0,132,42,0,1,45,46,128,235,0,135,85,2,128,
+40,0,0,124,128,148,0,132,131,1,128,7,0,135,83,2,133,142,1,137,0,0,1,96,
+34,128,132,0,128,182,1,137,66,0,128,104,0,128,69,0,0,96,128,176,0,129,46,0,
+2,46,46,39,133,66,0,0,96,135,115,2,131,28,1,134,0,0,128,65,0,128,0,0,
+0,34,136,67,0,129,88,0,3,96,46,96,46,128,164,1,128,163,0,0,45,128,223,0,
+130,60,0,0,45,130,251,0,7,45,39,34,39,34,34,96,39,128,4,0,142,65,3,0,
+124,128,24,0,134,136,1,132,240,0,128,159,0,129,12,0,128,59,0,2,96,34,96,130,
+253,2,131,126,0,128,110,2,128,74,0,0,34,134,187,2,128,39,1,3,95,95,124,92,
+131,13,0,128,178,0,1,95,95,131,74,0,128,117,3,128,54,3,128,247,2,137,104,0,
+132,53,3,129,102,1,132,148,1,131,112,0,128,14,0,128,18,1,2,39,92,10,129,182,
+0,1,45,45,128,166,0,4,34,34,39,39,43,128,31,0,128,117,1,131,43,0,0,124,
+133,111,4,0,96,129,183,1,134,164,1,128,83,0,137,206,0,128,78,0,128,132,3,134,
+90,2,0,39,129,31,3,0,39,132,42,1,2,46,95,96,128,25,0,128,57,0,130,98,
+1,135,53,0,128,32,0,130,50,0,0,95,129,198,1,130,7,0,134,69,3,134,25,2,
+1,32,96,131,167,0,134,53,0,1,47,46,128,50,0,131,32,3,128,185,1,128,178,0,
+135,60,1,136,236,0,131,106,2,133,53,0,1,46,39,128,138,0,130,117,2,130,134,0,
+137,107,3,130,90,1,138,130,1,132,53,0,0,44,128,50,0,135,86,0,133,38,3,133,
+123,1,129,183,0,131,136,1,133,111,2,130,53,0,133,100,0,133,211,3,132,99,0,134,
+35,0,134,68,3,133,17,0,143,236,5,0,46,134,152,0,133,74,0,137,133,0,131,87,
+0,142,52,0,136,52,1,133,31,5,133,169,0,132,77,0,143,51,0,144,30,2,130,96,
+3,134,40,1,156,136,6,134,135,2,135,61,4,157,185,6,128,169,4,135,45,0,143,13,
+3,144,48,0,129,177,3,129,202,2,0,10,0,32,168,0,0,5,95,46,45,45,46,10,
+164,43,0,4,95,32,32,44,39,130,10,0,0,92,162,50,0,129,44,0,1,96,34,133,
+13,0,162,102,0,0,124,140,14,0,150,51,0,3,44,39,96,46,135,101,0,157,51,0,
+1,46,46,128,187,0,0,47,130,185,0,129,13,0,140,49,0,146,51,0,129,45,0,0,
+96,132,40,0,128,106,0,131,152,0,132,114,0,130,10,0,0,39,142,51,0,129,29,0,
+129,39,0,1,95,46,128,111,0,2,95,32,124,130,61,0,136,50,0,144,102,0,129,46,
+0,2,124,46,34,133,103,0,131,101,0,137,158,0,143,53,1,128,35,0,138,242,0,129,
+209,0,130,218,0,133,0,0,0,96,136,51,0,131,37,1,1,46,124,138,134,0,130,52,
+0,0,106,152,2,1,0,92,128,67,0,0,47,128,104,0,140,141,1,129,71,0,139,132,
+1,137,156,0,128,135,0,0,46,128,55,0,141,51,0,139,121,0,140,53,1,128,51,0,
+133,198,1,137,0,0,137,222,0,2,95,124,95,139,2,1,129,239,0,144,52,0,134,17,
+0,1,46,39,128,123,1,0,96,138,51,0,0,47,134,154,1,148,109,2,0,124,128,165,
+2,3,124,32,96,45,128,184,1,0,46,138,110,0,132,85,0,133,40,0,0,44,129,46,
+3,136,17,0,0,95,131,74,2,134,71,0,129,122,1,1,46,45,129,108,2,133,22,0,
+0,96,134,29,0,131,163,1,129,189,0,128,241,1,2,45,45,39,133,24,3,135,236,0,
+128,130,1,130,50,0,4,39,34,34,39,34,130,53,0,128,61,0,136,134,0,1,46,39,
+143,194,0,130,79,0,136,60,0,131,11,0,138,39,0,130,12,0,0,47,143,205,1,136,
+61,0,128,60,0,134,134,0,142,60,0,1,44,100,128,5,0,142,50,3,135,245,0,1,
+124,10,135,141,1,0,58,133,177,0,133,139,1,2,34,45,39,129,249,0,0,47,139,177,
+1,0,95,135,190,3,128,50,1,136,112,0,0,92,139,216,1,2,96,46,46,128,63,0,
+128,64,0,0,92,134,170,0,0,46,128,28,1,133,148,3,132,126,0,0,39,133,112,1,
+140,58,2,137,202,3,129,210,2,135,133,1,132,93,0,135,145,2,128,250,1,132,176,0,
+128,38,0,129,189,3,128,0,0,137,62,0,130,42,1,129,130,0,142,68,1,131,55,3,
+0,95,131,23,0,129,5,0,128,37,0,130,60,0,130,137,0,128,232,0,135,194,1,128,
+111,0,0,46,128,104,0,135,172,0,129,175,0,128,62,0,128,35,0,135,62,0,129,167,
+0,1,34,34,128,116,0,2,95,95,44,134,59,5,131,161,0,132,183,4,138,74,1,130,
+236,3,128,55,0,1,96,45,129,0,0,131,32,0,3,124,34,39,39,128,65,2,151,101,
+5,138,36,1,129,192,0,141,66,5,158,167,5,137,130,0,130,64,1,134,135,2,134,20,
+3,166,232,5,130,65,1,131,15,0,1,44,45,128,186,0,163,141,6,130,70,1,128,105,
+5,133,239,4,131,229,2,169,251,6,128,155,6,129,107,0,129,78,1,131,3,2,128,252,
+3,164,124,0,143,73,0,1,32,10,0,32,145,0,0,17,44,45,39,34,34,34,45,45,
+46,46,95,95,32,32,46,39,92,10,145,37,0,0,46,137,12,0,1,96,34,128,4,0,
+147,39,0,0,39,143,18,0,133,40,0,0,95,129,0,0,148,81,0,132,18,0,128,41,
+0,2,44,34,34,131,67,0,1,96,39,130,147,0,130,65,0,143,102,0,2,10,32,47,
+141,19,0,0,96,129,44,0,128,42,0,130,45,0,0,43,131,94,0,1,58,39,128,84,
+0,144,105,0,130,45,0,1,96,46,128,5,0,137,19,0,2,124,10,124,146,34,1,128,
+45,0,1,45,96,134,177,0,0,95,129,8,0,150,42,0,1,39,45,129,88,0,0,95,
+130,135,0,2,39,32,124,128,37,0,1,124,10,139,101,0,140,134,0,130,131,0,2,46,
+32,92,129,42,0,128,214,0,140,146,0,133,42,1,1,46,46,128,4,0,130,179,0,129,
+38,0,0,96,130,42,1,132,242,0,138,78,0,130,20,0,0,58,131,27,0,130,73,0,
+1,39,124,133,167,1,148,133,0,128,76,0,128,26,0,128,175,0,129,128,0,1,95,44,
+128,104,0,1,46,95,135,218,1,129,80,0,141,0,0,0,45,131,72,0,5,96,96,46,
+39,124,44,129,10,2,131,33,1,137,54,0,0,32,142,29,1,1,34,32,128,188,0,128,
+35,0,128,204,0,131,33,1,129,34,0,132,72,0,129,232,1,130,226,0,148,64,0,130,
+148,0,132,100,0,0,45,130,29,2,0,46,128,5,0,129,207,0,0,59,133,33,0,128,
+15,0,129,16,2,137,148,2,137,65,0,0,96,131,85,2,128,4,0,131,54,2,1,46,
+34,131,56,1,133,19,1,129,79,0,132,141,0,129,131,1,141,66,0,133,101,1,128,30,
+1,1,45,39,128,65,0,132,53,0,128,54,3,129,9,0,129,3,0,1,44,39,129,5,
+0,0,106,135,199,2,141,66,0,0,43,130,183,0,131,46,1,131,131,0,0,43,130,11,
+0,128,82,0,128,25,0,128,37,0,0,47,128,64,0,129,133,1,128,78,0,130,52,2,
+147,83,3,129,232,0,131,104,0,130,178,0,128,6,0,128,81,1,130,28,1,0,124,129,
+86,0,128,207,0,0,92,130,114,0,129,83,0,135,66,0,1,44,46,128,99,1,129,101,
+1,128,219,1,0,39,131,243,0,0,47,137,30,1,1,95,46,130,87,1,0,124,128,65,
+0,0,44,129,210,0,0,92,129,100,2,130,16,3,135,191,1,133,253,2,128,11,1,128,
+134,1,128,68,0,0,47,132,219,0,128,217,0,1,95,46,128,203,0,0,95,128,69,0,
+129,96,0,131,122,2,0,95,129,143,0,0,44,139,78,1,131,110,1,1,96,34,131,195,
+1,130,71,0,132,133,0,2,46,39,95,129,135,4,135,143,0,1,45,34,128,103,1,128,
+143,0,129,215,1,139,104,4,135,12,4,128,72,0,128,110,0,128,68,0,131,197,4,136,
+209,4,130,236,1,129,163,0,0,124,128,47,1,0,46,138,130,0,139,24,2,130,47,3,
+129,205,0,0,47,129,3,1,132,230,1,131,31,0,1,44,39,128,234,0,128,8,1,0,
+44,149,62,0,129,9,1,128,251,0,1,45,45,128,97,0,128,1,0,128,94,1,132,77,
+2,128,161,0,1,46,39,128,16,2,128,15,0,0,43,141,60,0,132,69,1,128,142,1,
+128,152,0,0,34,128,252,1,128,243,0,0,124,130,37,4,133,87,0,128,92,5,130,11,
+0,0,124,137,2,2,140,191,3,130,111,1,0,47,131,179,3,0,34,128,47,0,135,209,
+0,130,16,0,135,243,3,136,192,4,128,154,1,130,24,1,128,17,1,128,230,1,0,92,
+130,164,1,0,46,129,204,2,135,102,2,129,16,0,145,213,5,134,90,1,130,45,0,129,
+178,4,129,190,0,138,154,0,142,37,1,138,172,1,133,101,0,3,96,61,43,61,129,159,
+1,132,0,0,0,46,143,155,1,135,157,5,1,95,95,128,61,2,136,16,0,0,124,131,
+20,0,0,95,129,90,1,147,52,0,147,184,5,130,148,2,128,174,0,0,10,0,32,156,
+0,0,2,46,46,10,157,33,0,128,2,0,157,35,0,128,0,0,0,39,156,35,0,3,
+39,32,92,47,157,36,0,0,47,130,109,0,0,96,154,36,0,128,32,0,1,32,124,129,
+7,0,154,37,0,0,39,129,37,0,158,181,0,129,71,0,155,147,0,129,71,0,128,72,
+0,3,46,46,95,95,150,178,0,133,72,0,128,146,0,129,46,0,1,34,45,144,45,0,
+129,181,0,131,146,0,0,96,132,10,0,3,32,96,34,45,130,41,0,2,95,95,46,133,
+18,0,134,73,0,131,119,0,139,0,0,129,39,0,128,49,0,129,173,0,137,48,0,131,
+50,0,2,124,46,46,133,50,0,132,65,0,128,36,0,128,137,0,128,53,0,2,95,95,
+44,129,56,0,1,45,34,132,32,0,0,47,130,239,0,0,46,134,135,0,132,50,0,128,
+159,1,140,131,0,1,46,39,129,220,0,131,224,0,135,200,0,1,39,44,132,48,1,0,
+96,136,66,0,0,96,129,4,0,0,92,129,219,0,130,108,0,1,39,46,129,255,0,0,
+44,130,59,0,138,170,0,0,95,135,62,0,138,64,0,133,122,0,0,34,134,80,0,128,
+173,0,130,121,0,136,8,1,1,44,39,128,2,0,135,172,1,0,46,134,74,1,129,6,
+0,140,48,1,130,59,0,134,186,0,0,95,128,58,0,0,46,137,231,1,128,57,0,132,
+60,0,129,5,0,134,248,0,133,52,0,134,75,1,0,46,128,144,0,138,56,0,134,58,
+0,0,47,132,242,0,138,55,0,0,44,132,16,0,128,63,0,128,114,0,140,87,2,128,
+48,0,0,96,128,36,0,130,33,0,134,55,0,133,97,1,128,16,0,140,222,0,130,241,
+0,2,34,96,46,130,196,0,129,30,0,4,45,39,34,34,39,128,210,1,135,148,1,1,
+92,95,128,106,1,139,49,0,0,124,128,121,1,131,217,0,3,44,39,44,45,129,48,0,
+4,34,96,45,46,96,131,30,1,129,6,1,0,96,140,55,3,128,235,1,128,32,0,128,
+174,1,0,46,137,233,1,2,92,96,46,129,91,0,128,175,1,1,45,34,141,70,3,128,
+26,0,129,5,0,1,45,124,138,217,1,0,46,128,129,2,132,98,2,141,48,0,129,244,
+0,0,34,128,52,0,0,124,133,153,2,131,120,0,131,13,0,0,95,128,165,0,140,146,
+0,130,87,0,128,241,0,1,96,46,140,48,0,129,89,2,130,147,2,140,97,0,131,173,
+1,129,54,0,130,148,1,134,169,2,132,52,2,142,227,3,133,184,0,129,217,4,131,205,
+0,130,46,0,129,55,1,135,249,1,145,21,4,1,46,124,130,78,0,0,47,128,185,3,
+128,79,3,129,196,1,128,62,0,133,7,1,138,99,0,131,70,0,130,111,1,128,226,0,
+129,136,3,130,206,1,130,24,3,128,99,0,138,133,1,130,119,1,129,120,0,128,29,3,
+131,0,3,0,96,133,205,3,128,35,4,134,160,2,136,50,0,129,19,0,128,91,0,129,
+207,1,146,0,0,129,201,0,130,3,0,135,50,0,0,124,128,97,0,150,47,0,131,52,
+0,0,39,130,217,2,136,102,0,0,96,128,63,2,158,247,5,129,15,3,159,105,5,142,
+53,0,2,34,32,10,0,32,137,0,0,5,46,34,45,46,46,95,135,15,0,0,95,128,
+0,0,0,10,138,33,0,0,92,130,5,0,1,96,45,132,37,0,0,47,128,2,0,1,
+34,34,128,53,0,139,37,0,1,32,46,130,37,0,128,23,0,7,96,45,95,46,39,96,
+46,106,132,61,0,131,38,0,129,86,0,130,0,0,0,39,128,41,0,8,44,45,45,45,
+39,34,34,44,124,128,24,0,1,124,46,128,126,0,0,95,128,49,0,129,39,0,0,46,
+128,29,0,135,118,0,128,114,0,128,115,0,2,44,39,32,128,39,0,0,44,131,20,0,
+1,124,124,128,23,0,134,162,0,0,96,130,115,0,5,95,95,44,46,45,43,129,81,0,
+128,69,0,128,41,0,1,94,46,128,162,0,133,45,0,1,32,124,129,45,0,0,96,128,
+175,0,0,45,129,77,0,130,55,0,128,47,0,128,16,0,0,34,128,116,0,128,0,0,
+128,22,0,129,116,0,1,46,34,129,78,0,129,137,0,130,55,0,130,73,0,3,96,46,
+34,34,128,166,0,0,96,128,58,0,1,32,39,129,238,0,1,47,95,128,46,0,128,18,
+0,132,94,0,129,102,0,128,157,0,131,106,0,129,3,0,128,46,0,128,44,1,130,47,
+1,131,154,0,130,210,0,0,10,138,214,0,128,0,0,129,2,1,0,39,129,197,0,134,
+56,0,128,54,1,0,45,130,57,0,130,172,0,129,58,0,0,44,129,15,1,134,68,0,
+132,17,1,128,231,0,129,73,0,129,22,0,128,54,0,133,96,1,128,2,0,1,96,46,
+135,52,0,130,170,1,139,154,1,131,171,0,0,92,129,52,0,129,110,0,133,53,0,128,
+72,0,0,96,128,136,0,1,96,46,134,240,1,128,10,0,141,53,0,1,32,124,128,103,
+0,128,2,0,130,41,1,132,55,0,130,56,0,132,19,2,136,5,2,136,61,0,131,22,
+1,130,127,1,131,122,0,129,180,0,129,247,0,130,38,0,132,215,0,0,96,140,66,2,
+0,62,131,22,0,132,189,1,2,124,39,46,128,3,0,133,128,2,128,91,0,132,106,1,
+148,62,0,131,192,1,134,61,0,131,87,1,137,192,2,136,42,0,1,96,32,128,250,1,
+0,34,135,61,0,0,44,130,209,1,0,44,128,180,2,134,18,0,1,124,34,134,180,1,
+141,62,0,129,128,0,133,59,0,130,147,0,131,153,0,133,89,1,129,9,0,135,11,0,
+141,60,0,136,61,0,129,53,0,133,212,0,129,27,1,131,0,0,0,106,133,215,1,147,
+62,0,128,17,0,130,62,0,129,55,0,131,182,0,136,125,3,140,123,0,128,229,0,0,
+92,129,226,2,132,105,2,132,63,0,129,35,2,131,129,2,139,146,2,132,62,0,135,22,
+0,1,47,96,134,213,0,128,46,3,129,5,3,129,74,0,3,124,10,46,39,130,29,3,
+143,252,3,128,185,0,135,64,1,130,63,3,128,24,0,1,10,124,136,165,0,139,110,0,
+135,171,0,132,5,1,129,92,2,4,10,32,39,39,34,128,2,0,128,0,0,1,39,39,
+128,115,0,131,0,0,130,87,0,134,47,0,133,227,1,0,32,128,161,0,132,95,4,145,
+97,0,128,165,0,130,48,0,139,85,4,149,49,0,129,187,0,0,124,131,192,0,0,44,
+128,122,2,137,177,1,131,114,1,146,101,0,128,172,1,129,99,0,129,145,0,138,118,3,
+0,46,150,102,0,1,32,46,130,21,3,133,248,1,137,54,0,152,52,0,0,96,129,52,
+0,138,214,3,134,109,3,0,92,151,53,0,129,143,5,141,170,1,1,32,34,131,56,0,
+0,96,150,213,0,150,0,0,130,114,0,1,92,124,173,54,0,131,228,0,4,124,32,10,
+10,10,0,32,139,0,0,4,44,45,45,45,46,129,8,0,3,95,95,95,10,140,27,0,
+13,124,40,95,95,41,124,32,46,39,44,45,46,96,46,141,29,0,0,96,128,54,0,0,
+106,128,36,0,5,32,92,46,39,46,39,141,29,0,1,95,39,128,33,0,0,34,128,4,
+0,2,44,45,39,142,90,0,1,44,34,135,69,0,0,34,128,93,0,2,45,46,92,140,
+62,0,132,68,0,1,46,46,128,27,0,139,59,0,0,124,137,31,0,4,95,96,46,46,
+39,128,100,0,140,54,0,2,44,46,45,132,20,0,0,96,131,62,0,4,44,45,34,34,
+39,128,11,0,1,46,32,136,44,0,0,40,129,125,0,129,162,0,135,109,0,128,110,0,
+135,16,0,128,69,0,128,49,0,128,217,0,0,44,134,18,0,1,46,39,128,246,0,128,
+206,0,1,95,95,129,30,0,129,80,0,128,48,0,128,67,0,128,68,1,131,69,1,136,
+0,0,2,47,10,47,132,84,0,0,95,130,64,0,0,46,131,244,0,0,92,128,65,0,
+1,46,39,137,197,0,130,73,1,133,208,0,0,95,128,112,0,2,39,46,45,128,43,0,
+128,107,0,129,132,0,134,123,0,129,100,0,135,55,1,138,57,0,0,47,131,34,1,130,
+84,0,128,140,1,0,46,128,157,0,138,58,0,143,52,0,132,49,0,128,141,0,128,15,
+0,131,20,0,1,95,32,129,175,0,131,70,0,0,33,129,7,0,128,4,0,134,166,0,
+1,124,34,133,133,1,129,61,0,132,118,0,129,29,0,129,9,1,136,204,0,128,16,2,
+129,206,1,2,32,95,124,129,247,0,135,185,1,130,103,0,0,46,128,42,1,1,34,45,
+129,215,0,128,64,0,137,156,0,128,120,0,1,44,39,132,219,0,132,177,1,137,224,0,
+131,110,0,129,5,0,131,113,0,128,0,0,129,8,0,128,3,0,132,177,0,133,43,0,
+136,56,0,0,124,128,101,1,128,103,1,131,11,0,131,128,1,130,70,0,130,17,0,135,
+112,1,132,44,0,137,56,0,137,23,0,129,214,1,129,200,0,129,151,1,129,29,2,0,
+34,130,43,1,130,102,1,130,240,1,138,246,2,135,84,0,145,121,1,129,143,0,128,43,
+1,128,116,2,128,11,0,139,46,3,0,96,129,101,0,135,179,2,0,95,132,84,2,1,
+34,39,129,81,0,3,124,44,34,34,128,125,3,130,86,1,2,46,32,92,141,103,3,135,
+176,0,134,116,0,129,102,1,128,48,0,1,96,96,128,46,2,0,124,133,196,3,139,29,
+1,139,58,0,135,184,0,130,44,0,128,143,0,129,74,0,130,144,1,132,169,3,137,32,
+1,133,178,1,131,10,1,136,46,1,129,198,0,136,13,1,0,39,128,134,3,128,49,1,
+142,25,4,129,179,1,129,109,2,128,34,0,131,167,2,132,177,0,0,45,135,133,0,142,
+110,0,128,211,2,129,44,0,130,54,0,129,117,3,3,46,46,40,32,130,170,0,129,126,
+2,129,49,1,1,39,44,141,103,0,131,14,1,131,63,2,132,198,1,128,70,1,129,144,
+0,130,116,4,3,34,95,44,34,136,17,1,129,32,4,128,43,0,129,122,1,1,45,43,
+128,37,0,138,192,1,1,96,34,129,21,0,130,19,0,0,96,134,50,0,132,122,2,141,
+74,2,135,255,0,2,34,32,44,130,246,2,136,179,1,131,240,0,130,32,3,145,0,0,
+128,75,1,129,2,0,130,28,0,136,232,1,2,95,58,45,131,143,0,146,107,0,130,218,
+1,128,15,3,129,219,0,132,55,1,128,114,5,128,182,1,131,45,0,128,2,3,138,107,
+4,132,79,1,133,214,0,129,35,3,132,112,3,134,92,0,129,20,5,128,8,1,145,61,
+4,138,129,0,131,109,0,135,93,0,128,118,0,148,11,1,130,180,1,130,183,3,128,19,
+2,131,168,1,130,219,2,130,185,1,132,232,0,129,164,1,2,39,32,10,0,32,135,0,
+0,0,95,130,0,0,0,10,133,13,0,2,46,45,34,131,17,0,2,96,46,95,136,37,
+0,3,32,32,44,46,131,35,0,5,44,34,95,44,34,39,131,19,0,2,96,45,46,137,
+38,0,2,47,46,124,129,35,0,3,44,39,44,34,132,88,0,137,38,0,130,13,0,2,
+47,47,32,129,35,0,5,47,46,39,32,44,45,131,70,0,128,29,0,131,39,0,1,96,
+46,128,4,0,2,124,32,106,128,6,0,0,124,128,34,0,128,39,0,128,45,0,128,40,
+0,129,74,0,0,46,128,0,0,128,37,0,5,96,34,45,45,46,46,129,41,0,0,39,
+129,35,0,128,3,0,5,39,32,39,10,106,47,131,184,0,132,149,0,128,30,0,4,95,
+44,46,34,34,131,78,0,131,39,0,0,47,128,38,0,2,124,46,45,133,33,0,138,0,
+0,4,96,46,39,47,124,132,78,0,1,47,10,146,34,0,129,0,0,0,39,128,186,0,
+132,76,0,133,45,1,143,0,0,128,137,0,128,145,0,129,45,0,145,35,0,0,124,129,
+146,0,0,96,128,211,0,0,47,129,8,0,146,70,0,0,124,129,220,0,128,65,1,0,
+39,128,33,0,0,44,147,68,0,128,3,0,0,92,128,22,1,0,106,128,206,0,146,66,
+0,130,126,0,129,3,0,0,46,146,98,0,129,63,0,133,249,0,0,34,128,77,1,128,
+153,1,155,37,0,130,22,2,128,108,0,143,37,0,1,44,124,132,45,1,128,160,1,1,
+45,55,130,169,1,129,168,1,129,82,0,144,84,0,0,46,131,84,0,1,44,34,128,36,
+1,128,219,0,128,118,1,131,215,1,132,48,0,128,7,2,147,139,0,129,43,1,3,32,
+39,45,39,128,44,0,1,39,32,128,230,1,128,180,0,135,115,2,4,96,34,34,39,45,
+129,0,0,0,96,128,3,0,131,72,0,143,65,0,0,124,129,143,0,128,193,0,2,44,
+39,34,129,161,1,130,168,1,0,96,128,43,0,0,44,131,36,2,139,0,0,129,40,0,
+140,66,0,3,44,34,96,124,128,177,0,132,87,1,132,26,1,1,46,44,128,112,0,3,
+32,59,45,45,140,42,1,128,215,2,139,62,0,129,31,0,1,39,46,128,216,1,0,45,
+128,4,0,132,230,2,128,21,0,129,11,0,129,140,0,0,39,132,185,0,128,98,1,128,
+194,2,132,101,3,137,203,1,130,208,2,133,118,0,1,96,43,130,236,0,2,46,95,59,
+129,33,2,129,83,0,130,108,1,129,60,0,0,39,140,119,0,132,105,0,3,124,32,34,
+39,128,0,1,129,95,0,1,124,44,133,171,0,131,5,1,0,96,140,109,0,129,45,0,
+128,80,0,0,124,128,85,0,0,55,133,37,0,132,225,1,129,10,0,128,60,0,0,39,
+130,225,3,140,162,0,128,5,2,2,96,46,124,128,53,0,131,95,3,132,99,0,0,92,
+130,10,0,128,244,1,150,45,3,134,56,1,133,8,0,128,50,0,129,215,3,151,49,0,
+132,59,1,131,21,4,134,28,2,129,3,4,150,145,3,7,32,96,39,45,43,45,34,124,
+133,58,0,129,208,0,0,39,147,123,3,136,153,0,0,96,129,202,0,129,193,0,130,249,
+0,128,174,4,155,47,0,0,96,129,248,1,128,34,5,130,46,0,0,44,147,150,3,137,
+94,0,2,124,39,46,128,255,2,129,44,0,0,47,147,228,3,141,92,0,130,183,0,157,
+133,0,135,135,5,2,39,32,10,0,32,140,0,0,0,95,129,3,0,5,44,46,45,46,
+39,32,128,4,0,0,10,139,26,0,128,20,0,2,124,44,39,128,10,0,6,46,34,34,
+46,124,32,124,129,6,0,0,95,137,35,0,7,40,32,124,124,32,44,39,44,128,23,0,
+9,32,96,46,95,96,39,32,96,32,32,128,48,0,0,96,138,73,0,6,96,92,32,124,
+32,96,34,128,96,0,4,34,96,45,46,46,128,34,0,129,82,0,130,25,0,139,113,0,
+0,124,131,46,0,2,46,46,45,128,38,0,129,153,0,135,20,0,0,92,136,40,0,1,
+95,44,131,19,0,6,32,95,46,46,46,39,95,128,165,0,129,0,0,1,44,43,130,82,
+0,134,83,0,128,148,0,0,39,129,39,0,128,78,0,3,46,45,39,46,128,187,0,1,
+40,95,128,48,0,3,95,32,45,34,129,21,0,0,34,129,99,0,133,44,0,0,124,128,
+188,0,129,232,0,129,3,0,1,47,92,128,247,0,2,34,34,96,131,5,0,129,34,0,
+132,133,0,128,8,0,131,133,0,131,111,0,1,32,47,130,1,0,129,1,1,129,31,0,
+131,5,0,1,46,96,128,1,0,132,221,0,0,124,133,180,0,128,92,0,128,93,0,2,
+45,46,95,129,93,0,1,124,96,128,128,0,129,34,1,129,114,1,1,32,92,130,1,0,
+130,142,0,129,13,0,132,228,0,128,70,1,129,64,0,128,92,0,1,47,95,128,118,1,
+1,32,124,128,137,0,129,7,0,128,64,1,3,34,39,96,39,128,69,1,128,177,1,0,
+34,128,55,0,132,234,0,0,46,128,42,0,0,46,128,182,0,130,50,0,129,40,0,128,
+113,0,129,187,1,132,38,1,131,215,0,129,68,1,133,98,0,0,39,130,186,0,0,124,
+130,96,0,2,46,45,43,128,185,1,128,12,1,3,45,45,34,45,131,66,1,131,191,0,
+130,11,0,128,50,0,0,96,129,50,0,128,47,0,129,175,0,130,35,1,128,132,0,128,
+40,0,3,96,34,46,34,129,10,0,128,95,1,131,167,1,133,59,0,133,102,0,128,147,
+0,129,54,1,0,106,132,73,0,130,81,0,134,145,0,1,124,92,128,19,1,0,34,130,
+52,0,130,15,2,129,160,0,128,52,0,128,14,0,129,191,0,132,2,0,132,12,1,134,
+52,0,130,207,1,0,124,129,30,1,130,100,0,131,4,0,128,3,1,131,123,1,132,164,
+1,0,95,128,0,0,131,180,2,133,10,0,131,53,0,133,209,0,131,104,0,136,50,0,
+128,87,1,128,107,2,128,26,2,0,45,128,18,2,131,15,3,130,46,1,133,118,0,134,
+215,0,0,39,140,54,0,2,124,32,34,128,74,2,131,30,2,0,96,129,211,1,128,143,
+0,0,96,128,39,3,132,207,0,131,2,0,142,161,0,130,223,0,133,94,0,133,99,0,
+128,208,0,131,22,3,129,78,0,128,2,0,130,221,0,0,124,146,55,0,138,155,0,130,
+159,1,133,160,2,129,20,0,130,120,2,0,10,131,36,0,128,4,0,136,55,0,130,26,
+0,132,100,0,132,58,1,129,3,0,132,55,0,130,3,0,128,180,1,130,120,0,130,39,
+0,134,55,0,134,107,0,136,70,0,130,201,1,137,55,0,133,56,0,0,92,135,175,1,
+134,215,1,135,227,0,128,4,0,3,43,46,46,124,128,150,1,131,3,0,128,154,3,130,
+0,0,130,148,2,134,65,0,0,92,135,250,1,137,126,1,131,119,0,134,5,0,138,0,
+0,130,130,0,134,25,0,130,10,3,145,244,0,136,67,0,134,234,2,131,38,0,128,219,
+1,131,249,1,131,30,0,0,92,135,183,0,129,15,0,132,154,0,134,66,0,131,158,4,
+128,107,2,134,95,3,0,10,128,64,2,129,87,4,131,21,0,128,5,4,138,211,4,143,
+176,0,133,139,0,129,65,0,1,46,10,135,73,0,1,95,44,129,153,4,133,225,0,131,
+8,1,149,61,0,131,135,1,129,184,0,128,144,0,0,95,133,228,3,140,77,5,145,45,
+1,134,62,0,0,124,133,205,5,136,59,0,141,245,1,152,63,0,133,62,5,130,129,5,
+129,92,5,128,113,3,132,255,2,137,53,2,0,92,132,27,0,132,224,0,2,46,46,44,
+128,39,0,139,65,0,1,96,45,131,64,3,133,21,1,129,140,3,129,49,5,132,38,0,
+132,226,5,130,120,1,135,38,0,128,9,5,129,196,5,0,45,131,187,1,151,164,0,128,
+37,0,128,93,5,0,10,0,32,138,0,0,1,39,10,138,14,0,0,46,139,14,0,0,
+124,141,31,0,2,124,32,124,136,16,0,5,46,32,32,96,32,39,139,80,0,141,0,0,
+137,81,0,2,39,96,46,128,51,0,128,53,0,134,28,0,1,45,45,136,13,0,129,0,
+0,0,44,135,48,0,0,46,129,94,0,2,46,96,124,128,4,0,128,0,0,2,95,95,
+95,128,64,0,130,130,0,137,46,0,1,95,39,134,145,0,128,24,0,129,27,0,130,80,
+0,1,95,44,129,9,0,5,96,45,96,44,45,34,136,45,0,0,46,130,172,0,1,39,
+45,133,99,0,128,89,0,8,96,46,95,44,39,96,32,46,39,129,55,0,128,30,0,0,
+44,138,207,0,0,47,131,136,0,128,0,0,137,247,0,0,96,129,71,0,0,39,133,41,
+0,128,6,0,2,96,45,46,128,157,0,130,98,0,131,20,0,1,96,45,128,0,0,137,
+59,1,1,44,39,128,75,1,130,77,0,136,0,0,128,14,1,131,48,0,0,92,128,9,
+1,1,34,34,129,129,0,0,92,134,51,0,0,124,128,217,0,0,96,128,50,0,0,46,
+138,240,0,132,53,0,129,149,0,128,56,0,128,186,0,2,95,46,34,134,103,0,129,95,
+0,129,155,0,1,47,95,128,51,0,129,47,1,130,0,0,0,95,128,189,0,0,45,129,
+101,0,128,25,0,0,124,128,3,0,0,46,130,17,1,132,104,0,128,126,0,128,188,0,
+129,197,0,0,34,129,131,0,0,86,131,13,0,134,4,1,130,8,0,130,128,0,3,96,
+45,39,34,132,105,0,0,44,128,181,1,128,46,1,130,135,0,132,210,0,0,47,129,41,
+0,129,115,1,129,11,0,130,24,0,136,181,0,129,58,1,1,46,39,129,16,1,129,158,
+0,3,47,34,34,124,130,108,1,128,52,0,128,61,0,132,64,0,129,103,0,128,122,0,
+139,53,0,135,47,1,130,217,0,0,45,129,135,1,130,118,1,140,72,1,0,96,131,55,
+0,0,124,128,251,1,1,124,10,134,67,0,131,236,1,130,8,0,130,10,0,132,52,0,
+130,26,2,135,32,0,128,137,0,129,229,2,0,124,133,53,0,134,129,0,0,124,130,47,
+0,130,4,0,128,102,1,2,32,32,55,131,9,0,0,34,130,219,1,128,205,0,0,34,
+134,40,2,128,96,1,3,95,10,124,96,131,122,2,135,154,0,130,73,0,0,46,128,29,
+0,131,130,2,129,24,0,128,61,0,138,99,0,136,50,2,2,96,46,10,128,236,2,2,
+45,39,44,137,220,0,129,40,0,129,188,0,0,44,132,47,1,133,152,1,1,44,45,131,
+65,1,140,232,0,129,104,1,132,29,2,138,66,0,128,130,0,128,250,1,131,101,1,135,
+208,0,136,134,0,2,46,34,34,130,55,0,128,23,0,139,239,3,131,155,1,131,62,2,
+133,62,0,136,200,0,135,66,0,1,44,34,129,145,0,2,124,46,34,144,63,0,128,36,
+4,133,46,4,131,62,0,135,99,3,133,172,0,130,149,0,0,124,145,125,0,1,44,34,
+128,162,3,134,44,0,128,238,2,136,118,1,0,45,131,25,0,1,44,34,129,179,2,0,
+47,141,59,0,0,46,128,110,4,0,95,128,83,1,0,46,129,183,0,128,67,1,136,216,
+3,0,96,128,70,0,130,111,3,0,47,129,4,0,0,124,142,118,0,0,124,129,22,4,
+0,96,128,17,3,128,115,2,137,15,4,131,136,0,128,138,4,129,71,3,141,56,0,128,
+22,3,131,10,4,128,82,3,129,23,1,1,96,34,128,39,3,128,183,4,128,125,3,128,
+43,2,128,156,2,0,34,128,57,0,129,24,0,137,230,0,128,149,0,0,41,133,207,0,
+139,122,4,3,96,39,34,46,130,237,0,130,104,2,128,25,2,134,52,0,1,39,34,129,
+53,0,128,88,0,128,146,3,145,114,5,137,2,2,0,124,138,127,5,0,34,146,47,0,
+135,56,0,129,71,1,130,60,0,139,231,5,160,0,0,130,166,5,1,45,39,128,65,0,
+171,55,0,130,176,4,173,50,0,129,206,1,0,10,1,10,32,173,0,0,3,44,45,45,
+39,128,0,0,1,45,46,173,58,0,1,46,46,129,5,0,1,96,39,128,3,0,174,117,
+0,128,52,0,128,64,0,4,39,46,46,46,39,170,59,0,128,55,0,3,44,39,58,58,
+130,11,0,0,124,173,117,0,5,44,46,46,45,89,45,128,66,0,2,47,45,45,162,59,
+0,130,224,0,135,0,0,3,124,39,32,95,162,175,0,4,46,39,32,46,95,130,0,0,
+128,93,1,2,39,34,124,129,180,0,153,54,0,1,47,44,129,156,0,1,32,39,129,155,
+0,129,62,0,128,7,0,4,46,34,32,124,32,153,52,0,3,47,32,32,34,128,46,0,
+7,39,32,45,61,76,59,39,92,130,57,0,1,96,45,128,82,1,139,51,0,0,44,128,
+90,0,134,50,0,128,143,0,131,0,0,4,93,44,76,95,47,131,108,0,131,174,0,137,
+229,0,0,92,133,65,0,1,124,96,128,0,1,4,39,92,32,32,95,136,68,0,128,204,
+0,141,29,1,0,44,136,63,0,4,61,45,46,32,96,134,153,1,128,64,0,128,28,0,
+2,124,46,96,138,195,1,2,96,45,118,132,30,0,128,117,2,139,83,0,131,13,0,0,
+45,128,169,1,134,198,0,0,95,128,237,1,3,34,32,96,92,128,32,1,130,14,0,131,
+196,0,1,95,39,129,85,1,3,45,44,95,45,130,246,0,137,194,0,8,46,93,45,45,
+45,62,32,95,96,133,62,1,0,46,129,52,0,129,61,0,4,39,32,47,39,45,129,114,
+0,3,45,46,61,91,128,36,0,2,45,96,44,130,123,0,0,39,128,68,0,137,196,0,
+133,135,0,1,60,47,139,76,1,3,93,46,46,98,128,52,0,2,46,32,45,128,49,0,
+1,44,32,130,65,0,0,96,128,22,2,0,45,128,208,0,132,187,1,133,180,0,2,95,
+45,45,128,110,0,1,44,44,138,64,0,0,46,129,180,0,9,32,32,60,92,93,96,96,
+44,91,32,128,117,0,129,95,1,1,92,46,128,209,0,128,91,2,0,32,128,133,3,2,
+96,45,32,128,12,0,1,95,44,130,39,0,2,96,39,39,130,73,1,1,92,34,128,26,
+0,0,76,134,125,1,0,88,129,150,1,0,96,129,196,2,130,150,1,128,18,0,128,146,
+0,1,58,95,129,108,1,130,227,0,5,84,88,95,44,46,58,128,91,3,128,212,0,130,
+63,0,129,125,1,133,98,1,3,34,96,32,61,128,191,0,128,0,0,128,102,0,130,20,
+0,132,25,0,0,96,128,120,0,6,96,92,32,124,61,58,124,129,91,2,128,19,1,0,
+92,128,38,0,130,66,1,0,124,129,88,0,131,93,0,132,193,1,129,46,4,0,46,130,
+145,0,0,95,133,55,1,128,129,1,12,96,44,46,96,96,45,40,41,32,89,46,45,91,
+128,16,0,129,59,0,131,232,3,138,26,1,128,142,1,128,155,0,1,45,93,129,229,1,
+0,45,131,62,0,0,118,129,33,0,0,92,128,137,0,0,96,128,29,2,2,39,10,96,
+134,206,1,135,117,0,128,232,2,128,186,1,128,119,1,0,47,128,91,0,128,92,0,0,
+44,129,6,2,130,62,2,2,44,41,76,128,105,0,133,224,0,133,58,0,0,95,128,4,
+1,128,95,0,2,96,61,46,128,138,3,136,117,4,131,30,0,131,38,3,3,44,34,39,
+44,134,48,0,128,68,1,128,150,0,0,95,133,199,1,132,121,0,0,96,134,24,2,0,
+124,128,18,0,133,205,1,139,208,2,138,124,2,135,222,4,133,92,1,134,79,3,136,23,
+0,140,244,2,139,0,3,131,79,0,135,1,3,0,92,137,124,1,137,66,0,138,114,2,
+132,167,0,136,21,5,128,185,3,135,56,0,135,177,0,129,221,1,140,186,0,139,214,4,
+0,39,129,95,2,131,153,3,2,32,47,96,131,61,1,0,44,128,79,2,131,210,4,0,
+95,128,210,4,128,137,1,129,91,1,136,17,1,135,51,1,0,96,129,28,0,1,39,74,
+129,158,4,136,24,1,134,94,3,3,96,46,95,92,128,56,0,129,179,3,141,113,6,130,
+62,0,130,51,0,1,96,39,129,15,3,132,200,1,137,153,3,130,40,1,130,144,0,0,
+34,144,176,6,128,55,2,128,32,0,129,248,2,131,80,1,129,170,0,139,32,0,1,45,
+46,128,244,2,1,39,46,130,74,2,142,62,0,0,47,128,48,0,0,95,128,29,1,1,
+124,45,128,195,0,0,45,129,93,5,144,0,0,129,184,0,142,121,6,2,96,45,34,130,
+156,0,149,29,6,128,71,3,0,32,148,0,0,5,95,46,45,34,46,10,141,21,0,0,
+46,128,21,0,3,34,96,46,39,129,11,0,5,39,46,46,95,95,44,142,34,0,3,96,
+45,46,32,131,32,0,6,32,47,32,32,44,46,96,143,69,0,128,22,0,131,32,0,2,
+32,39,96,131,44,0,145,36,0,128,61,0,131,115,0,0,45,132,44,0,129,38,0,128,
+0,0,140,41,0,3,46,46,39,46,132,9,0,0,92,139,24,0,0,124,141,41,0,1,
+96,46,132,83,0,0,124,128,73,0,137,25,0,0,39,141,84,0,0,124,137,9,0,134,
+87,0,0,47,130,22,0,0,92,139,43,0,132,235,0,130,43,0,0,41,128,162,0,133,
+44,0,129,22,0,2,40,95,96,138,44,0,0,44,135,87,0,131,98,0,139,134,0,140,
+176,0,139,44,0,2,95,44,46,128,89,1,162,44,0,132,93,1,136,14,1,154,89,0,
+131,0,0,135,45,0,147,44,0,1,92,44,129,39,1,142,45,0,140,44,0,135,12,1,
+137,101,0,2,96,46,95,145,44,0,138,161,0,140,67,2,5,46,44,43,95,95,95,141,
+21,2,136,164,0,143,40,2,128,18,0,144,71,2,134,50,0,135,154,0,1,47,32,128,
+203,0,134,18,0,140,207,1,136,51,0,128,37,0,131,183,0,1,32,47,133,229,1,131,
+2,2,128,159,0,144,212,2,130,204,1,130,33,1,129,3,3,129,67,3,131,61,0,0,
+39,132,172,0,1,46,39,144,52,0,130,212,2,129,92,0,1,45,34,128,5,0,128,94,
+3,0,124,129,45,0,129,193,1,130,52,0,128,4,0,0,39,128,12,1,146,56,0,0,
+47,135,61,2,128,104,2,4,46,96,34,32,92,130,165,0,0,124,128,187,3,0,39,128,
+78,0,129,136,3,146,125,3,130,164,0,133,23,1,128,155,1,4,46,32,96,34,46,133,
+110,0,133,22,0,129,248,2,145,59,0,131,3,3,1,96,45,128,0,0,129,10,4,128,
+131,0,0,47,128,113,2,128,184,0,0,39,132,245,0,132,10,1,146,236,0,131,95,0,
+134,146,1,4,96,45,43,45,34,134,193,1,135,220,1,0,92,145,148,1,133,52,4,1,
+95,92,128,88,1,0,95,128,137,4,132,146,1,133,116,0,157,62,0,4,106,34,46,95,
+44,128,212,4,129,115,4,135,227,4,0,39,131,146,0,128,169,1,135,63,0,0,46,145,
+63,0,128,52,2,129,112,0,130,170,0,128,178,1,128,74,0,130,127,0,1,95,124,129,
+70,0,129,10,0,135,141,1,128,82,0,142,64,0,128,227,1,130,47,0,132,9,3,130,
+226,2,128,197,0,3,45,34,95,124,134,152,2,134,125,1,128,95,0,128,90,1,129,66,
+0,128,231,0,132,171,0,3,44,39,34,45,131,39,1,128,189,4,0,45,130,70,0,130,
+55,2,0,96,128,55,2,133,122,0,0,95,128,141,0,136,171,4,2,124,32,92,128,65,
+3,131,37,0,129,173,1,0,39,133,170,0,128,103,2,131,40,0,132,202,5,133,5,5,
+128,84,0,1,46,96,135,201,0,128,216,1,128,68,0,3,46,39,124,10,128,16,0,3,
+92,32,46,34,128,121,1,132,246,0,132,60,0,128,133,1,136,158,5,132,30,1,0,96,
+128,20,0,130,158,0,132,37,0,2,124,46,47,128,233,0,2,39,10,124,128,45,2,128,
+81,0,0,47,129,241,1,138,20,2,137,132,0,130,67,0,128,45,0,133,36,1,3,124,
+10,96,95,128,32,0,0,96,139,34,0,145,70,3,128,135,0,1,10,10,0,32,183,0,
+0,5,46,39,96,46,39,10,183,63,0,0,96,130,5,0,172,65,0,5,44,45,39,46,
+96,46,138,66,0,1,96,96,138,66,0,3,39,34,45,45,134,32,0,143,0,0,1,47,
+39,131,7,0,0,92,133,16,0,0,124,130,4,0,139,133,0,129,28,0,131,158,0,145,
+0,0,0,39,132,94,0,133,135,0,1,39,44,145,200,0,129,28,0,130,91,0,148,253,
+0,8,45,32,95,44,46,34,45,46,95,128,2,0,131,76,0,0,47,140,65,0,129,169,
+0,4,124,44,96,46,45,128,0,0,152,209,0,1,32,32,128,69,0,129,139,0,0,124,
+128,130,0,1,44,34,134,41,0,0,46,130,233,0,132,238,0,1,32,39,157,68,0,3,
+92,92,32,124,128,6,1,2,124,32,58,133,104,1,130,189,0,139,51,0,133,77,0,147,
+16,2,0,46,131,64,0,128,203,0,5,95,46,39,44,124,124,130,7,0,140,3,1,0,
+92,152,132,0,0,124,128,0,0,0,10,131,86,1,4,47,32,46,95,124,128,36,1,3,
+46,46,46,39,134,170,1,132,65,0,128,86,0,149,64,0,0,46,130,134,1,0,95,128,
+188,0,140,139,1,0,96,137,253,0,128,80,0,135,67,2,140,218,1,3,39,10,46,34,
+132,58,1,134,0,0,128,137,0,131,178,1,0,96,132,93,1,129,5,0,144,65,0,3,
+46,39,46,10,128,104,1,128,179,0,137,64,0,137,0,1,128,208,0,0,32,128,19,1,
+131,61,2,137,197,0,129,48,1,129,186,0,140,85,0,140,136,0,129,17,0,0,45,133,
+74,0,133,41,0,2,46,39,95,130,58,0,129,18,0,2,46,95,95,129,125,0,128,90,
+0,142,158,0,0,44,137,74,0,128,135,0,0,95,128,56,0,1,44,34,136,114,2,0,
+47,131,66,0,141,179,2,142,129,0,128,245,3,130,98,0,0,95,135,59,0,145,76,1,
+3,95,58,46,93,145,247,2,1,34,39,128,33,1,1,95,96,128,41,1,151,84,2,1,
+58,34,149,108,2,131,214,0,128,5,0,136,63,0,135,203,3,145,114,1,148,126,3,128,
+49,3,137,110,3,141,193,0,153,65,0,133,43,0,0,96,138,132,0,142,50,0,135,190,
+0,153,6,4,139,67,0,133,90,4,143,149,0,144,67,0,134,96,0,0,46,140,190,4,
+128,120,3,146,56,0,144,67,0,134,18,0,129,121,3,140,24,0,135,69,0,136,137,1,
+144,148,1,133,67,0,131,124,3,141,24,0,134,142,5,134,106,0,0,47,144,190,3,131,
+28,0,130,182,3,143,136,0,136,250,1,133,13,0,128,172,2,3,96,39,34,34,130,199,
+2,139,42,0,131,231,2,140,68,0,134,181,0,1,44,34,128,188,2,132,68,0,133,190,
+5,138,77,3,132,15,6,130,14,0,140,68,0,132,48,0,132,72,3,132,170,1,0,124,
+130,124,2,135,18,2,138,180,0,2,124,32,44,141,212,5,130,25,0,130,106,3,135,39,
+0,0,124,139,44,6,132,139,0,132,15,0,0,96,141,88,6,129,23,0,135,223,1,133,
+243,0,128,7,0,137,59,2,130,149,0,141,191,0,129,43,0,135,3,2,133,222,5,128,
+125,0,138,212,1,128,217,3,142,204,6,129,212,4,136,57,0,0,95,128,102,4,130,106,
+7,141,126,5,0,46,140,238,0,1,47,46,138,137,5,0,92,128,106,0,155,239,7,2,
+39,32,10,2,10,10,32,157,0,0,14,95,95,46,45,45,46,46,95,44,45,39,34,34,
+45,46,156,48,0,128,37,0,16,32,46,39,32,44,39,32,32,46,45,34,39,39,45,46,
+96,46,132,26,0,129,70,0,154,61,0,129,52,0,2,32,32,124,130,2,0,2,39,96,
+45,130,55,0,0,92,128,1,0,131,0,0,128,16,0,0,124,153,62,0,0,47,133,102,
+0,133,11,0,130,120,0,135,63,0,1,32,124,153,62,0,133,61,0,129,54,0,132,178,
+0,132,63,0,133,190,0,153,62,0,134,61,0,0,46,131,46,0,131,64,0,129,121,0,
+132,16,0,128,208,0,143,251,0,0,46,128,78,1,132,177,0,2,44,34,34,128,42,1,
+128,248,0,128,250,0,133,58,0,130,4,0,0,96,128,140,0,5,95,95,44,39,46,39,
+143,125,0,128,101,0,128,2,0,129,66,0,131,53,0,128,12,0,132,62,0,131,63,0,
+131,138,0,128,187,1,0,45,134,60,0,0,95,131,0,0,133,40,1,0,96,129,47,0,
+129,3,0,129,121,1,128,182,1,136,66,1,1,124,46,128,55,0,2,45,46,95,133,57,
+0,132,198,1,1,96,34,128,20,0,129,40,0,130,44,0,132,219,0,0,124,134,36,1,
+129,8,0,0,124,128,203,0,0,39,128,218,0,0,95,129,3,0,135,181,0,134,7,2,
+136,161,0,128,156,0,3,95,46,46,39,134,36,1,130,252,1,0,45,130,110,2,131,28,
+0,129,67,0,131,56,1,131,42,1,139,69,0,0,124,134,219,1,131,41,1,135,67,0,
+131,62,2,129,65,0,128,16,0,1,43,34,132,0,1,129,76,1,133,75,2,134,67,0,
+0,32,132,54,0,132,191,0,134,96,0,128,24,0,130,95,1,129,46,0,1,44,34,132,
+199,0,134,65,0,134,136,0,129,171,2,137,147,0,0,96,133,79,0,129,32,0,128,159,
+0,129,13,0,0,47,132,61,0,129,82,0,131,55,0,1,95,95,131,7,0,1,124,96,
+128,58,2,132,74,0,128,112,1,136,96,0,129,149,1,130,10,0,133,55,2,129,16,0,
+130,141,2,128,16,2,136,161,0,0,47,130,3,2,128,31,2,132,32,0,130,18,1,131,
+6,2,128,10,0,133,179,2,0,124,129,73,0,0,96,134,116,1,134,78,0,129,245,1,
+2,46,39,47,131,60,0,132,61,0,132,67,2,1,46,95,133,53,2,130,103,0,128,3,
+0,132,109,1,133,102,2,0,92,128,123,0,0,44,130,252,0,0,124,130,144,0,0,46,
+129,61,0,128,197,2,131,53,0,0,44,133,14,2,133,54,0,131,108,2,129,18,0,0,
+39,128,56,0,130,229,3,129,155,2,128,30,0,0,92,129,75,2,128,213,0,131,56,0,
+133,162,1,131,62,1,135,189,0,2,32,39,47,130,93,2,134,160,0,128,71,0,133,139,
+1,134,88,4,129,45,3,130,155,0,132,235,0,133,36,1,128,97,0,128,2,0,136,59,
+0,134,105,3,1,32,44,135,90,3,131,50,2,129,61,0,131,180,0,0,44,129,35,0,
+0,47,128,161,1,129,160,0,129,60,0,129,57,3,130,105,1,132,60,0,134,18,4,133,
+128,3,0,95,128,228,0,1,96,45,128,3,5,128,246,1,129,56,0,131,228,1,130,64,
+0,1,96,34,128,18,0,131,57,0,1,46,32,135,145,3,134,116,3,132,30,1,128,8,
+0,129,56,0,131,23,0,131,44,0,130,96,4,131,57,0,133,112,0,0,47,128,56,1,
+128,36,3,129,0,0,133,54,0,130,53,0,128,44,0,132,18,0,130,186,0,132,231,0,
+0,44,132,54,0,135,167,2,0,95,133,236,3,1,47,44,128,11,0,0,45,128,169,5,
+129,42,3,3,96,34,46,124,131,133,5,128,54,0,133,22,1,132,95,0,128,131,4,128,
+79,0,131,59,4,1,96,45,135,242,2,128,93,1,1,95,124,131,76,0,1,124,44,134,
+49,0,128,45,6,128,238,0,129,182,4,132,130,4,129,207,3,132,51,0,129,73,0,134,
+61,0,131,49,0,0,39,129,45,0,129,24,0,136,26,0,2,32,34,45,129,18,3,128,
+156,0,131,136,0,128,204,0,128,169,0,0,34,128,185,0,129,14,0,0,47,128,44,0,
+129,146,6,0,10,128,143,1,128,22,0,128,7,0,2,39,34,10,1,10,32,152,0,0,
+1,47,124,142,30,0,1,47,96,130,6,0,0,124,129,10,0,0,32,142,30,0,0,46,
+130,24,0,128,30,0,2,96,46,39,130,36,0,0,44,136,27,0,141,44,0,0,124,133,
+44,0,130,5,0,3,96,34,39,47,132,24,0,1,95,44,128,60,0,134,0,0,2,44,
+34,39,155,57,0,129,137,0,131,97,0,1,34,32,136,57,0,3,44,39,47,95,147,56,
+0,14,44,34,124,32,46,45,34,34,34,39,39,96,44,96,46,129,51,0,132,65,0,0,
+47,128,30,0,128,10,0,2,39,32,41,131,57,0,2,46,39,46,135,57,0,5,34,34,
+43,46,95,124,129,96,0,130,20,0,131,105,0,2,44,95,95,131,129,0,0,41,130,67,
+0,0,46,133,171,0,2,96,46,96,129,37,0,1,46,39,133,171,0,4,39,95,44,34,
+46,131,60,1,0,92,132,91,0,132,68,0,129,3,0,128,59,0,135,172,0,129,59,0,
+2,47,32,106,130,223,0,2,95,44,45,128,57,0,134,134,0,2,96,45,46,130,55,0,
+131,130,0,131,17,0,1,39,47,135,230,0,3,95,92,39,32,129,100,0,4,124,44,34,
+32,95,128,41,0,128,132,0,130,135,0,128,25,0,1,46,46,139,52,1,129,33,1,0,
+10,131,71,0,1,46,34,128,83,0,2,92,46,95,129,0,0,2,46,45,39,131,218,0,
+1,96,45,128,41,0,129,13,0,1,32,44,130,50,0,0,95,129,5,0,128,32,0,128,
+172,0,128,111,0,3,92,96,46,95,129,141,0,2,32,96,124,129,55,0,0,44,128,231,
+0,131,67,1,129,117,0,132,148,1,129,255,1,2,34,32,124,130,67,0,128,134,0,0,
+39,130,1,2,4,92,45,46,96,34,129,17,0,130,109,0,2,95,95,96,130,46,0,128,
+131,1,129,122,0,1,45,45,128,61,0,1,44,94,128,4,0,128,70,0,130,88,1,128,
+111,0,129,14,1,129,57,0,130,133,0,128,114,0,1,44,46,130,0,0,131,216,0,3,
+124,44,45,34,132,110,0,129,172,1,0,124,130,107,0,129,37,0,128,21,0,128,122,1,
+2,96,32,92,129,58,0,132,146,0,2,124,124,92,128,164,0,2,124,47,96,129,10,1,
+132,140,1,2,32,32,40,130,52,2,0,96,135,23,1,130,188,2,0,39,128,35,0,130,
+59,0,129,114,1,128,151,0,0,124,133,31,0,128,8,0,128,154,1,131,155,0,1,95,
+95,131,203,1,133,27,0,128,178,0,131,65,2,130,69,0,128,206,0,131,0,0,133,250,
+2,129,38,0,129,71,0,129,102,1,128,80,0,1,124,44,128,34,0,128,133,2,0,124,
+132,204,1,0,46,128,151,2,132,12,1,129,110,2,0,47,129,225,0,129,250,1,129,30,
+0,130,42,0,135,70,0,128,61,0,133,103,1,128,9,0,128,138,1,130,228,0,0,41,
+130,59,3,0,92,128,246,0,0,39,129,72,1,130,1,1,130,140,0,130,45,0,129,92,
+0,131,73,1,130,55,1,1,39,44,128,129,0,134,182,3,0,34,128,150,1,129,70,0,
+2,96,43,96,130,79,1,131,84,1,131,10,1,1,94,44,128,226,1,131,131,2,129,210,
+1,1,45,45,134,144,3,0,47,128,228,1,133,68,0,0,124,129,176,2,0,92,128,15,
+1,129,76,2,132,116,2,130,109,3,1,45,96,128,14,0,0,47,132,131,1,130,2,1,
+1,96,46,130,89,1,132,4,3,135,65,0,128,7,0,128,153,3,133,215,0,130,17,1,
+0,96,128,40,1,0,95,130,241,0,133,56,3,129,96,1,133,120,4,130,49,0,128,78,
+0,129,80,1,1,39,102,130,3,1,132,76,0,1,44,39,128,47,1,128,24,0,128,31,
+2,0,46,129,218,1,130,84,0,0,43,128,41,1,128,248,0,0,46,138,62,0,129,223,
+1,128,0,0,128,192,2,130,143,0,1,96,46,128,145,1,132,190,0,128,105,0,128,76,
+1,131,4,1,133,229,1,129,50,0,128,54,3,0,39,128,61,2,0,39,130,55,2,128,
+222,1,128,0,0,131,119,2,128,50,2,130,101,1,0,96,131,22,2,129,85,3,130,240,
+0,133,20,5,128,69,1,0,45,129,206,4,128,10,0,0,46,130,61,0,141,158,4,131,
+167,0,0,41,130,17,2,128,166,2,0,46,130,110,4,135,125,0,128,86,0,129,124,3,
+0,96,128,162,0,143,173,5,130,121,0,129,31,4,129,202,0,131,246,1,133,27,5,128,
+110,2,128,12,1,0,96,130,60,0,147,0,0,133,12,3,130,25,2,133,78,0,128,59,
+0,128,125,5,0,95,131,255,3,131,13,3,148,61,0,0,44,129,129,2,129,59,4,132,
+56,1,129,68,0,3,46,39,45,39,128,70,2,131,223,3,153,61,0,128,96,1,133,208,
+0,132,52,5,134,4,2,129,189,0,130,14,3,142,61,6,140,64,0,130,1,3,129,164,
+0,129,189,0,134,189,1,132,3,0,128,6,3,154,62,0,130,126,6,129,168,3,132,133,
+0,128,102,1,129,230,4,130,122,0,163,62,0,141,76,0,1,32,55,128,235,1,132,83,
+1,174,62,0,133,202,0,133,62,0,142,255,6,164,133,0,128,157,5,2,44,46,124,151,
+243,1,157,0,0,129,155,3,0,10,0,32,163,0,0,2,44,124,10,164,41,0,0,124,
+158,41,0,11,44,45,34,39,34,34,96,39,32,96,46,95,156,43,0,1,39,45,128,0,
+0,0,46,130,10,0,3,95,95,96,46,129,0,0,157,50,0,1,32,96,130,4,0,128,
+52,0,128,3,0,0,59,132,18,0,0,46,158,189,0,129,48,0,132,54,0,129,162,0,
+0,34,128,9,0,161,242,0,129,48,0,1,95,46,128,200,0,129,249,0,128,175,0,162,
+52,0,3,46,39,44,39,128,99,0,129,0,1,128,65,0,2,45,45,39,159,51,0,4,
+47,46,39,32,95,129,53,0,129,102,0,0,47,158,47,0,2,39,47,95,128,48,0,132,
+144,1,159,252,0,129,132,0,2,45,96,34,130,2,1,159,191,1,134,233,1,170,46,0,
+131,188,0,0,96,152,46,0,129,67,1,134,239,0,133,99,0,150,46,0,131,61,1,133,
+80,1,158,46,0,0,32,130,16,2,128,98,0,128,69,1,0,47,130,185,0,154,46,0,
+0,95,131,34,0,0,34,128,88,0,0,47,131,232,0,129,114,0,146,46,0,2,95,44,
+45,128,246,1,136,184,0,133,140,0,0,32,144,120,1,0,124,129,81,0,139,20,1,136,
+16,0,0,92,144,48,0,137,24,1,130,67,1,133,26,1,149,49,0,128,243,2,134,82,
+0,130,43,0,0,106,140,8,1,138,50,0,1,44,34,128,127,2,135,0,3,132,82,1,
+134,206,0,141,14,0,0,95,132,0,0,138,67,0,130,58,0,132,166,3,129,115,0,131,
+126,0,144,67,0,128,42,1,0,34,130,0,1,1,95,95,128,200,3,2,34,96,45,141,
+205,3,128,224,0,2,44,45,46,129,23,0,129,191,2,132,233,0,138,49,1,129,207,2,
+129,176,0,128,64,0,128,184,0,0,34,133,150,0,128,19,0,139,73,0,0,92,130,19,
+2,130,73,0,134,10,3,0,44,141,66,2,128,26,0,0,45,133,66,0,131,70,0,140,
+69,0,134,107,1,130,110,0,131,32,1,140,215,0,138,142,1,130,194,0,137,66,0,0,
+44,130,141,4,128,54,0,131,100,1,132,9,1,137,66,0,128,143,2,130,61,4,136,77,
+2,133,64,0,130,89,2,136,60,3,135,237,2,133,14,0,129,247,0,131,168,2,0,45,
+130,28,5,128,89,5,131,60,0,132,48,0,1,95,95,138,58,0,130,9,1,128,176,0,
+129,126,1,131,102,0,128,29,0,129,3,1,131,231,2,138,38,0,128,4,0,131,77,0,
+0,39,135,102,1,132,34,0,130,117,0,129,54,0,138,44,1,130,28,0,129,58,0,141,
+140,1,129,24,2,1,46,39,141,21,0,0,124,128,123,0,139,110,1,3,124,32,46,96,
+139,87,2,0,10,1,10,32,167,0,0,4,44,45,45,46,95,166,48,0,2,95,44,39,
+130,7,0,1,96,46,156,50,0,2,44,46,45,131,0,0,0,34,135,19,0,157,52,0,
+0,47,142,17,0,130,60,0,0,96,128,160,0,155,161,0,0,46,139,48,0,131,168,0,
+135,117,0,155,60,0,0,124,138,223,0,2,95,46,46,137,178,0,159,181,0,134,62,0,
+2,39,39,34,131,27,1,141,0,0,170,128,0,149,0,0,2,96,34,45,155,135,0,147,
+123,0,146,142,0,153,71,0,135,74,1,158,0,0,0,124,152,71,0,143,202,1,176,71,
+0,133,108,2,164,200,2,0,39,147,71,0,0,44,139,206,1,157,0,0,0,47,146,69,
+0,168,22,1,151,68,0,162,232,1,201,67,0,147,233,1,169,84,1,149,156,1,0,96,
+193,39,2,167,68,0,152,106,2,165,68,0,148,29,2,170,222,1,154,57,3,165,153,1,
+155,127,3,166,156,1,152,18,1,168,54,3,150,69,0,170,122,3,149,91,1,158,5,4,
+128,109,5,2,46,46,95,153,239,2,157,154,1,1,44,45,132,168,0,4,96,34,39,45,
+45,133,136,0,1,95,95,132,84,0,160,154,1,131,55,4,131,71,0,129,101,5,131,57,
+0,1,95,46,152,0,1,130,50,0,137,220,0,128,55,0,133,135,0,134,187,4,130,218,
+0,132,76,0,129,48,0,154,80,1,135,109,0,0,96,128,51,7,128,45,0,0,96,143,
+43,1,133,212,0,130,125,0,137,22,1,3,95,46,45,39,132,41,7,132,2,1,129,50,
+7,131,25,0,0,34,133,85,1,4,34,34,34,39,10,1,10,32,162,0,0,0,124,163,
+39,0,0,47,162,39,0,1,44,39,162,79,0,0,46,166,119,0,0,124,161,39,0,2,
+39,32,39,161,39,0,0,47,128,1,0,136,39,0,9,95,44,46,45,34,34,45,45,46,
+95,143,38,0,135,39,0,128,209,0,134,0,0,0,96,129,183,0,133,0,0,0,106,128,
+118,0,130,122,0,129,39,0,137,37,0,140,41,0,1,124,124,130,83,0,0,44,150,150,
+0,7,95,95,95,46,46,45,45,44,128,71,0,128,120,0,141,0,0,0,92,135,228,0,
+9,96,46,39,96,46,45,46,44,45,34,128,93,0,133,96,0,130,59,0,128,199,0,1,
+39,39,128,72,0,0,44,128,136,0,0,10,145,69,0,136,71,0,5,92,96,32,46,34,
+96,132,166,0,1,34,39,129,23,0,2,44,39,34,130,70,0,2,39,39,34,128,72,0,
+0,46,128,1,0,0,10,137,233,0,140,184,1,129,6,0,1,39,45,139,240,0,0,92,
+128,0,1,136,3,1,1,44,39,128,135,0,129,247,0,146,209,1,131,34,0,132,130,0,
+136,196,1,0,46,135,18,0,3,46,39,32,47,155,64,0,136,228,0,1,44,34,129,110,
+1,128,31,1,1,45,46,129,76,1,128,78,1,128,157,0,128,195,0,140,147,1,134,63,
+0,130,49,1,2,46,124,44,129,70,1,132,99,2,129,216,0,128,53,0,1,34,34,130,
+143,1,128,98,1,128,70,1,145,2,1,134,227,0,2,124,124,44,132,158,0,0,124,128,
+171,0,130,10,0,5,124,34,34,96,39,34,128,197,1,128,135,0,129,82,2,1,96,46,
+128,84,1,130,143,0,134,244,0,130,13,2,132,11,0,128,30,0,131,77,0,133,144,2,
+130,51,2,133,116,0,0,96,132,156,0,128,154,1,1,124,32,128,149,0,0,96,137,204,
+0,2,44,43,46,134,236,2,128,191,1,135,26,0,130,90,0,129,14,0,129,8,0,0,
+46,129,0,0,136,80,1,128,96,0,135,34,3,129,15,0,135,121,1,129,0,0,2,55,
+32,32,133,16,1,140,237,0,0,92,145,89,3,133,9,1,130,114,0,0,96,135,104,0,
+132,212,0,2,32,32,70,144,53,0,134,37,0,0,124,132,14,3,1,96,39,128,138,1,
+128,119,2,154,141,4,133,49,2,1,34,106,146,33,3,128,31,0,130,131,3,140,0,0,
+131,76,2,128,59,0,130,220,1,142,50,0,0,96,129,41,3,148,161,0,128,52,0,1,
+96,46,143,125,2,1,124,47,146,98,4,128,238,1,130,77,1,141,3,4,129,100,1,154,
+147,4,0,124,135,148,3,132,82,1,157,47,0,129,181,0,132,204,0,129,103,1,147,143,
+0,138,54,1,2,124,32,94,129,218,2,129,154,0,155,45,0,128,198,0,128,247,3,4,
+32,106,96,32,86,130,94,3,161,157,5,132,34,1,168,43,0,166,42,0,147,157,1,143,
+180,0,2,34,34,10,0,32,224,0,0,0,10,163,38,0,1,96,96,224,100,0,1,32,
+111,185,101,0,165,100,0,1,45,47,224,100,0,2,32,47,45,224,100,0,1,46,47,154,
+48,1,2,46,45,58,151,31,0,166,100,0,2,32,58,58,150,21,2,128,97,0,0,45,
+153,131,0,167,100,0,1,46,58,147,48,1,0,46,128,24,0,2,46,32,45,153,231,0,
+167,46,1,1,45,58,128,76,0,128,0,0,2,45,45,46,135,80,0,0,96,129,16,0,
+129,14,0,150,230,0,165,100,0,0,96,129,74,0,2,96,32,96,131,202,0,128,78,0,
+129,15,0,129,105,0,0,46,128,117,0,132,194,0,189,100,0,1,58,96,131,138,3,1,
+46,47,130,202,0,130,200,0,7,96,45,96,45,45,45,96,96,128,40,1,131,229,0,130,
+7,0,182,100,0,128,78,0,128,118,1,130,203,0,1,96,45,133,197,0,1,45,45,128,
+88,0,129,23,0,130,97,0,128,15,0,185,194,2,129,81,0,130,138,3,0,45,128,9,
+0,128,6,0,128,100,0,131,112,0,130,98,0,128,3,0,128,207,0,129,4,0,168,39,
+3,128,169,0,1,58,47,128,19,1,130,0,0,129,73,0,1,46,58,129,81,0,0,96,
+128,58,2,128,80,0,132,125,1,130,124,1,129,38,1,128,2,0,131,58,1,155,89,2,
+146,201,0,128,76,0,128,24,1,130,235,1,130,34,1,128,26,1,0,47,128,18,0,131,
+122,1,129,87,0,129,7,0,3,111,115,115,47,128,26,0,129,156,1,128,5,0,158,113,
+4,145,46,1,131,34,1,133,86,2,128,104,0,4,58,96,46,58,58,129,21,0,128,114,
+0,129,149,3,3,43,78,77,100,128,112,0,129,128,0,129,29,0,154,244,1,150,147,1,
+128,80,0,136,0,0,129,71,2,4,109,78,100,43,47,132,137,5,0,104,128,12,0,1,
+115,47,130,116,2,129,119,2,134,146,0,172,100,0,128,192,0,131,168,2,131,70,0,128,
+79,0,5,111,121,100,109,109,100,129,92,2,129,45,1,129,191,0,133,100,0,148,7,4,
+163,93,2,129,186,2,130,93,2,129,86,0,0,58,131,89,0,130,74,1,133,191,6,133,
+126,3,154,134,3,158,194,2,0,58,128,98,3,129,81,0,130,215,0,133,91,4,129,189,
+2,132,251,5,131,111,0,158,191,2,155,100,0,129,11,1,131,20,3,129,203,2,133,101,
+0,134,196,2,130,78,1,160,191,2,158,140,3,1,46,47,131,40,3,129,38,1,131,102,
+0,131,46,3,128,109,2,132,117,0,130,111,2,187,100,0,133,38,1,132,40,1,130,207,
+2,129,176,4,131,189,4,131,162,1,190,25,7,129,40,3,130,69,0,132,109,0,131,81,
+2,132,188,0,129,17,2,159,190,2,163,133,5,0,58,128,87,7,132,81,2,133,228,1,
+131,120,0,129,179,1,192,227,7,131,94,4,0,96,128,65,4,132,100,0,137,173,6,129,
+122,2,164,39,9,148,100,0,132,187,4,129,100,0,128,130,1,129,194,4,132,176,2,132,
+23,0,130,2,0,186,173,8,131,94,0,129,199,0,132,90,0,137,58,5,135,210,0,164,
+43,1,147,133,5,134,132,5,156,13,1,141,100,0,133,186,5,143,69,1,141,100,0,128,
+57,2,130,102,0,134,147,1,141,48,0,0,96,129,37,1,143,201,0,130,188,1,130,22,
+0,130,91,8,139,160,0,140,100,0,128,73,2,136,250,2,131,176,2,131,16,0,133,82,
+0,129,138,1,130,195,2,130,15,2,132,134,0,128,185,1,139,140,0,128,90,1,136,136,
+9,139,100,0,128,61,0,144,193,3,130,227,1,133,100,0,128,6,2,129,27,9,0,58,
+128,0,0,128,72,7,128,70,7,129,73,7,142,3,2,130,150,7,147,100,0,132,249,6,
+146,146,5,130,23,0,128,237,3,128,38,7,129,166,8,132,211,4,132,0,0,141,183,6,
+133,40,9,145,100,0,129,209,5,148,210,2,128,146,3,128,203,2,130,73,6,130,113,1,
+134,85,0,129,111,0,139,196,12,129,32,0,151,248,1,137,109,10,131,99,2,133,0,0,
+129,62,10,129,102,0,132,212,9,140,234,1,134,152,0,129,213,4,131,250,7,151,100,0,
+128,228,0,136,230,0,132,245,1,129,115,1,130,253,6,133,1,2,135,240,3,134,156,0,
+144,30,8,151,18,9,128,63,6,128,250,8,130,135,2,133,102,0,129,249,0,133,54,3,
+138,149,3,136,192,2,137,203,2,146,111,1,138,100,0,129,51,8,128,47,4,132,213,5,
+131,250,0,131,225,1,137,36,0,130,195,0,138,18,0,137,88,0,145,101,0,139,93,2,
+132,133,10,132,172,4,131,9,0,140,102,2,0,47,128,240,7,142,137,3,137,233,1,144,
+133,9,138,100,0,135,146,0,146,81,4,129,231,0,128,26,2,143,100,0,138,23,3,143,
+52,3,143,140,3,150,246,5,128,194,10,132,203,10,147,163,8,128,223,2,131,201,1,143,
+26,0,141,187,4,138,169,3,136,233,1,128,196,0,0,43,131,21,14,129,214,13,148,54,
+10,130,103,0,160,100,0,129,210,1,129,64,6,137,95,0,1,47,47,129,137,12,128,199,
+2,129,202,11,2,96,58,47,128,84,4,150,134,14,2,46,58,47,157,46,1,137,50,12,
+138,248,1,133,7,13,129,128,0,129,53,0,2,88,72,32,153,0,0,1,72,88,140,16,
+0,3,10,72,59,88,142,20,0,137,47,0,141,79,0,128,48,0,128,0,0,149,102,0,
+128,75,0,142,48,0,0,88,128,0,0,128,50,0,147,49,0,1,72,88,142,24,0,0,
+10,129,117,0,128,23,0,146,49,0,128,26,0,131,23,0,136,103,0,129,48,0,131,49,
+0,143,200,0,129,25,0,129,48,0,138,103,0,1,10,32,128,146,0,0,72,129,49,0,
+134,19,0,128,57,0,131,11,0,128,96,0,128,22,0,129,76,0,136,77,0,0,10,130,
+23,0,138,49,0,1,72,72,129,2,0,131,23,0,128,42,0,130,20,1,135,4,1,128,
+48,0,134,49,0,0,88,130,171,0,130,113,0,129,8,0,129,20,0,129,115,1,133,18,
+1,130,10,0,0,72,129,48,0,132,49,0,129,93,1,128,40,0,129,57,0,131,138,0,
+130,118,0,128,1,0,0,59,131,67,0,129,106,0,0,72,129,244,0,128,11,0,132,198,
+0,0,59,130,9,0,129,0,1,129,190,0,130,67,0,128,10,0,130,21,0,129,45,0,
+130,174,1,130,195,0,130,0,0,131,49,0,129,77,0,129,73,0,129,98,0,128,24,0,
+128,35,0,130,6,0,134,47,0,129,48,0,129,156,0,131,48,0,128,31,0,130,127,0,
+129,28,0,129,42,0,129,86,1,130,60,0,130,46,0,131,140,1,130,195,0,132,150,0,
+131,71,0,132,24,1,131,151,0,142,47,0,132,48,0,130,114,1,135,49,0,131,0,0,
+131,47,0,132,48,0,133,47,0,133,48,0,128,150,0,131,29,1,1,88,32,133,102,0,
+131,143,0,134,47,0,130,113,0,136,48,0,131,175,0,128,176,1,132,49,0,1,88,32,
+131,80,1,129,111,1,135,246,0,128,50,0,131,48,0,130,120,1,130,68,0,132,111,1,
+131,112,0,132,108,0,128,78,0,134,47,0,129,48,0,132,204,1,132,128,1,130,124,1,
+132,65,2,129,10,0,130,126,0,134,46,0,130,124,2,131,14,0,132,19,1,131,10,0,
+136,119,1,131,174,0,133,46,0,134,135,1,131,219,1,129,9,2,134,35,1,133,186,3,
+130,113,1,131,244,0,129,176,0,132,244,0,131,113,1,130,26,3,132,0,0,132,95,0,
+130,193,0,131,10,2,130,103,0,133,184,1,133,74,1,131,223,1,129,55,0,133,237,2,
+128,26,0,131,147,0,131,123,2,132,146,0,132,224,0,130,66,2,131,88,2,135,50,3,
+137,85,1,133,135,1,133,76,1,130,54,0,136,144,0,132,35,1,132,3,2,133,37,1,
+134,120,0,132,59,1,134,75,0,130,204,3,129,50,0,131,164,3,130,133,3,134,124,2,
+130,24,0,133,76,1,128,111,0,136,47,2,130,183,1,130,6,2,135,48,0,131,47,0,
+130,48,0,140,55,4,133,50,1,131,74,3,133,48,0,131,47,0,131,240,1,134,58,4,
+130,9,0,131,101,1,132,235,4,131,98,0,129,113,3,131,58,2,130,70,0,129,13,0,
+131,48,0,131,49,0,133,47,0,132,96,2,132,26,2,135,145,2,128,150,0,133,49,0,
+129,190,0,131,98,0,133,180,1,129,167,1,135,222,2,130,22,5,130,158,0,132,49,0,
+130,106,1,130,55,0,133,232,1,135,184,1,136,216,5,130,54,0,130,49,0,132,171,4,
+130,4,5,132,254,1,130,38,3,137,64,3,131,62,6,128,203,0,131,107,0,132,89,2,
+131,98,1,132,244,3,133,75,2,131,194,2,131,28,0,130,114,1,131,140,0,131,85,2,
+134,32,0,137,48,0,131,242,2,131,148,0,131,58,3,128,139,0,132,188,0,136,82,0,
+134,146,0,133,62,0,134,48,0,130,231,5,132,98,0,137,48,0,0,59,131,15,3,131,
+47,0,132,172,0,131,23,0,130,138,0,131,233,2,138,48,0,128,140,5,133,190,2,131,
+25,0,135,11,0,129,255,0,130,82,1,140,48,0,134,192,4,133,160,2,136,241,6,136,
+135,2,137,48,0,129,70,1,131,240,0,130,28,6,135,60,0,141,136,2,130,252,5,0,
+10,130,138,2,136,60,1,133,2,2,145,130,7,129,41,0,129,124,2,135,120,0,132,140,
+3,147,131,7,131,160,0,134,26,2,132,246,5,153,230,7,138,140,5,135,189,1,149,96,
+0,144,48,0,131,20,2,155,96,0,138,48,0,129,49,0,133,192,4,163,48,0,131,200,
+2,0,10,0,32,149,0,0,1,47,124,130,6,0,1,39,10,150,32,0,11,32,96,46,
+32,32,44,39,124,44,45,46,95,128,0,0,149,40,0,0,47,129,4,0,1,96,39,128,
+3,0,132,16,0,3,96,34,34,45,128,0,0,3,46,46,46,44,139,51,0,128,78,0,
+128,80,0,2,95,95,46,128,44,0,147,0,0,3,46,45,39,46,139,104,0,1,47,32,
+129,167,0,1,39,32,146,51,0,1,44,95,134,10,0,2,96,39,96,129,114,0,136,60,
+0,130,102,0,0,46,128,192,0,149,108,0,2,96,46,96,128,217,0,138,17,0,1,39,
+46,134,63,0,131,30,1,134,212,0,147,174,0,128,2,0,129,67,0,2,44,34,39,128,
+124,0,130,74,0,128,14,0,131,66,0,0,44,133,230,0,154,65,0,129,133,0,128,67,
+0,1,46,95,129,107,1,131,62,0,129,70,0,133,149,1,131,20,0,157,0,0,0,46,
+129,105,0,128,64,0,128,208,0,133,48,0,128,71,0,128,14,0,132,69,0,132,202,0,
+158,0,0,130,61,0,139,71,0,129,14,0,0,92,172,70,0,10,44,39,44,46,39,34,
+45,92,32,32,92,131,82,0,132,73,0,130,70,0,1,44,45,150,143,1,145,87,2,2,
+32,46,34,128,71,0,128,66,1,132,132,0,156,16,1,0,39,128,73,1,1,32,44,128,
+36,0,131,60,0,129,178,0,131,26,1,128,62,0,128,143,2,1,95,41,156,115,0,128,
+47,0,0,34,132,7,1,132,70,1,0,39,128,11,0,128,21,0,130,74,1,128,137,0,
+132,102,0,0,46,130,223,2,0,95,128,172,2,129,161,0,0,39,133,70,2,133,164,2,
+138,41,1,1,96,46,129,133,0,130,190,0,137,13,1,128,50,0,128,65,0,129,97,0,
+135,140,2,133,55,0,140,34,1,2,96,32,47,132,130,1,136,64,0,132,226,1,130,49,
+2,130,50,2,0,45,131,84,0,129,0,0,134,168,0,132,142,0,134,213,2,0,76,139,
+238,2,129,127,0,130,243,1,128,176,3,128,140,0,128,28,0,128,9,0,2,46,46,47,
+139,63,0,4,124,124,45,46,44,133,4,2,130,54,0,138,159,0,128,128,0,137,215,0,
+133,11,1,136,91,3,128,47,0,0,124,129,34,0,136,67,0,140,202,1,1,95,46,128,
+67,0,0,96,129,15,1,133,209,2,132,53,3,1,95,95,130,145,0,130,36,1,0,124,
+129,119,0,1,39,45,139,177,4,0,47,128,153,4,132,40,2,132,72,1,128,119,0,129,
+207,0,1,45,45,130,16,0,128,71,0,3,46,40,32,41,138,56,1,129,182,3,142,205,
+4,128,227,0,0,46,132,53,2,128,192,4,131,5,0,0,39,128,2,0,129,86,4,132,
+43,1,137,127,1,130,42,0,139,208,0,138,183,2,129,234,2,142,94,3,130,66,0,128,
+83,0,129,215,0,128,0,0,133,71,1,151,131,5,148,243,2,133,231,1,1,32,34,128,
+212,2,133,140,1,133,35,2,147,58,0,147,115,5,132,170,5,135,147,3,1,39,32,145,
+231,5,135,59,0,129,116,2,161,145,4,143,210,0,139,135,5,134,36,1,152,0,0,0,
+95,140,62,6,137,53,0,128,48,2,2,45,34,124,130,182,2,155,208,3,140,66,0,133,
+65,0,133,45,2,129,218,3,2,39,46,44,129,3,1,141,174,1,129,179,0,128,120,2,
+0,34,140,66,0,132,111,0,135,206,0,131,180,3,129,50,3,128,42,2,129,46,4,133,
+185,2,128,155,1,1,45,34,128,212,2,128,68,0,139,66,0,131,58,0,136,2,1,132,
+75,0,133,118,3,128,71,0,130,190,2,140,8,7,142,25,4,132,107,0,134,173,3,138,
+142,2,133,136,0,137,31,1,128,175,4,1,44,39,128,118,2,134,198,2,138,49,0,128,
+29,0,128,23,0,0,41,148,41,2,135,123,2,140,82,1,0,96,132,74,1,144,0,0,
+135,71,4,131,252,5,168,134,6,129,3,0,0,44,156,24,3,142,204,2,0,45,128,134,
+7,1,39,10,1,10,32,225,0,0,226,101,0,159,100,0,2,58,43,47,131,0,0,5,
+58,45,45,46,96,96,208,100,0,3,46,43,43,45,132,10,0,7,96,96,46,45,45,43,
+104,115,133,15,0,196,100,0,3,96,47,43,58,138,185,0,6,46,111,47,96,32,43,43,
+199,100,0,0,96,128,38,1,139,27,1,2,96,43,43,130,16,0,2,45,115,46,195,100,
+0,0,45,135,38,1,140,98,0,129,10,0,1,111,58,155,84,0,0,96,128,189,1,157,
+100,0,136,38,1,128,134,1,6,45,58,58,58,47,47,43,138,190,0,0,47,134,112,0,
+145,62,0,128,160,0,2,58,104,111,136,33,0,144,100,0,0,46,136,219,1,2,121,58,
+46,128,81,2,129,0,0,1,47,43,137,101,0,0,46,150,50,1,130,40,0,4,46,115,
+96,46,121,153,100,0,0,58,137,131,0,0,121,129,11,0,4,111,100,109,100,43,131,61,
+0,135,75,0,1,111,47,147,240,2,0,111,128,36,0,128,99,0,128,8,0,152,100,0,
+0,43,137,60,0,0,96,129,142,0,1,96,109,128,0,0,0,100,128,109,0,128,7,1,
+129,57,1,132,0,0,0,104,145,202,1,0,111,129,4,1,129,99,0,1,32,121,136,145,
+0,140,100,0,0,96,130,37,0,139,100,0,3,32,58,115,121,131,29,1,128,36,1,134,
+229,0,137,169,0,134,98,0,130,16,2,130,74,1,138,30,0,139,100,0,140,157,2,2,
+46,111,115,137,215,0,0,45,129,161,0,133,0,0,142,148,1,130,68,3,134,174,1,137,
+200,0,139,100,0,139,52,2,130,180,2,132,61,1,129,238,3,0,47,137,172,1,131,227,
+0,144,225,2,0,96,130,99,0,139,231,0,136,100,0,140,254,2,0,47,129,194,1,2,
+32,46,121,131,186,4,0,58,128,183,4,150,186,1,129,20,2,132,29,0,131,99,0,131,
+48,2,144,100,0,1,96,115,134,9,5,128,10,5,0,58,130,156,1,0,45,141,245,3,
+136,166,2,141,82,2,137,99,0,140,176,1,134,100,0,132,30,0,131,27,1,5,45,121,
+111,111,58,96,128,200,1,146,98,0,2,111,121,45,137,23,0,131,82,2,138,68,0,139,
+200,0,134,100,0,0,96,136,129,3,131,95,1,0,111,138,180,3,136,151,5,0,47,128,
+159,1,131,201,2,129,67,1,0,46,136,100,1,133,99,0,0,58,140,67,5,133,100,0,
+136,42,0,129,252,0,0,96,129,46,1,135,5,1,136,181,0,138,70,3,128,109,0,130,
+99,1,131,177,1,134,12,1,140,200,0,133,100,0,135,199,1,129,236,2,128,115,1,130,
+215,0,136,20,5,132,126,0,148,25,5,131,219,0,0,111,132,196,2,141,200,0,132,100,
+0,0,47,133,22,0,0,96,128,12,1,137,214,1,133,12,1,129,194,2,0,43,139,168,
+3,145,0,0,0,47,130,171,0,141,200,0,131,100,0,0,46,132,22,0,0,96,128,10,
+3,128,189,0,132,98,0,129,88,0,3,58,47,121,111,133,126,1,1,47,104,139,83,2,
+145,176,1,0,115,145,200,0,132,201,0,132,145,4,128,115,5,128,227,3,133,158,4,1,
+115,115,140,27,3,1,121,46,132,70,1,151,0,0,129,173,0,142,200,0,138,241,3,0,
+96,128,184,0,135,116,3,138,141,5,132,174,1,150,57,3,133,0,0,129,46,2,143,158,
+7,148,25,7,2,46,58,111,143,0,5,131,175,4,128,91,8,151,53,1,128,97,0,143,
+200,0,146,180,6,129,130,1,0,43,144,99,0,131,114,1,129,194,1,151,148,1,0,121,
+144,200,0,143,100,0,128,141,6,128,138,0,134,110,2,140,108,6,130,107,2,139,21,9,
+1,96,111,128,186,2,130,138,4,0,47,128,51,3,0,121,144,200,0,142,100,0,131,106,
+5,0,47,137,212,5,138,95,6,128,23,0,0,45,131,207,0,135,42,4,128,216,8,2,
+43,45,46,131,6,4,129,112,0,131,140,2,136,52,2,140,79,6,132,10,3,3,45,111,
+104,115,129,42,0,142,124,1,129,12,1,138,171,0,132,186,5,141,64,9,130,8,10,134,
+201,3,138,93,2,137,40,0,1,45,115,128,157,0,0,45,131,150,0,136,148,0,1,121,
+46,134,116,1,0,96,128,29,0,1,43,104,134,3,4,142,10,10,134,198,6,137,100,0,
+138,170,4,129,112,0,128,157,0,131,117,7,136,107,0,1,46,115,129,200,0,129,95,0,
+1,47,47,128,139,5,139,86,6,136,212,10,138,144,7,134,100,0,1,46,115,137,151,4,
+132,112,0,128,157,0,135,220,0,131,89,0,130,71,1,131,124,0,145,31,2,129,21,10,
+128,64,9,0,46,130,0,0,128,180,9,0,111,129,192,1,134,100,0,1,58,121,136,174,
+0,136,8,5,128,229,3,138,5,1,0,96,136,189,7,145,174,2,128,58,2,128,13,10,
+128,94,0,128,0,0,128,103,0,130,190,6,135,46,1,131,60,0,129,26,1,0,43,138,
+91,2,128,39,0,128,158,1,135,17,0,135,101,0,144,176,8,142,194,10,130,244,2,136,
+126,7,0,58,128,27,1,132,249,8,138,151,3,129,19,0,137,27,11,133,78,5,139,202,
+2,148,89,10,130,43,0,139,194,2,129,241,2,1,58,96,131,210,9,129,91,3,137,40,
+1,133,6,2,133,132,0,130,194,9,146,101,3,137,79,0,130,42,0,143,86,4,128,132,
+1,0,104,132,59,2,142,172,11,131,103,3,128,252,7,146,99,0,140,42,1,134,157,2,
+148,32,5,153,104,5,129,171,5,2,111,111,43,143,62,4,138,42,1,129,151,2,134,14,
+0,181,152,14,0,121,128,170,3,139,102,0,136,26,6,138,97,0,184,100,0,128,250,9,
+136,178,8,137,229,11,138,91,3,188,98,15,134,200,2,131,68,8,0,121,131,124,2,128,
+208,1,144,212,6,182,100,0,138,125,11,131,170,2,141,183,3,192,44,16,131,208,4,133,
+46,1,0,121,128,241,2,147,97,0,194,145,16,132,115,9,150,97,0,208,246,16,0,10,
+0,32,224,0,0,0,10,255,100,0,255,100,0,8,32,32,96,46,58,43,111,121,104,134,
+0,0,6,121,121,115,111,43,58,46,198,100,0,1,46,58,128,93,0,7,121,111,43,47,
+45,46,96,96,135,117,0,128,118,0,5,47,111,121,121,43,45,190,100,0,0,96,128,96,
+0,0,115,145,177,0,135,32,0,2,115,104,111,135,122,0,175,100,0,5,96,47,115,115,
+47,46,136,65,0,149,38,0,1,104,47,181,100,0,0,45,128,97,0,128,19,1,1,46,
+45,134,0,0,0,46,129,0,0,136,49,1,135,102,0,1,111,121,133,235,0,170,100,0,
+4,58,121,121,58,58,129,88,0,0,96,133,0,0,131,109,0,2,58,58,47,129,0,0,
+128,27,0,138,108,0,1,58,104,132,101,0,168,100,0,2,45,121,111,139,68,0,142,187,
+0,1,96,96,128,111,0,136,171,1,1,58,100,131,11,0,166,100,0,2,96,111,115,151,
+233,1,138,40,0,1,45,47,134,91,2,1,43,104,170,100,0,1,46,121,135,199,1,159,
+44,0,0,47,133,143,0,1,121,43,168,100,0,0,58,131,196,1,128,242,1,131,231,1,
+157,93,2,133,204,0,1,46,109,129,41,0,163,100,0,1,43,121,130,222,1,130,244,1,
+137,90,2,130,15,0,146,112,0,0,43,132,203,0,0,100,129,202,0,162,100,0,2,111,
+115,58,148,187,0,135,97,2,140,108,0,1,96,115,131,201,0,1,111,100,129,100,0,158,
+86,3,128,99,0,137,189,3,151,89,2,128,108,0,0,46,135,27,2,0,111,131,54,1,
+1,46,78,128,18,0,160,100,0,1,43,115,160,136,0,133,106,0,1,58,45,132,103,0,
+129,38,1,4,96,58,96,32,109,128,157,1,159,100,0,1,58,121,166,99,0,132,153,5,
+128,102,0,2,96,45,43,129,67,1,128,57,0,1,100,58,160,147,1,0,46,133,182,3,
+168,181,3,0,47,130,94,0,0,43,130,156,0,161,100,0,0,96,134,31,3,133,73,4,
+160,204,0,131,94,0,128,43,1,128,0,0,130,46,1,159,144,1,128,179,2,129,188,2,
+131,34,3,130,0,0,139,28,5,143,232,5,131,18,0,131,157,1,129,40,3,156,100,0,
+1,96,100,128,214,5,150,188,0,135,35,5,128,108,0,135,238,3,133,8,0,0,45,128,
+160,1,1,47,109,159,39,3,0,43,130,22,4,161,86,2,128,238,0,130,186,0,0,96,
+134,126,4,128,92,4,0,46,128,86,6,158,100,0,1,96,104,169,89,2,128,88,2,0,
+45,131,143,1,128,112,0,128,100,0,129,115,0,0,115,129,47,3,155,100,0,0,47,164,
+200,0,136,171,5,129,180,4,128,94,0,128,207,0,130,154,1,0,100,129,216,0,155,39,
+3,170,200,0,130,34,1,129,149,0,128,140,1,129,100,0,129,94,0,1,96,109,129,206,
+0,154,100,0,0,45,131,128,4,129,221,1,132,124,5,157,193,2,130,44,1,128,25,3,
+129,97,0,0,43,128,45,0,131,80,6,154,100,0,1,111,58,133,252,4,130,98,0,135,
+189,2,132,202,2,142,114,0,0,45,129,189,0,130,38,1,0,47,128,1,2,128,100,0,
+130,45,1,154,100,0,2,96,100,58,149,150,8,131,188,2,136,115,0,131,39,0,132,200,
+0,128,1,2,2,96,32,47,128,11,0,1,45,100,130,23,0,146,100,0,129,143,2,2,
+47,111,58,165,191,2,129,192,2,128,49,0,128,104,0,130,94,1,128,100,0,128,190,4,
+0,46,129,100,0,130,91,2,145,100,0,128,122,10,3,43,47,58,45,128,223,5,132,6,
+8,166,244,1,0,45,130,195,1,0,96,129,146,1,129,103,0,128,199,2,130,23,7,143,
+100,0,128,92,0,131,83,1,2,115,96,43,131,134,0,170,149,9,130,247,2,130,169,0,
+130,101,3,132,65,0,139,100,0,2,46,111,111,131,189,0,1,46,104,128,99,0,173,191,
+2,128,77,5,130,106,0,2,45,46,58,130,168,0,0,45,133,1,3,138,100,0,1,58,
+121,133,204,8,1,121,58,161,14,7,148,87,3,128,229,9,128,213,1,128,168,0,133,77,
+0,137,100,0,0,47,134,87,10,2,96,100,115,130,123,2,128,87,1,0,43,129,25,10,
+128,133,5,141,103,2,130,155,5,128,0,0,128,214,11,135,26,0,0,111,129,42,2,129,
+89,2,129,148,1,131,14,9,140,100,0,0,58,135,223,3,1,96,109,129,99,0,5,45,
+43,47,111,43,45,129,106,2,128,99,0,128,214,1,136,34,12,1,58,43,129,118,0,129,
+22,5,2,47,111,111,128,138,2,132,27,0,3,96,104,46,96,129,10,0,129,100,0,133,
+144,1,138,100,0,0,96,134,221,0,129,46,1,129,244,2,1,47,96,128,164,9,7,46,
+115,100,78,78,109,78,43,128,82,5,131,139,6,129,94,5,129,201,6,2,46,43,115,128,
+136,12,129,182,0,0,111,128,158,10,132,145,12,0,45,131,12,1,128,197,2,0,121,136,
+54,2,135,100,0,0,58,131,82,10,132,12,0,128,177,3,0,104,129,26,6,1,96,104,
+128,98,0,9,109,109,78,100,100,121,32,58,115,45,129,188,0,128,62,1,128,64,0,0,
+43,129,21,0,0,78,128,102,13,128,101,0,130,36,1,129,23,3,129,157,2,129,131,3,
+0,46,139,112,10,135,100,0,0,43,130,26,2,134,159,1,1,47,96,129,193,11,128,2,
+10,0,78,128,0,0,128,80,0,1,109,115,128,19,0,130,57,1,1,96,32,128,130,2,
+1,45,109,130,123,0,128,4,0,128,194,0,130,57,0,0,96,131,207,9,6,46,111,46,
+96,58,47,115,138,106,13,136,201,0,129,134,9,136,243,2,128,13,14,0,43,128,227,4,
+0,121,129,96,0,3,109,109,46,96,134,109,2,128,8,0,0,46,129,95,0,130,123,0,
+129,214,3,131,102,11,131,99,0,3,96,115,121,111,140,53,11,136,246,1,136,24,13,132,
+191,3,128,214,6,0,58,129,121,14,0,115,129,186,13,0,45,132,184,7,129,141,0,128,
+104,3,1,43,100,129,102,0,128,8,0,129,157,6,130,27,3,131,74,2,0,96,135,82,
+2,143,98,0,1,46,104,133,213,1,138,4,12,128,87,3,130,0,5,137,27,0,129,73,
+2,128,126,14,0,47,130,7,0,0,47,130,67,4,130,33,4,131,254,2,133,73,4,145,
+100,0,128,74,1,128,213,1,165,248,14,128,151,1,129,1,2,1,58,47,135,222,0,133,
+13,8,1,46,78,152,100,0,129,1,8,0,111,160,112,14,134,166,5,129,224,0,139,105,
+10,130,11,1,0,111,138,62,2,143,28,5,0,96,129,205,0,142,217,3,169,23,15,2,
+47,96,43,142,211,10,136,100,0,128,131,13,128,224,5,131,31,2,164,54,1,133,141,1,
+132,67,1,129,52,0,2,46,43,104,136,64,1,143,82,4,0,121,129,131,4,129,143,4,
+134,137,13,132,7,0,149,83,6,140,43,16,130,219,5,130,111,4,128,136,4,137,104,0,
+138,46,1,130,12,7,0,121,133,32,13,128,14,0,131,28,0,132,60,0,138,110,0,0,
+96,128,9,0,129,199,2,138,65,8,128,169,3,134,215,4,0,115,136,38,15,140,75,6,
+0,115,131,174,6,130,13,10,133,49,0,134,115,10,129,154,14,136,137,10,135,224,14,132,
+99,0,129,115,7,133,38,5,130,215,4,133,18,3,140,93,2,128,145,2,128,214,5,1,
+47,43,128,23,17,133,66,0,128,194,4,134,54,0,1,111,45,130,43,4,128,12,5,128,
+134,2,140,50,2,132,228,3,128,220,2,128,233,7,131,222,2,131,167,8,147,68,8,0,
+96,128,116,16,135,143,0,132,108,0,128,79,17,128,174,4,3,46,47,104,111,129,0,0,
+141,197,0,2,96,58,104,128,253,8,134,98,2,1,100,115,128,35,0,130,61,18,150,100,
+0,129,178,0,0,43,128,104,2,3,47,47,43,121,128,164,4,129,76,6,0,43,132,246,
+7,1,104,43,144,224,11,128,179,4,2,111,58,58,128,163,5,128,90,0,128,55,0,129,
+43,0,133,20,17,151,201,0,135,0,0,0,115,128,31,5,128,112,0,135,47,17,128,245,
+7,135,117,1,131,56,1,128,82,6,128,227,1,128,29,1,1,115,121,149,33,13,161,249,
+14,143,46,9,130,0,0,128,53,5,128,185,0,1,115,121,130,63,5,128,11,0,140,164,
+1,186,100,0,137,37,2,128,106,0,142,121,3,203,100,0,137,69,0,1,10,32,172,0,
+0,2,43,115,46,173,50,0,1,32,32,172,101,0,4,96,104,96,111,43,221,100,0,6,
+47,111,32,32,45,111,45,137,118,0,0,45,159,218,0,171,100,0,1,96,100,130,81,0,
+3,43,121,111,43,128,0,0,7,47,58,58,111,111,47,46,115,137,115,0,174,100,0,3,
+45,47,45,96,136,12,0,129,86,0,1,115,46,129,0,0,0,58,130,86,0,9,96,96,
+46,58,47,47,47,45,45,104,185,100,0,2,96,104,45,129,69,0,12,58,46,46,47,111,
+115,111,47,58,45,45,46,45,130,100,0,135,122,0,7,32,32,46,47,43,111,43,47,137,
+17,0,172,46,1,1,47,115,130,176,0,128,20,1,138,87,0,1,96,46,128,110,0,135,
+17,0,4,46,47,96,46,43,138,167,1,171,147,1,1,115,47,132,86,0,129,109,0,140,
+0,0,128,213,0,133,116,0,128,111,2,3,96,47,111,58,180,100,0,1,96,100,130,101,
+0,132,132,1,142,29,0,133,102,0,0,46,129,37,0,0,96,128,176,1,177,100,0,0,
+46,128,136,1,0,58,131,134,1,133,0,0,139,124,1,0,46,132,86,0,131,58,3,1,
+96,121,132,248,0,169,100,0,1,47,111,128,85,0,0,45,130,127,1,135,0,0,128,17,
+0,136,106,0,132,126,2,132,159,3,1,47,111,128,70,3,165,100,0,128,74,0,6,45,
+45,58,111,104,43,43,129,200,0,142,29,0,1,46,45,135,21,0,131,136,1,132,193,0,
+0,47,148,14,4,144,100,0,2,47,121,111,129,173,2,129,27,1,130,186,0,0,58,137,
+34,1,0,45,128,210,2,0,45,128,15,2,1,46,47,131,102,0,130,100,0,0,96,131,
+106,0,0,45,128,185,1,0,121,145,189,1,145,201,0,128,250,2,137,248,2,0,96,135,
+105,1,128,164,1,128,24,0,130,115,2,0,96,131,12,2,128,68,3,3,45,58,58,47,
+128,217,0,1,46,58,128,118,0,2,96,58,104,128,159,0,141,53,3,147,147,1,3,96,
+45,43,115,129,51,0,132,171,2,134,99,0,130,167,0,1,45,121,132,212,0,128,12,0,
+2,45,58,96,130,81,0,128,48,0,0,46,128,141,0,129,184,3,128,26,4,141,255,1,
+149,248,1,1,58,111,128,44,0,130,89,2,136,148,1,0,121,131,185,4,133,119,1,0,
+47,130,73,1,0,96,129,26,2,129,195,0,128,39,2,129,5,1,0,104,142,200,0,150,
+100,0,0,104,129,41,0,129,74,2,131,193,2,130,109,0,0,58,131,59,2,1,58,115,
+131,189,0,128,132,3,128,22,0,1,58,47,128,186,1,0,45,128,148,1,1,47,111,128,
+21,0,2,47,47,96,144,149,1,148,100,0,129,18,1,130,99,2,130,252,1,133,45,1,
+132,247,3,128,101,4,130,197,2,129,199,0,0,45,129,214,0,0,96,129,250,1,0,121,
+129,17,0,1,115,96,135,232,0,158,100,0,1,43,43,142,120,3,129,21,0,131,164,0,
+129,66,4,0,46,128,229,0,0,47,128,127,0,129,34,1,0,32,128,22,0,1,47,32,
+129,169,1,0,104,128,150,2,144,197,2,133,100,0,128,182,0,134,177,0,129,172,0,0,
+43,129,109,1,131,227,3,133,22,0,128,34,0,0,43,132,159,4,128,231,1,128,176,1,
+0,47,128,29,0,128,186,0,129,31,3,128,129,2,128,100,0,0,46,129,244,5,0,111,
+143,246,3,131,100,0,0,58,129,128,6,0,58,128,233,1,133,228,1,1,111,47,128,152,
+2,131,45,3,128,91,0,128,110,0,0,58,129,77,6,2,47,43,115,134,219,2,128,206,
+0,129,132,1,129,141,1,129,43,5,1,96,32,128,187,6,0,45,129,79,1,131,29,2,
+143,100,0,1,58,115,130,41,6,128,192,1,132,134,0,2,58,121,43,136,175,6,0,46,
+128,153,6,133,59,1,0,45,135,167,0,128,2,6,128,114,0,132,40,0,3,96,46,104,
+45,128,71,0,132,205,0,145,100,0,129,133,2,128,71,4,129,114,1,131,101,0,2,96,
+47,104,129,191,2,132,41,1,130,196,2,129,196,4,128,217,0,132,150,1,133,227,5,128,
+157,0,129,100,4,129,5,1,128,96,0,3,47,111,45,45,145,140,7,137,248,1,0,96,
+129,82,2,129,187,2,0,96,130,21,1,129,122,0,129,50,1,129,170,0,0,96,128,101,
+3,129,204,0,132,231,3,135,112,6,0,43,129,185,1,130,133,7,129,125,2,146,91,2,
+140,93,2,129,133,0,129,202,0,130,32,2,129,96,0,133,163,1,0,46,128,159,2,128,
+114,1,136,112,5,133,179,3,0,104,130,149,7,130,37,2,128,35,3,130,205,8,156,100,
+0,129,15,4,128,124,8,1,46,43,128,146,0,129,237,3,129,101,3,130,148,3,128,46,
+4,129,177,0,129,11,0,139,100,0,130,219,5,129,150,5,128,107,0,128,214,2,0,47,
+147,147,9,138,100,0,0,46,129,25,2,128,31,4,4,43,111,47,47,121,129,59,0,129,
+119,2,131,48,1,130,24,3,0,45,128,239,7,138,46,1,129,14,5,128,43,1,0,111,
+128,74,8,128,148,0,0,43,149,129,7,136,100,0,128,148,2,1,121,104,128,167,2,128,
+187,2,128,103,0,128,252,0,128,134,1,128,92,0,128,31,3,130,241,5,131,248,1,138,
+80,8,1,47,121,129,226,0,133,58,3,1,58,111,128,36,5,155,100,0,0,96,128,135,
+0,131,66,0,129,92,0,132,247,1,129,0,0,128,114,3,128,98,5,144,124,7,0,46,
+128,30,2,130,41,1,128,63,3,131,227,2,0,46,128,40,4,145,4,8,134,100,0,133,
+152,8,141,42,8,128,31,1,0,96,133,205,1,1,46,47,136,192,6,2,46,46,43,128,
+92,0,128,152,0,3,96,45,47,121,128,103,3,128,150,1,128,82,1,0,43,135,96,3,
+128,31,0,132,142,7,133,100,0,129,71,3,129,242,0,0,58,136,132,3,130,247,6,128,
+48,4,1,45,43,130,48,1,129,155,1,136,192,6,131,178,2,133,24,6,131,157,3,128,
+132,0,128,241,6,130,34,6,128,120,4,0,45,130,152,5,136,100,0,128,88,2,129,48,
+1,128,145,0,0,47,135,242,0,128,203,5,128,202,0,129,158,6,129,0,0,130,138,7,
+138,239,0,128,234,1,128,193,1,129,46,0,0,43,129,235,4,132,103,0,0,46,129,171,
+0,128,73,0,0,47,134,184,3,132,100,0,2,96,58,115,130,115,6,131,230,5,134,242,
+0,129,143,1,128,68,0,128,212,4,129,99,2,129,12,0,141,15,8,128,42,0,128,50,
+11,129,236,3,128,20,11,128,50,1,128,39,2,129,255,3,129,60,2,135,158,1,131,100,
+0,128,180,2,133,153,9,1,96,115,128,148,0,2,45,47,115,128,85,0,128,37,1,129,
+44,3,128,227,0,0,58,128,139,1,132,15,2,141,181,1,3,58,111,58,96,128,95,5,
+128,2,1,129,36,2,0,115,146,196,2,131,100,0,128,31,3,128,134,4,130,54,4,129,
+108,0,1,46,43,129,166,9,130,83,5,132,239,5,130,57,4,129,0,0,129,209,4,144,
+49,11,131,224,11,147,104,10,133,100,0,0,45,128,90,0,128,143,0,128,28,3,129,130,
+4,128,76,6,128,74,5,1,111,121,134,149,0,0,45,128,184,11,134,223,2,129,13,1,
+129,79,0,135,224,9,132,88,8,158,112,11,0,96,133,122,2,0,46,131,82,3,128,214,
+0,0,109,133,160,6,128,145,1,144,38,1,134,219,0,129,151,0,165,159,12,128,23,2,
+128,84,3,134,182,6,130,12,0,128,191,1,128,179,0,155,123,12,208,51,14,144,64,0,
+1,10,32,163,0,0,4,96,45,45,58,45,140,0,0,1,46,96,164,60,0,0,32,156,
+101,0,128,92,0,150,80,0,7,45,43,43,43,58,58,45,46,185,100,0,131,95,0,151,
+173,0,1,46,58,129,104,0,128,100,0,129,226,0,177,100,0,1,46,58,128,162,0,157,
+159,0,131,223,0,1,96,111,132,144,0,152,209,0,143,100,0,3,96,58,47,111,158,96,
+0,133,140,0,136,235,0,0,96,128,213,0,148,247,0,140,100,0,128,97,0,3,58,96,
+96,47,165,100,0,142,97,1,147,103,0,138,100,0,3,45,111,43,46,128,156,0,0,58,
+166,54,2,144,103,0,145,9,2,136,100,0,5,58,47,45,96,46,46,167,152,2,150,171,
+1,0,58,141,102,0,134,100,0,1,45,47,160,139,2,165,102,0,0,47,139,169,0,132,
+100,0,0,46,200,98,0,128,77,0,128,63,3,143,100,0,128,237,1,143,42,0,138,39,
+0,171,0,0,129,61,3,136,81,0,129,100,0,148,77,2,148,255,1,8,46,58,111,121,
+104,100,121,121,111,128,194,1,150,101,0,1,43,96,128,70,3,137,100,0,0,96,128,17,
+0,134,41,4,3,121,100,104,43,133,60,0,0,47,144,163,2,3,111,100,78,77,133,0,
+0,1,78,43,148,99,1,1,96,43,129,128,1,133,85,0,128,98,0,133,97,0,2,46,
+43,104,131,62,0,2,78,100,111,130,101,0,0,96,139,139,2,2,46,58,115,136,95,0,
+132,0,0,1,109,121,147,81,3,0,45,128,106,1,0,96,133,101,0,1,10,32,132,240,
+1,1,46,115,137,64,0,3,78,100,121,43,128,51,4,0,96,132,101,0,0,96,128,33,
+1,1,104,109,141,96,0,132,42,0,0,121,146,205,0,130,107,4,132,101,0,2,10,32,
+115,131,24,1,143,66,0,11,78,109,109,100,104,121,115,115,115,121,104,109,132,128,0,2,
+78,109,78,142,203,0,128,205,0,145,32,2,131,93,2,131,101,0,2,10,32,104,130,166,
+1,1,46,100,137,53,0,2,100,100,100,143,116,0,2,109,115,58,128,169,3,1,46,47,
+138,242,0,131,123,0,0,111,145,154,2,129,71,1,0,96,130,213,1,132,201,0,2,43,
+32,121,134,49,0,3,115,45,96,96,128,32,1,1,47,104,139,73,0,0,121,134,72,0,
+0,46,140,25,0,1,77,77,144,134,2,130,119,3,0,46,129,99,0,0,10,130,58,1,
+128,68,2,0,43,133,46,0,134,79,2,0,96,134,117,0,130,197,0,136,69,0,0,46,
+144,151,1,1,100,111,143,103,0,129,1,5,129,226,0,128,246,1,130,70,2,1,32,46,
+133,116,1,136,238,0,137,69,0,0,100,137,158,2,144,150,1,128,0,0,0,43,140,176,
+4,128,123,3,0,46,128,200,2,0,10,134,254,1,133,200,0,148,199,0,0,77,128,44,
+0,133,24,0,0,115,147,99,2,131,206,2,0,47,138,92,5,1,45,47,128,98,1,129,
+134,3,132,254,5,132,58,0,133,143,1,0,58,141,117,1,1,121,58,128,62,0,128,209,
+2,0,47,137,31,2,145,207,2,0,100,137,158,3,128,155,6,131,181,4,128,160,7,128,
+87,0,133,101,0,129,89,2,0,104,144,89,2,129,62,0,1,104,100,143,139,3,145,40,
+0,0,115,136,102,0,0,115,133,127,5,128,184,0,3,45,96,45,121,161,64,0,147,84,
+0,3,111,111,111,115,135,225,0,0,78,135,139,4,0,111,135,71,6,1,96,43,128,30,
+5,0,45,132,82,4,173,96,0,133,84,2,130,13,2,132,169,3,130,177,2,131,36,5,
+133,100,0,0,46,132,69,1,1,45,115,148,55,4,151,0,0,137,80,4,2,100,100,43,
+128,25,9,128,47,2,2,109,121,121,133,39,2,134,201,0,0,45,135,57,2,1,46,47,
+171,51,1,137,215,2,130,17,3,129,188,0,0,100,128,7,0,130,144,9,137,100,0,131,
+186,4,134,224,0,0,115,168,54,1,135,158,0,133,69,4,130,59,4,130,144,9,132,239,
+5,132,100,0,134,64,1,131,31,7,1,46,43,128,221,2,133,15,5,156,0,0,139,109,
+6,132,114,0,130,73,4,0,32,130,24,3,128,67,6,132,100,0,135,175,6,130,40,0,
+132,35,0,0,43,149,216,5,150,46,1,134,173,0,1,45,43,128,82,3,129,15,2,129,
+135,5,133,192,2,137,244,0,1,96,43,130,90,1,130,3,0,1,121,111,128,66,6,153,
+210,0,0,78,139,226,5,134,18,1,7,111,46,45,58,115,96,96,45,131,28,5,135,195,
+6,135,255,9,129,59,11,0,46,128,28,9,2,45,43,58,128,38,0,128,77,10,3,115,
+111,43,43,128,8,3,0,111,129,6,0,2,115,100,104,128,119,0,128,0,0,128,177,3,
+1,115,43,128,178,0,137,105,1,132,147,1,131,169,4,128,190,9,139,111,9,142,12,9,
+0,96,130,112,6,129,59,6,129,224,2,129,116,0,130,121,0,132,186,11,0,96,128,0,
+0,131,245,0,136,120,7,0,96,133,67,0,139,9,9,137,57,10,138,192,10,128,207,11,
+136,12,0,138,65,2,131,101,10,130,110,0,139,44,12,128,163,4,146,211,9,140,104,11,
+128,52,0,0,58,128,4,5,128,97,0,128,97,2,139,210,0,141,135,8,142,57,8,133,
+149,0,143,157,10,144,50,12,128,162,0,131,8,1,132,28,1,148,217,12,129,141,0,138,
+5,1,128,44,0,130,47,0,144,131,7,165,44,14,149,149,12,133,135,0,0,10,1,10,
+32,145,0,0,1,96,46,135,0,0,0,96,134,20,0,134,9,0,174,0,0,141,101,0,
+0,96,128,96,0,0,45,135,98,0,2,32,32,45,133,24,0,1,32,32,135,112,0,151,
+0,0,128,63,0,155,100,0,128,32,0,130,95,0,135,75,0,128,9,0,0,58,131,9,
+0,130,58,0,128,32,0,0,96,132,0,0,137,148,0,133,49,0,130,23,0,145,240,0,
+134,100,0,131,34,1,143,150,0,131,100,0,132,58,0,135,91,0,134,77,1,131,18,0,
+129,8,0,130,9,0,145,200,0,134,100,0,143,97,0,131,30,1,2,58,96,58,129,60,
+0,131,27,0,149,46,1,135,58,0,146,99,0,132,100,0,135,35,1,136,243,1,0,45,
+130,18,0,2,58,32,45,128,56,0,132,45,1,156,98,0,148,99,0,131,100,0,133,98,
+0,138,143,1,132,0,0,128,106,0,0,45,128,169,1,134,151,1,143,137,2,147,11,0,
+141,100,0,131,90,0,128,245,1,146,169,0,3,45,46,58,45,131,152,1,144,66,0,128,
+9,2,146,210,0,142,100,0,0,45,129,107,1,0,96,129,20,1,148,148,2,1,96,96,
+130,199,2,144,32,0,138,86,0,147,163,0,131,100,0,129,64,0,151,98,0,131,103,0,
+0,47,135,252,1,137,98,0,137,86,0,1,96,58,151,66,0,0,10,129,239,0,0,46,
+133,113,3,150,101,0,129,47,1,141,36,0,0,45,137,16,0,128,12,0,128,51,2,149,
+100,0,128,28,0,151,231,0,138,10,1,130,203,2,135,198,0,0,58,131,68,1,132,211,
+0,128,39,3,128,143,2,132,185,3,143,100,0,158,198,0,130,0,0,128,97,0,138,185,
+0,2,46,58,58,134,56,0,128,98,0,155,222,4,0,10,150,227,0,142,100,2,130,51,
+1,135,13,0,134,89,3,129,11,0,142,110,4,154,32,5,152,151,1,128,14,1,141,72,
+2,128,85,0,129,253,1,128,31,3,132,18,4,136,201,4,178,100,0,129,179,0,132,101,
+0,0,45,133,183,0,128,78,0,130,18,0,130,5,3,135,243,2,128,219,0,182,100,0,
+130,26,1,129,225,1,130,217,3,131,72,0,129,253,1,128,205,0,131,78,3,134,0,0,
+0,46,139,1,2,171,100,0,130,52,1,129,186,3,130,101,0,129,136,1,129,215,4,131,
+34,1,0,46,130,60,1,130,152,5,141,155,1,172,201,0,130,166,0,130,101,0,129,219,
+6,130,25,3,133,53,1,128,9,3,131,219,0,138,106,4,173,248,1,131,77,0,129,187,
+3,133,164,6,130,110,0,131,167,1,128,10,0,129,199,0,147,249,1,164,100,0,133,18,
+7,128,64,0,129,78,0,130,162,7,130,80,0,129,93,2,129,8,0,136,47,5,143,200,
+2,162,100,0,129,155,0,131,4,1,130,132,4,132,175,0,130,114,6,131,96,0,135,166,
+3,130,51,1,141,48,1,160,100,0,131,187,0,132,54,0,129,178,0,137,216,1,130,117,
+0,136,98,8,130,194,4,0,46,174,93,2,129,116,1,134,221,3,130,77,2,137,166,0,
+130,150,3,0,45,135,202,0,130,210,2,141,47,1,159,100,0,128,53,0,131,224,3,130,
+171,8,141,241,5,128,147,1,128,213,6,136,42,6,130,195,0,140,102,0,158,100,0,129,
+99,0,138,3,7,136,38,5,131,79,2,139,125,3,132,3,2,138,150,1,157,100,0,128,
+31,1,130,199,0,135,190,7,130,87,2,131,119,3,136,175,0,135,132,1,133,9,0,136,
+240,7,157,100,0,0,45,131,154,0,135,171,5,131,56,6,142,118,1,130,47,1,130,169,
+3,132,147,3,134,120,4,162,100,0,129,153,0,136,251,0,130,109,0,144,130,6,129,0,
+4,129,244,1,0,47,130,94,4,133,173,3,162,100,0,132,57,4,136,236,1,129,95,0,
+148,20,11,129,62,5,128,98,0,130,52,8,133,89,10,130,6,0,158,100,0,140,221,7,
+139,122,3,146,188,8,132,146,0,131,103,0,130,4,0,156,100,0,130,54,2,137,184,0,
+128,14,0,152,174,7,131,95,4,133,220,6,132,100,4,159,147,1,0,58,130,196,5,137,
+123,3,149,38,10,133,50,1,131,163,5,137,102,0,159,100,0,128,35,0,135,85,0,131,
+68,4,158,114,8,134,155,5,132,89,5,158,93,2,137,86,0,134,35,5,156,151,0,139,
+232,11,1,96,45,158,241,3,129,147,1,138,193,12,158,100,0,131,79,1,137,185,1,158,
+100,0,128,86,0,129,122,3,0,45,132,74,6,151,85,11,139,229,2,172,100,0,129,253,
+4,133,60,8,138,60,1,153,100,0,139,178,10,159,100,0,130,172,4,131,142,6,139,14,
+15,152,252,0,131,49,7,172,180,6,162,91,0,136,95,2,130,66,5,0,58,130,11,12,
+164,100,0,170,96,0,132,42,3,129,232,6,135,12,10,173,119,9,160,147,0,130,139,12,
+130,106,6,133,247,5,207,100,0,128,28,6,135,138,11,131,202,0,207,100,0,136,191,6,
+128,154,2,128,97,0,0,32,154,0,0,2,43,72,43,148,25,0,0,10,154,55,0,2,
+72,59,59,136,56,0,1,43,72,135,0,0,0,43,155,56,0,0,43,128,55,0,131,116,
+0,128,52,0,1,43,59,129,0,0,131,54,0,156,113,0,128,42,0,0,72,128,116,0,
+129,41,0,130,52,0,0,59,129,115,0,129,66,0,154,170,0,0,72,129,169,0,0,43,
+129,172,0,130,53,0,132,167,0,1,43,43,132,246,0,150,56,0,2,72,59,72,129,3,
+0,128,59,0,128,55,0,135,53,0,134,45,1,150,56,0,128,222,0,128,53,0,129,44,
+0,133,14,1,130,0,0,128,135,0,157,85,1,129,164,0,133,12,1,132,53,0,136,55,
+0,153,28,1,132,72,1,136,54,0,136,55,0,160,199,1,147,55,0,156,56,0,130,232,
+0,134,55,0,138,68,2,159,199,1,141,112,0,131,44,1,149,57,2,131,116,1,132,252,
+1,135,55,0,135,63,2,146,113,0,128,53,0,131,30,2,129,0,2,136,112,0,133,63,
+2,129,55,0,145,56,0,129,250,1,130,144,0,128,250,1,137,112,0,133,53,0,130,55,
+0,130,56,0,139,59,3,129,43,2,128,5,0,129,0,0,139,226,0,138,55,0,129,56,
+0,130,172,1,141,55,0,130,113,0,137,56,0,135,112,0,131,43,0,128,56,0,129,32,
+0,130,114,0,131,44,0,129,5,1,130,104,2,129,80,0,135,227,0,134,56,0,134,171,
+2,131,131,0,129,16,1,131,23,0,131,221,0,134,53,2,134,170,0,139,112,0,128,56,
+0,133,74,0,129,163,0,130,11,0,129,52,0,134,111,0,134,57,0,140,55,0,1,32,
+10,135,243,0,129,131,0,130,123,0,130,45,0,134,75,3,132,77,3,140,55,0,1,32,
+10,137,187,0,0,72,131,56,0,131,111,0,131,63,0,131,85,3,134,113,0,136,29,3,
+135,45,1,129,164,3,130,55,0,129,136,3,139,223,0,130,16,0,140,56,0,131,199,2,
+136,220,1,136,112,0,135,222,2,132,56,0,136,239,1,128,85,1,134,137,1,135,86,1,
+131,5,0,135,55,0,133,170,0,144,143,3,131,133,4,133,74,1,143,55,0,131,114,0,
+138,113,0,132,55,0,130,39,0,132,84,1,130,190,0,137,168,0,132,203,0,137,153,2,
+133,56,0,129,210,4,132,226,0,128,93,0,132,5,2,144,20,3,139,56,0,130,100,2,
+133,54,0,129,120,0,135,56,0,132,8,2,147,56,0,0,43,134,54,0,131,235,0,137,
+196,1,134,194,5,145,56,0,131,29,0,132,25,4,132,92,1,132,177,2,135,106,2,129,
+58,0,140,56,0,132,48,1,133,21,0,138,57,0,134,177,2,130,26,2,140,56,0,131,
+31,6,135,195,4,133,236,1,132,3,4,132,23,0,130,62,0,141,28,1,130,205,0,137,
+76,5,133,58,0,140,18,5,143,142,1,138,76,0,136,92,4,132,210,6,164,145,7,136,
+184,2,129,194,0,137,159,0,156,144,5,137,57,0,130,73,4,165,56,0,136,171,0,151,
+58,0,137,56,0,133,31,0,129,0,2,132,51,0,144,107,2,143,56,0,135,89,0,130,
+82,5,131,135,4,150,57,0,136,56,0,129,41,2,140,172,0,141,76,5,148,56,0,135,
+205,0,131,59,2,135,170,2,144,57,0,138,56,0,133,57,0,134,55,0,137,84,4,140,
+57,0,139,56,0,132,57,0,131,94,5,132,68,0,133,174,0,140,9,2,140,56,0,131,
+46,0,132,151,5,131,161,2,132,60,3,141,57,0,141,56,0,130,147,0,131,157,3,133,
+203,9,133,91,3,139,171,0,142,56,0,136,171,0,130,231,6,129,166,1,132,94,6,150,
+199,1,136,87,0,135,250,3,131,201,4,154,56,0,132,45,0,134,63,2,132,243,6,130,
+101,7,154,227,0,133,174,0,139,100,7,131,52,8,154,85,1,135,147,1,134,132,3,129,
+114,0,133,6,2,151,199,1,133,161,0,132,252,3,133,26,4,147,55,0,146,200,3,133,
+245,4,131,28,7,159,171,2,143,255,9,136,66,4,168,204,11,133,145,1,148,119,4,155,
+203,9,132,182,9,0,32,130,0,0,1,58,58,131,7,0,165,0,0,0,10,131,6,0,
+2,72,72,72,145,56,0,2,58,72,72,157,54,0,143,56,0,128,52,0,161,54,0,128,
+55,0,130,41,0,138,11,0,160,54,0,138,0,0,132,65,0,154,54,0,135,101,0,141,
+0,0,154,54,0,0,44,134,99,0,0,44,128,0,0,130,68,0,128,9,0,129,7,0,
+154,54,0,133,220,0,0,44,132,69,0,0,58,131,31,1,128,7,0,160,54,0,129,53,
+0,128,97,0,128,49,0,0,44,128,3,0,129,58,0,129,7,0,157,219,0,130,150,0,
+140,130,1,148,55,0,137,73,1,129,214,0,133,47,0,134,54,2,147,165,0,136,54,0,
+130,13,1,134,53,0,133,55,0,133,238,0,150,54,0,129,53,0,131,55,0,0,44,130,
+54,0,131,47,0,147,165,0,131,54,0,130,127,1,131,54,0,129,44,0,0,72,128,51,
+0,133,230,0,1,44,72,145,110,0,131,54,0,130,17,1,132,54,0,128,37,0,129,66,
+1,0,44,131,213,0,0,44,128,81,0,0,58,133,200,1,141,54,0,128,94,0,133,75,
+1,133,237,1,140,99,2,140,235,2,130,54,0,133,51,0,128,169,1,129,51,0,129,162,
+0,134,32,0,131,42,2,132,69,2,134,55,0,129,54,0,134,80,0,128,134,0,140,52,
+0,133,42,2,133,34,0,133,55,0,128,54,0,139,198,2,129,167,0,140,255,0,130,129,
+0,129,236,0,135,55,0,128,54,0,139,52,0,146,168,1,128,45,2,129,41,1,135,17,
+3,0,10,135,252,2,132,133,0,146,112,1,129,141,1,131,149,0,131,110,0,0,10,141,
+106,3,147,21,2,136,37,0,132,54,0,139,53,0,143,217,0,141,55,0,131,54,0,140,
+163,0,136,206,2,143,23,1,136,164,0,139,219,1,135,151,2,142,54,0,129,95,0,128,
+249,0,131,56,0,0,10,144,53,0,146,222,0,130,54,0,129,132,1,1,44,72,128,84,
+2,138,54,0,129,49,0,128,30,0,145,76,1,130,114,2,129,224,2,128,57,0,2,58,
+44,72,137,54,0,128,89,2,128,181,1,129,131,0,128,31,0,139,108,5,129,77,0,129,
+76,3,129,47,2,129,57,0,137,54,0,129,104,0,129,133,0,129,218,2,128,139,0,135,
+227,0,131,223,2,134,117,2,128,92,0,138,54,0,130,130,4,129,28,0,128,53,0,128,
+169,0,138,0,0,136,171,2,128,144,0,139,73,1,130,220,0,130,7,3,129,100,2,137,
+0,0,129,20,0,134,126,0,0,72,138,183,1,129,53,3,135,40,5,141,53,0,136,24,
+3,128,109,0,136,37,2,138,178,1,130,84,1,136,181,3,132,108,0,130,200,0,1,44,
+58,140,54,0,136,60,1,129,14,0,136,193,0,131,108,0,129,156,4,129,50,1,136,54,
+0,134,79,0,131,180,4,132,39,4,139,54,0,132,9,5,137,54,0,132,108,0,133,236,
+4,139,172,2,157,54,0,131,35,5,129,235,1,149,54,0,0,44,139,219,0,131,54,0,
+131,53,0,149,54,0,128,84,0,129,219,1,137,73,1,161,54,0,129,63,5,130,183,1,
+135,127,3,158,54,0,133,103,1,129,37,2,135,250,0,137,54,0,130,83,0,146,110,0,
+131,21,6,136,185,4,137,18,1,137,151,7,139,248,3,130,239,2,137,39,5,136,110,6,
+130,118,0,142,58,8,132,210,2,140,149,5,133,189,0,131,221,3,141,108,0,139,150,5,
+131,3,6,144,92,2,144,114,8,136,44,4,136,168,6,138,199,5,135,108,0,146,89,4,
+138,206,8,135,55,0,134,222,4,148,53,5,133,96,8,129,7,4,137,222,0,151,49,0,
+139,54,0,138,209,0,1,58,10,0,32,128,0,0,4,58,45,45,58,46,129,8,0,201,
+0,0,4,46,45,45,47,96,131,10,0,0,10,129,4,0,0,43,128,3,0,203,102,0,
+1,46,58,129,78,0,1,45,45,136,100,0,1,45,58,131,5,0,132,120,0,189,95,0,
+2,47,47,47,129,176,0,1,96,47,130,86,0,133,100,0,128,218,0,129,5,0,1,96,
+58,132,121,0,180,0,0,1,96,45,129,95,0,0,45,130,170,0,128,106,0,133,98,0,
+130,100,0,0,45,128,0,0,1,96,45,131,44,1,1,45,46,179,205,0,1,96,45,128,
+94,0,2,58,46,96,130,61,0,129,108,0,138,21,1,128,100,0,1,43,96,128,22,0,
+128,23,0,132,102,0,174,155,1,129,31,1,1,58,46,129,0,0,128,99,0,0,46,129,
+205,0,129,182,0,131,130,1,134,100,0,1,96,47,131,44,1,128,140,0,130,95,0,0,
+45,132,110,0,162,0,0,4,45,47,43,58,96,128,163,0,132,36,1,134,8,1,128,249,
+1,136,100,0,129,32,0,133,189,0,0,96,131,35,0,0,96,137,32,0,154,0,0,3,
+47,43,45,96,128,45,0,131,97,0,137,90,2,139,18,0,4,10,46,47,96,96,129,227,
+0,138,21,0,0,96,128,66,1,160,136,1,3,111,58,32,46,139,125,1,128,14,1,2,
+43,43,47,128,119,3,138,66,2,0,10,133,185,2,0,96,129,83,1,132,41,0,0,46,
+128,59,0,160,100,0,128,99,0,0,47,133,111,3,130,54,0,128,91,0,131,251,1,1,
+96,58,138,63,0,0,10,128,170,1,128,182,1,132,38,0,132,20,0,128,45,1,0,111,
+159,99,0,3,58,111,32,45,135,38,0,0,96,131,89,2,131,92,2,140,113,3,1,10,
+111,131,45,1,128,225,0,135,189,2,128,35,0,160,100,0,3,121,96,32,115,141,34,2,
+129,96,0,128,201,2,140,21,0,1,10,45,132,91,2,128,107,0,134,28,0,2,58,96,
+46,159,100,0,1,58,43,137,200,0,130,171,4,129,203,2,129,143,1,141,211,3,0,10,
+128,74,1,128,24,0,139,145,0,2,58,32,43,159,251,3,128,197,0,0,111,135,54,0,
+128,205,3,134,47,1,0,45,141,208,1,130,86,4,130,15,4,136,229,0,2,58,96,115,
+159,90,2,1,121,32,144,37,0,129,213,3,143,205,3,129,86,4,129,69,1,137,70,1,
+1,46,46,160,200,0,128,45,1,138,66,2,128,109,1,131,46,1,144,0,5,1,10,32,
+131,33,3,136,145,1,162,200,0,2,32,111,45,129,143,4,135,97,0,132,93,2,128,105,
+0,145,100,0,129,159,3,1,43,43,136,44,1,162,200,0,1,32,121,128,239,3,145,42,
+1,145,197,3,129,187,4,140,26,0,0,46,161,200,0,0,96,128,88,2,135,138,0,130,
+135,3,131,0,0,145,44,0,129,133,5,130,97,6,2,46,45,46,132,192,4,135,108,6,
+132,158,3,128,27,0,142,159,0,129,222,4,140,224,1,129,105,0,147,245,4,128,100,0,
+128,46,1,128,112,4,128,75,5,133,87,0,134,200,0,128,137,4,129,207,1,0,96,129,
+47,2,0,46,139,62,0,0,111,128,31,6,136,146,1,130,35,3,132,138,5,146,100,0,
+128,215,2,131,29,0,133,34,0,128,110,1,132,77,5,128,43,7,128,20,0,128,70,3,
+128,20,8,138,183,0,0,96,129,22,8,144,25,7,150,100,0,0,58,130,228,4,135,31,
+5,1,32,115,132,8,0,0,47,129,150,7,131,56,2,0,46,141,99,0,134,168,4,129,
+88,5,131,141,1,142,242,5,137,100,0,128,173,5,128,48,1,136,211,4,0,46,130,165,
+1,128,225,0,2,96,58,96,128,47,6,129,219,4,138,241,4,128,143,2,135,41,1,130,
+29,0,128,235,0,138,105,3,148,241,3,128,34,0,128,144,0,131,53,1,134,250,1,129,
+92,3,128,30,6,128,71,0,138,19,1,135,139,2,128,42,0,133,26,2,153,132,8,131,
+18,9,0,47,128,242,0,134,240,5,129,32,7,130,151,9,128,184,7,128,221,2,129,82,
+0,133,53,6,129,131,2,138,177,0,129,231,0,129,35,0,128,200,0,128,253,6,155,201,
+0,128,77,0,130,116,1,132,65,0,129,135,1,128,15,0,0,46,128,81,5,131,16,0,
+131,127,0,133,234,0,137,82,3,130,5,0,129,71,8,128,147,1,155,100,0,129,91,3,
+129,146,0,135,221,1,128,139,1,128,87,3,134,210,3,129,54,2,129,103,5,136,182,2,
+133,158,1,130,103,0,134,144,10,154,100,0,128,44,3,132,186,10,133,24,1,128,82,0,
+135,89,3,128,223,3,129,144,3,132,104,8,137,170,3,128,228,2,128,197,3,128,159,0,
+161,100,0,132,150,2,128,193,0,133,102,0,1,45,96,136,56,0,128,74,0,129,229,2,
+138,141,1,130,35,0,129,74,1,129,152,1,129,59,0,131,204,2,130,182,6,136,110,5,
+138,100,0,128,184,2,1,46,58,128,200,3,129,20,1,131,24,9,138,134,8,131,81,0,
+138,69,4,130,178,9,0,96,130,140,5,130,94,2,130,221,9,129,112,2,129,110,0,137,
+53,3,135,100,0,129,142,3,128,0,3,128,90,0,130,39,7,129,211,0,134,160,1,131,
+30,0,136,195,0,130,3,0,0,47,128,81,1,129,79,4,128,3,0,130,116,2,129,81,
+6,130,49,3,131,47,5,135,102,9,136,100,0,129,227,3,0,58,128,150,0,130,61,7,
+132,86,10,132,22,0,136,172,1,129,36,1,130,52,11,131,110,4,129,55,3,129,75,0,
+129,65,8,139,35,1,128,105,0,128,93,10,144,100,0,129,112,10,128,233,8,128,80,0,
+131,107,4,133,227,0,131,157,1,129,12,1,133,189,1,128,175,3,129,40,2,129,154,3,
+130,97,0,130,202,0,130,29,7,129,204,0,130,129,9,129,119,1,131,76,2,139,100,0,
+130,176,0,0,43,129,176,5,139,184,6,130,219,0,128,121,0,128,230,0,131,57,10,129,
+200,7,134,98,0,130,143,6,134,149,1,130,122,11,130,0,0,130,122,0,129,22,3,142,
+100,0,131,240,3,0,96,129,55,1,135,17,0,130,201,0,128,22,1,129,231,2,128,56,
+7,132,120,6,130,50,8,130,83,13,130,44,1,132,192,9,131,38,4,129,213,2,130,6,
+0,0,45,128,45,0,144,100,0,131,25,1,0,58,136,176,4,132,204,2,128,18,6,130,
+9,1,132,229,12,128,215,0,128,14,1,128,65,5,128,25,4,128,103,0,129,5,0,129,
+17,0,128,29,0,131,7,6,128,14,0,129,9,7,2,58,115,96,148,100,0,129,88,0,
+134,38,3,130,180,6,133,241,1,133,233,3,128,76,0,128,184,0,130,196,0,133,103,0,
+134,227,10,132,207,1,129,245,1,129,58,4,0,47,150,100,0,129,75,4,132,186,2,133,
+96,5,133,147,6,129,92,0,128,34,2,130,103,0,129,44,1,131,133,14,135,25,10,133,
+100,0,132,255,0,0,32,153,100,0,128,178,11,128,30,1,128,21,1,134,216,12,0,47,
+130,62,6,130,51,1,129,185,0,129,5,0,132,108,0,136,154,0,128,111,0,133,46,1,
+131,53,0,155,100,0,128,214,7,128,78,0,129,89,1,133,193,4,129,145,1,132,69,2,
+130,220,10,137,38,1,134,51,0,128,33,2,136,200,1,129,109,1,153,100,0,131,45,0,
+130,78,9,131,235,1,128,120,4,129,199,0,129,225,3,131,2,2,140,97,0,131,81,1,
+131,85,1,0,96,134,104,3,0,58,151,248,1,131,51,0,128,101,0,130,51,5,130,102,
+0,130,113,14,129,108,3,129,0,0,128,157,2,143,44,2,128,149,0,132,167,15,130,31,
+3,133,2,5,155,100,0,129,1,6,132,136,13,128,132,7,156,227,13,130,137,0,128,96,
+6,139,99,0,129,176,1,157,100,0,134,139,5,128,197,0,145,6,9,135,193,3,131,201,
+2,132,236,1,132,175,3,132,133,16,155,100,0,136,151,8,0,58,141,234,5,138,241,4,
+129,240,3,134,4,2,134,172,14,133,201,5,155,100,0,1,47,96,133,28,7,128,83,2,
+146,99,0,130,96,0,138,102,2,135,98,0,134,181,1,150,86,4,129,126,6,135,44,1,
+129,45,1,143,34,0,130,5,7,129,226,2,134,97,0,128,222,3,142,98,0,148,100,0,
+130,65,5,130,218,6,133,119,12,0,45,137,240,8,131,94,0,134,95,0,134,37,9,129,
+211,16,131,138,0,137,237,12,148,100,0,128,53,4,128,2,0,129,119,3,130,0,0,128,
+3,5,128,191,1,130,190,9,133,94,0,129,174,6,131,203,7,132,182,0,129,23,0,128,
+97,6,134,184,10,140,98,15,146,200,0,128,134,3,128,42,1,130,49,12,133,83,12,128,
+160,2,130,218,14,130,82,4,133,93,0,130,207,7,129,118,0,132,180,6,137,57,1,156,
+100,0,132,112,5,131,234,2,129,25,6,128,205,0,128,176,10,129,167,4,131,115,16,131,
+197,7,129,91,0,130,44,1,130,61,8,133,18,11,155,18,9,150,90,4,129,75,0,131,
+117,5,130,9,3,130,90,0,133,4,7,128,28,0,130,140,14,151,209,11,162,100,0,1,
+47,111,130,2,3,129,85,0,131,22,1,130,228,14,132,88,0,164,131,19,156,100,0,128,
+47,8,130,107,18,130,56,19,132,65,15,175,220,19,155,100,0,128,179,8,129,102,0,2,
+46,43,111,129,95,18,182,110,21,153,100,0,129,229,4,1,45,43,128,102,0,0,115,137,
+132,9,204,100,0,128,229,4,128,13,13,0,45,161,213,15,182,100,0,128,91,3,128,99,
+0,0,43,161,94,19,183,100,0,0,111,129,49,12,132,104,10,214,100,0,0,43,128,142,
+3,154,67,6,193,100,0,0,47,128,122,6,191,143,1,157,248,1,0,47,129,24,3,221,
+100,0,128,254,19,0,45,128,49,21,220,100,0,129,174,8,1,43,111,129,134,3,144,191,
+5,199,100,0,132,32,21,130,172,4,144,102,9,198,100,0,141,239,14,1,32,10,1,10,
+32,220,0,0,4,46,45,58,111,58,149,101,0,1,47,45,189,94,0,1,96,45,130,0,
+0,0,58,128,72,0,6,10,47,111,58,45,45,96,143,129,0,0,58,129,29,0,165,79,
+0,1,47,47,144,95,0,128,8,0,2,45,58,46,129,15,0,128,201,0,3,45,58,96,
+46,129,20,0,130,15,0,134,0,0,128,121,0,1,58,58,134,13,0,131,44,0,147,0,
+0,5,45,58,47,111,45,111,132,167,0,136,73,0,128,63,0,132,20,0,130,46,1,131,
+112,0,132,127,0,2,96,111,47,129,7,0,0,96,128,201,0,129,3,0,132,100,0,130,
+152,0,129,36,0,0,43,139,245,0,129,14,1,4,45,47,96,47,96,132,62,0,134,29,
+0,135,59,0,132,100,0,129,29,1,133,68,0,128,40,0,0,43,129,72,0,2,46,45,
+43,128,121,0,0,96,132,155,1,0,47,128,217,0,131,108,0,137,24,1,131,171,0,3,
+58,45,96,111,132,30,1,136,123,0,134,150,0,135,100,0,136,102,0,135,244,0,128,158,
+0,129,23,0,0,46,128,73,0,128,90,0,128,237,0,3,45,58,32,46,135,55,1,132,
+112,1,1,45,47,140,104,1,131,18,0,132,29,0,139,100,0,130,151,0,141,190,1,130,
+112,0,4,43,121,58,58,43,129,205,0,129,182,0,128,109,0,4,96,46,46,47,46,138,
+147,0,139,54,0,129,222,0,128,154,0,136,18,0,133,100,0,2,47,43,43,129,111,2,
+133,170,1,137,0,0,134,73,1,130,65,0,0,46,128,163,0,128,44,0,128,7,0,147,
+23,3,129,45,0,139,98,0,138,201,0,130,22,2,145,102,0,128,37,1,138,170,0,1,
+46,96,129,185,1,147,104,2,128,93,0,141,98,0,138,100,0,132,246,1,0,58,143,174,
+2,2,96,47,46,129,47,1,3,32,58,121,121,130,166,1,147,97,0,131,160,0,143,98,
+0,141,100,0,131,244,1,1,43,111,140,39,0,128,225,0,6,100,111,45,47,43,100,104,
+128,69,0,145,186,3,130,136,0,129,239,0,145,98,0,131,100,0,0,46,128,99,1,130,
+27,3,134,0,0,138,31,1,0,96,128,173,1,0,47,128,31,0,1,111,111,132,77,0,
+147,140,1,130,145,2,128,184,2,131,0,0,1,47,43,136,237,0,133,201,0,130,34,0,
+147,163,0,131,54,4,2,96,47,43,128,192,2,128,111,0,1,46,96,145,29,2,139,253,
+2,140,73,0,139,46,1,131,33,0,143,56,0,128,52,4,128,153,0,128,207,4,129,58,
+3,148,146,1,129,59,0,3,58,47,47,58,130,54,1,157,147,1,132,31,4,137,91,1,
+1,47,96,133,64,1,131,161,0,139,201,0,135,187,0,130,9,0,144,230,0,150,80,6,
+136,138,4,1,47,96,130,140,3,136,70,2,143,99,1,149,95,0,155,100,0,131,0,0,
+129,197,4,0,58,128,198,0,135,68,1,129,63,2,134,250,1,130,167,3,153,205,1,158,
+100,0,128,31,4,130,130,1,2,43,45,96,128,44,2,128,5,0,132,177,3,1,96,45,
+134,215,0,1,96,46,128,118,2,154,95,0,158,100,0,0,111,128,200,1,0,96,128,106,
+0,131,222,6,131,11,4,0,46,130,234,5,130,193,0,128,80,1,128,210,0,128,141,6,
+183,100,0,128,235,1,129,59,6,130,151,3,131,43,1,0,47,129,10,0,132,59,2,129,
+86,3,128,14,2,131,7,4,143,78,2,161,100,0,128,23,3,128,16,3,2,58,43,46,
+129,30,3,129,172,3,130,173,0,130,97,2,0,46,130,118,2,129,176,5,128,121,0,129,
+43,1,128,47,5,0,45,128,65,3,178,201,0,131,81,6,0,46,129,180,5,129,146,1,
+130,3,3,132,85,7,129,0,4,1,96,46,128,112,2,1,58,46,128,25,0,128,101,6,
+0,43,128,134,0,177,248,1,129,73,0,133,50,2,133,117,1,133,150,4,128,117,0,130,
+255,1,128,73,4,128,101,0,128,138,0,130,70,4,153,204,0,147,100,0,130,61,7,133,
+99,3,132,75,2,136,122,1,128,86,0,132,197,2,130,34,0,0,43,128,91,6,0,96,
+153,100,2,158,221,9,0,58,131,21,3,140,221,1,130,55,6,133,135,0,0,43,142,127,
+7,173,100,0,129,124,1,142,64,2,128,85,0,128,204,0,166,152,9,159,167,10,128,72,
+8,129,152,9,139,40,6,1,111,58,128,222,2,128,139,7,197,100,0,128,160,2,128,153,
+1,136,69,6,130,124,1,0,111,128,219,6,128,125,2,160,137,3,161,100,0,132,61,6,
+129,253,1,128,82,6,131,95,0,130,232,6,128,50,9,128,149,1,133,57,10,188,201,0,
+132,69,2,130,131,11,129,155,1,129,175,2,130,117,0,149,234,7,182,100,0,129,111,3,
+129,140,10,128,202,0,0,47,128,225,3,129,149,10,147,133,7,184,100,0,128,37,8,129,
+45,9,129,5,2,0,96,128,132,7,0,58,129,33,5,206,100,0,135,89,8,133,36,12,
+128,199,6,162,243,1,169,46,1,135,137,7,134,110,0,134,99,0,0,10,0,32,221,0,
+0,3,96,32,32,10,221,98,0,2,96,46,46,134,100,0,128,111,0,208,97,0,3,46,
+45,32,32,128,2,0,130,100,0,1,46,46,128,112,0,160,147,0,168,137,0,129,45,0,
+128,85,0,128,91,0,128,12,0,0,10,128,14,0,0,58,128,11,0,157,100,0,129,133,
+0,151,34,0,141,61,0,129,180,0,129,97,0,132,25,0,4,10,32,58,45,58,130,12,
+0,131,20,0,145,94,0,128,51,0,128,196,0,138,200,0,139,43,0,129,181,0,141,99,
+0,133,10,0,129,4,0,0,10,129,58,0,128,54,1,129,25,0,149,193,0,132,147,0,
+136,31,0,129,95,1,128,6,0,0,45,131,18,0,129,81,0,136,100,0,0,96,135,88,
+1,0,45,131,22,0,0,10,129,45,0,130,100,0,142,114,1,129,194,0,137,71,0,132,
+163,0,129,0,0,128,42,0,128,61,1,0,58,128,107,0,130,113,0,134,110,0,129,96,
+0,1,96,96,132,90,0,128,21,0,130,88,0,131,147,1,131,100,0,133,219,0,134,0,
+0,1,58,58,128,69,0,130,18,0,134,253,0,0,96,133,41,0,129,152,0,129,27,0,
+133,7,1,1,96,45,132,123,0,128,21,0,136,112,0,132,43,0,128,93,2,129,15,1,
+133,175,0,133,23,0,129,7,0,1,96,46,129,172,1,130,54,0,135,108,1,136,60,2,
+130,48,1,131,95,0,128,140,0,141,65,0,137,178,0,129,100,0,132,104,2,137,170,0,
+128,195,0,130,169,0,135,18,0,131,77,1,134,209,0,129,88,0,130,12,2,135,175,0,
+138,182,1,138,124,1,129,39,3,129,157,2,132,19,0,131,88,0,129,152,0,131,48,2,
+129,97,1,134,87,0,129,137,1,131,3,2,129,11,0,132,131,0,131,54,0,129,45,1,
+137,16,0,133,50,1,135,100,0,130,144,0,133,239,0,128,46,0,130,33,0,131,134,1,
+0,43,131,42,1,130,84,0,130,6,0,132,221,0,135,191,0,131,139,1,128,14,0,138,
+86,0,0,58,138,222,1,132,86,4,128,60,0,134,175,1,135,130,1,134,242,1,128,27,
+0,130,120,0,135,187,1,132,7,0,146,247,2,142,22,0,133,187,4,128,140,0,0,45,
+131,26,0,133,30,1,132,172,2,142,209,3,134,197,0,128,141,0,142,98,0,130,50,0,
+142,25,4,134,133,5,129,39,2,0,46,128,225,2,132,106,0,129,54,1,133,79,0,0,
+46,128,127,0,130,130,2,134,59,2,129,26,0,144,196,0,132,152,0,142,23,0,134,100,
+0,132,31,0,128,103,0,130,242,2,129,207,4,134,154,0,1,58,58,129,1,1,132,62,
+0,130,171,0,145,132,4,0,46,134,52,0,150,100,0,132,76,1,128,61,0,0,58,129,
+251,1,0,47,130,98,3,131,1,2,129,201,0,136,32,3,147,72,0,128,236,0,149,253,
+4,142,180,6,130,178,0,128,107,0,129,8,3,129,3,0,137,130,4,131,219,2,146,224,
+4,132,146,2,166,100,0,129,99,0,128,150,0,129,151,0,130,162,4,132,231,3,131,210,
+1,141,73,0,129,173,1,140,145,3,159,100,0,128,48,0,0,45,129,242,1,132,55,4,
+135,41,2,128,21,0,135,97,0,136,245,1,128,134,1,159,202,6,139,100,0,128,192,0,
+136,74,0,130,1,5,137,51,6,129,178,0,131,135,5,135,117,3,161,45,7,140,248,1,
+140,50,0,140,31,1,143,217,6,130,240,6,172,201,0,143,51,2,143,38,7,138,61,4,
+135,118,2,184,100,0,143,175,2,138,17,0,128,138,6,141,134,0,194,100,0,138,166,7,
+132,212,6,188,100,0,134,122,3,143,224,7,145,77,1,180,201,0,133,78,0,137,177,0,
+0,45,133,92,0,162,198,0,169,201,0,137,145,6,133,9,5,165,236,9,157,11,11,129,
+45,4,131,57,5,135,101,0,164,36,1,167,100,0,130,174,4,132,130,3,130,139,1,171,
+173,10,164,100,0,129,204,8,135,196,0,129,5,4,159,54,11,173,100,0,129,77,4,139,
+30,1,134,78,8,198,100,0,130,176,4,143,12,2,172,149,1,151,100,0,131,193,6,145,
+129,1,133,29,11,190,100,0,1,46,45,132,41,6,136,63,10,136,70,5,135,238,7,185,
+100,0,129,88,6,132,181,2,139,231,1,128,111,6,129,6,11,129,11,8,166,0,2,152,
+147,1,150,222,1,129,122,5,168,98,0,179,152,14,132,192,10,168,100,0,0,32,154,0,
+0,3,72,32,32,10,140,18,0,0,43,140,32,0,0,43,129,33,0,1,43,72,128,0,
+0,132,25,0,0,43,129,53,0,135,46,0,0,59,128,14,0,9,10,32,72,43,43,43,
+59,59,59,43,130,26,0,129,52,0,136,66,0,130,33,0,128,65,0,131,34,0,0,59,
+129,34,0,128,3,0,129,34,0,130,86,0,0,72,128,21,0,130,33,0,129,23,0,134,
+34,0,130,53,0,129,26,0,130,0,0,129,16,0,132,169,0,131,33,0,128,105,0,129,
+54,0,132,12,0,128,13,0,128,34,0,130,169,0,136,68,0,129,2,0,128,71,0,134,
+64,0,3,59,43,32,43,132,237,0,131,33,0,129,4,0,128,100,0,130,62,0,128,12,
+0,128,203,0,128,13,0,132,33,0,132,122,0,129,100,0,130,57,0,128,28,0,129,38,
+0,128,66,0,140,33,0,128,58,0,129,33,0,0,72,130,72,0,131,80,0,133,101,0,
+133,123,0,128,32,0,130,33,0,0,72,132,33,0,128,43,0,140,33,0,131,78,0,129,
+35,1,129,101,0,0,72,128,220,0,133,33,0,133,224,0,132,179,0,128,4,0,133,99,
+1,133,15,1,132,34,1,129,23,0,130,146,0,131,31,0,130,168,1,132,15,1,133,33,
+0,129,4,1,129,96,0,130,212,0,131,68,0,141,67,0,131,46,0,129,15,1,131,35,
+0,132,67,0,134,32,0,130,34,0,129,170,0,132,17,0,129,198,1,130,33,0,134,100,
+0,135,102,0,131,32,1,129,82,0,140,33,0,129,161,0,129,28,0,130,105,0,131,86,
+2,147,33,0,128,26,0,132,29,1,143,33,0,131,238,0,132,235,0,146,67,0,132,78,
+1,134,233,2,144,33,0,130,248,1,137,248,2,141,203,0,130,9,1,134,239,2,135,203,
+0,135,16,1,130,44,0,134,239,2,129,42,0,131,49,1,133,33,1,135,225,1,140,33,
+0,133,167,2,136,122,1,141,33,0,128,68,0,135,34,0,136,83,3,134,135,0,130,68,
+0,134,36,0,135,100,0,135,203,0,133,33,0,130,0,0,129,171,0,136,100,0,134,251,
+3,134,34,0,132,249,0,135,7,4,134,29,4,132,34,0,134,26,1,132,65,0,137,63,
+4,129,34,0,136,24,1,134,38,4,136,97,4,128,146,1,136,19,1,134,209,0,139,131,
+4,133,100,0,135,31,0,144,165,4,130,56,4,0,10,0,32,150,0,0,1,72,58,139,
+15,0,0,10,151,41,0,128,1,0,138,56,0,150,42,0,128,82,0,137,42,0,128,56,
+0,150,42,0,128,39,0,136,128,0,128,13,0,141,42,0,135,159,0,129,8,0,135,43,
+0,129,56,0,138,42,0,136,200,0,0,58,130,72,0,128,7,0,1,72,72,128,21,0,
+128,23,0,0,58,138,214,0,0,58,140,113,0,134,59,0,0,58,129,181,0,137,85,0,
+130,16,0,136,42,0,133,129,0,132,138,0,137,171,0,0,72,137,42,0,128,55,0,130,
+131,0,129,37,0,130,12,1,0,72,136,128,0,0,58,140,85,0,133,2,1,131,95,1,
+128,71,0,135,42,0,139,114,1,129,82,0,131,187,0,0,58,129,176,0,129,4,0,136,
+42,0,138,85,0,129,57,0,128,17,0,132,232,0,130,139,0,136,42,0,138,171,0,131,
+38,1,129,176,0,134,113,0,134,42,0,129,109,0,140,31,2,129,42,0,131,62,0,129,
+91,1,135,42,0,0,72,128,43,0,139,86,0,129,146,0,130,35,0,132,241,0,136,42,
+0,141,129,0,129,38,1,131,42,0,131,115,0,135,128,0,129,20,0,139,43,0,128,126,
+0,134,192,1,139,214,0,0,58,139,89,1,131,248,0,133,43,0,138,42,0,128,108,0,
+139,219,1,132,5,2,130,44,0,138,128,0,132,4,2,138,44,0,129,36,0,129,43,0,
+140,214,0,134,36,2,134,119,1,133,129,0,132,6,1,141,91,3,132,80,2,133,90,0,
+132,216,0,131,14,0,141,48,3,132,199,0,132,43,0,129,145,0,129,0,0,147,177,3,
+132,24,0,135,175,2,134,144,0,142,42,0,133,242,0,134,216,0,134,240,1,149,42,0,
+134,39,2,135,229,3,132,42,0,135,246,0,133,153,0,132,39,2,141,85,0,131,19,2,
+132,41,1,135,158,1,135,13,4,134,44,1,133,26,1,137,81,1,139,42,0,130,12,0,
+128,42,0,140,248,1,138,190,3,139,85,0,133,122,2,139,215,2,132,96,0,133,139,3,
+129,4,0,0,10,134,154,1,133,250,0,138,61,4,133,211,0,130,3,2,130,230,3,133,
+251,0,135,33,0,134,127,0,136,42,0,133,105,3,132,254,0,132,11,1,135,148,0,135,
+58,1,128,42,0,136,165,0,130,44,0,131,174,4,138,84,0,144,42,0,139,55,3,132,
+135,4,136,171,0,140,252,0,133,93,1,131,6,0,136,144,1,128,1,1,142,40,1,132,
+84,5,137,66,1,131,42,0,136,102,0,146,17,6,136,42,0,153,43,0,138,238,5,134,
+3,2,137,178,5,142,41,0,133,3,2,134,242,2,139,44,0,138,188,1,135,175,2,134,
+110,4,132,214,2,135,183,1,136,101,2,133,5,3,137,218,2,141,138,0,132,102,1,137,
+136,4,151,236,6,142,91,3,138,218,2,143,119,6,140,134,3,134,37,5,144,60,0,144,
+99,7,130,217,5,130,0,0,1,58,10,0,32,177,0,0,2,96,45,96,169,46,0,0,
+10,145,20,0,0,45,157,67,0,148,32,0,149,53,0,148,100,0,138,14,0,2,46,45,
+46,139,67,0,0,46,140,32,0,135,100,0,147,102,0,146,100,0,0,58,137,168,0,3,
+96,46,46,96,128,102,0,128,0,0,1,45,45,130,6,0,1,46,58,158,233,0,163,201,
+0,1,45,96,128,91,0,128,93,0,129,5,0,128,81,0,128,131,1,128,19,0,0,58,
+131,99,0,128,27,0,172,194,1,146,100,0,128,185,0,131,0,0,128,210,0,128,97,0,
+129,5,1,128,102,0,128,0,0,154,193,0,128,31,0,169,100,0,130,48,0,128,0,0,
+142,180,0,172,85,2,156,100,0,131,103,0,135,99,0,3,96,45,58,58,130,11,0,131,
+5,0,149,50,0,177,201,0,1,45,47,132,54,0,128,9,0,2,121,104,58,130,9,0,
+130,5,0,136,36,0,161,102,0,150,201,0,130,100,0,1,111,43,133,10,2,3,47,104,
+100,121,130,65,0,136,48,1,132,29,2,129,31,2,177,248,1,132,0,0,128,172,2,133,
+202,0,1,96,47,132,44,3,0,32,135,202,0,128,31,0,132,101,0,128,103,0,171,100,
+0,131,4,1,128,52,0,136,146,1,138,68,3,136,234,2,131,65,1,133,232,2,177,201,
+0,141,54,0,128,75,0,140,201,0,1,45,47,133,132,1,155,102,0,152,93,2,141,52,
+0,132,231,3,0,46,132,54,1,128,32,0,1,46,45,128,4,0,135,24,4,150,101,0,
+150,93,2,129,161,4,130,136,3,128,8,0,130,60,0,0,96,133,189,2,131,156,1,128,
+233,0,130,193,4,134,115,0,129,209,4,134,11,0,161,100,0,129,91,0,128,26,3,128,
+178,4,134,3,2,0,46,131,128,1,131,77,0,130,15,0,132,236,1,135,191,0,128,34,
+0,173,194,2,130,49,0,128,156,0,130,29,5,128,2,0,128,29,1,134,27,0,1,58,
+58,136,78,2,135,145,5,136,136,0,151,100,0,129,56,0,131,221,1,129,57,2,129,13,
+0,130,64,0,0,58,130,115,3,128,197,2,136,253,5,136,24,1,137,111,0,147,48,1,
+137,100,0,0,96,129,31,1,128,62,4,130,107,0,0,47,130,59,0,131,100,0,131,112,
+3,128,34,1,147,22,2,136,92,6,147,202,0,138,100,0,0,47,128,109,1,129,139,2,
+128,81,0,132,94,1,129,51,0,135,91,0,138,65,0,136,241,1,135,124,0,158,100,0,
+132,124,3,131,230,1,0,47,129,35,1,131,172,6,128,192,4,131,94,2,131,33,7,134,
+183,0,135,204,0,135,202,0,158,100,0,133,104,5,135,94,3,132,23,3,0,96,134,117,
+1,129,77,0,137,39,1,132,93,0,130,199,1,130,77,1,159,46,1,146,185,7,133,109,
+3,130,165,4,130,96,0,136,101,0,136,153,1,129,84,3,0,58,128,118,2,158,93,2,
+145,179,3,130,245,1,135,32,0,142,90,2,0,47,130,31,5,131,174,1,2,96,58,111,
+146,40,3,140,39,3,142,34,8,129,86,0,133,105,5,129,43,3,143,140,0,129,168,1,
+128,151,2,130,11,0,0,43,137,200,0,133,12,3,144,140,3,130,149,8,135,86,0,129,
+200,0,137,215,0,133,90,4,136,101,0,131,222,0,140,179,6,138,34,4,151,32,5,141,
+104,3,139,72,2,137,117,3,134,36,5,137,169,0,137,67,7,155,100,0,129,241,0,130,
+102,2,131,139,3,129,217,0,144,191,0,138,215,0,131,97,0,139,167,7,155,100,0,129,
+44,1,139,203,0,135,60,1,136,203,4,0,47,134,80,0,129,137,0,132,61,4,162,79,
+6,142,161,0,131,68,0,136,192,4,130,138,5,128,181,1,129,40,4,137,89,3,140,231,
+0,155,100,0,138,141,0,131,40,3,129,229,9,138,69,4,3,58,58,45,58,131,197,2,
+137,242,0,140,39,5,152,100,0,128,167,0,134,141,7,136,67,0,138,39,11,0,96,128,
+79,0,142,9,8,142,83,7,151,100,0,128,173,2,130,136,3,140,241,8,142,66,1,141,
+227,3,128,63,1,166,180,6,129,42,0,143,147,1,133,69,12,137,117,0,137,204,2,147,
+233,7,151,100,0,141,0,3,131,51,1,144,155,4,136,150,5,129,41,6,168,126,7,131,
+44,0,132,93,1,130,148,1,131,52,1,144,100,0,131,18,0,129,157,11,128,41,1,161,
+187,4,141,122,1,128,156,0,131,21,7,148,55,2,131,173,2,129,107,10,1,96,32,128,
+100,2,148,19,9,149,100,0,135,79,9,135,99,1,147,42,10,0,47,128,96,0,131,35,
+2,175,58,12,136,91,0,133,114,13,131,208,0,129,23,1,139,32,2,129,118,4,154,12,
+11,151,194,2,136,24,1,129,120,7,136,199,2,135,135,11,129,79,6,128,15,8,155,110,
+11,155,140,3,138,118,3,129,56,2,132,230,9,130,252,7,134,182,4,157,97,0,158,187,
+4,134,163,0,131,128,6,133,90,8,131,93,8,131,216,7,186,206,13,131,133,1,132,246,
+7,143,212,1,128,24,2,141,19,13,173,100,0,129,102,1,137,251,6,143,73,0,134,29,
+13,154,68,14,152,100,0,128,191,0,136,218,1,146,57,2,136,30,0,160,203,0,144,100,
+0,0,46,128,185,13,128,160,7,128,64,7,131,183,2,148,61,5,131,79,6,129,236,15,
+178,201,0,0,58,128,163,2,129,101,0,152,55,2,129,0,13,2,46,43,46,128,176,14,
+129,235,3,186,93,2,154,98,8,129,19,7,128,49,11,161,249,1,182,100,0,130,190,2,
+130,124,4,0,10,1,10,32,171,0,0,4,96,47,58,43,96,148,26,0,0,96,148,24,
+0,1,32,32,172,101,0,3,58,45,32,46,132,101,0,1,96,46,128,0,0,135,88,0,
+5,45,43,45,58,47,58,194,100,0,2,46,47,46,128,205,0,5,45,45,58,58,58,45,
+129,100,0,130,9,0,129,11,0,130,95,0,1,43,46,194,100,0,128,97,0,128,72,0,
+0,46,140,24,1,2,96,46,58,128,17,0,130,26,0,194,100,0,128,74,0,149,24,0,
+149,172,1,177,100,0,0,111,148,24,0,150,199,0,176,100,0,128,250,1,222,100,0,1,
+96,43,151,19,2,198,100,0,0,46,148,165,2,153,126,0,180,201,0,0,96,138,95,2,
+131,11,0,0,46,199,100,0,128,147,1,6,96,45,58,96,96,46,45,132,102,0,128,147,
+3,4,96,32,96,45,46,151,192,2,177,93,2,5,43,96,96,111,47,111,130,89,0,130,
+2,0,5,96,96,58,43,45,47,153,146,1,175,100,0,129,94,2,3,47,47,78,104,128,
+184,0,1,46,58,129,92,0,5,58,104,78,104,45,45,133,108,4,171,100,0,128,20,1,
+130,48,4,142,59,0,129,202,0,128,188,0,11,115,115,58,58,46,96,58,47,121,111,111,
+47,128,194,4,153,99,0,150,100,0,1,96,43,130,94,0,1,96,46,141,143,4,129,28,
+1,132,117,5,136,245,1,0,45,150,116,2,153,100,0,0,47,133,115,3,0,46,140,225,
+3,5,43,46,96,46,47,45,138,121,0,128,244,0,143,240,0,161,100,0,0,58,133,199,
+1,1,58,43,129,252,4,135,23,0,128,178,0,128,129,1,128,75,1,129,250,1,0,96,
+128,147,5,0,46,128,10,0,156,198,1,150,147,1,0,58,128,174,0,128,202,5,1,47,
+58,128,184,0,0,58,128,86,0,132,25,3,129,215,0,130,219,0,0,115,128,92,0,128,
+21,0,145,181,1,168,93,2,128,0,3,128,136,6,130,65,0,2,45,43,58,128,12,0,
+128,83,0,2,96,32,43,129,166,1,128,116,0,1,45,111,128,254,1,128,10,0,149,201,
+4,157,100,0,129,242,6,132,157,0,0,58,132,197,3,128,69,2,128,181,0,1,45,47,
+128,124,7,128,254,6,129,108,0,128,141,3,129,147,3,129,121,0,139,160,1,162,100,0,
+128,32,1,129,114,1,1,47,45,128,167,0,0,58,128,12,3,132,170,0,1,46,115,128,
+204,0,128,102,0,128,22,0,129,238,3,130,164,6,130,221,0,129,129,0,157,206,0,141,
+100,0,1,46,111,132,153,2,0,111,128,100,7,128,162,0,133,62,6,134,22,0,132,7,
+0,133,68,4,128,116,0,157,192,2,136,100,0,132,108,8,128,195,3,139,195,2,132,101,
+3,0,115,132,22,0,132,100,0,134,23,0,0,96,128,242,3,0,96,151,100,6,136,100,
+0,0,96,129,109,1,128,0,0,128,5,0,1,45,115,130,177,2,1,96,58,128,157,4,
+130,70,0,128,165,2,129,129,0,0,43,128,31,3,131,155,1,132,101,0,132,141,0,1,
+46,45,130,9,0,154,240,3,129,100,0,1,96,47,134,57,0,129,87,3,2,111,115,43,
+129,78,4,128,0,0,128,6,0,128,105,0,128,221,1,131,166,1,129,0,0,128,176,4,
+0,47,132,194,0,132,19,2,131,97,0,134,86,3,148,100,0,1,46,111,131,171,0,128,
+215,1,131,85,3,128,56,4,133,47,2,131,192,4,139,9,3,0,96,131,29,0,133,100,
+0,128,27,0,129,47,1,133,78,1,147,100,0,0,96,129,99,0,0,96,132,186,0,0,
+43,131,166,0,1,96,43,153,201,1,128,69,10,129,37,0,133,250,1,129,80,6,1,96,
+47,149,94,8,131,100,0,129,10,3,132,156,0,130,118,3,131,181,0,0,47,154,254,0,
+128,188,4,128,41,3,130,241,3,128,234,0,128,11,0,0,58,133,68,1,148,100,0,129,
+200,0,136,81,1,128,201,3,131,101,0,151,76,7,131,246,1,131,51,1,132,4,0,0,
+47,128,106,1,153,100,0,0,121,140,94,10,133,228,3,155,203,0,129,199,0,136,11,9,
+128,205,0,153,46,0,142,100,0,134,93,0,0,111,156,199,3,135,29,2,128,198,4,1,
+43,96,153,47,1,1,10,115,129,237,0,138,235,0,0,43,132,1,3,154,203,1,136,182,
+3,129,167,8,128,219,6,152,101,0,0,10,129,71,5,140,79,0,0,47,131,253,1,0,
+115,155,248,4,136,75,4,0,45,129,80,12,152,229,7,1,10,45,129,131,1,140,177,5,
+1,45,111,129,64,0,129,227,0,149,93,2,128,83,2,128,199,2,134,125,9,130,211,11,
+0,58,134,114,4,143,140,3,129,26,0,130,44,3,139,11,1,128,6,4,149,242,1,135,
+25,0,134,3,13,131,24,4,130,155,0,148,241,3,136,93,5,160,57,12,141,123,1,128,
+24,9,130,113,4,4,58,47,43,43,115,147,248,2,128,187,4,130,37,3,128,157,8,161,
+99,0,133,172,3,147,156,1,128,210,6,146,70,0,129,133,5,131,180,2,150,113,14,138,
+248,7,145,35,0,135,190,0,1,96,111,128,154,4,143,34,0,130,234,5,131,24,0,143,
+9,1,150,194,8,139,0,0,136,155,2,2,96,115,96,133,51,4,142,180,6,132,5,1,
+0,46,150,237,1,132,37,0,147,107,2,137,0,3,128,65,2,143,38,0,132,25,7,133,
+146,1,131,59,6,148,183,10,148,206,5,138,134,1,129,166,2,142,105,15,133,126,7,135,
+43,1,129,38,8,130,249,5,129,66,15,128,147,8,130,0,0,129,61,2,148,156,3,138,
+200,0,0,96,129,136,0,130,4,0,147,72,8,128,78,9,135,76,1,130,147,8,130,0,
+0,129,9,0,130,14,3,148,144,1,139,98,3,131,67,2,141,198,3,137,173,8,129,46,
+10,152,245,14,147,27,0,138,44,1,132,235,8,153,100,0,130,47,4,149,102,0,135,15,
+5,140,252,11,144,213,0,155,100,0,129,191,3,135,85,8,147,217,5,153,99,0,132,13,
+0,151,147,1,135,69,2,0,47,129,177,11,142,12,3,144,122,0,139,10,11,0,45,133,
+135,0,142,79,16,146,112,11,131,200,2,139,85,0,143,100,0,139,188,3,136,105,1,142,
+234,9,150,105,13,131,200,2,135,107,18,141,172,1,128,140,5,136,64,1,128,198,3,134,
+13,0,143,162,14,154,152,14,130,186,11,130,107,0,141,146,4,130,139,11,138,96,1,135,
+25,0,143,59,2,160,253,14,129,221,11,138,117,2,128,22,13,135,98,0,128,255,9,135,
+42,2,130,246,11,178,98,15,139,56,0,128,182,0,128,18,13,132,172,3,128,96,0,128,
+82,12,134,246,0,140,75,14,168,100,0,136,43,2,128,10,1,129,119,7,132,106,4,131,
+227,13,133,29,0,132,46,15,181,44,16,133,87,2,147,228,14,133,127,9,152,90,17,168,
+100,0,129,126,20,146,165,3,131,30,0,149,127,20,170,46,1,133,130,13,149,10,4,153,
+214,10,159,100,0,132,15,1,141,207,8,141,56,5,154,65,10,159,200,0,130,61,0,133,
+34,11,150,189,4,153,137,8,158,100,0,132,70,6,0,121,146,168,0,1,46,47,128,191,
+14,133,23,2,138,2,4,170,100,0,133,13,1,0,104,145,253,7,129,18,5,128,149,7,
+134,225,9,128,163,3,146,139,0,156,100,0,134,247,6,0,121,145,180,6,131,18,0,136,
+173,1,128,205,0,145,144,6,156,100,0,134,19,8,0,115,131,90,14,140,201,0,129,34,
+15,128,251,7,137,87,0,128,131,4,135,41,6,132,185,7,155,100,0,135,215,7,0,58,
+146,174,12,128,32,1,128,147,1,129,9,24,135,129,0,129,224,14,128,22,0,130,184,10,
+130,182,15,0,96,155,100,0,136,59,8,128,55,1,130,129,14,150,201,21,135,140,3,129,
+209,4,130,25,11,131,18,2,128,160,8,153,100,0,129,165,9,128,101,1,132,17,15,128,
+173,0,128,187,4,150,253,9,128,49,15,141,129,0,128,100,18,131,38,9,152,100,0,0,
+45,132,251,4,139,17,10,151,75,14,129,214,16,129,158,5,136,76,1,128,26,11,128,145,
+6,0,46,152,100,0,132,244,1,130,42,0,131,0,0,130,49,11,153,22,16,132,29,21,
+130,172,5,136,78,5,153,46,1,132,184,1,135,242,12,129,208,1,129,14,0,0,10,0,
+32,140,0,0,1,47,72,141,17,0,128,0,0,0,10,141,36,0,2,32,61,47,135,48,
+0,133,10,0,135,37,0,1,47,72,128,0,0,128,36,0,0,61,133,76,0,129,7,0,
+132,11,0,0,10,131,49,0,134,54,0,0,72,134,37,0,1,47,61,133,42,0,128,37,
+0,129,29,0,1,72,72,130,17,0,131,0,0,133,37,0,128,47,0,131,130,0,129,37,
+0,129,12,0,131,15,0,133,121,0,132,85,0,0,47,131,21,0,130,51,0,0,10,132,
+12,0,137,36,0,135,124,0,134,75,0,128,12,0,131,206,0,132,45,0,0,72,128,1,
+0,142,38,0,128,227,0,129,38,0,1,72,61,128,38,0,134,254,0,134,229,0,129,38,
+0,129,12,0,129,9,1,128,38,0,128,65,0,132,229,0,128,46,1,135,49,1,128,38,
+0,128,62,0,137,37,0,133,103,0,130,10,1,135,77,0,129,101,0,130,37,0,128,146,
+0,128,82,1,132,113,0,130,33,0,0,72,134,78,0,129,65,0,1,72,47,130,123,1,
+129,88,0,128,0,0,134,164,1,128,36,0,136,90,1,128,15,0,131,161,1,0,47,128,
+39,0,136,228,0,128,9,0,134,230,0,129,9,0,132,37,0,130,127,1,130,200,1,129,
+225,0,128,47,0,133,151,0,128,75,0,0,72,128,141,1,135,237,1,2,72,47,47,130,
+160,0,128,6,0,133,239,0,132,203,1,0,47,131,151,0,132,116,1,128,36,0,130,199,
+0,129,177,0,131,38,0,131,223,1,131,227,0,132,74,0,131,193,0,129,250,0,129,127,
+0,133,37,0,130,87,1,133,37,0,130,190,0,134,162,1,133,10,1,128,147,0,128,214,
+1,134,75,0,131,165,1,132,8,1,129,111,2,131,87,1,128,106,1,130,9,0,131,37,
+0,131,241,1,136,176,0,132,125,1,130,37,0,132,161,1,132,36,0,133,112,0,140,37,
+0,132,19,2,131,250,1,128,88,1,145,37,0,131,238,0,131,199,1,128,51,0,129,237,
+1,129,39,0,128,29,0,129,199,0,130,189,0,129,56,0,128,61,1,132,113,0,131,158,
+2,129,230,0,130,224,0,129,101,0,0,47,132,11,0,128,74,0,134,189,0,135,115,2,
+129,19,0,129,37,0,130,50,0,130,91,0,129,62,1,139,37,0,131,154,2,129,133,1,
+132,99,1,129,174,0,138,37,0,131,124,1,129,234,0,128,34,0,133,172,1,130,122,0,
+136,37,0,131,236,1,0,61,129,5,0,130,33,2,132,241,1,131,156,0,134,161,1,129,
+9,2,130,36,0,129,141,0,136,43,4,133,67,3,133,73,0,131,42,4,129,144,2,133,
+131,2,133,74,0,136,37,0,133,248,3,129,119,0,131,11,0,135,116,3,133,113,0,128,
+75,0,133,81,4,130,175,0,132,46,3,134,115,4,136,38,0,129,155,0,131,0,0,132,
+227,0,146,191,4,131,173,2,131,0,0,135,34,0,142,11,5,134,75,0,128,130,3
+};
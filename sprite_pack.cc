@@ -0,0 +1,62 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "sprite_pack.h"
+using namespace std;
+
+//Packs a sprite text file (see sprites.txt) into a sprite pack.
+//	sprite_pack sprites.txt sprite_data.h	writes the pack as the array built into the game
+//	sprite_pack custom.txt custom.pack	writes a pack for POKEMON_SPRITES to load at run time
+
+int main(int argc, char **argv) {
+	if (argc != 3) {
+		cerr << "Usage: " << argv[0] << " SPRITES.txt OUTPUT(.h|.pack)\n";
+		return 1;
+	}
+	ifstream ins(argv[1]);
+	if (!ins) {
+		cerr << "Couldn't load " << argv[1] << endl;
+		return 1;
+	}
+	vector<string> sprites;
+	string line;
+	int current = 0;
+	for (int n = 1; getline(ins, line); n++) {
+		if (!line.empty() and line[0] == '@') {
+			try {
+				current = stoi(line.substr(1));
+			} catch (const exception &) {
+				current = 0;
+			}
+			if (current <= 0 or current > 1 << 16) {
+				cerr << argv[1] << " line " << n << ": bad sprite number " << line.substr(1) << endl;
+				return 1;
+			}
+			if (int(sprites.size()) < current) sprites.resize(current);
+			sprites[current - 1].clear();
+			continue;
+		}
+		if (current) sprites[current - 1] += line + "\n";
+	}
+	vector<unsigned char> pack = build_sprite_pack(sprites);
+
+	string output = argv[2];
+	ofstream outs(output, ios::binary);
+	if (output.size() > 2 and output.substr(output.size() - 2) == ".h") {
+		outs << "//Generated by sprite_pack.cc from " << argv[1] << ", edit that instead\n";
+		outs << "#pragma once\n";
+		outs << "const unsigned char SPRITE_DATA[] = {";
+		for (size_t i = 0; i < pack.size(); i++) outs << (i ? "," : "") << (i % 24 ? "" : "\n") << int(pack[i]);
+		outs << "\n};\n";
+	} else
+		outs.write(reinterpret_cast<const char *>(pack.data()), pack.size());
+	if (!outs) {
+		cerr << "Couldn't write " << output << endl;
+		return 1;
+	}
+	size_t text = 0;
+	for (const string &s : sprites) text += s.size();
+	cout << sprites.size() << " sprites, " << text << " bytes packed into " << pack.size() << endl;
+	return 0;
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+using namespace std;
+
+//Sprite packs.
+//A pack holds the text of every sprite, each compressed on its own so one can be unpacked without
+//touching the rest. All numbers are little endian:
+//	"POKESPR1", uint32 count, count entries of {uint32 offset, uint32 size}, compressed sprites
+//Entry n - 1 is for Pokedex number n. Its offset counts from the start of the compressed sprites,
+//which run up to the next entry's offset (or the end of the pack), and size is the unpacked length.
+//A size of 0 means there is no sprite for that number.
+//Compressed sprites are a list of tokens, one byte t each:
+//	t < 128		t + 1 bytes follow that are copied as they are
+//	t >= 128	two bytes d follow, copy t - 128 + MIN_MATCH bytes from d + 1 bytes back
+//A copy can overlap what it is writing, so runs of one character are a copy from 1 back.
+
+const char SPRITE_MAGIC[8] = {'P', 'O', 'K', 'E', 'S', 'P', 'R', '1'};
+const size_t SPRITE_HEADER = sizeof(SPRITE_MAGIC) + 4, SPRITE_ENTRY = 8;
+const size_t MIN_MATCH = 3, MAX_MATCH = 127 + MIN_MATCH, MAX_LITERALS = 128, MAX_DISTANCE = 1 << 16;
+
+uint32_t get_u32(const unsigned char *p) {
+	return uint32_t(p[0]) | uint32_t(p[1]) << 8 | uint32_t(p[2]) << 16 | uint32_t(p[3]) << 24;
+}
+void put_u32(vector<unsigned char> &out, uint32_t x) {
+	for (int i = 0; i < 4; i++) out.push_back(x >> (8 * i));
+}
+
+//Compresses one sprite, looking for the longest earlier match at every position
+vector<unsigned char> compress_sprite(const string &text) {
+	vector<unsigned char> out;
+	size_t literals = 0;	//Start of the literals not written yet
+	auto flush = [&](size_t end) {
+		while (literals < end) {
+			size_t n = min(end - literals, MAX_LITERALS);
+			out.push_back(n - 1);
+			out.insert(out.end(), text.begin() + literals, text.begin() + literals + n);
+			literals += n;
+		}
+	};
+	for (size_t i = 0; i < text.size();) {
+		size_t best = 0, distance = 0;
+		for (size_t j = i > MAX_DISTANCE ? i - MAX_DISTANCE : 0; j < i; j++) {
+			size_t n = 0;
+			while (n < MAX_MATCH and i + n < text.size() and text[j + n] == text[i + n]) n++;
+			if (n >= best) {	//Ties go to the nearest match
+				best = n;
+				distance = i - j;
+			}
+		}
+		if (best < MIN_MATCH) {
+			i++;
+			continue;
+		}
+		flush(i);
+		out.push_back(128 + best - MIN_MATCH);
+		out.push_back((distance - 1) & 0xFF);
+		out.push_back((distance - 1) >> 8);
+		i += best;
+		literals = i;
+	}
+	flush(text.size());
+	return out;
+}
+
+//Unpacks size bytes from the n compressed bytes at src. Returns false if they are corrupt.
+bool decompress_sprite(const unsigned char *src, size_t n, size_t size, string &text) {
+	text.clear();
+	text.reserve(size);
+	for (size_t i = 0; i < n;) {
+		unsigned t = src[i++];
+		if (t < 128) {
+			if (i + t + 1 > n or text.size() + t + 1 > size) return false;
+			text.append(reinterpret_cast<const char *>(src + i), t + 1);
+			i += t + 1;
+		} else {
+			if (i + 2 > n) return false;
+			size_t length = t - 128 + MIN_MATCH, distance = (src[i] | src[i + 1] << 8) + 1;
+			i += 2;
+			if (distance > text.size() or text.size() + length > size) return false;
+			for (size_t k = 0; k < length; k++) text.push_back(text[text.size() - distance]);
+		}
+	}
+	return text.size() == size;
+}
+
+//Builds a pack from sprites[n - 1] for each Pokedex number n, "" for none
+vector<unsigned char> build_sprite_pack(const vector<string> &sprites) {
+	vector<unsigned char> header(SPRITE_MAGIC, SPRITE_MAGIC + sizeof(SPRITE_MAGIC)), data;
+	put_u32(header, sprites.size());
+	for (const string &text : sprites) {
+		put_u32(header, data.size());
+		put_u32(header, text.size());
+		vector<unsigned char> packed = compress_sprite(text);
+		data.insert(data.end(), packed.begin(), packed.end());
+	}
+	header.insert(header.end(), data.begin(), data.end());
+	return header;
+}
@@ -0,0 +1,233 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <fstream>
+#include <mutex>
+#include <memory>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "battle.h"
+#include "solver.h"
+#include "ai.h"
+#include "scheduler.h"
+using namespace std;
+
+//1v1 tablebase.
+//The solver's best moves, worked out ahead of time and looked up with a couple of hash probes. Every
+//position the solver reached is stored, keyed on the whole matchup (both sides' species, moves and
+//damage) and the whole position, so a hit is exactly a solved position. Anything else, a matchup
+//that wasn't solved or a position the solver never reached from the start, is a miss and goes to
+//the search AI. A pair is stored one way round, with the side whose key is lower as side 0, and
+//lookups swap the sides to match.
+//The file is a header, an open addressing table of 64 bit matchup keys, then one of 32 bit position
+//entries: the low bits of the key with the best slot + 1 in the bottom 3 bits. 0 marks an empty
+//entry in both. It is memory mapped read only, so any number of processes share one copy.
+
+const string TABLEBASE_FILE = "tablebase.bin";
+
+struct TablebaseHeader {
+	char magic[8] = {'P', 'O', 'K', 'E', 'T', 'B', '0', '4'};
+	uint64_t matchup_bits = 0;
+	uint64_t position_bits = 0;
+};
+
+//Hash of everything about a side that decides what it can do
+uint64_t side_key(const Side &side) {
+	uint64_t h = splitmix64(side.species ^ uint64_t(side.max_hp) << 16 ^ uint64_t(side.n_moves) << 32);
+	for (int i = 0; i <= MAX_MOVES; i++)
+		h = splitmix64(h ^ side.move_id[i] ^ uint64_t(side.accuracy[i]) << 16 ^ uint64_t(side.damage[i]) << 32);
+	return h;
+}
+
+//Whether m (and its positions) is stored the other way round
+bool stored_swapped(const Matchup &m) {
+	return side_key(m.side[0]) > side_key(m.side[1]);
+}
+
+Matchup swap_sides(Matchup m) {
+	swap(m.side[0], m.side[1]);
+	return m;
+}
+
+BattleState swap_sides(BattleState s) {
+	swap(s.species[0], s.species[1]);
+	swap(s.hp[0], s.hp[1]);
+	swap(s.pp[0], s.pp[1]);
+	s.to_move = 1 - s.to_move;
+	s.hash = s.full_hash();
+	return s;
+}
+
+//Key for a matchup the way round it is stored
+uint64_t matchup_key(const Matchup &m) {
+	uint64_t key = splitmix64(side_key(m.side[0]) ^ splitmix64(side_key(m.side[1]) ^ 0x7AB1E));
+	return key ? key : 1;
+}
+
+//Key for a position in the matchup with key matchup, both the way round they are stored
+uint64_t position_key(uint64_t matchup, const BattleState &s) {
+	return splitmix64(matchup ^ s.hash);
+}
+
+//Table size in bits for n keys at most 70% full
+int table_bits(size_t n) {
+	int bits = 1;
+	while ((uint64_t(1) << bits) * 7 < n * 10) bits++;
+	return bits;
+}
+
+class Tablebase {
+	const uint64_t *matchups = nullptr;
+	const uint32_t *positions = nullptr;
+	int matchup_bits = 0, position_bits = 0;
+	void *mapping = MAP_FAILED;
+	size_t mapped_size = 0;
+
+	bool has_matchup(uint64_t key) const {
+		uint64_t mask = (uint64_t(1) << matchup_bits) - 1;
+		for (uint64_t i = key >> (64 - matchup_bits);; i = (i + 1) & mask) {
+			if (matchups[i] == key) return true;
+			if (matchups[i] == 0) return false;
+		}
+	}
+  public:
+	Tablebase() {}
+	Tablebase(const Tablebase &) = delete;
+	Tablebase &operator=(const Tablebase &) = delete;
+	~Tablebase() {
+		if (mapping != MAP_FAILED) munmap(mapping, mapped_size);
+	}
+
+	//Maps a tablebase file, returns false if it is missing or not a tablebase
+	bool open(string filename) {
+		int fd = ::open(filename.c_str(), O_RDONLY);
+		if (fd == -1) return false;
+		struct stat st;
+		if (fstat(fd, &st) == 0 and size_t(st.st_size) >= sizeof(TablebaseHeader)) {
+			mapped_size = st.st_size;
+			mapping = mmap(nullptr, mapped_size, PROT_READ, MAP_SHARED, fd, 0);
+		}
+		::close(fd);
+		if (mapping == MAP_FAILED) return false;
+		TablebaseHeader header, expected;
+		memcpy(&header, mapping, sizeof(header));
+		bool valid = memcmp(header.magic, expected.magic, sizeof(header.magic)) == 0 and header.matchup_bits > 0 and header.matchup_bits < 40 and
+			header.position_bits > 0 and header.position_bits < 40 and
+			sizeof(header) + (size_t(8) << header.matchup_bits) + (size_t(4) << header.position_bits) <= mapped_size;
+		if (!valid) {
+			munmap(mapping, mapped_size);
+			mapping = MAP_FAILED;
+			return false;
+		}
+		matchup_bits = header.matchup_bits;
+		position_bits = header.position_bits;
+		const char *data = static_cast<const char *>(mapping) + sizeof(header);
+		matchups = reinterpret_cast<const uint64_t *>(data);
+		positions = reinterpret_cast<const uint32_t *>(data + (size_t(8) << matchup_bits));
+		return true;
+	}
+	bool loaded() const { return matchups != nullptr; }
+
+	//Best slot for the side to move, or -1 if the solver didn't reach this position
+	int lookup(const Matchup &m, const BattleState &s) const {
+		if (!matchups) return -1;
+		bool swapped = stored_swapped(m);
+		uint64_t matchup = matchup_key(swapped ? swap_sides(m) : m);
+		if (!has_matchup(matchup)) return -1;
+		uint64_t key = position_key(matchup, swapped ? swap_sides(s) : s), mask = (uint64_t(1) << position_bits) - 1;
+		uint32_t fingerprint = uint32_t(key) & ~7u;
+		for (uint64_t i = key >> (64 - position_bits);; i = (i + 1) & mask) {
+			uint32_t e = positions[i];
+			if (e == 0) return -1;
+			if ((e & ~7u) == fingerprint) return int(e & 7) - 1;
+		}
+	}
+};
+
+struct TablebaseStats {
+	size_t pairs = 0, solved = 0;	//Pairs of species tried, and solved within max_positions
+	size_t positions = 0;	//Entries written
+};
+
+//Solves every pair of species in dex (each with its moves as given) and writes every position the
+//solver reached to the tablebase. Pairs with more than max_positions positions are skipped, so they
+//stay with the search AI.
+TablebaseStats build_tablebase(const vector<Pokemon> &dex, string filename, size_t max_positions = size_t(1) << 14) {
+	TablebaseStats stats;
+	vector<pair<size_t, size_t>> pairs;
+	for (size_t i = 0; i < dex.size(); i++)
+		for (size_t j = i; j < dex.size(); j++) pairs.push_back({i, j});
+	vector<uint64_t> matchups;
+	vector<uint64_t> entries;	//Position keys with the best slot + 1 in the low 3 bits
+	mutex lock;
+	WorkStealer pool;
+	pool.run(pairs.size(), [&](size_t p) {
+		const Pokemon &a = dex[pairs[p].first], &b = dex[pairs[p].second];
+		Matchup m = make_matchup(a, b);
+		BattleSolver solver(m, max_positions);
+		if (!solver.solve(make_state(a, b))) return;
+		bool swapped = stored_swapped(m);
+		uint64_t matchup = matchup_key(swapped ? swap_sides(m) : m);
+		vector<uint64_t> found;
+		solver.for_each([&](const BattleState &s, int best) {
+			if (best != -1) found.push_back((position_key(matchup, swapped ? swap_sides(s) : s) & ~uint64_t(7)) | (best + 1));
+		});
+		lock_guard<mutex> guard(lock);
+		stats.solved++;
+		matchups.push_back(matchup);
+		entries.insert(entries.end(), found.begin(), found.end());
+	});
+	stats.pairs = pairs.size();
+	sort(matchups.begin(), matchups.end());
+	matchups.erase(unique(matchups.begin(), matchups.end()), matchups.end());
+	sort(entries.begin(), entries.end());
+	entries.erase(unique(entries.begin(), entries.end()), entries.end());
+	stats.positions = entries.size();
+
+	TablebaseHeader header;
+	header.matchup_bits = table_bits(matchups.size());
+	header.position_bits = table_bits(entries.size());
+	vector<uint64_t> matchup_table(size_t(1) << header.matchup_bits, 0);
+	for (uint64_t k : matchups) {
+		uint64_t i = k >> (64 - header.matchup_bits);
+		while (matchup_table[i]) i = (i + 1) & (matchup_table.size() - 1);
+		matchup_table[i] = k;
+	}
+	vector<uint32_t> position_table(size_t(1) << header.position_bits, 0);
+	for (uint64_t e : entries) {
+		uint64_t i = e >> (64 - header.position_bits);
+		while (position_table[i]) i = (i + 1) & (position_table.size() - 1);
+		position_table[i] = uint32_t(e);
+	}
+	ofstream outs(filename, ios::binary);
+	outs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+	outs.write(reinterpret_cast<const char *>(matchup_table.data()), matchup_table.size() * sizeof(uint64_t));
+	outs.write(reinterpret_cast<const char *>(position_table.data()), position_table.size() * sizeof(uint32_t));
+	return stats;
+}
+
+//Plays tablebase moves in the positions it knows, and asks another AI in the ones it doesn't
+class TablebaseAI : public OpponentAI {
+	const Tablebase &tablebase;
+	unique_ptr<OpponentAI> fallback;
+	size_t asked = 0, answered = 0;
+  public:
+	TablebaseAI(const Tablebase &tablebase, unique_ptr<OpponentAI> fallback) : tablebase(tablebase), fallback(move(fallback)) {}
+	int choose(const Matchup &matchup, const BattleState &s, Rng &rng) override {
+		asked++;
+		int slot = tablebase.lookup(matchup, s);
+		array<int, MAX_MOVES> moves;
+		int n = legal_moves(matchup, s, moves);
+		//A fingerprint can match by accident, only trust moves that are legal here
+		if (slot != -1 and find(moves.begin(), moves.begin() + n, slot) != moves.begin() + n) {
+			answered++;
+			return slot;
+		}
+		return fallback->choose(matchup, s, rng);
+	}
+	//Fraction of moves the tablebase answered without the fallback
+	double hit_rate() const { return asked ? double(answered) / asked : 0; }
+};
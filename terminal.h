@@ -0,0 +1,317 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <iostream>
+#include <streambuf>
+#include <cstring>
+#include <cerrno>
+#include <algorithm>
+#include <cstdint>
+#include <unistd.h>
+#include <exception>
+#include <csignal>
+#include <cstdlib>
+#include <sys/ioctl.h>
+#if defined(__SANITIZE_ADDRESS__)
+#define SANITIZED
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define SANITIZED
+#endif
+#endif
+#ifdef SANITIZED
+#include <sanitizer/common_interface_defs.h>
+#endif
+using namespace std;
+
+//Terminal control.
+//Clearing the screen and drawing the title banner used to run clear and figlet through a shell,
+//which forks and execs a process every time. These write the escape sequences and banner text
+//straight to the terminal instead.
+//Output goes through an output layer that keeps everything sent to cout in one buffer. It is
+//written with a single write when the game next waits for input, hands the screen to ncurses, or
+//exits, so a whole screen or prompt goes out at once however many endls it took to build. cerr
+//and clog stay unbuffered but send what cout is holding first, so messages come out in order, and
+//a crash sends it before the process goes (see send_output_on_crash).
+
+//Writes all n bytes at data to fd, returns false if it couldn't
+bool write_all(int fd, const char *data, size_t n) {
+	for (size_t done = 0; done < n;) {
+		ssize_t written = write(fd, data + done, n - done);
+		if (written < 0 and errno == EINTR) continue;
+		if (written <= 0) return false;
+		done += written;
+	}
+	return true;
+}
+
+//A streambuf for cout that holds text until send(). flush and endl don't write anything.
+class OutputLayer : public streambuf {
+	static const size_t MAX_BUFFER = 1 << 16;	//Sent early past this, so long reports don't pile up
+	int fd;
+	string buffer;
+	streambuf *old_cout = nullptr, *old_cin = nullptr, *old_cerr = nullptr, *old_clog = nullptr;
+	uint64_t newlines = 0;
+
+	//Reads through the old cin buffer, sending the output first so prompts show before the wait
+	class Input : public streambuf {
+		OutputLayer &layer;
+	  public:
+		streambuf *source = nullptr;
+		Input(OutputLayer &layer) : layer(layer) {}
+	  protected:
+		int_type underflow() override {
+			layer.send();
+			return source->sgetc();
+		}
+		int_type uflow() override {
+			layer.send();
+			int_type c = source->sbumpc();
+			if (traits_type::eq_int_type(c, traits_type::to_int_type('\n'))) layer.newlines++;	//The terminal echoes it
+			return c;
+		}
+		int_type pbackfail(int_type c) override {
+			return traits_type::eq_int_type(c, traits_type::eof()) ? source->sungetc() : source->sputbackc(traits_type::to_char_type(c));
+		}
+		streamsize showmanyc() override {
+			return source->in_avail();
+		}
+	} input;
+
+	//Writes straight through to the old cerr buffer, sending the output first so it stays in order
+	class Errors : public streambuf {
+		OutputLayer &layer;
+	  public:
+		streambuf *target = nullptr;
+		Errors(OutputLayer &layer) : layer(layer) {}
+	  protected:
+		int_type overflow(int_type c) override {
+			if (traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+			layer.send();
+			if (c == '\n') layer.newlines++;
+			return target->sputc(traits_type::to_char_type(c));
+		}
+		streamsize xsputn(const char *s, streamsize n) override {
+			layer.send();
+			layer.newlines += count(s, s + n, '\n');
+			return target->sputn(s, n);
+		}
+		int sync() override {
+			return target->pubsync();
+		}
+	} errors;
+  protected:
+	int_type overflow(int_type c) override {
+		if (traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+		buffer.push_back(traits_type::to_char_type(c));
+		if (c == '\n') newlines++;
+		if (buffer.size() >= MAX_BUFFER) send();
+		return c;
+	}
+	streamsize xsputn(const char *s, streamsize n) override {
+		buffer.append(s, n);
+		newlines += count(s, s + n, '\n');
+		if (buffer.size() >= MAX_BUFFER) send();
+		return n;
+	}
+	int sync() override {
+		return 0;
+	}
+  public:
+	OutputLayer(int fd = STDOUT_FILENO) : fd(fd), input(*this), errors(*this) {}
+	OutputLayer(const OutputLayer &) = delete;
+	OutputLayer &operator=(const OutputLayer &) = delete;
+	~OutputLayer() {
+		uninstall();
+	}
+
+	//Puts the layer under cout and cin, and in front of cerr and clog
+	void install() {
+		if (old_cout) return;
+		old_cout = cout.rdbuf(this);
+		input.source = cin.rdbuf();
+		old_cin = cin.rdbuf(&input);
+		errors.target = cerr.rdbuf();
+		old_cerr = cerr.rdbuf(&errors);
+		old_clog = clog.rdbuf(&errors);
+	}
+	//Sends what is left and gives cout and cin their own buffers back
+	void uninstall() {
+		if (!old_cout) return;
+		send();
+		cout.rdbuf(old_cout);
+		cin.rdbuf(old_cin);
+		cerr.rdbuf(old_cerr);
+		clog.rdbuf(old_clog);
+		old_cout = old_cin = old_cerr = old_clog = nullptr;
+	}
+
+	//Writes out everything held so far in one write
+	void send() {
+		if (buffer.empty()) return;
+		write_all(fd, buffer.data(), buffer.size());
+		buffer.clear();
+	}
+	//How many lines have gone past on the terminal, counting what cout and cerr wrote and the input echoed
+	uint64_t lines() const {
+		return newlines;
+	}
+};
+
+OutputLayer screen_output;	//Installed by main
+
+terminate_handler next_terminate = nullptr;
+
+void send_then_terminate() {
+	screen_output.send();
+	if (next_terminate) next_terminate();
+	abort();
+}
+
+extern "C" void send_then_abort(int sig) {
+	//send isn't async signal safe, but the process is going down anyway and this is the last chance
+	//to show the screen that led up to it
+	screen_output.send();
+	signal(sig, SIG_DFL);
+	raise(sig);
+}
+
+#ifdef SANITIZED
+//AddressSanitizer calls this before it prints a report, so the report comes after the screen
+extern "C" void __asan_on_error() {
+	screen_output.send();
+}
+#endif
+
+//Makes sure what cout is holding reaches the terminal if the game goes down before it would have:
+//an uncaught exception, an abort (a failed assert) or a sanitizer stopping the program
+void send_output_on_crash() {
+	next_terminate = set_terminate(send_then_terminate);
+	signal(SIGABRT, send_then_abort);
+#ifdef SANITIZED
+	__sanitizer_set_death_callback([] { screen_output.send(); });
+#endif
+}
+
+//Sends whatever cout is holding, before something else (like ncurses) writes to the terminal
+void flush_output() {
+	screen_output.send();
+	cout.flush();
+}
+
+//Writes text to the terminal after everything before it. With the output layer installed it joins
+//the rest of the screen in one write.
+void term_write(const string &text) {
+	cout.write(text.data(), text.size());
+	cout.flush();
+}
+
+const string CLEAR_SCREEN = "\033[H\033[2J\033[3J";	//Cursor home, clear the screen and the scrollback
+uint64_t screen_clears = 0;	//How many times clear_screen has run
+
+//Clears the screen like clear(1). Nothing if stdout isn't a terminal.
+void clear_screen() {
+	screen_clears++;
+	if (isatty(STDOUT_FILENO)) term_write(CLEAR_SCREEN);
+}
+
+//Rows and columns of the terminal on stdout, or false if it isn't one
+bool terminal_size(int &rows, int &cols) {
+	winsize ws;
+	if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) != 0 or ws.ws_row == 0) return false;
+	rows = ws.ws_row;
+	cols = ws.ws_col;
+	return true;
+}
+
+//Banners are drawn in figlet's standard font, with its smushing rules. Only the characters the game
+//uses are here; others are left out. $ is a hard blank: a space that nothing smushes into.
+const int BANNER_HEIGHT = 6;
+struct BannerGlyph {
+	char c;
+	const char *rows[BANNER_HEIGHT];
+};
+const BannerGlyph BANNER_FONT[] = {
+	{' ', {" $", " $", " $", " $", " $", " $"}},
+	{'#', {"   _  _   ", " _| || |_ ", "|_  ..  _|", "|_      _|", "  |_||_|  ", "          "}},
+	{'+', {"       ", "   _   ", " _| |_ ", "|_   _|", "  |_|  ", "       "}},
+	{'E', {" _____ ", "| ____|", "|  _|  ", "| |___ ", "|_____|", "       "}},
+	{'K', {" _  __", "| |/ /", "| ' / ", "| . \\ ", "|_|\\_\\", "      "}},
+	{'M', {" __  __ ", "|  \\/  |", "| |\\/| |", "| |  | |", "|_|  |_|", "        "}},
+	{'N', {" _   _ ", "| \\ | |", "|  \\| |", "| |\\  |", "|_| \\_|", "       "}},
+	{'O', {"  ___  ", " / _ \\ ", "| | | |", "| |_| |", " \\___/ ", "       "}},
+	{'P', {" ____  ", "|  _ \\ ", "| |_) |", "|  __/ ", "|_|    ", "       "}},
+	{'a', {"       ", "  __ _ ", " / _` |", "| (_| |", " \\__,_|", "       "}},
+	{'d', {"     _ ", "  __| |", " / _` |", "| (_| |", " \\__,_|", "       "}},
+	{'n', {"       ", " _ __  ", "| '_ \\ ", "| | | |", "|_| |_|", "       "}},
+};
+
+//What two characters smush into, or 0 if they can't: equal characters, an underscore under a
+//bracket or line, the stronger of two brackets, or a pair of opposite brackets
+char banner_smush(char left, char right) {
+	if (left == ' ') return right;
+	if (right == ' ') return left;
+	if (left == '$' or right == '$') return 0;
+	if (left == right) return left;
+	auto in = [](char c, const char *set) { return c and strchr(set, c); };
+	if (left == '_' and in(right, "|/\\[]{}()<>")) return right;
+	if (right == '_' and in(left, "|/\\[]{}()<>")) return left;
+	const char *classes[] = {"|", "/\\", "[]", "{}", "()", "<>"};
+	int l = -1, r = -1;
+	for (int i = 0; i < 6; i++) {
+		if (in(left, classes[i])) l = i;
+		if (in(right, classes[i])) r = i;
+	}
+	if (l != -1 and r != -1 and l != r) return l > r ? left : right;
+	string pair = {left, right};
+	if (pair == "[]" or pair == "][" or pair == "{}" or pair == "}{" or pair == "()" or pair == ")(") return '|';
+	return 0;
+}
+
+//Text drawn in big letters, like figlet
+string banner(const string &text) {
+	vector<string> lines(BANNER_HEIGHT);
+	int last_width = 0;
+	for (char c : text) {
+		const BannerGlyph *glyph = nullptr;
+		for (const BannerGlyph &g : BANNER_FONT)
+			if (g.c == c) glyph = &g;
+		if (!glyph) continue;
+		int width = strlen(glyph->rows[0]);
+		//Slide the glyph left until it would overlap something it can't smush with
+		int overlap = width;
+		for (int row = 0; row < BANNER_HEIGHT; row++) {
+			const string &line = lines[row];
+			const char *glyph_row = glyph->rows[row];
+			int end = line.size();	//Last non blank column of the line so far
+			while (end > 0 and (end == int(line.size()) or line[end] == ' ')) end--;
+			char left = end < int(line.size()) ? line[end] : 0;
+			int start = 0;	//First non blank column of the glyph
+			while (glyph_row[start] == ' ') start++;
+			int amount = start + line.size() - 1 - end;
+			if (!left or left == ' ') amount++;
+			else if (glyph_row[start] and last_width > 1 and width > 1 and banner_smush(left, glyph_row[start])) amount++;
+			overlap = min(overlap, amount);
+		}
+		for (int row = 0; row < BANNER_HEIGHT; row++) {
+			string &line = lines[row];
+			const char *glyph_row = glyph->rows[row];
+			for (int k = 0; k < overlap; k++) {
+				int column = line.size() - overlap + k;
+				if (column < 0) continue;
+				char left = line[column], right = glyph_row[k];
+				line[column] = last_width > 1 and width > 1 ? banner_smush(left, right) : (left == ' ' ? right : left);
+			}
+			line += glyph_row + overlap;
+		}
+		last_width = width;
+	}
+	string out;
+	for (string &line : lines) {
+		for (char &c : line)
+			if (c == '$') c = ' ';
+		while (!line.empty() and line.back() == ' ') line.pop_back();
+		out += line + "\n";
+	}
+	return out;
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <cmath>
+#include <fstream>
+#include "battle.h"
+#include "scheduler.h"
+using namespace std;
+
+//Round robin tournament: every species battles every other species reps times
+struct Tournament {
+	size_t n = 0;
+	vector<float> score;	//score[i * n + j] = fraction of battles i won against j, draws count half
+	vector<double> rating;	//Elo scale rating from the Bradley-Terry fit
+
+	float at(size_t i, size_t j) const { return score.at(i * n + j); }
+};
+
+//Fits Bradley-Terry strengths to the score matrix with the MM algorithm and converts them to Elo
+vector<double> bradley_terry(const vector<float> &score, size_t n) {
+	vector<double> wins(n, 0.5), strength(n, 1.0), next(n); //Half a win each so winless species still get a rating
+	for (size_t i = 0; i < n; i++)
+		for (size_t j = 0; j < n; j++)
+			if (i != j) wins[i] += score[i * n + j];
+	for (int iter = 0; iter < 200; iter++) {
+		double change = 0;
+		for (size_t i = 0; i < n; i++) {
+			double denom = 0;
+			for (size_t j = 0; j < n; j++)
+				if (i != j) denom += 1.0 / (strength[i] + strength[j]);
+			next[i] = denom > 0 ? wins[i] / denom : strength[i];
+		}
+		double log_mean = 0;
+		for (double s : next) log_mean += log(s);
+		log_mean /= n;
+		for (size_t i = 0; i < n; i++) {
+			double s = next[i] / exp(log_mean);
+			change = max(change, fabs(s - strength[i]) / strength[i]);
+			strength[i] = s;
+		}
+		if (change < 1e-6) break;
+	}
+	vector<double> elo(n);
+	for (size_t i = 0; i < n; i++) elo[i] = 1500 + 400 * log10(strength[i]);
+	return elo;
+}
+
+//Number of the pairings before row i of the upper triangle: (0,1) is 0, (0,n-1) is n-2, (1,2) is n-1...
+size_t pairs_before(size_t i, size_t n) {
+	return i * (2 * n - i - 1) / 2;
+}
+//The pairing i < j numbered k, the inverse of pairs_before(i, n) + (j - i - 1)
+void pair_of(size_t k, size_t n, size_t &i, size_t &j) {
+	double b = 2.0 * n - 1;
+	i = size_t(max(0.0, (b - sqrt(max(0.0, b * b - 8.0 * k))) / 2));
+	//The square root can be off by one either way for large n
+	while (i > 0 and pairs_before(i, n) > k) i--;
+	while (pairs_before(i + 1, n) <= k) i++;
+	j = k - pairs_before(i, n) + i + 1;
+}
+
+Tournament run_tournament(const vector<Pokemon> &dex, Policy policy, int reps, uint64_t seed) {
+	Tournament t;
+	t.n = dex.size();
+	t.score.assign(t.n * t.n, 0.5);
+	vector<Pokemon> fighters = dex;
+	for (Pokemon &p : fighters) p.moves = default_moveset(p);
+	//Each task is one pairing, i < j, and fills in both halves of the matrix
+	WorkStealer pool;
+	pool.run(t.n < 2 ? 0 : pairs_before(t.n - 1, t.n), [&](size_t pairing) {
+		size_t i, j;
+		pair_of(pairing, t.n, i, j);
+		size_t task = i * t.n + j;	//Battles are numbered by matrix cell, so a seed gives the same results as before
+		Matchup m = make_matchup(fighters[i], fighters[j]);
+		BattleState start = make_state(fighters[i], fighters[j]);
+		float points = 0;
+		for (int r = 0; r < reps; r++) {
+			uint64_t battle = task * reps + r;
+			Rng setup(seed, battle);
+			BattleState s = start;
+			s.set_to_move(first_mover(m, setup));
+			BattleResult result = simulate_battle(m, s, policy, policy, seed, battle);
+			if (result.winner == 0) points += 1;
+			else if (result.winner == -1) points += 0.5;
+		}
+		t.score[i * t.n + j] = points / reps;
+		t.score[j * t.n + i] = 1 - points / reps;
+	});
+	t.rating = bradley_terry(t.score, t.n);
+	return t;
+}
+
+//Writes the win matrix as a CSV, row species vs column species
+void save_win_matrix(const Tournament &t, const vector<Pokemon> &dex, string filename) {
+	ofstream outs(filename);
+	for (const Pokemon &p : dex) outs << "," << p.name;
+	outs << "\n";
+	for (size_t i = 0; i < t.n; i++) {
+		outs << dex[i].name;
+		for (size_t j = 0; j < t.n; j++) outs << "," << t.at(i, j);
+		outs << "\n";
+	}
+}